@@ -0,0 +1,102 @@
+#include "bench.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #define _POSIX_C_SOURCE 199309L
+    #include <time.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// private source
+// ----------------------------------------------------------------
+
+static volatile unsigned char sink;
+
+typedef struct _bench_entry
+{
+    const char* group;
+    const char* name;
+    const char* variant;
+    double ns_per_op;
+}
+bench_entry;
+
+static bench_entry* entries;
+static size_t entry_count;
+static size_t entry_capacity;
+
+// bench header
+// ----------------------------------------------------------------
+
+double bench_now()
+{
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + (now.tv_nsec / 1000000000.0);
+#endif
+}
+
+void bench_consume(const void* data, size_t size)
+{
+    const unsigned char* bytes = data;
+    unsigned char acc = 0;
+
+    for (size_t i = 0; i < size; i++)
+        acc ^= bytes[i];
+
+    sink ^= acc;
+}
+
+void bench_record(const char* group, const char* name, const char* variant, double ns_per_op)
+{
+    if (entry_count == entry_capacity)
+    {
+        size_t capacity = entry_capacity > 0 ? entry_capacity * 2 : 256;
+        bench_entry* grown = realloc(entries, capacity * sizeof(bench_entry));
+
+        if (grown == NULL)
+            return;
+
+        entries = grown;
+        entry_capacity = capacity;
+    }
+
+    entries[entry_count++] = (bench_entry){ group, name, variant, ns_per_op };
+}
+
+int bench_write_json(const char* path)
+{
+    FILE* file = fopen(path, "w");
+
+    if (file == NULL)
+        return 0;
+
+    fprintf(file, "[\n");
+
+    for (size_t i = 0; i < entry_count; i++)
+    {
+        const bench_entry* e = &entries[i];
+        double ops_per_sec = e->ns_per_op > 0.0 ? 1e9 / e->ns_per_op : 0.0;
+
+        fprintf(file, "  { \"group\": \"%s\", \"name\": \"%s\", \"variant\": \"%s\", \"ns_per_op\": %.4f, \"ops_per_sec\": %.0f }%s\n",
+            e->group, e->name, e->variant, e->ns_per_op, ops_per_sec, i + 1 < entry_count ? "," : "");
+    }
+
+    fprintf(file, "]\n");
+    fclose(file);
+
+    return 1;
+}
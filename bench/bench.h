@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stddef.h>
+
+// timing
+// ----------------------------------------------------------------
+
+// returns a monotonic timestamp in seconds
+double bench_now();
+
+// stops the compiler from discarding the results of a benchmarked loop
+void bench_consume(const void* data, size_t size);
+
+// results
+// ----------------------------------------------------------------
+
+// records a measurement for the json report, the strings must outlive the
+// benchmark, variant names the configuration such as the simd level
+void bench_record(const char* group, const char* name, const char* variant, double ns_per_op);
+
+// writes every recorded measurement to a json file, returns 0 on failure
+int bench_write_json(const char* path);
@@ -0,0 +1,194 @@
+#include <lux.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// regression checks run before the timings, each prints what failed and
+// counts towards a non zero exit
+
+// private source
+// ----------------------------------------------------------------
+
+// one more than a whole number of grains per worker at the most workers, the
+// split which used to produce a range past the last
+#define PARALLEL_WORKERS 64
+#define CULL_COUNT (PARALLEL_WORKERS * 4096 + 5)
+#define GRID_COUNT (PARALLEL_WORKERS * 16384 + 5)
+
+static float random_float(float min, float max)
+{
+    return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static int check_parallel_cull()
+{
+    lx_sphere* spheres = malloc(CULL_COUNT * sizeof(lx_sphere));
+    uint32_t* single = malloc(CULL_COUNT * sizeof(uint32_t));
+    uint32_t* split = malloc(CULL_COUNT * sizeof(uint32_t));
+    int failed = 0;
+
+    if (spheres == NULL || single == NULL || split == NULL)
+    {
+        printf("failed to allocate the parallel cull check\n");
+        failed = 1;
+    }
+    else
+    {
+        for (size_t i = 0; i < CULL_COUNT; i++)
+            spheres[i] = (lx_sphere){ { random_float(-50.0f, 50.0f), random_float(-50.0f, 50.0f), random_float(-100.0f, 0.0f) }, random_float(0.1f, 2.0f) };
+
+        lx_frustum f = lx_frustum_from_mat4(lx_mat4_perspective(60.0f, 16.0f / 9.0f, 0.1f, 80.0f));
+
+        lx_set_worker_count(1);
+        size_t expected = lx_frustum_cull_spheres_indices(&f, spheres, CULL_COUNT, single);
+        lx_set_worker_count(PARALLEL_WORKERS);
+        size_t visible = lx_frustum_cull_spheres_indices(&f, spheres, CULL_COUNT, split);
+
+        if (visible != expected || memcmp(single, split, visible * sizeof(uint32_t)) != 0)
+        {
+            printf("check failed: culling %d spheres on %d workers found %zu visible, one worker %zu\n", CULL_COUNT, PARALLEL_WORKERS, visible, expected);
+            failed = 1;
+        }
+    }
+
+    free(spheres);
+    free(single);
+    free(split);
+    return failed;
+}
+
+static int check_parallel_grid()
+{
+    lx_vec3* points = malloc(GRID_COUNT * sizeof(lx_vec3));
+    lx_hash_grid* grid = lx_hash_grid_create(1.0f);
+    uint32_t ids[256];
+    int failed = 0;
+
+    if (points == NULL || grid == NULL)
+    {
+        printf("failed to allocate the parallel grid check\n");
+        failed = 1;
+    }
+    else
+    {
+        for (size_t i = 0; i < GRID_COUNT; i++)
+            points[i] = (lx_vec3){ random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f), random_float(-100.0f, 100.0f) };
+
+        lx_vec3 center = points[GRID_COUNT - 1];
+
+        lx_set_worker_count(1);
+        lx_hash_grid_build(grid, points, GRID_COUNT);
+        size_t expected = lx_hash_grid_query_radius(grid, center, 2.0f, ids, 256);
+
+        lx_set_worker_count(PARALLEL_WORKERS);
+        lx_hash_grid_build(grid, points, GRID_COUNT);
+        size_t found = lx_hash_grid_query_radius(grid, center, 2.0f, ids, 256);
+
+        if (found != expected || found == 0)
+        {
+            printf("check failed: a grid of %d points built on %d workers found %zu neighbours, one worker %zu\n", GRID_COUNT, PARALLEL_WORKERS, found, expected);
+            failed = 1;
+        }
+    }
+
+    lx_hash_grid_destroy(grid);
+    free(points);
+    return failed;
+}
+
+// a cluster with one point far off, which used to search every ring of
+// cells out to the outlier
+#define NEAREST_COUNT 1000
+#define NEAREST_OUTLIER 8000.0f
+
+static int compare_floats(const void* a, const void* b)
+{
+    float x = *(const float*)a;
+    float y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+// the distances found against those of every point, sorted
+static int check_nearest_query(const lx_hash_grid* grid, const lx_vec3* points, size_t count, lx_vec3 center, size_t k)
+{
+    static uint32_t ids[NEAREST_COUNT + 1];
+    static float found[NEAREST_COUNT + 1];
+    static float expected[NEAREST_COUNT + 1];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        lx_vec3 d = lx_vec3_sub(points[i], center);
+        expected[i] = sqrtf(lx_vec3_dot(d, d));
+    }
+
+    qsort(expected, count, sizeof(float), compare_floats);
+
+    size_t n = lx_hash_grid_query_nearest(grid, center, k, ids, found);
+    size_t want = k < count ? k : count;
+    int failed = n != want;
+
+    for (size_t i = 0; i < n && !failed; i++)
+        failed = fabsf(found[i] - expected[i]) > 1e-4f * (1.0f + expected[i]);
+
+    if (failed)
+        printf("check failed: the %zu nearest of %zu points to (%g, %g, %g) found %zu, or at the wrong distances\n", k, count, center.x, center.y, center.z, n);
+
+    return failed;
+}
+
+static int check_grid_nearest()
+{
+    static lx_vec3 points[NEAREST_COUNT + 1];
+    lx_hash_grid* grid = lx_hash_grid_create(1.0f);
+    int failed = 0;
+
+    if (grid == NULL)
+    {
+        printf("failed to allocate the grid nearest check\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < NEAREST_COUNT; i++)
+        points[i] = (lx_vec3){ random_float(0.0f, 10.0f), random_float(0.0f, 10.0f), random_float(0.0f, 10.0f) };
+
+    points[NEAREST_COUNT] = (lx_vec3){ NEAREST_OUTLIER, NEAREST_OUTLIER, NEAREST_OUTLIER };
+    lx_hash_grid_build(grid, points, NEAREST_COUNT + 1);
+
+    lx_vec3 centers[] = { { 5.0f, 5.0f, 5.0f }, { -3.0f, 12.0f, 4.0f }, { NEAREST_OUTLIER, NEAREST_OUTLIER, NEAREST_OUTLIER - 1.0f } };
+    size_t ks[] = { 1, 2, 16, NEAREST_COUNT + 1, NEAREST_COUNT + 10 };
+
+    for (size_t c = 0; c < sizeof(centers) / sizeof(centers[0]); c++)
+    {
+        for (size_t i = 0; i < sizeof(ks) / sizeof(ks[0]); i++)
+            failed += check_nearest_query(grid, points, NEAREST_COUNT + 1, centers[c], ks[i]);
+    }
+
+    // flat grids only search the rings across x and y
+    lx_vec2 flat[NEAREST_COUNT];
+    for (size_t i = 0; i < NEAREST_COUNT; i++)
+    {
+        flat[i] = (lx_vec2){ points[i].x, points[i].y };
+        points[i].z = 0.0f;
+    }
+
+    lx_hash_grid_build_vec2(grid, flat, NEAREST_COUNT);
+    failed += check_nearest_query(grid, points, NEAREST_COUNT, (lx_vec3){ 5.0f, 5.0f, 0.0f }, 16);
+    failed += check_nearest_query(grid, points, NEAREST_COUNT, (lx_vec3){ 40.0f, -20.0f, 0.0f }, 4);
+
+    lx_hash_grid_destroy(grid);
+    return failed > 0;
+}
+
+// bench header
+// ----------------------------------------------------------------
+
+int bench_checks()
+{
+    int workers = lx_get_worker_count();
+    int failed = check_parallel_cull() + check_parallel_grid() + check_grid_nearest();
+    lx_set_worker_count(workers);
+
+    printf("checks, %d failed\n", failed);
+    return failed;
+}
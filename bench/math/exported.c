@@ -0,0 +1,4 @@
+#include <lux.h>
+
+#define TRANSFORM_FN transforms_exported
+#include "transforms.h"
@@ -0,0 +1,333 @@
+#define LX_MATH_INLINE
+#include <lux.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+// compares the approximate math functions with libm for throughput, and
+// with the same functions in double precision for the largest error over the
+// range each one documents, failing when it passes the documented bound or
+// is no faster than libm
+
+typedef void (*fast_fn)(const float* a, const float* b, size_t count, float* out);
+
+static void sin_libm(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        out[i] = sinf(a[i]);
+}
+
+static void sin_fast(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        out[i] = lx_float_sin_fast(a[i]);
+}
+
+static void sincos_libm(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i * 2] = sinf(a[i]);
+        out[i * 2 + 1] = cosf(a[i]);
+    }
+}
+
+static void sincos_fast(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        lx_float_sincos_fast(a[i], &out[i * 2], &out[i * 2 + 1]);
+}
+
+static void atan2_libm(const float* a, const float* b, size_t count, float* out)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = atan2f(a[i], b[i]);
+}
+
+static void atan2_fast(const float* a, const float* b, size_t count, float* out)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = lx_float_atan2_fast(a[i], b[i]);
+}
+
+// the vectors are read as consecutive triples of the inputs
+static void normalize_libm(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i + 3 <= count; i += 3)
+    {
+        lx_vec3 v = lx_vec3_normalize((lx_vec3){ a[i], a[i + 1], a[i + 2] });
+        out[i] = v.x;
+        out[i + 1] = v.y;
+        out[i + 2] = v.z;
+    }
+}
+
+static void normalize_fast(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i + 3 <= count; i += 3)
+    {
+        lx_vec3 v = lx_vec3_normalize_fast((lx_vec3){ a[i], a[i + 1], a[i + 2] });
+        out[i] = v.x;
+        out[i + 1] = v.y;
+        out[i + 2] = v.z;
+    }
+}
+
+static void rsqrt_libm(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        out[i] = 1.0f / sqrtf(a[i]);
+}
+
+static void rsqrt_fast(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        out[i] = lx_float_rsqrt_fast(a[i]);
+}
+
+// the references the errors are measured against
+
+static void sin_exact(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        out[i] = (float)sin((double)a[i]);
+}
+
+static void sincos_exact(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i * 2] = (float)sin((double)a[i]);
+        out[i * 2 + 1] = (float)cos((double)a[i]);
+    }
+}
+
+static void atan2_exact(const float* a, const float* b, size_t count, float* out)
+{
+    for (size_t i = 0; i < count; i++)
+        out[i] = (float)atan2((double)a[i], (double)b[i]);
+}
+
+static void normalize_exact(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i + 3 <= count; i += 3)
+    {
+        double x = a[i], y = a[i + 1], z = a[i + 2];
+        double mag = sqrt(x * x + y * y + z * z);
+
+        out[i] = (float)(x / mag);
+        out[i + 1] = (float)(y / mag);
+        out[i + 2] = (float)(z / mag);
+    }
+}
+
+static void rsqrt_exact(const float* a, const float* b, size_t count, float* out)
+{
+    (void)b;
+    for (size_t i = 0; i < count; i++)
+        out[i] = (float)(1.0 / sqrt((double)a[i]));
+}
+
+// the documented ranges, walked evenly or across every exponent, so the
+// extremes are covered as well as the values usually passed
+
+static float spread(size_t i, size_t count)
+{
+    return (float)i / (float)(count - 1);
+}
+
+// a float of any normal exponent from the low to the high one
+static float across_exponents(size_t i, size_t count, int low, int high)
+{
+    float t = spread((i * 7919) % count, count);
+    return ldexpf(1.0f + spread(i, count), low + (int)(t * (float)(high - low)));
+}
+
+static void fill_angles(float* a, float* b, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        a[i] = -1e4f + 2e4f * spread(i, count);
+        b[i] = 0.0f;
+    }
+}
+
+// like the vectors below, a shared scale keeps the angles spread evenly
+static void fill_directions(float* a, float* b, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        float scale = across_exponents(i, count, -126, 126);
+        a[i] = scale * (-1.0f + 2.0f * spread((i * 104729) % count, count));
+        b[i] = scale * (-1.0f + 2.0f * spread((i * 7919 + count / 2) % count, count));
+    }
+}
+
+static void fill_positive(float* a, float* b, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        a[i] = across_exponents(i, count, -126, 127);
+        b[i] = 0.0f;
+    }
+}
+
+// each vector shares one scale, from near where the squared length falls
+// below the normal range to near where it overflows, with components of
+// either sign and any size below it
+static void fill_vectors(float* a, float* b, size_t count)
+{
+    for (size_t i = 0; i + 3 <= count; i += 3)
+    {
+        float scale = across_exponents(i / 3, count / 3, -50, 60);
+        for (size_t j = i; j < i + 3; j++)
+            a[j] = scale * (-1.0f + 2.0f * spread((j * 104729) % count, count));
+    }
+
+    for (size_t i = 0; i < count; i++)
+        b[i] = 0.0f;
+}
+
+typedef struct _fast_case
+{
+    const char* name;
+    fast_fn libm;
+    fast_fn fast;
+    fast_fn exact;
+    void (*fill)(float* a, float* b, size_t count);
+    size_t outputs;
+
+    // the documented bound, relative to each result or absolute
+    float bound;
+    int relative;
+}
+fast_case;
+
+static const fast_case cases[] = {
+    { "sin", sin_libm, sin_fast, sin_exact, fill_angles, 1, 2e-7f, 0 },
+    { "sincos", sincos_libm, sincos_fast, sincos_exact, fill_angles, 2, 2e-7f, 0 },
+    { "atan2", atan2_libm, atan2_fast, atan2_exact, fill_directions, 1, 3e-6f, 0 },
+    { "rsqrt", rsqrt_libm, rsqrt_fast, rsqrt_exact, fill_positive, 1, 5e-6f, 1 },
+    { "normalize", normalize_libm, normalize_fast, normalize_exact, fill_vectors, 1, 5e-6f, 1 },
+};
+
+static double time_round(fast_fn fn, const float* a, const float* b, size_t count, float* out)
+{
+    double start = bench_now();
+    fn(a, b, count, out);
+    double elapsed = bench_now() - start;
+
+    bench_consume(out, count * sizeof(float));
+    return elapsed;
+}
+
+// the rounds alternate between the two, so a busy stretch of the machine
+// slows both rather than whichever ran through it
+static void time_pair(const fast_case* test, const float* a, const float* b, size_t count, float* expected, float* actual, int rounds, double* libm_ns, double* fast_ns)
+{
+    test->libm(a, b, count, expected);
+    test->fast(a, b, count, actual);
+
+    double libm_best = 0.0;
+    double fast_best = 0.0;
+    for (int r = 0; r < rounds; r++)
+    {
+        double libm = time_round(test->libm, a, b, count, expected);
+        double fast = time_round(test->fast, a, b, count, actual);
+
+        libm_best = r == 0 || libm < libm_best ? libm : libm_best;
+        fast_best = r == 0 || fast < fast_best ? fast : fast_best;
+    }
+
+    *libm_ns = libm_best * 1e9 / (double)count;
+    *fast_ns = fast_best * 1e9 / (double)count;
+}
+
+static int compare(const fast_case* test, const float* a, const float* b, size_t count, int rounds)
+{
+    size_t outputs = count * test->outputs;
+    float* expected = malloc(outputs * sizeof(float));
+    float* actual = malloc(outputs * sizeof(float));
+
+    if (!expected || !actual)
+    {
+        printf("failed to allocate fast math results\n");
+        free(expected);
+        free(actual);
+        return 1;
+    }
+
+    double libm_ns, fast_ns;
+    time_pair(test, a, b, count, expected, actual, rounds, &libm_ns, &fast_ns);
+
+    test->exact(a, b, count, expected);
+
+    // the vector loops leave the last few outputs when count is not a
+    // multiple of their size, the same ones in both
+    size_t checked = test->fast == normalize_fast ? count / 3 * 3 : outputs;
+
+    float max_error = 0.0f;
+    for (size_t i = 0; i < checked; i++)
+    {
+        float error = fabsf(actual[i] - expected[i]);
+        if (test->relative)
+            error = expected[i] != 0.0f ? error / fabsf(expected[i]) : error;
+
+        // comparisons with nan are false, so it is counted as an error here
+        if (!(error <= max_error))
+            max_error = isnan(error) ? INFINITY : error;
+    }
+
+    // an approximation no faster than libm has no reason to exist
+    int inaccurate = !(max_error <= test->bound);
+    int slower = !(fast_ns < libm_ns);
+    printf("  %-10s libm %6.2f ns  fast %6.2f ns  %5.2fx  max error %.2e%s%s\n", test->name, libm_ns, fast_ns, libm_ns / fast_ns, max_error,
+        inaccurate ? ", past its bound" : "", slower ? ", slower than libm" : "");
+
+    bench_record("fast_math", test->name, "libm", libm_ns);
+    bench_record("fast_math", test->name, "fast", fast_ns);
+
+    free(expected);
+    free(actual);
+    return inaccurate || slower;
+}
+
+int bench_fast_math(size_t count, int rounds)
+{
+    float* a = malloc(count * sizeof(float));
+    float* b = malloc(count * sizeof(float));
+
+    if (!a || !b)
+    {
+        printf("failed to allocate fast math inputs\n");
+        free(a);
+        free(b);
+        return 1;
+    }
+
+    printf("fast math, %zu values, best of %d rounds\n", count, rounds);
+
+    int failed = 0;
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        cases[i].fill(a, b, count);
+        failed += compare(&cases[i], a, b, count, rounds);
+    }
+
+    free(a);
+    free(b);
+    return failed;
+}
@@ -0,0 +1,5 @@
+#define LX_MATH_INLINE
+#include <lux.h>
+
+#define TRANSFORM_FN transforms_inlined
+#include "transforms.h"
@@ -0,0 +1,114 @@
+#include <lux.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+void transforms_exported(lx_mat4 view_proj, const lx_vec3* positions, const float* angles, size_t count, lx_vec4* out);
+void transforms_inlined(lx_mat4 view_proj, const lx_vec3* positions, const float* angles, size_t count, lx_vec4* out);
+int bench_fast_math(size_t count, int rounds);
+void bench_surface(lx_simd_level best);
+int bench_checks();
+
+typedef void (*transform_fn)(lx_mat4 view_proj, const lx_vec3* positions, const float* angles, size_t count, lx_vec4* out);
+
+static const size_t COUNT = 100000;
+static const int ROUNDS = 20;
+
+static double run(transform_fn fn, lx_mat4 view_proj, const lx_vec3* positions, const float* angles, lx_vec4* out)
+{
+    fn(view_proj, positions, angles, COUNT, out);
+
+    double best = 0.0;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        double start = bench_now();
+        fn(view_proj, positions, angles, COUNT, out);
+        double elapsed = bench_now() - start;
+
+        bench_consume(out, COUNT * sizeof(lx_vec4));
+
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+    }
+
+    return best * 1e9 / (double)COUNT;
+}
+
+// the benchmark never calls lx_init, so it selects the kernels itself
+static lx_simd_level select_best_simd_level()
+{
+    static const lx_simd_level preferred[] = { LX_SIMD_AVX2, LX_SIMD_SSE41, LX_SIMD_SSE2, LX_SIMD_NEON };
+
+    for (size_t i = 0; i < sizeof(preferred) / sizeof(preferred[0]); i++)
+    {
+        if (lx_is_simd_level_supported(preferred[i]) && lx_set_simd_level(preferred[i]))
+            return preferred[i];
+    }
+
+    return LX_SIMD_SCALAR;
+}
+
+// usage: bench_math [--json <path>]
+int main(int argc, char** argv)
+{
+    const char* json_path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            json_path = argv[++i];
+    }
+
+    lx_simd_level level = select_best_simd_level();
+
+    if (bench_checks() != 0)
+        return 1;
+
+    lx_vec3* positions = malloc(COUNT * sizeof(lx_vec3));
+    float* angles = malloc(COUNT * sizeof(float));
+    lx_vec4* out = malloc(COUNT * sizeof(lx_vec4));
+
+    if (!positions || !angles || !out)
+    {
+        printf("failed to allocate benchmark data\n");
+        return 1;
+    }
+
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        positions[i] = (lx_vec3){ (float)(i % 100), (float)(i % 37), -(float)(i % 53) };
+        angles[i] = (float)(i % 360);
+    }
+
+    lx_mat4 view = lx_mat4_look_at((lx_vec3){ 0.0f, 10.0f, 20.0f }, lx_vec3_zero(), (lx_vec3){ 0.0f, 1.0f, 0.0f });
+    lx_mat4 view_proj = lx_mat4_mul(lx_mat4_perspective(45.0f, 16.0f / 9.0f, 0.1f, 100.0f), view);
+
+    double exported = run(transforms_exported, view_proj, positions, angles, out);
+    double inlined = run(transforms_inlined, view_proj, positions, angles, out);
+
+    printf("transform loop, %zu objects, best of %d rounds, simd level %d\n", COUNT, ROUNDS, (int)level);
+    printf("  exported    %8.2f ns/object\n", exported);
+    printf("  inline      %8.2f ns/object\n", inlined);
+    printf("  speedup     %8.2fx\n", exported / inlined);
+
+    bench_record("transform_loop", "transform", "exported", exported);
+    bench_record("transform_loop", "transform", "inline", inlined);
+
+    int failed = bench_fast_math(COUNT, ROUNDS);
+    bench_surface(level);
+
+    free(positions);
+    free(angles);
+    free(out);
+
+    if (json_path != NULL && !bench_write_json(json_path))
+    {
+        printf("failed to write json results to %s\n", json_path);
+        return 1;
+    }
+
+    // the timings are still written when the fast math leaves its bounds
+    return failed != 0;
+}
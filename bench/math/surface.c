@@ -0,0 +1,556 @@
+#include <lux.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+
+// times every function of the math api through the exported symbols. single
+// call cases loop over arrays of inputs, batch and stream cases make one call
+// over the whole array, both report the time per element. cases which go
+// through the simd kernels run once per supported level.
+
+#define COUNT 4096
+#define ROUNDS 15
+
+// the palette size of a typical character
+#define SKIN_BONES 64
+
+// a clip of that many tracks, sampled for COUNT / SKIN_BONES instances
+#define ANIM_KEYS 30
+
+typedef void (*case_fn)(size_t count);
+
+typedef struct _bench_case
+{
+    const char* group;
+    const char* name;
+    int dispatched;
+    case_fn fn;
+}
+bench_case;
+
+// inputs are filled once, outputs share one buffer large enough for a mat4
+// per element
+static float* fa;
+static float* fb;
+static lx_vec2* v2a;
+static lx_vec2* v2b;
+static lx_vec3* v3a;
+static lx_vec3* v3b;
+static lx_vec4* v4a;
+static lx_vec4* v4b;
+static lx_mat2* m2a;
+static lx_mat2* m2b;
+static lx_mat3* m3a;
+static lx_mat3* m3b;
+static lx_mat4* m4a;
+static lx_mat4* m4b;
+static lx_quat* qa;
+static lx_quat* qb;
+static lx_sphere* spheres;
+static lx_aabb* boxes;
+static lx_frustum frustum;
+static lx_ray* rays;
+static lx_bvh* bvh;
+static lx_aabb_tree* tree;
+static lx_sweep_prune* sweep;
+static lx_hash_grid* grid;
+static lx_vec3* box_mins;
+static lx_vec3* box_maxs;
+static lx_skin_vertex* skin;
+static lx_anim_clip* clip;
+static lx_anim_cursors* cursors;
+static float* anim_times;
+static lx_vec3 pack_scale, pack_offset;
+static lx_rng rng;
+static lx_vec2_stream s2a, s2b, s2o;
+static lx_vec3_stream s3a, s3b, s3o;
+static void* out;
+
+#define OUT(type) ((type*)out)
+
+// single calls
+// ----------------------------------------------------------------
+
+#define SINGLE_CASES(X) \
+    X(utility, float_clamp, 0, OUT(float)[i] = lx_float_clamp(fa[i], -0.5f, 0.5f)) \
+    X(utility, float_lerp, 0, OUT(float)[i] = lx_float_lerp(fa[i], fb[i], 0.25f)) \
+    X(utility, float_equal, 0, OUT(int)[i] = lx_float_equal(fa[i], fb[i], 1e-3f)) \
+    X(utility, deg_to_rad, 0, OUT(float)[i] = lx_deg_to_rad(fa[i])) \
+    X(utility, rad_to_deg, 0, OUT(float)[i] = lx_rad_to_deg(fa[i])) \
+    X(utility, float_rsqrt_fast, 0, OUT(float)[i] = lx_float_rsqrt_fast(fb[i] + 2.0f)) \
+    X(utility, float_sincos_fast, 0, lx_float_sincos_fast(fa[i], &OUT(float)[i * 2], &OUT(float)[i * 2 + 1])) \
+    X(utility, float_sin_fast, 0, OUT(float)[i] = lx_float_sin_fast(fa[i])) \
+    X(utility, float_cos_fast, 0, OUT(float)[i] = lx_float_cos_fast(fa[i])) \
+    X(utility, float_atan2_fast, 0, OUT(float)[i] = lx_float_atan2_fast(fa[i], fb[i])) \
+    \
+    X(vec2, zero, 0, OUT(lx_vec2)[i] = lx_vec2_zero()) \
+    X(vec2, from_vec3, 0, OUT(lx_vec2)[i] = lx_vec2_from_vec3(v3a[i])) \
+    X(vec2, from_vec4, 0, OUT(lx_vec2)[i] = lx_vec2_from_vec4(v4a[i])) \
+    X(vec2, add, 0, OUT(lx_vec2)[i] = lx_vec2_add(v2a[i], v2b[i])) \
+    X(vec2, sub, 0, OUT(lx_vec2)[i] = lx_vec2_sub(v2a[i], v2b[i])) \
+    X(vec2, mul, 0, OUT(lx_vec2)[i] = lx_vec2_mul(v2a[i], v2b[i])) \
+    X(vec2, scale_by_scalar, 0, OUT(lx_vec2)[i] = lx_vec2_scale_by_scalar(v2a[i], fa[i])) \
+    X(vec2, normalize, 0, OUT(lx_vec2)[i] = lx_vec2_normalize(v2a[i])) \
+    X(vec2, normalize_fast, 0, OUT(lx_vec2)[i] = lx_vec2_normalize_fast(v2a[i])) \
+    X(vec2, lerp, 0, OUT(lx_vec2)[i] = lx_vec2_lerp(v2a[i], v2b[i], 0.25f)) \
+    X(vec2, clamp, 0, OUT(lx_vec2)[i] = lx_vec2_clamp(v2a[i], v2b[i], (lx_vec2){ 1.0f, 1.0f })) \
+    X(vec2, dot, 0, OUT(float)[i] = lx_vec2_dot(v2a[i], v2b[i])) \
+    X(vec2, magnitude, 0, OUT(float)[i] = lx_vec2_magnitude(v2a[i])) \
+    X(vec2, magnitude_squared, 0, OUT(float)[i] = lx_vec2_magnitude_squared(v2a[i])) \
+    X(vec2, equal, 0, OUT(int)[i] = lx_vec2_equal(v2a[i], v2b[i], 1e-3f)) \
+    \
+    X(vec3, zero, 0, OUT(lx_vec3)[i] = lx_vec3_zero()) \
+    X(vec3, from_vec2, 0, OUT(lx_vec3)[i] = lx_vec3_from_vec2(v2a[i])) \
+    X(vec3, from_vec4, 0, OUT(lx_vec3)[i] = lx_vec3_from_vec4(v4a[i])) \
+    X(vec3, add, 0, OUT(lx_vec3)[i] = lx_vec3_add(v3a[i], v3b[i])) \
+    X(vec3, sub, 0, OUT(lx_vec3)[i] = lx_vec3_sub(v3a[i], v3b[i])) \
+    X(vec3, mul, 0, OUT(lx_vec3)[i] = lx_vec3_mul(v3a[i], v3b[i])) \
+    X(vec3, scale_by_scalar, 0, OUT(lx_vec3)[i] = lx_vec3_scale_by_scalar(v3a[i], fa[i])) \
+    X(vec3, normalize, 0, OUT(lx_vec3)[i] = lx_vec3_normalize(v3a[i])) \
+    X(vec3, normalize_fast, 0, OUT(lx_vec3)[i] = lx_vec3_normalize_fast(v3a[i])) \
+    X(vec3, lerp, 0, OUT(lx_vec3)[i] = lx_vec3_lerp(v3a[i], v3b[i], 0.25f)) \
+    X(vec3, clamp, 0, OUT(lx_vec3)[i] = lx_vec3_clamp(v3a[i], v3b[i], (lx_vec3){ 1.0f, 1.0f, 1.0f })) \
+    X(vec3, reflect, 0, OUT(lx_vec3)[i] = lx_vec3_reflect(v3a[i], v3b[i])) \
+    X(vec3, dot, 0, OUT(float)[i] = lx_vec3_dot(v3a[i], v3b[i])) \
+    X(vec3, magnitude, 0, OUT(float)[i] = lx_vec3_magnitude(v3a[i])) \
+    X(vec3, magnitude_squared, 0, OUT(float)[i] = lx_vec3_magnitude_squared(v3a[i])) \
+    X(vec3, distance, 0, OUT(float)[i] = lx_vec3_distance(v3a[i], v3b[i])) \
+    X(vec3, equal, 0, OUT(int)[i] = lx_vec3_equal(v3a[i], v3b[i], 1e-3f)) \
+    X(vec3, cross, 0, OUT(lx_vec3)[i] = lx_vec3_cross(v3a[i], v3b[i])) \
+    \
+    X(vec4, zero, 0, OUT(lx_vec4)[i] = lx_vec4_zero()) \
+    X(vec4, from_vec2, 0, OUT(lx_vec4)[i] = lx_vec4_from_vec2(v2a[i])) \
+    X(vec4, from_vec3, 0, OUT(lx_vec4)[i] = lx_vec4_from_vec3(v3a[i])) \
+    X(vec4, add, 0, OUT(lx_vec4)[i] = lx_vec4_add(v4a[i], v4b[i])) \
+    X(vec4, sub, 0, OUT(lx_vec4)[i] = lx_vec4_sub(v4a[i], v4b[i])) \
+    X(vec4, mul, 0, OUT(lx_vec4)[i] = lx_vec4_mul(v4a[i], v4b[i])) \
+    X(vec4, scale_by_scalar, 0, OUT(lx_vec4)[i] = lx_vec4_scale_by_scalar(v4a[i], fa[i])) \
+    X(vec4, normalize, 0, OUT(lx_vec4)[i] = lx_vec4_normalize(v4a[i])) \
+    X(vec4, normalize_fast, 0, OUT(lx_vec4)[i] = lx_vec4_normalize_fast(v4a[i])) \
+    X(vec4, lerp, 0, OUT(lx_vec4)[i] = lx_vec4_lerp(v4a[i], v4b[i], 0.25f)) \
+    X(vec4, clamp, 0, OUT(lx_vec4)[i] = lx_vec4_clamp(v4a[i], v4b[i], (lx_vec4){ 1.0f, 1.0f, 1.0f, 1.0f })) \
+    X(vec4, dot, 0, OUT(float)[i] = lx_vec4_dot(v4a[i], v4b[i])) \
+    X(vec4, magnitude, 0, OUT(float)[i] = lx_vec4_magnitude(v4a[i])) \
+    X(vec4, magnitude_squared, 0, OUT(float)[i] = lx_vec4_magnitude_squared(v4a[i])) \
+    X(vec4, equal, 0, OUT(int)[i] = lx_vec4_equal(v4a[i], v4b[i], 1e-3f)) \
+    \
+    X(mat2, zero, 0, OUT(lx_mat2)[i] = lx_mat2_zero()) \
+    X(mat2, identity, 0, OUT(lx_mat2)[i] = lx_mat2_identity()) \
+    X(mat2, from_mat3, 0, OUT(lx_mat2)[i] = lx_mat2_from_mat3(m3a[i])) \
+    X(mat2, from_mat4, 0, OUT(lx_mat2)[i] = lx_mat2_from_mat4(m4a[i])) \
+    X(mat2, add, 0, OUT(lx_mat2)[i] = lx_mat2_add(m2a[i], m2b[i])) \
+    X(mat2, sub, 0, OUT(lx_mat2)[i] = lx_mat2_sub(m2a[i], m2b[i])) \
+    X(mat2, mul, 0, OUT(lx_mat2)[i] = lx_mat2_mul(m2a[i], m2b[i])) \
+    X(mat2, scale_by_scalar, 0, OUT(lx_mat2)[i] = lx_mat2_scale_by_scalar(m2a[i], fa[i])) \
+    X(mat2, transpose, 0, OUT(lx_mat2)[i] = lx_mat2_transpose(m2a[i])) \
+    X(mat2, inverse, 0, OUT(lx_mat2)[i] = lx_mat2_inverse(m2a[i])) \
+    X(mat2, mul_vec2, 0, OUT(lx_vec2)[i] = lx_mat2_mul_vec2(m2a[i], v2a[i])) \
+    X(mat2, equal, 0, OUT(int)[i] = lx_mat2_equal(m2a[i], m2b[i], 1e-3f)) \
+    \
+    X(mat3, zero, 0, OUT(lx_mat3)[i] = lx_mat3_zero()) \
+    X(mat3, identity, 0, OUT(lx_mat3)[i] = lx_mat3_identity()) \
+    X(mat3, from_mat2, 0, OUT(lx_mat3)[i] = lx_mat3_from_mat2(m2a[i])) \
+    X(mat3, from_mat4, 0, OUT(lx_mat3)[i] = lx_mat3_from_mat4(m4a[i])) \
+    X(mat3, add, 0, OUT(lx_mat3)[i] = lx_mat3_add(m3a[i], m3b[i])) \
+    X(mat3, sub, 0, OUT(lx_mat3)[i] = lx_mat3_sub(m3a[i], m3b[i])) \
+    X(mat3, mul, 0, OUT(lx_mat3)[i] = lx_mat3_mul(m3a[i], m3b[i])) \
+    X(mat3, scale_by_scalar, 0, OUT(lx_mat3)[i] = lx_mat3_scale_by_scalar(m3a[i], fa[i])) \
+    X(mat3, transpose, 0, OUT(lx_mat3)[i] = lx_mat3_transpose(m3a[i])) \
+    X(mat3, inverse, 0, OUT(lx_mat3)[i] = lx_mat3_inverse(m3a[i])) \
+    X(mat3, mul_vec3, 0, OUT(lx_vec3)[i] = lx_mat3_mul_vec3(m3a[i], v3a[i])) \
+    X(mat3, equal, 0, OUT(int)[i] = lx_mat3_equal(m3a[i], m3b[i], 1e-3f)) \
+    \
+    X(mat4, zero, 0, OUT(lx_mat4)[i] = lx_mat4_zero()) \
+    X(mat4, identity, 0, OUT(lx_mat4)[i] = lx_mat4_identity()) \
+    X(mat4, from_mat2, 0, OUT(lx_mat4)[i] = lx_mat4_from_mat2(m2a[i])) \
+    X(mat4, from_mat3, 0, OUT(lx_mat4)[i] = lx_mat4_from_mat3(m3a[i])) \
+    X(mat4, add, 0, OUT(lx_mat4)[i] = lx_mat4_add(m4a[i], m4b[i])) \
+    X(mat4, sub, 0, OUT(lx_mat4)[i] = lx_mat4_sub(m4a[i], m4b[i])) \
+    X(mat4, mul, 1, OUT(lx_mat4)[i] = lx_mat4_mul(m4a[i], m4b[i])) \
+    X(mat4, scale_by_scalar, 0, OUT(lx_mat4)[i] = lx_mat4_scale_by_scalar(m4a[i], fa[i])) \
+    X(mat4, transpose, 0, OUT(lx_mat4)[i] = lx_mat4_transpose(m4a[i])) \
+    X(mat4, inverse, 1, OUT(lx_mat4)[i] = lx_mat4_inverse(m4a[i])) \
+    X(mat4, inverse_affine, 1, OUT(lx_mat4)[i] = lx_mat4_inverse_affine(m4a[i])) \
+    X(mat4, inverse_rigid, 1, OUT(lx_mat4)[i] = lx_mat4_inverse_rigid(m4a[i])) \
+    X(mat4, classify, 0, OUT(int)[i] = (int)lx_mat4_classify(m4a[i], 1e-4f)) \
+    X(mat4, inverse_as, 1, OUT(lx_mat4)[i] = lx_mat4_inverse_as(m4a[i], LX_MAT4_AFFINE)) \
+    X(mat4, translate, 0, OUT(lx_mat4)[i] = lx_mat4_translate(m4a[i], v3a[i])) \
+    X(mat4, scale, 0, OUT(lx_mat4)[i] = lx_mat4_scale(m4a[i], v3a[i])) \
+    X(mat4, rotate, 1, OUT(lx_mat4)[i] = lx_mat4_rotate(m4a[i], v3a[i], fa[i])) \
+    X(mat4, look_at, 0, OUT(lx_mat4)[i] = lx_mat4_look_at(v3a[i], v3b[i], (lx_vec3){ 0.0f, 1.0f, 0.0f })) \
+    X(mat4, perspective, 0, OUT(lx_mat4)[i] = lx_mat4_perspective(45.0f + fa[i], 1.5f, 0.1f, 100.0f)) \
+    X(mat4, perspective_reversed, 0, OUT(lx_mat4)[i] = lx_mat4_perspective_reversed(45.0f + fa[i], 1.5f, 0.1f)) \
+    X(mat4, orthographic, 0, OUT(lx_mat4)[i] = lx_mat4_orthographic(-1.0f, 1.0f + fb[i], -1.0f, 1.0f, 0.1f, 100.0f)) \
+    X(mat4, mul_vec4, 1, OUT(lx_vec4)[i] = lx_mat4_mul_vec4(m4a[i], v4a[i])) \
+    X(mat4, equal, 0, OUT(int)[i] = lx_mat4_equal(m4a[i], m4b[i], 1e-3f)) \
+    X(mat4, normal_matrix, 0, OUT(lx_mat3)[i] = lx_mat4_normal_matrix(m4a[i])) \
+    X(mat4, from_trs, 0, OUT(lx_mat4)[i] = lx_mat4_from_trs(v3a[i], qa[i], v3b[i])) \
+    \
+    X(mat4_to, mul_to, 1, lx_mat4_mul_to(&OUT(lx_mat4)[i], &m4a[i], &m4b[i])) \
+    X(mat4_to, mul_vec4_to, 1, lx_mat4_mul_vec4_to(&OUT(lx_vec4)[i], &m4a[i], &v4a[i])) \
+    X(mat4_to, inverse_to, 1, lx_mat4_inverse_to(&OUT(lx_mat4)[i], &m4a[i])) \
+    X(mat4_to, transpose_to, 0, lx_mat4_transpose_to(&OUT(lx_mat4)[i], &m4a[i])) \
+    X(mat4_to, translate_to, 0, lx_mat4_translate_to(&OUT(lx_mat4)[i], &m4a[i], v3a[i])) \
+    X(mat4_to, scale_to, 0, lx_mat4_scale_to(&OUT(lx_mat4)[i], &m4a[i], v3a[i])) \
+    X(mat4_to, rotate_to, 1, lx_mat4_rotate_to(&OUT(lx_mat4)[i], &m4a[i], v3a[i], fa[i])) \
+    X(mat4_to, from_trs_to, 0, lx_mat4_from_trs_to(&OUT(lx_mat4)[i], v3a[i], qa[i], v3b[i])) \
+    \
+    X(quat, identity, 0, OUT(lx_quat)[i] = lx_quat_identity()) \
+    X(quat, from_axis_angle, 0, OUT(lx_quat)[i] = lx_quat_from_axis_angle(v3a[i], fa[i])) \
+    X(quat, mul, 0, OUT(lx_quat)[i] = lx_quat_mul(qa[i], qb[i])) \
+    X(quat, conjugate, 0, OUT(lx_quat)[i] = lx_quat_conjugate(qa[i])) \
+    X(quat, normalize, 0, OUT(lx_quat)[i] = lx_quat_normalize(qa[i])) \
+    X(quat, dot, 0, OUT(float)[i] = lx_quat_dot(qa[i], qb[i])) \
+    X(quat, nlerp, 0, OUT(lx_quat)[i] = lx_quat_nlerp(qa[i], qb[i], 0.25f)) \
+    X(quat, slerp, 0, OUT(lx_quat)[i] = lx_quat_slerp(qa[i], qb[i], 0.25f)) \
+    X(quat, rotate_vec3, 0, OUT(lx_vec3)[i] = lx_quat_rotate_vec3(qa[i], v3a[i])) \
+    X(quat, to_mat3, 0, OUT(lx_mat3)[i] = lx_quat_to_mat3(qa[i])) \
+    X(quat, to_mat4, 0, OUT(lx_mat4)[i] = lx_quat_to_mat4(qa[i])) \
+    X(quat, equal, 0, OUT(int)[i] = lx_quat_equal(qa[i], qb[i], 1e-3f)) \
+    \
+    X(random, rng_next_float, 0, OUT(float)[i] = lx_rng_next_float(&rng)) \
+    \
+    X(spatial, frustum_test_sphere, 0, OUT(int)[i] = lx_frustum_test_sphere(&frustum, spheres[i])) \
+    X(spatial, frustum_test_aabb, 0, OUT(int)[i] = lx_frustum_test_aabb(&frustum, boxes[i])) \
+    X(spatial, ray_test_aabb, 0, OUT(int)[i] = lx_ray_test_aabb(rays[i], boxes[i], NULL)) \
+    X(spatial, bvh_raycast, 0, lx_bvh_raycast(bvh, rays[i], 1000.0f, &OUT(lx_ray_hit)[i])) \
+    X(spatial, hash_grid_query_radius, 0, lx_hash_grid_query_radius(grid, box_mins[i], 8.0f, OUT(uint32_t), COUNT)) \
+    X(spatial, hash_grid_query_nearest, 0, lx_hash_grid_query_nearest(grid, box_mins[i], 8, OUT(uint32_t), OUT(float) + COUNT))
+
+// batches and streams
+// ----------------------------------------------------------------
+
+#define BATCH_CASES(X) \
+    X(batch, mat4_mul_vec4_array, 1, lx_mat4_mul_vec4_array(&m4a[0], v4a, OUT(lx_vec4), count)) \
+    X(batch, mat4_mul_vec3_array, 1, lx_mat4_mul_vec3_array(&m4a[0], v3a, OUT(lx_vec3), count, 1.0f)) \
+    X(batch, mat4_mul_array, 1, lx_mat4_mul_array(&m4a[0], m4b, OUT(lx_mat4), count)) \
+    X(batch, mat4_normal_matrix_array, 1, lx_mat4_normal_matrix_array(m4a, OUT(lx_mat3), count)) \
+    X(batch, mat4_from_trs_array, 1, lx_mat4_from_trs_array(v3a, qa, v3b, OUT(lx_mat4), count)) \
+    \
+    X(pack, half, 1, lx_pack_half(&v4a[0].x, OUT(uint16_t), count * 4)) \
+    X(pack, positions, 1, lx_pack_positions(v3a, OUT(int16_t), count, &pack_scale, &pack_offset)) \
+    X(pack, normals, 1, lx_pack_normals(v3a, OUT(int16_t), count)) \
+    X(pack, tangents, 1, lx_pack_tangents(v4a, OUT(uint32_t), count)) \
+    X(pack, colors, 1, lx_pack_colors(v4a, OUT(uint8_t), count)) \
+    \
+    X(random, rng_fill_floats, 1, lx_rng_fill_floats(&rng, OUT(float), count)) \
+    X(random, rng_fill_unit_vec3, 1, lx_rng_fill_unit_vec3(&rng, OUT(lx_vec3), count)) \
+    X(random, rng_fill_in_sphere, 1, lx_rng_fill_in_sphere(&rng, OUT(lx_vec3), count)) \
+    X(noise, simplex2, 1, lx_noise_simplex2(v2a, OUT(float), count)) \
+    X(noise, simplex3, 1, lx_noise_simplex3(v3a, OUT(float), count)) \
+    \
+    X(stream, vec2_add, 1, lx_vec2_stream_add(&s2a, &s2b, &s2o)) \
+    X(stream, vec2_sub, 1, lx_vec2_stream_sub(&s2a, &s2b, &s2o)) \
+    X(stream, vec2_scale, 1, lx_vec2_stream_scale(&s2a, 0.5f, &s2o)) \
+    X(stream, vec2_dot, 1, lx_vec2_stream_dot(&s2a, &s2b, OUT(float))) \
+    X(stream, vec2_normalize, 1, lx_vec2_stream_normalize(&s2a, &s2o)) \
+    X(stream, vec2_lerp, 1, lx_vec2_stream_lerp(&s2a, &s2b, 0.25f, &s2o)) \
+    X(stream, vec2_clamp, 1, lx_vec2_stream_clamp(&s2a, (lx_vec2){ -0.5f, -0.5f }, (lx_vec2){ 0.5f, 0.5f }, &s2o)) \
+    X(stream, vec2_distance, 1, lx_vec2_stream_distance(&s2a, &s2b, OUT(float))) \
+    X(stream, vec2_min, 1, OUT(lx_vec2)[0] = lx_vec2_stream_min(&s2a)) \
+    X(stream, vec2_max, 1, OUT(lx_vec2)[0] = lx_vec2_stream_max(&s2a)) \
+    X(stream, vec3_add, 1, lx_vec3_stream_add(&s3a, &s3b, &s3o)) \
+    X(stream, vec3_sub, 1, lx_vec3_stream_sub(&s3a, &s3b, &s3o)) \
+    X(stream, vec3_scale, 1, lx_vec3_stream_scale(&s3a, 0.5f, &s3o)) \
+    X(stream, vec3_dot, 1, lx_vec3_stream_dot(&s3a, &s3b, OUT(float))) \
+    X(stream, vec3_cross, 1, lx_vec3_stream_cross(&s3a, &s3b, &s3o)) \
+    X(stream, vec3_normalize, 1, lx_vec3_stream_normalize(&s3a, &s3o)) \
+    X(stream, vec3_lerp, 1, lx_vec3_stream_lerp(&s3a, &s3b, 0.25f, &s3o)) \
+    X(stream, vec3_clamp, 1, lx_vec3_stream_clamp(&s3a, (lx_vec3){ -0.5f, -0.5f, -0.5f }, (lx_vec3){ 0.5f, 0.5f, 0.5f }, &s3o)) \
+    X(stream, vec3_distance, 1, lx_vec3_stream_distance(&s3a, &s3b, OUT(float))) \
+    X(stream, vec3_min, 1, OUT(lx_vec3)[0] = lx_vec3_stream_min(&s3a)) \
+    X(stream, vec3_max, 1, OUT(lx_vec3)[0] = lx_vec3_stream_max(&s3a)) \
+    \
+    X(spatial, frustum_cull_spheres, 1, lx_frustum_cull_spheres(&frustum, spheres, count, OUT(uint32_t))) \
+    X(spatial, frustum_cull_aabbs, 1, lx_frustum_cull_aabbs(&frustum, boxes, count, OUT(uint32_t))) \
+    X(spatial, bvh_raycast_packet, 1, lx_bvh_raycast_packet(bvh, rays, count, 1000.0f, OUT(lx_ray_hit))) \
+    X(spatial, aabb_tree_query_frustum, 0, lx_aabb_tree_query_frustum(tree, &frustum, OUT(uint32_t), count)) \
+    X(spatial, aabb_tree_query_pairs, 0, lx_aabb_tree_query_pairs(tree, OUT(lx_pair), count)) \
+    X(spatial, sweep_prune_update, 1, lx_sweep_prune_update(sweep, box_mins, box_maxs, count, OUT(lx_pair), count)) \
+    X(spatial, hash_grid_build, 0, lx_hash_grid_build(grid, box_mins, count)) \
+    \
+    X(scene, skin_vertices, 1, lx_skin_vertices(m4a, SKIN_BONES, skin, count, OUT(lx_vec3), OUT(lx_vec3) + COUNT)) \
+    X(scene, anim_sample, 1, lx_anim_sample(clip, cursors, anim_times, OUT(lx_vec3), (lx_quat*)(OUT(float) + COUNT * 3), (lx_vec3*)(OUT(float) + COUNT * 7)))
+
+#define DEFINE_SINGLE(group, name, dispatched, call) \
+    static void group##_##name(size_t count) \
+    { \
+        for (size_t i = 0; i < count; i++) \
+            call; \
+    }
+
+#define DEFINE_BATCH(group, name, dispatched, call) \
+    static void group##_##name(size_t count) \
+    { \
+        call; \
+    }
+
+#define LIST_CASE(group, name, dispatched, call) { #group, #name, dispatched, group##_##name },
+
+SINGLE_CASES(DEFINE_SINGLE)
+BATCH_CASES(DEFINE_BATCH)
+
+static const bench_case cases[] = {
+    SINGLE_CASES(LIST_CASE)
+    BATCH_CASES(LIST_CASE)
+};
+
+// private source
+// ----------------------------------------------------------------
+
+static float random_float(float min, float max)
+{
+    return min + (max - min) * ((float)rand() / (float)RAND_MAX);
+}
+
+static lx_vec3 random_vec3(float min, float max)
+{
+    return (lx_vec3){ random_float(min, max), random_float(min, max), random_float(min, max) };
+}
+
+static int allocate_inputs()
+{
+    fa = malloc(COUNT * sizeof(float));
+    fb = malloc(COUNT * sizeof(float));
+    v2a = malloc(COUNT * sizeof(lx_vec2));
+    v2b = malloc(COUNT * sizeof(lx_vec2));
+    v3a = malloc(COUNT * sizeof(lx_vec3));
+    v3b = malloc(COUNT * sizeof(lx_vec3));
+    v4a = malloc(COUNT * sizeof(lx_vec4));
+    v4b = malloc(COUNT * sizeof(lx_vec4));
+    m2a = malloc(COUNT * sizeof(lx_mat2));
+    m2b = malloc(COUNT * sizeof(lx_mat2));
+    m3a = malloc(COUNT * sizeof(lx_mat3));
+    m3b = malloc(COUNT * sizeof(lx_mat3));
+    m4a = malloc(COUNT * sizeof(lx_mat4));
+    m4b = malloc(COUNT * sizeof(lx_mat4));
+    qa = malloc(COUNT * sizeof(lx_quat));
+    qb = malloc(COUNT * sizeof(lx_quat));
+    spheres = malloc(COUNT * sizeof(lx_sphere));
+    boxes = malloc(COUNT * sizeof(lx_aabb));
+    rays = malloc(COUNT * sizeof(lx_ray));
+    box_mins = malloc(COUNT * sizeof(lx_vec3));
+    box_maxs = malloc(COUNT * sizeof(lx_vec3));
+    skin = malloc(COUNT * sizeof(lx_skin_vertex));
+    anim_times = malloc(COUNT / SKIN_BONES * sizeof(float));
+    out = malloc(COUNT * sizeof(lx_mat4));
+
+    s2a = lx_vec2_stream_create(COUNT);
+    s2b = lx_vec2_stream_create(COUNT);
+    s2o = lx_vec2_stream_create(COUNT);
+    s3a = lx_vec3_stream_create(COUNT);
+    s3b = lx_vec3_stream_create(COUNT);
+    s3o = lx_vec3_stream_create(COUNT);
+
+    return fa && fb && v2a && v2b && v3a && v3b && v4a && v4b && m2a && m2b && m3a && m3b && m4a && m4b &&
+        qa && qb && spheres && boxes && rays && box_mins && box_maxs && skin && anim_times && out && s2a.x && s2b.x && s2o.x && s3a.x && s3b.x && s3o.x;
+}
+
+static void free_inputs()
+{
+    free(fa);
+    free(fb);
+    free(v2a);
+    free(v2b);
+    free(v3a);
+    free(v3b);
+    free(v4a);
+    free(v4b);
+    free(m2a);
+    free(m2b);
+    free(m3a);
+    free(m3b);
+    free(m4a);
+    free(m4b);
+    free(qa);
+    free(qb);
+    free(spheres);
+    free(boxes);
+    free(rays);
+    free(box_mins);
+    free(box_maxs);
+    free(skin);
+    free(anim_times);
+    free(out);
+    lx_bvh_destroy(bvh);
+    lx_aabb_tree_destroy(tree);
+    lx_sweep_prune_destroy(sweep);
+    lx_hash_grid_destroy(grid);
+    lx_anim_cursors_destroy(cursors);
+    lx_anim_clip_destroy(clip);
+
+    lx_vec2_stream_destroy(&s2a);
+    lx_vec2_stream_destroy(&s2b);
+    lx_vec2_stream_destroy(&s2o);
+    lx_vec3_stream_destroy(&s3a);
+    lx_vec3_stream_destroy(&s3b);
+    lx_vec3_stream_destroy(&s3o);
+}
+
+static void fill_inputs()
+{
+    srand(1);
+    lx_rng_seed(&rng, 1, 0);
+
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        fa[i] = random_float(-4.0f, 4.0f);
+        fb[i] = random_float(-4.0f, 4.0f);
+        v2a[i] = (lx_vec2){ random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f) };
+        v2b[i] = (lx_vec2){ random_float(-1.0f, 1.0f), random_float(-1.0f, 1.0f) };
+        v3a[i] = random_vec3(-1.0f, 1.0f);
+        v3b[i] = random_vec3(-1.0f, 1.0f);
+        v4a[i] = (lx_vec4){ v3a[i].x, v3a[i].y, v3a[i].z, 1.0f };
+        v4b[i] = (lx_vec4){ v3b[i].x, v3b[i].y, v3b[i].z, 1.0f };
+        qa[i] = lx_quat_from_axis_angle(random_vec3(-1.0f, 1.0f), random_float(-180.0f, 180.0f));
+        qb[i] = lx_quat_from_axis_angle(random_vec3(-1.0f, 1.0f), random_float(-180.0f, 180.0f));
+
+        // model matrices, so the inverses take the paths real transforms do
+        m4a[i] = lx_mat4_from_trs(random_vec3(-10.0f, 10.0f), qa[i], random_vec3(0.5f, 2.0f));
+        m4b[i] = lx_mat4_from_trs(random_vec3(-10.0f, 10.0f), qb[i], random_vec3(0.5f, 2.0f));
+        m3a[i] = lx_mat3_from_mat4(m4a[i]);
+        m3b[i] = lx_mat3_from_mat4(m4b[i]);
+        m2a[i] = lx_mat2_from_mat4(m4a[i]);
+        m2b[i] = lx_mat2_from_mat4(m4b[i]);
+
+        lx_vec3 center = random_vec3(-50.0f, 50.0f);
+        lx_vec3 extent = random_vec3(0.5f, 2.0f);
+        spheres[i] = (lx_sphere){ center, extent.x };
+        boxes[i] = (lx_aabb){ lx_vec3_sub(center, extent), lx_vec3_add(center, extent) };
+        box_mins[i] = boxes[i].min;
+        box_maxs[i] = boxes[i].max;
+
+        // one to four influences, weights summing to 1
+        skin[i] = (lx_skin_vertex){ v3a[i], lx_vec3_normalize(v3b[i]), { 0 }, { 0.0f } };
+        int influences = 1 + (int)(i % 4);
+        for (int s = 0; s < influences; s++)
+        {
+            skin[i].bones[s] = (uint16_t)(rand() % SKIN_BONES);
+            skin[i].weights[s] = 1.0f / (float)influences;
+        }
+
+        s2a.x[i] = v2a[i].x;
+        s2a.y[i] = v2a[i].y;
+        s2b.x[i] = v2b[i].x;
+        s2b.y[i] = v2b[i].y;
+        s3a.x[i] = v3a[i].x;
+        s3a.y[i] = v3a[i].y;
+        s3a.z[i] = v3a[i].z;
+        s3b.x[i] = v3b[i].x;
+        s3b.y[i] = v3b[i].y;
+        s3b.z[i] = v3b[i].z;
+    }
+
+    lx_mat4 view = lx_mat4_look_at((lx_vec3){ 0.0f, 0.0f, 60.0f }, lx_vec3_zero(), (lx_vec3){ 0.0f, 1.0f, 0.0f });
+    lx_mat4 projection = lx_mat4_perspective(60.0f, 16.0f / 9.0f, 0.1f, 200.0f);
+    frustum = lx_frustum_from_mat4(lx_mat4_mul(projection, view));
+
+    // picking rays through a 64 pixel wide screen, row by row so neighbouring
+    // rays share packets as they would for a block of pixels
+    for (size_t i = 0; i < COUNT; i++)
+        rays[i] = lx_ray_from_screen((float)(i % 64) + 0.5f, (float)(i / 64) + 0.5f, 64.0f, 64.0f, view, projection);
+
+    bvh = lx_bvh_create_aabbs(boxes, COUNT);
+
+    tree = lx_aabb_tree_create(0.1f);
+    for (size_t i = 0; tree != NULL && i < COUNT; i++)
+        lx_aabb_tree_insert(tree, boxes[i], (uint32_t)i);
+
+    // the boxes stay still between calls, as for a scene at rest
+    sweep = lx_sweep_prune_create();
+
+    grid = lx_hash_grid_create(8.0f);
+    if (grid != NULL)
+        lx_hash_grid_build(grid, box_mins, COUNT);
+
+    // keys at 30 per second, taken from the random inputs
+    float key_times[ANIM_KEYS];
+    for (int k = 0; k < ANIM_KEYS; k++)
+        key_times[k] = (float)k / 30.0f;
+
+    lx_anim_track tracks[SKIN_BONES];
+    for (int t = 0; t < SKIN_BONES; t++)
+    {
+        const lx_vec3* v = &v3a[t * ANIM_KEYS];
+        const lx_quat* q = &qa[t * ANIM_KEYS];
+        tracks[t] = (lx_anim_track){ key_times, v, ANIM_KEYS, key_times, q, ANIM_KEYS, key_times, v, ANIM_KEYS };
+    }
+
+    clip = lx_anim_clip_create(tracks, SKIN_BONES);
+    cursors = clip != NULL ? lx_anim_cursors_create(clip, COUNT / SKIN_BONES) : NULL;
+
+    for (size_t i = 0; i < COUNT / SKIN_BONES; i++)
+        anim_times[i] = random_float(0.0f, (float)(ANIM_KEYS - 1) / 30.0f);
+}
+
+static double time_case(const bench_case* c)
+{
+    c->fn(COUNT);
+
+    double best = 0.0;
+    for (int r = 0; r < ROUNDS; r++)
+    {
+        double start = bench_now();
+        c->fn(COUNT);
+        double elapsed = bench_now() - start;
+
+        bench_consume(out, COUNT * sizeof(float));
+
+        if (r == 0 || elapsed < best)
+            best = elapsed;
+    }
+
+    return best * 1e9 / (double)COUNT;
+}
+
+static void run_cases(const char* level_name, int dispatched_only)
+{
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        const bench_case* c = &cases[i];
+
+        if (dispatched_only && !c->dispatched)
+            continue;
+
+        double ns = time_case(c);
+        bench_record(c->group, c->name, level_name, ns);
+
+        printf("  %-8s %-26s %-7s %9.2f ns/op %10.1f Mop/s\n", c->group, c->name, level_name, ns, 1e3 / ns);
+    }
+}
+
+// bench header
+// ----------------------------------------------------------------
+
+void bench_surface(lx_simd_level best)
+{
+    static const char* level_names[] = { "scalar", "sse2", "sse41", "avx2", "neon" };
+
+    if (!allocate_inputs())
+    {
+        printf("failed to allocate math surface inputs\n");
+        free_inputs();
+        return;
+    }
+
+    fill_inputs();
+
+    printf("math surface, %d elements, best of %d rounds\n", COUNT, ROUNDS);
+
+    // every case runs at the best level, the kernel backed ones are then
+    // repeated at each lower level for comparison
+    lx_set_simd_level(best);
+    run_cases(level_names[best], 0);
+
+    for (int level = LX_SIMD_SCALAR; level <= LX_SIMD_NEON; level++)
+    {
+        if (level == (int)best || !lx_is_simd_level_supported((lx_simd_level)level) || !lx_set_simd_level((lx_simd_level)level))
+            continue;
+
+        run_cases(level_names[level], 1);
+    }
+
+    lx_set_simd_level(best);
+    free_inputs();
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// shared body of the transform benchmark, included once by a translation unit
+// using the exported math api and once by one using LX_MATH_INLINE so both
+// measure exactly the same code
+//
+// the including file defines TRANSFORM_FN as the name of the generated function
+
+#include <stddef.h>
+
+void TRANSFORM_FN(lx_mat4 view_proj, const lx_vec3* positions, const float* angles, size_t count, lx_vec4* out)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        lx_mat4 model = lx_mat4_identity();
+        model = lx_mat4_translate(model, positions[i]);
+        model = lx_mat4_rotate(model, (lx_vec3){ 0.0f, 1.0f, 0.0f }, angles[i]);
+        model = lx_mat4_scale(model, (lx_vec3){ 2.0f, 2.0f, 2.0f });
+
+        lx_mat4 mvp = lx_mat4_mul(view_proj, model);
+        lx_vec4 p = lx_mat4_mul_vec4(mvp, (lx_vec4){ 1.0f, 1.0f, 1.0f, 1.0f });
+
+        out[i] = lx_vec4_add(p, lx_vec4_scale_by_scalar(lx_vec4_normalize(p), 0.5f));
+    }
+}
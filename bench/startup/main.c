@@ -0,0 +1,149 @@
+#include <lux.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+
+static const int ROUNDS = 10;
+
+static void on_resize(int width, int height)
+{
+    glViewport(0, 0, width, height);
+}
+
+static void on_error(const char* desc)
+{
+    printf("error %s\n", desc);
+}
+
+// what a typical first frame touches, a shader, a triangle and a clear
+static void draw_first_frame()
+{
+    static const char* vertex =
+        "#version 330 core\n"
+        "layout (location = 0) in vec2 vpos;\n"
+        "void main(){ gl_Position = vec4(vpos, 0.0f, 1.0f); }";
+
+    static const char* fragment =
+        "#version 330 core\n"
+        "out vec4 FragColor;\n"
+        "void main(){ FragColor = vec4(1.0f); }";
+
+    static const float vertices[] = { -0.5f, -0.5f, 0.5f, -0.5f, 0.0f, 0.5f };
+
+    unsigned int vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &vertex, NULL);
+    glCompileShader(vs);
+
+    unsigned int fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fragment, NULL);
+    glCompileShader(fs);
+
+    unsigned int program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    unsigned int vao, vbo;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glBindVertexArray(vao);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(program);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    lx_swap_buffers();
+    glFinish();
+
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
+    glDeleteProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+}
+
+// the time from lx_init to a finished first frame, in seconds
+static double time_to_first_frame(int lazy)
+{
+    double start = bench_now();
+
+    int failed = lx_init((lx_init_props){
+        .title = "Lux Startup Bench",
+        .width = 640,
+        .height = 360,
+
+        .on_resize = on_resize,
+        .on_error = on_error,
+
+        .gl_lazy_loading = lazy,
+    });
+
+    if (failed)
+        return -1.0;
+
+    if (glCreateShader == NULL)
+    {
+        lx_quit();
+        return -1.0;
+    }
+
+    draw_first_frame();
+    double elapsed = bench_now() - start;
+
+    lx_quit();
+    return elapsed;
+}
+
+// usage: bench_startup [--json <path>]
+int main(int argc, char** argv)
+{
+    const char* json_path = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            json_path = argv[++i];
+    }
+
+    // the modes alternate so drift in the system affects both alike, and the
+    // first round warms the driver and is not counted
+    double best[2] = { 0.0, 0.0 };
+
+    for (int r = 0; r <= ROUNDS; r++)
+    {
+        for (int lazy = 0; lazy < 2; lazy++)
+        {
+            double elapsed = time_to_first_frame(lazy);
+            if (elapsed < 0.0)
+            {
+                printf("failed to create an opengl 3.3 context\n");
+                return 1;
+            }
+
+            if (r > 0 && (r == 1 || elapsed < best[lazy]))
+                best[lazy] = elapsed;
+        }
+    }
+
+    printf("time to first frame, best of %d rounds\n", ROUNDS);
+    printf("  eager       %8.3f ms\n", best[0] * 1e3);
+    printf("  lazy        %8.3f ms\n", best[1] * 1e3);
+    printf("  speedup     %8.2fx\n", best[0] / best[1]);
+
+    bench_record("startup", "first_frame", "eager", best[0] * 1e9);
+    bench_record("startup", "first_frame", "lazy", best[1] * 1e9);
+
+    if (json_path != NULL && !bench_write_json(json_path))
+    {
+        printf("failed to write json results to %s\n", json_path);
+        return 1;
+    }
+
+    return 0;
+}
@@ -6,4 +6,6 @@
 #include "lux/gl.h"
 #include "lux/input.h"
 #include "lux/math.h"
+#include "lux/scene.h"
+#include "lux/spatial.h"
 #include "lux/utils.h"
@@ -3,12 +3,71 @@
 #include "api.h"
 LX_BEGIN_HEADER
 
+#include <stddef.h>
+
 // types
 // ----------------------------------------------------------------
 
 typedef void (*lx_on_resize)(int width, int height);
 typedef void (*lx_on_error)(const char* desc);
 
+// where the lx_gl functions lead. the null backends never touch a driver or
+// open a window, every function is a no-op returning zero, except those
+// handing out names, statuses and strings, which answer as a working context
+// would. the recording backend also logs each call by name
+typedef enum _lx_gl_backend
+{
+    LX_GL_BACKEND_DRIVER = 0,
+    LX_GL_BACKEND_NULL,
+    LX_GL_BACKEND_RECORDING
+}
+lx_gl_backend;
+
+// the profile of the created context. the default leaves it to the platform,
+// which is a core profile on windows and whatever the driver offers elsewhere,
+// usually a compatibility profile. core profiles need version 3.2 or later
+typedef enum _lx_gl_profile
+{
+    LX_GL_PROFILE_DEFAULT = 0,
+    LX_GL_PROFILE_CORE,
+    LX_GL_PROFILE_COMPATIBILITY
+}
+lx_gl_profile;
+
+// implementation limits of the loaded context, queried once by lx_init.
+// limits the context version does not define are left as 0
+typedef struct _lx_gl_caps
+{
+    int max_texture_size;
+    int max_3d_texture_size;
+    int max_cube_map_texture_size;
+    int max_array_texture_layers;
+    int max_renderbuffer_size;
+    int max_samples;
+    int max_color_attachments;
+    int max_draw_buffers;
+    int max_texture_image_units;
+    int max_combined_texture_image_units;
+    int max_vertex_attribs;
+    int max_uniform_block_size;
+    int max_uniform_buffer_bindings;
+    int uniform_buffer_offset_alignment;
+    int max_shader_storage_block_size;
+    int max_shader_storage_buffer_bindings;
+    int shader_storage_buffer_offset_alignment;
+    float max_texture_max_anisotropy;
+}
+lx_gl_caps;
+
+// the binding and state calls seen by the gl state cache, those passed on
+// to the driver and those skipped as redundant
+typedef struct _lx_gl_state_counters
+{
+    size_t issued;
+    size_t filtered;
+}
+lx_gl_state_counters;
+
 typedef struct _lx_init_props
 {
     const char* title;
@@ -17,6 +76,29 @@ typedef struct _lx_init_props
 
     lx_on_resize on_resize;
     lx_on_error on_error;
+
+    // look each opengl function up on its first call rather than all of
+    // them during lx_init, which shortens startup
+    int gl_lazy_loading;
+
+    lx_gl_backend gl_backend;
+
+    // the opengl version to create a context for, or 0 for the newest the
+    // driver offers. only the functions of this version are loaded, even if
+    // the driver hands back a newer context
+    int gl_major;
+    int gl_minor;
+    lx_gl_profile gl_profile;
+
+    // a context which skips error checking, where errors are undefined
+    // behaviour instead, and one which reports more of them. they cannot
+    // be combined, and drivers without support ignore them
+    int gl_no_error;
+    int gl_debug;
+
+    // skip binding and state calls which would not change the driver's
+    // state, see lx_gl_get_state_counters
+    int gl_state_cache;
 }
 lx_init_props;
 
@@ -110,4 +192,69 @@ LX_API int lx_get_width();
  */
 LX_API int lx_get_height();
 
+// gl capabilities
+// ----------------------------------------------------------------
+
+/**
+ * @brief Queries if the OpenGL context supports an extension, looked up in a
+ * set built during initialisation rather than asking the driver.
+ *
+ * @param name The full extension name, such as "GL_KHR_debug".
+ *
+ * @return 1 if supported, 0 otherwise.
+ */
+LX_API int lx_gl_has_extension(const char* name);
+
+/**
+ * @brief Returns the implementation limits of the OpenGL context, queried once
+ * during initialisation.
+ *
+ * @return The limits, valid until Lux is quit, or NULL if Lux has not been
+ * initialised.
+ */
+LX_API const lx_gl_caps* lx_gl_get_caps();
+
+// gl backend
+// ----------------------------------------------------------------
+
+/**
+ * @brief Copies the names of the opengl functions called since
+ * initialisation or the last clear, in order, when running on the recording
+ * backend.
+ *
+ * @param names The function names, capacity of them, may be NULL.
+ * @param capacity The number of names that fit in the array.
+ *
+ * @return The total number of recorded calls, which may exceed capacity.
+ */
+LX_API size_t lx_gl_get_recorded_calls(const char** names, size_t capacity);
+
+/**
+ * @brief Clears the calls recorded by the recording backend.
+ */
+LX_API void lx_gl_clear_recorded_calls();
+
+// gl state cache
+// ----------------------------------------------------------------
+
+/**
+ * @brief Returns how many binding and state calls the gl state cache has passed
+ * on to the driver and skipped since initialisation or the last reset.
+ *
+ * @return The counters, zero if the cache is not enabled.
+ */
+LX_API lx_gl_state_counters lx_gl_get_state_counters();
+
+/**
+ * @brief Resets the counters of the gl state cache to zero.
+ */
+LX_API void lx_gl_reset_state_counters();
+
+/**
+ * @brief Forgets the state cached by the gl state cache, so the next call to
+ * each function reaches the driver. Needed after code which does not go
+ * through the lx_gl functions changes the state, such as another library.
+ */
+LX_API void lx_gl_invalidate_state_cache();
+
 LX_END_HEADER
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "../math.h"
+
+#include <math.h>
+
+// definitions
+// ----------------------------------------------------------------
+
+LX_MATH_API lx_quat lx_quat_identity()
+{
+    return (lx_quat){ 0.0f, 0.0f, 0.0f, 1.0f };
+}
+
+LX_MATH_API lx_quat lx_quat_from_axis_angle(lx_vec3 axis, float degrees)
+{
+    axis = lx_vec3_normalize(axis);
+    float half = lx_deg_to_rad(degrees) * 0.5f;
+    float s = sinf(half);
+
+    return (lx_quat){
+        axis.x * s,
+        axis.y * s,
+        axis.z * s,
+        cosf(half)
+    };
+}
+
+LX_MATH_API lx_quat lx_quat_mul(lx_quat a, lx_quat b)
+{
+    return (lx_quat){
+        a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+        a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+        a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+        a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+    };
+}
+
+LX_MATH_API lx_quat lx_quat_conjugate(lx_quat q)
+{
+    return (lx_quat){ -q.x, -q.y, -q.z, q.w };
+}
+
+LX_MATH_API lx_quat lx_quat_normalize(lx_quat q)
+{
+    float mag = sqrtf(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+
+    if (mag == 0.0f)
+        return lx_quat_identity();
+
+    return (lx_quat){
+        q.x / mag,
+        q.y / mag,
+        q.z / mag,
+        q.w / mag
+    };
+}
+
+LX_MATH_API float lx_quat_dot(lx_quat a, lx_quat b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+LX_MATH_API lx_quat lx_quat_nlerp(lx_quat a, lx_quat b, float t)
+{
+    // q and -q are the same rotation, flipping b keeps to the shorter arc
+    float sign = lx_quat_dot(a, b) < 0.0f ? -1.0f : 1.0f;
+
+    return lx_quat_normalize((lx_quat){
+        lx_float_lerp(a.x, b.x * sign, t),
+        lx_float_lerp(a.y, b.y * sign, t),
+        lx_float_lerp(a.z, b.z * sign, t),
+        lx_float_lerp(a.w, b.w * sign, t)
+    });
+}
+
+LX_MATH_API lx_quat lx_quat_slerp(lx_quat a, lx_quat b, float t)
+{
+    float d = lx_quat_dot(a, b);
+
+    if (d < 0.0f)
+    {
+        b = (lx_quat){ -b.x, -b.y, -b.z, -b.w };
+        d = -d;
+    }
+
+    // nearly parallel rotations divide by a vanishing sine, where nlerp is
+    // indistinguishable anyway
+    if (d > 0.9995f)
+        return lx_quat_nlerp(a, b, t);
+
+    float theta = acosf(d);
+    float inv_sin = 1.0f / sinf(theta);
+    float wa = sinf((1.0f - t) * theta) * inv_sin;
+    float wb = sinf(t * theta) * inv_sin;
+
+    return (lx_quat){
+        a.x * wa + b.x * wb,
+        a.y * wa + b.y * wb,
+        a.z * wa + b.z * wb,
+        a.w * wa + b.w * wb
+    };
+}
+
+LX_MATH_API lx_vec3 lx_quat_rotate_vec3(lx_quat q, lx_vec3 v)
+{
+    // v + 2w(u x v) + 2u x (u x v), with u the vector part of q
+    lx_vec3 u = { q.x, q.y, q.z };
+    lx_vec3 t = lx_vec3_scale_by_scalar(lx_vec3_cross(u, v), 2.0f);
+
+    return lx_vec3_add(lx_vec3_add(v, lx_vec3_scale_by_scalar(t, q.w)), lx_vec3_cross(u, t));
+}
+
+LX_MATH_API lx_mat3 lx_quat_to_mat3(lx_quat q)
+{
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    return (lx_mat3){
+        .m = {
+            1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy),
+            2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx),
+            2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)
+        }
+    };
+}
+
+LX_MATH_API lx_mat4 lx_quat_to_mat4(lx_quat q)
+{
+    return lx_mat4_from_trs((lx_vec3){ 0.0f, 0.0f, 0.0f }, q, (lx_vec3){ 1.0f, 1.0f, 1.0f });
+}
+
+LX_MATH_API int lx_quat_equal(lx_quat a, lx_quat b, float epsilon)
+{
+    return fabsf(a.x - b.x) <= epsilon &&
+        fabsf(a.y - b.y) <= epsilon &&
+        fabsf(a.z - b.z) <= epsilon &&
+        fabsf(a.w - b.w) <= epsilon;
+}
+
+LX_MATH_API lx_mat4 lx_mat4_from_trs(lx_vec3 translation, lx_quat rotation, lx_vec3 scale)
+{
+    lx_mat3 r = lx_quat_to_mat3(rotation);
+
+    // each column of the rotation is scaled by its own axis
+    return (lx_mat4){
+        .m = {
+            r.m[0] * scale.x, r.m[1] * scale.x, r.m[2] * scale.x, 0.0f,
+            r.m[3] * scale.y, r.m[4] * scale.y, r.m[5] * scale.y, 0.0f,
+            r.m[6] * scale.z, r.m[7] * scale.z, r.m[8] * scale.z, 0.0f,
+            translation.x, translation.y, translation.z, 1.0f
+        }
+    };
+}
+
+LX_MATH_API void lx_mat4_from_trs_to(lx_mat4* out, lx_vec3 translation, lx_quat rotation, lx_vec3 scale)
+{
+    *out = lx_mat4_from_trs(translation, rotation, scale);
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "../math.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #include <xmmintrin.h>
+#endif
+
+// definitions
+// ----------------------------------------------------------------
+
+LX_MATH_API float lx_float_clamp(float f, float min, float max)
+{
+    if (f < min) return min;
+    if (f > max) return max;
+    return f;
+}
+
+LX_MATH_API float lx_float_lerp(float a, float b, float t)
+{
+    return a + (b - a) * t;
+}
+
+LX_MATH_API int lx_float_equal(float a, float b, float epsilon)
+{
+    return fabsf(a - b) <= epsilon;
+}
+
+LX_MATH_API float lx_deg_to_rad(float degrees)
+{
+    return degrees * (LX_PI / 180); 
+}
+
+LX_MATH_API float lx_rad_to_deg(float radians)
+{
+    return radians * (180 / LX_PI);
+}
+
+LX_MATH_API float lx_float_rsqrt_fast(float f)
+{
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    // 12 bit hardware estimate, one newton step roughly doubles the precision.
+    // the estimate of zero is infinite, raising it to the smallest normal
+    // float keeps it finite, with a max rather than a branch
+    __m128 clamped = _mm_max_ss(_mm_set1_ps(f), _mm_set_ss(FLT_MIN));
+    float y = _mm_cvtss_f32(_mm_rsqrt_ss(clamped));
+    return y * (1.5f - 0.5f * f * y * y);
+#else
+    // bit level estimate, which needs a second newton step for the same bound
+    union { float f; uint32_t u; } bits = { f };
+    bits.u = 0x5f375a86u - (bits.u >> 1);
+
+    float y = bits.f;
+    y = y * (1.5f - 0.5f * f * y * y);
+    return y * (1.5f - 0.5f * f * y * y);
+#endif
+}
+
+LX_MATH_API void lx_float_sincos_fast(float radians, float* s, float* c)
+{
+    // reduce to [-pi/4, pi/4] around the nearest multiple of pi/2, splitting
+    // pi/2 in three parts so the reduction stays exact for moderate angles
+    float q = (radians * 0.636619772f + 12582912.0f) - 12582912.0f;
+    float r = ((radians - q * 1.5703125f) - q * 4.837512969970703125e-4f) - q * 7.54978995489188216e-8f;
+    float r2 = r * r;
+
+    float rs = r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    float rc = 1.0f - 0.5f * r2 + r2 * r2 * (4.166664568298827e-2f + r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+    // the quadrant swaps the results and flips their sign bits, written
+    // without branches so loops over the function can vectorize
+    uint32_t quadrant = (uint32_t)(int32_t)q;
+    union { float f; uint32_t u; } qs = { (quadrant & 1) ? rc : rs };
+    union { float f; uint32_t u; } qc = { (quadrant & 1) ? rs : rc };
+
+    qs.u ^= (quadrant & 2) << 30;
+    qc.u ^= ((quadrant + 1) & 2) << 30;
+
+    *s = qs.f;
+    *c = qc.f;
+}
+
+LX_MATH_API float lx_float_sin_fast(float radians)
+{
+    float s, c;
+    lx_float_sincos_fast(radians, &s, &c);
+    return s;
+}
+
+LX_MATH_API float lx_float_cos_fast(float radians)
+{
+    float s, c;
+    lx_float_sincos_fast(radians, &s, &c);
+    return c;
+}
+
+LX_MATH_API float lx_float_atan2_fast(float y, float x)
+{
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    float hi = ax > ay ? ax : ay;
+    float lo = ax > ay ? ay : ax;
+
+    if (hi == 0.0f)
+        return 0.0f;
+
+    // odd minimax polynomial for atan on [0, 1], then mirrored into the octant
+    float t = lo / hi;
+    float t2 = t * t;
+    float a = t * (0.99997726f + t2 * (-0.33262347f + t2 * (0.19354346f + t2 * (-0.11643287f + t2 * (0.05265332f + t2 * -0.01172120f)))));
+
+    if (ay > ax) a = 1.57079633f - a;
+    if (x < 0.0f) a = 3.14159265f - a;
+    return y < 0.0f ? -a : a;
+}
@@ -3,6 +3,9 @@
 #include "api.h"
 LX_BEGIN_HEADER
 
+#include <stddef.h>
+#include <stdint.h>
+
 // types
 // ----------------------------------------------------------------
 
@@ -12,6 +15,92 @@ typedef struct _lx_vec4 { float x, y, z, w; } lx_vec4;
 typedef struct _lx_mat2 { float m[4]; } lx_mat2;
 typedef struct _lx_mat3 { float m[9]; } lx_mat3;
 typedef struct _lx_mat4 { float m[16]; } lx_mat4;
+typedef struct _lx_quat { float x, y, z, w; } lx_quat;
+
+// aligned storage for the pointer api, the vec and mat members alias the
+// plain types so they can be passed straight to the _to functions
+#if defined(_MSC_VER)
+    #define LX_ALIGN(n) __declspec(align(n))
+#else
+    #define LX_ALIGN(n) __attribute__((aligned(n)))
+#endif
+
+typedef union _lx_vec4a { LX_ALIGN(16) lx_vec4 vec; float v[4]; } lx_vec4a;
+typedef union _lx_mat4a { LX_ALIGN(16) lx_mat4 mat; float m[16]; } lx_mat4a;
+
+typedef struct _lx_vec2_stream { float* x; float* y; size_t count; } lx_vec2_stream;
+typedef struct _lx_vec3_stream { float* x; float* y; float* z; size_t count; } lx_vec3_stream;
+
+// eight xoshiro128+ generators stepped side by side so bulk fills vectorize,
+// seed with lx_rng_seed before use
+typedef struct _lx_rng { uint32_t state[4][8]; uint32_t lane; } lx_rng;
+
+typedef enum _lx_simd_level
+{
+    LX_SIMD_SCALAR = 0,
+    LX_SIMD_SSE2,
+    LX_SIMD_SSE41,
+    LX_SIMD_AVX2,
+    LX_SIMD_NEON
+}
+lx_simd_level;
+
+typedef enum _lx_mat4_kind
+{
+    LX_MAT4_GENERAL = 0,
+    LX_MAT4_AFFINE,
+    LX_MAT4_RIGID
+}
+lx_mat4_kind;
+
+#define LX_PI 3.14159265358979323846f
+
+// inline mode
+// ----------------------------------------------------------------
+
+// defining LX_MATH_INLINE before including lux provides the whole math api as
+// static inline definitions rather than calls into the shared library, the
+// library itself always exports the out-of-line symbols. the definitions use
+// c compound literals, so c++ translation units keep the exported symbols.
+#if defined(LX_MATH_INLINE) && !defined(LX_BUILD) && !defined(__cplusplus)
+    #define LX_MATH_INLINE_DEFINITIONS
+    #define LX_MATH_API static inline
+#else
+    #define LX_MATH_API LX_API
+#endif
+
+// simd
+// ----------------------------------------------------------------
+
+/**
+ * @brief Returns the instruction set used by the math kernels.
+ *
+ * The best level supported by the cpu is selected during initialisation,
+ * before that the scalar kernels are used.
+ *
+ * @return The active simd level.
+ */
+LX_API lx_simd_level lx_get_simd_level();
+
+/**
+ * @brief Checks if the running cpu and this build of Lux both support a simd
+ * level.
+ *
+ * @param level The simd level to check.
+ *
+ * @return 1 if supported, otherwise 0.
+ */
+LX_API int lx_is_simd_level_supported(lx_simd_level level);
+
+/**
+ * @brief Forces the math kernels to a specific simd level, mainly for testing
+ * and benchmarking. A forced level is kept through initialisation.
+ *
+ * @param level The simd level to use.
+ *
+ * @return 1 if the level is now active, 0 if it is not supported.
+ */
+LX_API int lx_set_simd_level(lx_simd_level level);
 
 // utility
 // ----------------------------------------------------------------
@@ -25,7 +114,7 @@ typedef struct _lx_mat4 { float m[16]; } lx_mat4;
  *
  * @return The clamped value.
  */
-LX_API float lx_float_clamp(float f, float min, float max);
+LX_MATH_API float lx_float_clamp(float f, float min, float max);
 
 /**
  * @brief Linearly interpolates between two float values.
@@ -36,7 +125,7 @@ LX_API float lx_float_clamp(float f, float min, float max);
  *
  * @return The interpolated float value.
  */
-LX_API float lx_float_lerp(float a, float b, float t);
+LX_MATH_API float lx_float_lerp(float a, float b, float t);
 
 /**
  * @brief Checks if two floats are equal within a given epsilon.
@@ -47,7 +136,7 @@ LX_API float lx_float_lerp(float a, float b, float t);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_float_equal(float a, float b, float epsilon);
+LX_MATH_API int lx_float_equal(float a, float b, float epsilon);
 
 /**
  * @brief Converts degrees to radians.
@@ -56,7 +145,7 @@ LX_API int lx_float_equal(float a, float b, float epsilon);
  *
  * @return Angle in radians.
  */
-LX_API float lx_deg_to_rad(float degrees);
+LX_MATH_API float lx_deg_to_rad(float degrees);
 
 /**
  * @brief Converts radians to degrees.
@@ -65,7 +154,57 @@ LX_API float lx_deg_to_rad(float degrees);
  *
  * @return Angle in degrees.
  */
-LX_API float lx_rad_to_deg(float radians);
+LX_MATH_API float lx_rad_to_deg(float radians);
+
+/**
+ * @brief Approximates the reciprocal square root of a float, refined with
+ * newton steps to a relative error below 5e-6.
+ *
+ * @param f The value, which must be positive and normal, between FLT_MIN and
+ * FLT_MAX, or zero.
+ *
+ * @return An approximation of 1 / sqrt(f), large but finite for zero.
+ */
+LX_MATH_API float lx_float_rsqrt_fast(float f);
+
+/**
+ * @brief Approximates the sine and cosine of an angle together with a
+ * polynomial, with an absolute error below 2e-7 for |radians| up to 1e4.
+ *
+ * @param radians Angle in radians.
+ * @param s Receives the sine.
+ * @param c Receives the cosine.
+ */
+LX_MATH_API void lx_float_sincos_fast(float radians, float* s, float* c);
+
+/**
+ * @brief Approximates the sine of an angle, see lx_float_sincos_fast.
+ *
+ * @param radians Angle in radians.
+ *
+ * @return The sine of the angle.
+ */
+LX_MATH_API float lx_float_sin_fast(float radians);
+
+/**
+ * @brief Approximates the cosine of an angle, see lx_float_sincos_fast.
+ *
+ * @param radians Angle in radians.
+ *
+ * @return The cosine of the angle.
+ */
+LX_MATH_API float lx_float_cos_fast(float radians);
+
+/**
+ * @brief Approximates the angle of a 2D direction with a polynomial, with an
+ * absolute error below 3e-6 radians.
+ *
+ * @param y The y component of the direction.
+ * @param x The x component of the direction.
+ *
+ * @return The angle in radians between -pi and pi, or 0 if both are zero.
+ */
+LX_MATH_API float lx_float_atan2_fast(float y, float x);
 
 // vec2
 // ----------------------------------------------------------------
@@ -75,7 +214,7 @@ LX_API float lx_rad_to_deg(float radians);
  *
  * @return A 2D vector with all components set to zero.
  */
-LX_API lx_vec2 lx_vec2_zero();
+LX_MATH_API lx_vec2 lx_vec2_zero();
 
 /**
  * @brief Creates a 2D vector from a 3D vector by dropping the z component.
@@ -84,7 +223,7 @@ LX_API lx_vec2 lx_vec2_zero();
  *
  * @return A 2D vector.
  */
-LX_API lx_vec2 lx_vec2_from_vec3(lx_vec3 v);
+LX_MATH_API lx_vec2 lx_vec2_from_vec3(lx_vec3 v);
 
 /**
  * @brief Creates a 2D vector from a 4D vector by dropping the z and w components.
@@ -93,7 +232,7 @@ LX_API lx_vec2 lx_vec2_from_vec3(lx_vec3 v);
  *
  * @return A 2D vector.
  */
-LX_API lx_vec2 lx_vec2_from_vec4(lx_vec4 v);
+LX_MATH_API lx_vec2 lx_vec2_from_vec4(lx_vec4 v);
 
 /**
  * @brief Adds two 2D vectors.
@@ -103,7 +242,7 @@ LX_API lx_vec2 lx_vec2_from_vec4(lx_vec4 v);
  *
  * @return The sum of the vectors.
  */
-LX_API lx_vec2 lx_vec2_add(lx_vec2 a, lx_vec2 b);
+LX_MATH_API lx_vec2 lx_vec2_add(lx_vec2 a, lx_vec2 b);
 
 /**
  * @brief Subtracts one 2D vector from another.
@@ -113,7 +252,7 @@ LX_API lx_vec2 lx_vec2_add(lx_vec2 a, lx_vec2 b);
  *
  * @return The result of a - b.
  */
-LX_API lx_vec2 lx_vec2_sub(lx_vec2 a, lx_vec2 b);
+LX_MATH_API lx_vec2 lx_vec2_sub(lx_vec2 a, lx_vec2 b);
 
 /**
  * @brief Multiplies two 2D vectors component-wise.
@@ -123,7 +262,7 @@ LX_API lx_vec2 lx_vec2_sub(lx_vec2 a, lx_vec2 b);
  *
  * @return The component-wise product.
  */
-LX_API lx_vec2 lx_vec2_mul(lx_vec2 a, lx_vec2 b);
+LX_MATH_API lx_vec2 lx_vec2_mul(lx_vec2 a, lx_vec2 b);
 
 /**
  * @brief Scales a 2D vector by a scalar.
@@ -133,7 +272,7 @@ LX_API lx_vec2 lx_vec2_mul(lx_vec2 a, lx_vec2 b);
  *
  * @return The scaled vector.
  */
-LX_API lx_vec2 lx_vec2_scale_by_scalar(lx_vec2 v, float scale);
+LX_MATH_API lx_vec2 lx_vec2_scale_by_scalar(lx_vec2 v, float scale);
 
 /**
  * @brief Normalizes a 2D vector.
@@ -142,7 +281,18 @@ LX_API lx_vec2 lx_vec2_scale_by_scalar(lx_vec2 v, float scale);
  *
  * @return The normalized vector.
  */
-LX_API lx_vec2 lx_vec2_normalize(lx_vec2 v);
+LX_MATH_API lx_vec2 lx_vec2_normalize(lx_vec2 v);
+
+/**
+ * @brief Normalizes a 2D vector using an approximate reciprocal square root,
+ * with a relative error below 5e-6 per component while the squared length is
+ * a normal float, components from about 1e-19 to 1e19, and undefined past it.
+ *
+ * @param v The vector to normalize.
+ *
+ * @return The normalized vector, or a zero vector if v has zero length.
+ */
+LX_MATH_API lx_vec2 lx_vec2_normalize_fast(lx_vec2 v);
 
 /**
  * @brief Linearly interpolates between two 2D vectors.
@@ -153,7 +303,7 @@ LX_API lx_vec2 lx_vec2_normalize(lx_vec2 v);
  *
  * @return The interpolated vector.
  */
-LX_API lx_vec2 lx_vec2_lerp(lx_vec2 a, lx_vec2 b, float t);
+LX_MATH_API lx_vec2 lx_vec2_lerp(lx_vec2 a, lx_vec2 b, float t);
 
 /**
  * @brief Clamps each component of a 2D vector between the corresponding components of min and max.
@@ -164,7 +314,7 @@ LX_API lx_vec2 lx_vec2_lerp(lx_vec2 a, lx_vec2 b, float t);
  *
  * @return The clamped vector.
  */
-LX_API lx_vec2 lx_vec2_clamp(lx_vec2 v, lx_vec2 min, lx_vec2 max);
+LX_MATH_API lx_vec2 lx_vec2_clamp(lx_vec2 v, lx_vec2 min, lx_vec2 max);
 
 /**
  * @brief Computes the dot product of two 2D vectors.
@@ -174,7 +324,7 @@ LX_API lx_vec2 lx_vec2_clamp(lx_vec2 v, lx_vec2 min, lx_vec2 max);
  *
  * @return The dot product.
  */
-LX_API float lx_vec2_dot(lx_vec2 a, lx_vec2 b);
+LX_MATH_API float lx_vec2_dot(lx_vec2 a, lx_vec2 b);
 
 /**
  * @brief Computes the magnitude of a 2D vector.
@@ -183,7 +333,7 @@ LX_API float lx_vec2_dot(lx_vec2 a, lx_vec2 b);
  *
  * @return The length of the vector.
  */
-LX_API float lx_vec2_magnitude(lx_vec2 v);
+LX_MATH_API float lx_vec2_magnitude(lx_vec2 v);
 
 /**
  * @brief Computes the squared magnitude of a 2D vector.
@@ -192,7 +342,7 @@ LX_API float lx_vec2_magnitude(lx_vec2 v);
  *
  * @return The squared length of the vector.
  */
-LX_API float lx_vec2_magnitude_squared(lx_vec2 v);
+LX_MATH_API float lx_vec2_magnitude_squared(lx_vec2 v);
 
 /**
  * @brief Checks if two 2D vectors are equal within a given epsilon.
@@ -203,7 +353,7 @@ LX_API float lx_vec2_magnitude_squared(lx_vec2 v);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_vec2_equal(lx_vec2 a, lx_vec2 b, float epsilon);
+LX_MATH_API int lx_vec2_equal(lx_vec2 a, lx_vec2 b, float epsilon);
 
 // vec3
 // ----------------------------------------------------------------
@@ -213,7 +363,7 @@ LX_API int lx_vec2_equal(lx_vec2 a, lx_vec2 b, float epsilon);
  *
  * @return A 3D vector with all components set to zero.
  */
-LX_API lx_vec3 lx_vec3_zero();
+LX_MATH_API lx_vec3 lx_vec3_zero();
 
 /**
  * @brief Creates a 3D vector from a 2D vector, setting z to 0.
@@ -222,7 +372,7 @@ LX_API lx_vec3 lx_vec3_zero();
  *
  * @return A 3D vector.
  */
-LX_API lx_vec3 lx_vec3_from_vec2(lx_vec2 v);
+LX_MATH_API lx_vec3 lx_vec3_from_vec2(lx_vec2 v);
 
 /**
  * @brief Creates a 3D vector from a 4D vector by dropping the w component.
@@ -231,7 +381,7 @@ LX_API lx_vec3 lx_vec3_from_vec2(lx_vec2 v);
  *
  * @return A 3D vector.
  */
-LX_API lx_vec3 lx_vec3_from_vec4(lx_vec4 v);
+LX_MATH_API lx_vec3 lx_vec3_from_vec4(lx_vec4 v);
 
 /**
  * @brief Adds two 3D vectors.
@@ -241,7 +391,7 @@ LX_API lx_vec3 lx_vec3_from_vec4(lx_vec4 v);
  *
  * @return The sum of the vectors.
  */
-LX_API lx_vec3 lx_vec3_add(lx_vec3 a, lx_vec3 b);
+LX_MATH_API lx_vec3 lx_vec3_add(lx_vec3 a, lx_vec3 b);
 
 /**
  * @brief Subtracts one 3D vector from another.
@@ -251,7 +401,7 @@ LX_API lx_vec3 lx_vec3_add(lx_vec3 a, lx_vec3 b);
  *
  * @return The result of a - b.
  */
-LX_API lx_vec3 lx_vec3_sub(lx_vec3 a, lx_vec3 b);
+LX_MATH_API lx_vec3 lx_vec3_sub(lx_vec3 a, lx_vec3 b);
 
 /**
  * @brief Multiplies two 3D vectors component-wise.
@@ -261,7 +411,7 @@ LX_API lx_vec3 lx_vec3_sub(lx_vec3 a, lx_vec3 b);
  *
  * @return The component-wise product.
  */
-LX_API lx_vec3 lx_vec3_mul(lx_vec3 a, lx_vec3 b);
+LX_MATH_API lx_vec3 lx_vec3_mul(lx_vec3 a, lx_vec3 b);
 
 /**
  * @brief Scales a 3D vector by a scalar.
@@ -271,7 +421,7 @@ LX_API lx_vec3 lx_vec3_mul(lx_vec3 a, lx_vec3 b);
  *
  * @return The scaled vector.
  */
-LX_API lx_vec3 lx_vec3_scale_by_scalar(lx_vec3 v, float scale);
+LX_MATH_API lx_vec3 lx_vec3_scale_by_scalar(lx_vec3 v, float scale);
 
 /**
  * @brief Normalizes a 3D vector.
@@ -280,7 +430,18 @@ LX_API lx_vec3 lx_vec3_scale_by_scalar(lx_vec3 v, float scale);
  *
  * @return The normalized vector.
  */
-LX_API lx_vec3 lx_vec3_normalize(lx_vec3 v);
+LX_MATH_API lx_vec3 lx_vec3_normalize(lx_vec3 v);
+
+/**
+ * @brief Normalizes a 3D vector using an approximate reciprocal square root,
+ * with a relative error below 5e-6 per component while the squared length is
+ * a normal float, components from about 1e-19 to 1e19, and undefined past it.
+ *
+ * @param v The vector to normalize.
+ *
+ * @return The normalized vector, or a zero vector if v has zero length.
+ */
+LX_MATH_API lx_vec3 lx_vec3_normalize_fast(lx_vec3 v);
 
 /**
  * @brief Linearly interpolates between two 3D vectors.
@@ -291,7 +452,7 @@ LX_API lx_vec3 lx_vec3_normalize(lx_vec3 v);
  *
  * @return The interpolated vector.
  */
-LX_API lx_vec3 lx_vec3_lerp(lx_vec3 a, lx_vec3 b, float t);
+LX_MATH_API lx_vec3 lx_vec3_lerp(lx_vec3 a, lx_vec3 b, float t);
 
 /**
  * @brief Clamps each component of a 3D vector between the corresponding components of min and max.
@@ -302,7 +463,7 @@ LX_API lx_vec3 lx_vec3_lerp(lx_vec3 a, lx_vec3 b, float t);
  *
  * @return The clamped vector.
  */
-LX_API lx_vec3 lx_vec3_clamp(lx_vec3 v, lx_vec3 min, lx_vec3 max);
+LX_MATH_API lx_vec3 lx_vec3_clamp(lx_vec3 v, lx_vec3 min, lx_vec3 max);
 
 /**
  * @brief Reflects a vector around a normal.
@@ -312,7 +473,7 @@ LX_API lx_vec3 lx_vec3_clamp(lx_vec3 v, lx_vec3 min, lx_vec3 max);
  *
  * @return The reflected vector.
  */
-LX_API lx_vec3 lx_vec3_reflect(lx_vec3 i, lx_vec3 n);
+LX_MATH_API lx_vec3 lx_vec3_reflect(lx_vec3 i, lx_vec3 n);
 
 /**
  * @brief Computes the dot product of two 3D vectors.
@@ -322,7 +483,7 @@ LX_API lx_vec3 lx_vec3_reflect(lx_vec3 i, lx_vec3 n);
  *
  * @return The dot product.
  */
-LX_API float lx_vec3_dot(lx_vec3 a, lx_vec3 b);
+LX_MATH_API float lx_vec3_dot(lx_vec3 a, lx_vec3 b);
 
 /**
  * @brief Computes the magnitude of a 3D vector.
@@ -331,7 +492,7 @@ LX_API float lx_vec3_dot(lx_vec3 a, lx_vec3 b);
  *
  * @return The length of the vector.
  */
-LX_API float lx_vec3_magnitude(lx_vec3 v);
+LX_MATH_API float lx_vec3_magnitude(lx_vec3 v);
 
 /**
  * @brief Computes the squared magnitude of a 3D vector.
@@ -340,7 +501,7 @@ LX_API float lx_vec3_magnitude(lx_vec3 v);
  *
  * @return The squared length of the vector.
  */
-LX_API float lx_vec3_magnitude_squared(lx_vec3 v);
+LX_MATH_API float lx_vec3_magnitude_squared(lx_vec3 v);
 
 /**
  * @brief Computes the distance between two 3D vectors.
@@ -350,7 +511,7 @@ LX_API float lx_vec3_magnitude_squared(lx_vec3 v);
  *
  * @return The distance between the vectors.
  */
-LX_API float lx_vec3_distance(lx_vec3 a, lx_vec3 b);
+LX_MATH_API float lx_vec3_distance(lx_vec3 a, lx_vec3 b);
 
 /**
  * @brief Checks if two 3D vectors are equal within a given epsilon.
@@ -361,7 +522,7 @@ LX_API float lx_vec3_distance(lx_vec3 a, lx_vec3 b);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_vec3_equal(lx_vec3 a, lx_vec3 b, float epsilon);
+LX_MATH_API int lx_vec3_equal(lx_vec3 a, lx_vec3 b, float epsilon);
 
 /**
  * @brief Computes the cross product of two 3D vectors.
@@ -371,7 +532,7 @@ LX_API int lx_vec3_equal(lx_vec3 a, lx_vec3 b, float epsilon);
  *
  * @return The cross product.
  */
-LX_API lx_vec3 lx_vec3_cross(lx_vec3 a, lx_vec3 b);
+LX_MATH_API lx_vec3 lx_vec3_cross(lx_vec3 a, lx_vec3 b);
 
 // vec4
 // ----------------------------------------------------------------
@@ -381,7 +542,7 @@ LX_API lx_vec3 lx_vec3_cross(lx_vec3 a, lx_vec3 b);
  *
  * @return A 4D vector with all components set to zero.
  */
-LX_API lx_vec4 lx_vec4_zero();
+LX_MATH_API lx_vec4 lx_vec4_zero();
 
 /**
  * @brief Creates a 4D vector from a 2D vector, setting z and w to 0.
@@ -390,7 +551,7 @@ LX_API lx_vec4 lx_vec4_zero();
  *
  * @return A 4D vector.
  */
-LX_API lx_vec4 lx_vec4_from_vec2(lx_vec2 v);
+LX_MATH_API lx_vec4 lx_vec4_from_vec2(lx_vec2 v);
 
 /**
  * @brief Creates a 4D vector from a 3D vector, setting w to 0.
@@ -399,7 +560,7 @@ LX_API lx_vec4 lx_vec4_from_vec2(lx_vec2 v);
  *
  * @return A 4D vector.
  */
-LX_API lx_vec4 lx_vec4_from_vec3(lx_vec3 v);
+LX_MATH_API lx_vec4 lx_vec4_from_vec3(lx_vec3 v);
 
 /**
  * @brief Adds two 4D vectors.
@@ -409,7 +570,7 @@ LX_API lx_vec4 lx_vec4_from_vec3(lx_vec3 v);
  *
  * @return The sum of the vectors.
  */
-LX_API lx_vec4 lx_vec4_add(lx_vec4 a, lx_vec4 b);
+LX_MATH_API lx_vec4 lx_vec4_add(lx_vec4 a, lx_vec4 b);
 
 /**
  * @brief Subtracts one 4D vector from another.
@@ -419,7 +580,7 @@ LX_API lx_vec4 lx_vec4_add(lx_vec4 a, lx_vec4 b);
  *
  * @return The result of a - b.
  */
-LX_API lx_vec4 lx_vec4_sub(lx_vec4 a, lx_vec4 b);
+LX_MATH_API lx_vec4 lx_vec4_sub(lx_vec4 a, lx_vec4 b);
 
 /**
  * @brief Multiplies two 4D vectors component-wise.
@@ -429,7 +590,7 @@ LX_API lx_vec4 lx_vec4_sub(lx_vec4 a, lx_vec4 b);
  *
  * @return The component-wise product.
  */
-LX_API lx_vec4 lx_vec4_mul(lx_vec4 a, lx_vec4 b);
+LX_MATH_API lx_vec4 lx_vec4_mul(lx_vec4 a, lx_vec4 b);
 
 /**
  * @brief Scales a 4D vector by a scalar.
@@ -439,7 +600,7 @@ LX_API lx_vec4 lx_vec4_mul(lx_vec4 a, lx_vec4 b);
  *
  * @return The scaled vector.
  */
-LX_API lx_vec4 lx_vec4_scale_by_scalar(lx_vec4 v, float scale);
+LX_MATH_API lx_vec4 lx_vec4_scale_by_scalar(lx_vec4 v, float scale);
 
 /**
  * @brief Normalizes a 4D vector.
@@ -448,7 +609,18 @@ LX_API lx_vec4 lx_vec4_scale_by_scalar(lx_vec4 v, float scale);
  *
  * @return The normalized vector.
  */
-LX_API lx_vec4 lx_vec4_normalize(lx_vec4 v);
+LX_MATH_API lx_vec4 lx_vec4_normalize(lx_vec4 v);
+
+/**
+ * @brief Normalizes a 4D vector using an approximate reciprocal square root,
+ * with a relative error below 5e-6 per component while the squared length is
+ * a normal float, components from about 1e-19 to 1e19, and undefined past it.
+ *
+ * @param v The vector to normalize.
+ *
+ * @return The normalized vector, or a zero vector if v has zero length.
+ */
+LX_MATH_API lx_vec4 lx_vec4_normalize_fast(lx_vec4 v);
 
 /**
  * @brief Linearly interpolates between two 4D vectors.
@@ -459,7 +631,7 @@ LX_API lx_vec4 lx_vec4_normalize(lx_vec4 v);
  *
  * @return The interpolated vector.
  */
-LX_API lx_vec4 lx_vec4_lerp(lx_vec4 a, lx_vec4 b, float t);
+LX_MATH_API lx_vec4 lx_vec4_lerp(lx_vec4 a, lx_vec4 b, float t);
 
 /**
  * @brief Clamps each component of a 4D vector between the corresponding components of min and max.
@@ -470,7 +642,7 @@ LX_API lx_vec4 lx_vec4_lerp(lx_vec4 a, lx_vec4 b, float t);
  *
  * @return The clamped vector.
  */
-LX_API lx_vec4 lx_vec4_clamp(lx_vec4 v, lx_vec4 min, lx_vec4 max);
+LX_MATH_API lx_vec4 lx_vec4_clamp(lx_vec4 v, lx_vec4 min, lx_vec4 max);
 
 /**
  * @brief Computes the dot product of two 4D vectors.
@@ -480,7 +652,7 @@ LX_API lx_vec4 lx_vec4_clamp(lx_vec4 v, lx_vec4 min, lx_vec4 max);
  *
  * @return The dot product.
  */
-LX_API float lx_vec4_dot(lx_vec4 a, lx_vec4 b);
+LX_MATH_API float lx_vec4_dot(lx_vec4 a, lx_vec4 b);
 
 /**
  * @brief Computes the magnitude of a 4D vector.
@@ -489,7 +661,7 @@ LX_API float lx_vec4_dot(lx_vec4 a, lx_vec4 b);
  *
  * @return The length of the vector.
  */
-LX_API float lx_vec4_magnitude(lx_vec4 v);
+LX_MATH_API float lx_vec4_magnitude(lx_vec4 v);
 
 /**
  * @brief Computes the squared magnitude of a 4D vector.
@@ -498,7 +670,7 @@ LX_API float lx_vec4_magnitude(lx_vec4 v);
  *
  * @return The squared length of the vector.
  */
-LX_API float lx_vec4_magnitude_squared(lx_vec4 v);
+LX_MATH_API float lx_vec4_magnitude_squared(lx_vec4 v);
 
 /**
  * @brief Checks if two 4D vectors are equal within a given epsilon.
@@ -509,7 +681,7 @@ LX_API float lx_vec4_magnitude_squared(lx_vec4 v);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_vec4_equal(lx_vec4 a, lx_vec4 b, float epsilon);
+LX_MATH_API int lx_vec4_equal(lx_vec4 a, lx_vec4 b, float epsilon);
 
 // mat2
 // ----------------------------------------------------------------
@@ -519,14 +691,14 @@ LX_API int lx_vec4_equal(lx_vec4 a, lx_vec4 b, float epsilon);
  *
  * @return A 2x2 matrix with all elements set to zero.
  */
-LX_API lx_mat2 lx_mat2_zero();
+LX_MATH_API lx_mat2 lx_mat2_zero();
 
 /**
  * @brief Returns a 2x2 identity matrix.
  *
  * @return A 2x2 identity matrix.
  */
-LX_API lx_mat2 lx_mat2_identity();
+LX_MATH_API lx_mat2 lx_mat2_identity();
 
 /**
  * @brief Creates a 2x2 matrix from the top-left of a 3x3 matrix.
@@ -535,7 +707,7 @@ LX_API lx_mat2 lx_mat2_identity();
  *
  * @return A 2x2 matrix.
  */
-LX_API lx_mat2 lx_mat2_from_mat3(lx_mat3 m);
+LX_MATH_API lx_mat2 lx_mat2_from_mat3(lx_mat3 m);
 
 /**
  * @brief Creates a 2x2 matrix from the top-left of a 4x4 matrix.
@@ -544,7 +716,7 @@ LX_API lx_mat2 lx_mat2_from_mat3(lx_mat3 m);
  *
  * @return A 2x2 matrix.
  */
-LX_API lx_mat2 lx_mat2_from_mat4(lx_mat4 m);
+LX_MATH_API lx_mat2 lx_mat2_from_mat4(lx_mat4 m);
 
 /**
  * @brief Adds two 2x2 matrices.
@@ -554,7 +726,7 @@ LX_API lx_mat2 lx_mat2_from_mat4(lx_mat4 m);
  *
  * @return The sum of the matrices.
  */
-LX_API lx_mat2 lx_mat2_add(lx_mat2 a, lx_mat2 b);
+LX_MATH_API lx_mat2 lx_mat2_add(lx_mat2 a, lx_mat2 b);
 
 /**
  * @brief Subtracts one 2x2 matrix from another.
@@ -564,7 +736,7 @@ LX_API lx_mat2 lx_mat2_add(lx_mat2 a, lx_mat2 b);
  *
  * @return The result of a - b.
  */
-LX_API lx_mat2 lx_mat2_sub(lx_mat2 a, lx_mat2 b);
+LX_MATH_API lx_mat2 lx_mat2_sub(lx_mat2 a, lx_mat2 b);
 
 /**
  * @brief Multiplies two 2x2 matrices.
@@ -574,7 +746,7 @@ LX_API lx_mat2 lx_mat2_sub(lx_mat2 a, lx_mat2 b);
  *
  * @return The matrix product a * b.
  */
-LX_API lx_mat2 lx_mat2_mul(lx_mat2 a, lx_mat2 b);
+LX_MATH_API lx_mat2 lx_mat2_mul(lx_mat2 a, lx_mat2 b);
 
 /**
  * @brief Scales a 2x2 matrix by a scalar.
@@ -584,7 +756,7 @@ LX_API lx_mat2 lx_mat2_mul(lx_mat2 a, lx_mat2 b);
  *
  * @return The scaled matrix.
  */
-LX_API lx_mat2 lx_mat2_scale_by_scalar(lx_mat2 a, float scale);
+LX_MATH_API lx_mat2 lx_mat2_scale_by_scalar(lx_mat2 a, float scale);
 
 /**
  * @brief Returns the transpose of a 2x2 matrix.
@@ -593,7 +765,7 @@ LX_API lx_mat2 lx_mat2_scale_by_scalar(lx_mat2 a, float scale);
  *
  * @return The transposed matrix.
  */
-LX_API lx_mat2 lx_mat2_transpose(lx_mat2 m);
+LX_MATH_API lx_mat2 lx_mat2_transpose(lx_mat2 m);
 
 /**
  * @brief Returns the inverse of a 2x2 matrix.
@@ -602,7 +774,7 @@ LX_API lx_mat2 lx_mat2_transpose(lx_mat2 m);
  *
  * @return The inverse matrix.
  */
-LX_API lx_mat2 lx_mat2_inverse(lx_mat2 m);
+LX_MATH_API lx_mat2 lx_mat2_inverse(lx_mat2 m);
 
 /**
  * @brief Multiplies a 2x2 matrix by a 2D vector.
@@ -612,7 +784,7 @@ LX_API lx_mat2 lx_mat2_inverse(lx_mat2 m);
  *
  * @return The resulting vector.
  */
-LX_API lx_vec2 lx_mat2_mul_vec2(lx_mat2 m, lx_vec2 v);
+LX_MATH_API lx_vec2 lx_mat2_mul_vec2(lx_mat2 m, lx_vec2 v);
 
 /**
  * @brief Checks if two 2x2 matrices are equal within a given epsilon.
@@ -623,7 +795,7 @@ LX_API lx_vec2 lx_mat2_mul_vec2(lx_mat2 m, lx_vec2 v);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_mat2_equal(lx_mat2 a, lx_mat2 b, float epsilon);
+LX_MATH_API int lx_mat2_equal(lx_mat2 a, lx_mat2 b, float epsilon);
 
 // mat3
 // ----------------------------------------------------------------
@@ -633,14 +805,14 @@ LX_API int lx_mat2_equal(lx_mat2 a, lx_mat2 b, float epsilon);
  *
  * @return A 3x3 matrix with all elements set to zero.
  */
-LX_API lx_mat3 lx_mat3_zero();
+LX_MATH_API lx_mat3 lx_mat3_zero();
 
 /**
  * @brief Returns a 3x3 identity matrix.
  *
  * @return A 3x3 identity matrix.
  */
-LX_API lx_mat3 lx_mat3_identity();
+LX_MATH_API lx_mat3 lx_mat3_identity();
 
 /**
  * @brief Creates a 3x3 matrix from a 2x2 matrix (fills remaining values with
@@ -650,7 +822,7 @@ LX_API lx_mat3 lx_mat3_identity();
  *
  * @return A 3x3 matrix.
  */
-LX_API lx_mat3 lx_mat3_from_mat2(lx_mat2 m);
+LX_MATH_API lx_mat3 lx_mat3_from_mat2(lx_mat2 m);
 
 /**
  * @brief Creates a 3x3 matrix from the top-left of a 4x4 matrix.
@@ -659,7 +831,7 @@ LX_API lx_mat3 lx_mat3_from_mat2(lx_mat2 m);
  *
  * @return A 3x3 matrix.
  */
-LX_API lx_mat3 lx_mat3_from_mat4(lx_mat4 m);
+LX_MATH_API lx_mat3 lx_mat3_from_mat4(lx_mat4 m);
 
 /**
  * @brief Adds two 3x3 matrices.
@@ -669,7 +841,7 @@ LX_API lx_mat3 lx_mat3_from_mat4(lx_mat4 m);
  *
  * @return The sum of the matrices.
  */
-LX_API lx_mat3 lx_mat3_add(lx_mat3 a, lx_mat3 b);
+LX_MATH_API lx_mat3 lx_mat3_add(lx_mat3 a, lx_mat3 b);
 
 /**
  * @brief Subtracts one 3x3 matrix from another.
@@ -679,7 +851,7 @@ LX_API lx_mat3 lx_mat3_add(lx_mat3 a, lx_mat3 b);
  *
  * @return The result of a - b.
  */
-LX_API lx_mat3 lx_mat3_sub(lx_mat3 a, lx_mat3 b);
+LX_MATH_API lx_mat3 lx_mat3_sub(lx_mat3 a, lx_mat3 b);
 
 /**
  * @brief Multiplies two 3x3 matrices.
@@ -689,7 +861,7 @@ LX_API lx_mat3 lx_mat3_sub(lx_mat3 a, lx_mat3 b);
  *
  * @return The matrix product a * b.
  */
-LX_API lx_mat3 lx_mat3_mul(lx_mat3 a, lx_mat3 b);
+LX_MATH_API lx_mat3 lx_mat3_mul(lx_mat3 a, lx_mat3 b);
 
 /**
  * @brief Scales a 3x3 matrix by a scalar.
@@ -699,7 +871,7 @@ LX_API lx_mat3 lx_mat3_mul(lx_mat3 a, lx_mat3 b);
  *
  * @return The scaled matrix.
  */
-LX_API lx_mat3 lx_mat3_scale_by_scalar(lx_mat3 a, float scale);
+LX_MATH_API lx_mat3 lx_mat3_scale_by_scalar(lx_mat3 a, float scale);
 
 /**
  * @brief Returns the transpose of a 3x3 matrix.
@@ -708,7 +880,7 @@ LX_API lx_mat3 lx_mat3_scale_by_scalar(lx_mat3 a, float scale);
  *
  * @return The transposed matrix.
  */
-LX_API lx_mat3 lx_mat3_transpose(lx_mat3 m);
+LX_MATH_API lx_mat3 lx_mat3_transpose(lx_mat3 m);
 
 /**
  * @brief Returns the inverse of a 3x3 matrix.
@@ -717,7 +889,7 @@ LX_API lx_mat3 lx_mat3_transpose(lx_mat3 m);
  *
  * @return The inverse matrix.
  */
-LX_API lx_mat3 lx_mat3_inverse(lx_mat3 m);
+LX_MATH_API lx_mat3 lx_mat3_inverse(lx_mat3 m);
 
 /**
  * @brief Multiplies a 3x3 matrix by a 3D vector.
@@ -727,7 +899,7 @@ LX_API lx_mat3 lx_mat3_inverse(lx_mat3 m);
  *
  * @return The resulting vector.
  */
-LX_API lx_vec3 lx_mat3_mul_vec3(lx_mat3 m, lx_vec3 v);
+LX_MATH_API lx_vec3 lx_mat3_mul_vec3(lx_mat3 m, lx_vec3 v);
 
 /**
  * @brief Checks if two 3x3 matrices are equal within a given epsilon.
@@ -738,7 +910,7 @@ LX_API lx_vec3 lx_mat3_mul_vec3(lx_mat3 m, lx_vec3 v);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_mat3_equal(lx_mat3 a, lx_mat3 b, float epsilon);
+LX_MATH_API int lx_mat3_equal(lx_mat3 a, lx_mat3 b, float epsilon);
 
 // mat4
 // ----------------------------------------------------------------
@@ -748,14 +920,14 @@ LX_API int lx_mat3_equal(lx_mat3 a, lx_mat3 b, float epsilon);
  *
  * @return A 4x4 matrix with all elements set to zero.
  */
-LX_API lx_mat4 lx_mat4_zero();
+LX_MATH_API lx_mat4 lx_mat4_zero();
 
 /**
  * @brief Returns a 4x4 identity matrix.
  *
  * @return A 4x4 identity matrix.
  */
-LX_API lx_mat4 lx_mat4_identity();
+LX_MATH_API lx_mat4 lx_mat4_identity();
 
 /**
  * @brief Creates a 4x4 matrix from a 2x2 matrix (fills remaining values with
@@ -765,7 +937,7 @@ LX_API lx_mat4 lx_mat4_identity();
  *
  * @return A 4x4 matrix.
  */
-LX_API lx_mat4 lx_mat4_from_mat2(lx_mat2 m);
+LX_MATH_API lx_mat4 lx_mat4_from_mat2(lx_mat2 m);
 
 /**
  * @brief Creates a 4x4 matrix from a 3x3 matrix (fills remaining values with
@@ -775,7 +947,7 @@ LX_API lx_mat4 lx_mat4_from_mat2(lx_mat2 m);
  *
  * @return A 4x4 matrix.
  */
-LX_API lx_mat4 lx_mat4_from_mat3(lx_mat3 m);
+LX_MATH_API lx_mat4 lx_mat4_from_mat3(lx_mat3 m);
 
 /**
  * @brief Adds two 4x4 matrices.
@@ -785,7 +957,7 @@ LX_API lx_mat4 lx_mat4_from_mat3(lx_mat3 m);
  *
  * @return The sum of the matrices.
  */
-LX_API lx_mat4 lx_mat4_add(lx_mat4 a, lx_mat4 b);
+LX_MATH_API lx_mat4 lx_mat4_add(lx_mat4 a, lx_mat4 b);
 
 /**
  * @brief Subtracts one 4x4 matrix from another.
@@ -795,7 +967,7 @@ LX_API lx_mat4 lx_mat4_add(lx_mat4 a, lx_mat4 b);
  *
  * @return The result of a - b.
  */
-LX_API lx_mat4 lx_mat4_sub(lx_mat4 a, lx_mat4 b);
+LX_MATH_API lx_mat4 lx_mat4_sub(lx_mat4 a, lx_mat4 b);
 
 /**
  * @brief Multiplies two 4x4 matrices.
@@ -805,7 +977,7 @@ LX_API lx_mat4 lx_mat4_sub(lx_mat4 a, lx_mat4 b);
  *
  * @return The matrix product a * b.
  */
-LX_API lx_mat4 lx_mat4_mul(lx_mat4 a, lx_mat4 b);
+LX_MATH_API lx_mat4 lx_mat4_mul(lx_mat4 a, lx_mat4 b);
 
 /**
  * @brief Scales a 4x4 matrix by a scalar.
@@ -815,7 +987,7 @@ LX_API lx_mat4 lx_mat4_mul(lx_mat4 a, lx_mat4 b);
  *
  * @return The scaled matrix.
  */
-LX_API lx_mat4 lx_mat4_scale_by_scalar(lx_mat4 a, float scale);
+LX_MATH_API lx_mat4 lx_mat4_scale_by_scalar(lx_mat4 a, float scale);
 
 /**
  * @brief Returns the transpose of a 4x4 matrix.
@@ -824,7 +996,7 @@ LX_API lx_mat4 lx_mat4_scale_by_scalar(lx_mat4 a, float scale);
  *
  * @return The transposed matrix.
  */
-LX_API lx_mat4 lx_mat4_transpose(lx_mat4 m);
+LX_MATH_API lx_mat4 lx_mat4_transpose(lx_mat4 m);
 
 /**
  * @brief Returns the inverse of a 4x4 matrix.
@@ -833,7 +1005,58 @@ LX_API lx_mat4 lx_mat4_transpose(lx_mat4 m);
  *
  * @return The inverse matrix.
  */
-LX_API lx_mat4 lx_mat4_inverse(lx_mat4 m);
+LX_MATH_API lx_mat4 lx_mat4_inverse(lx_mat4 m);
+
+/**
+ * @brief Inverts an affine 4x4 matrix, one whose bottom row is (0, 0, 0, 1),
+ * such as any combination of translations, rotations and scales.
+ *
+ * Only the upper 3x3 is inverted, the translation is then rotated back by it.
+ * lx_mat4_inverse takes this path itself for affine matrices.
+ *
+ * @param m The affine matrix to invert.
+ *
+ * @return The inverse matrix, or a zero matrix if m is singular.
+ */
+LX_MATH_API lx_mat4 lx_mat4_inverse_affine(lx_mat4 m);
+
+/**
+ * @brief Inverts a rigid 4x4 matrix, made only of rotations and translations,
+ * such as a view matrix from lx_mat4_look_at.
+ *
+ * The rotation is inverted by transposing it, so the result is wrong for
+ * matrices which scale or shear.
+ *
+ * @param m The rigid matrix to invert.
+ *
+ * @return The inverse matrix.
+ */
+LX_MATH_API lx_mat4 lx_mat4_inverse_rigid(lx_mat4 m);
+
+/**
+ * @brief Finds the most specific kind of a 4x4 matrix, to pick the cheapest
+ * correct inverse with lx_mat4_inverse_as.
+ *
+ * Checking for a rigid matrix costs about as much as an affine inverse, so
+ * classify once and keep the result when the same kind of matrix is inverted
+ * often.
+ *
+ * @param m The matrix to classify.
+ * @param epsilon The tolerance for the rotation being orthonormal.
+ *
+ * @return LX_MAT4_RIGID, LX_MAT4_AFFINE or LX_MAT4_GENERAL.
+ */
+LX_MATH_API lx_mat4_kind lx_mat4_classify(lx_mat4 m, float epsilon);
+
+/**
+ * @brief Inverts a 4x4 matrix of a known kind.
+ *
+ * @param m The matrix to invert.
+ * @param kind The kind of m, as returned by lx_mat4_classify.
+ *
+ * @return The inverse matrix.
+ */
+LX_MATH_API lx_mat4 lx_mat4_inverse_as(lx_mat4 m, lx_mat4_kind kind);
 
 /**
  * @brief Applies a translation to the given 4x4 matrix.
@@ -843,7 +1066,7 @@ LX_API lx_mat4 lx_mat4_inverse(lx_mat4 m);
  *
  * @return The translated matrix.
  */
-LX_API lx_mat4 lx_mat4_translate(lx_mat4 m, lx_vec3 translation);
+LX_MATH_API lx_mat4 lx_mat4_translate(lx_mat4 m, lx_vec3 translation);
 
 /**
  * @brief Applies scaling to the given 4x4 matrix.
@@ -853,7 +1076,7 @@ LX_API lx_mat4 lx_mat4_translate(lx_mat4 m, lx_vec3 translation);
  *
  * @return The scaled matrix.
  */
-LX_API lx_mat4 lx_mat4_scale(lx_mat4 m, lx_vec3 scale);
+LX_MATH_API lx_mat4 lx_mat4_scale(lx_mat4 m, lx_vec3 scale);
 
 /**
  * @brief Rotates a 4x4 matrix around an arbitrary axis by a specified angle.
@@ -867,7 +1090,7 @@ LX_API lx_mat4 lx_mat4_scale(lx_mat4 m, lx_vec3 scale);
  *
  * @return The rotated matrix.
  */
-LX_API lx_mat4 lx_mat4_rotate(lx_mat4 m, lx_vec3 axis, float degrees);
+LX_MATH_API lx_mat4 lx_mat4_rotate(lx_mat4 m, lx_vec3 axis, float degrees);
 
 /**
  * @brief Creates a view matrix for a camera looking from eye towards center, with the specified up vector.
@@ -878,7 +1101,7 @@ LX_API lx_mat4 lx_mat4_rotate(lx_mat4 m, lx_vec3 axis, float degrees);
  *
  * @return The resulting view matrix.
  */
-LX_API lx_mat4 lx_mat4_look_at(lx_vec3 eye, lx_vec3 center, lx_vec3 up);
+LX_MATH_API lx_mat4 lx_mat4_look_at(lx_vec3 eye, lx_vec3 center, lx_vec3 up);
 
 
 /**
@@ -891,7 +1114,23 @@ LX_API lx_mat4 lx_mat4_look_at(lx_vec3 eye, lx_vec3 center, lx_vec3 up);
  *
  * @return The perspective projection matrix.
  */
-LX_API lx_mat4 lx_mat4_perspective(float fov, float aspect, float near, float far);
+LX_MATH_API lx_mat4 lx_mat4_perspective(float fov, float aspect, float near, float far);
+
+/**
+ * @brief Creates a perspective projection matrix with reversed depth and no far
+ * plane, mapping the near plane to a depth of 1 and infinity to 0.
+ *
+ * Floating point depth keeps its precision far from the camera this way. The
+ * matrix expects clip space depth of 0 to 1, as set by glClipControl with
+ * GL_ZERO_TO_ONE, a depth clear of 0 and a GL_GREATER depth test.
+ *
+ * @param fov The vertical field of view in degrees.
+ * @param aspect The aspect ratio (width divided by height).
+ * @param near The near clipping plane distance.
+ *
+ * @return The perspective projection matrix.
+ */
+LX_MATH_API lx_mat4 lx_mat4_perspective_reversed(float fov, float aspect, float near);
 
 /**
  * @brief Creates an orthographic projection matrix.
@@ -905,7 +1144,7 @@ LX_API lx_mat4 lx_mat4_perspective(float fov, float aspect, float near, float fa
  *
  * @return The orthographic projection matrix.
  */
-LX_API lx_mat4 lx_mat4_orthographic(float left, float right, float bottom, float top, float near, float far);
+LX_MATH_API lx_mat4 lx_mat4_orthographic(float left, float right, float bottom, float top, float near, float far);
 
 /**
  * @brief Multiplies a 4x4 matrix by a 4D vector.
@@ -915,7 +1154,7 @@ LX_API lx_mat4 lx_mat4_orthographic(float left, float right, float bottom, float
  *
  * @return The resulting vector.
  */
-LX_API lx_vec4 lx_mat4_mul_vec4(lx_mat4 m, lx_vec4 v);
+LX_MATH_API lx_vec4 lx_mat4_mul_vec4(lx_mat4 m, lx_vec4 v);
 
 /**
  * @brief Checks if two 4x4 matrices are equal within a given epsilon.
@@ -926,6 +1165,767 @@ LX_API lx_vec4 lx_mat4_mul_vec4(lx_mat4 m, lx_vec4 v);
  *
  * @return 1 if equal within epsilon, otherwise 0.
  */
-LX_API int lx_mat4_equal(lx_mat4 a, lx_mat4 b, float epsilon);
+LX_MATH_API int lx_mat4_equal(lx_mat4 a, lx_mat4 b, float epsilon);
+
+/**
+ * @brief Computes the normal matrix of a 4x4 matrix, the inverse transpose of
+ * its upper 3x3.
+ *
+ * @param m The model matrix.
+ *
+ * @return The normal matrix, or a zero matrix if m is singular.
+ */
+LX_MATH_API lx_mat3 lx_mat4_normal_matrix(lx_mat4 m);
+
+// quat
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates an identity quaternion, representing no rotation.
+ *
+ * @return The identity quaternion.
+ */
+LX_MATH_API lx_quat lx_quat_identity();
+
+/**
+ * @brief Creates a quaternion rotating around an axis, matching
+ * lx_mat4_rotate.
+ *
+ * @param axis The axis of rotation, this does not need to be normalized.
+ * @param degrees The angle in degrees.
+ *
+ * @return The rotation quaternion.
+ */
+LX_MATH_API lx_quat lx_quat_from_axis_angle(lx_vec3 axis, float degrees);
+
+/**
+ * @brief Multiplies two quaternions, the result applies b and then a.
+ *
+ * @param a The first quaternion.
+ * @param b The second quaternion.
+ *
+ * @return The product a * b.
+ */
+LX_MATH_API lx_quat lx_quat_mul(lx_quat a, lx_quat b);
+
+/**
+ * @brief Computes the conjugate of a quaternion, the inverse rotation of a
+ * unit quaternion.
+ *
+ * @param q The quaternion.
+ *
+ * @return The conjugate quaternion.
+ */
+LX_MATH_API lx_quat lx_quat_conjugate(lx_quat q);
+
+/**
+ * @brief Normalizes a quaternion.
+ *
+ * @param q The quaternion to normalize.
+ *
+ * @return The unit quaternion, or the identity if q has zero length.
+ */
+LX_MATH_API lx_quat lx_quat_normalize(lx_quat q);
+
+/**
+ * @brief Computes the dot product of two quaternions.
+ *
+ * @param a The first quaternion.
+ * @param b The second quaternion.
+ *
+ * @return The dot product.
+ */
+LX_MATH_API float lx_quat_dot(lx_quat a, lx_quat b);
+
+/**
+ * @brief Interpolates between two unit quaternions along the shortest path by
+ * lerping and normalizing, cheaper than lx_quat_slerp but without a constant
+ * angular velocity.
+ *
+ * @param a The rotation at t = 0.
+ * @param b The rotation at t = 1.
+ * @param t The interpolation factor.
+ *
+ * @return The interpolated unit quaternion.
+ */
+LX_MATH_API lx_quat lx_quat_nlerp(lx_quat a, lx_quat b, float t);
+
+/**
+ * @brief Spherically interpolates between two unit quaternions along the
+ * shortest path.
+ *
+ * @param a The rotation at t = 0.
+ * @param b The rotation at t = 1.
+ * @param t The interpolation factor.
+ *
+ * @return The interpolated unit quaternion.
+ */
+LX_MATH_API lx_quat lx_quat_slerp(lx_quat a, lx_quat b, float t);
+
+/**
+ * @brief Rotates a 3D vector by a unit quaternion.
+ *
+ * @param q The rotation.
+ * @param v The vector to rotate.
+ *
+ * @return The rotated vector.
+ */
+LX_MATH_API lx_vec3 lx_quat_rotate_vec3(lx_quat q, lx_vec3 v);
+
+/**
+ * @brief Converts a unit quaternion to a 3x3 rotation matrix.
+ *
+ * @param q The rotation.
+ *
+ * @return The rotation matrix.
+ */
+LX_MATH_API lx_mat3 lx_quat_to_mat3(lx_quat q);
+
+/**
+ * @brief Converts a unit quaternion to a 4x4 rotation matrix.
+ *
+ * @param q The rotation.
+ *
+ * @return The rotation matrix.
+ */
+LX_MATH_API lx_mat4 lx_quat_to_mat4(lx_quat q);
+
+/**
+ * @brief Checks if two quaternions are equal within a given epsilon.
+ *
+ * q and -q represent the same rotation but are not considered equal.
+ *
+ * @param a First quaternion.
+ * @param b Second quaternion.
+ * @param epsilon Tolerance for comparison.
+ *
+ * @return 1 if equal within epsilon, otherwise 0.
+ */
+LX_MATH_API int lx_quat_equal(lx_quat a, lx_quat b, float epsilon);
+
+/**
+ * @brief Builds a model matrix from a translation, rotation and scale in one
+ * step, equal to translating, then rotating, then scaling the identity.
+ *
+ * @param translation The translation.
+ * @param rotation The rotation, a unit quaternion.
+ * @param scale The scale along each local axis.
+ *
+ * @return The model matrix.
+ */
+LX_MATH_API lx_mat4 lx_mat4_from_trs(lx_vec3 translation, lx_quat rotation, lx_vec3 scale);
+
+// out parameters
+// ----------------------------------------------------------------
+
+// variants of the mat4 functions which read their operands through pointers
+// and write the result to out, avoiding the copies of 64 byte matrices in and
+// out of every call. out may always be the same matrix as an operand.
+
+/**
+ * @brief Multiplies two 4x4 matrices, as lx_mat4_mul.
+ *
+ * @param out Receives a * b.
+ * @param a Left matrix.
+ * @param b Right matrix.
+ */
+LX_MATH_API void lx_mat4_mul_to(lx_mat4* out, const lx_mat4* a, const lx_mat4* b);
+
+/**
+ * @brief Multiplies a 4D vector by a 4x4 matrix, as lx_mat4_mul_vec4.
+ *
+ * @param out Receives m * v.
+ * @param m The matrix.
+ * @param v The vector.
+ */
+LX_MATH_API void lx_mat4_mul_vec4_to(lx_vec4* out, const lx_mat4* m, const lx_vec4* v);
+
+/**
+ * @brief Inverts a 4x4 matrix, as lx_mat4_inverse.
+ *
+ * @param out Receives the inverse, or a zero matrix if m is singular.
+ * @param m The matrix to invert.
+ */
+LX_MATH_API void lx_mat4_inverse_to(lx_mat4* out, const lx_mat4* m);
+
+/**
+ * @brief Transposes a 4x4 matrix, as lx_mat4_transpose.
+ *
+ * @param out Receives the transposed matrix.
+ * @param m The matrix to transpose.
+ */
+LX_MATH_API void lx_mat4_transpose_to(lx_mat4* out, const lx_mat4* m);
+
+/**
+ * @brief Applies a translation to a 4x4 matrix, as lx_mat4_translate, by
+ * updating the last column rather than multiplying by a full matrix.
+ *
+ * @param out Receives the translated matrix.
+ * @param m The matrix to translate.
+ * @param translation The translation vector.
+ */
+LX_MATH_API void lx_mat4_translate_to(lx_mat4* out, const lx_mat4* m, lx_vec3 translation);
+
+/**
+ * @brief Applies scaling to a 4x4 matrix, as lx_mat4_scale, by scaling the
+ * first three columns rather than multiplying by a full matrix.
+ *
+ * @param out Receives the scaled matrix.
+ * @param m The matrix to scale.
+ * @param scale The scale factors for each axis.
+ */
+LX_MATH_API void lx_mat4_scale_to(lx_mat4* out, const lx_mat4* m, lx_vec3 scale);
+
+/**
+ * @brief Rotates a 4x4 matrix around an axis, as lx_mat4_rotate.
+ *
+ * @param out Receives the rotated matrix.
+ * @param m The matrix to rotate.
+ * @param axis The axis vector around which to rotate.
+ * @param degrees The rotation angle in degrees.
+ */
+LX_MATH_API void lx_mat4_rotate_to(lx_mat4* out, const lx_mat4* m, lx_vec3 axis, float degrees);
+
+/**
+ * @brief Builds a model matrix from a translation, rotation and scale, as
+ * lx_mat4_from_trs.
+ *
+ * @param out Receives the model matrix.
+ * @param translation The translation.
+ * @param rotation The rotation, a unit quaternion.
+ * @param scale The scale along each local axis.
+ */
+LX_MATH_API void lx_mat4_from_trs_to(lx_mat4* out, lx_vec3 translation, lx_quat rotation, lx_vec3 scale);
+
+// batch
+// ----------------------------------------------------------------
+
+/**
+ * @brief Multiplies an array of 4D vectors by a 4x4 matrix.
+ *
+ * @param m The matrix.
+ * @param in The vectors to transform.
+ * @param out The transformed vectors, this may be the same array as in.
+ * @param count The number of vectors.
+ */
+LX_API void lx_mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count);
+
+/**
+ * @brief Multiplies an array of 3D vectors by a 4x4 matrix, treating each
+ * vector as a 4D vector with the given w component.
+ *
+ * Use a w of 1 for points, or 0 for directions which ignore translation. The
+ * w component of the result is discarded.
+ *
+ * @param m The matrix.
+ * @param in The vectors to transform.
+ * @param out The transformed vectors, this may be the same array as in.
+ * @param count The number of vectors.
+ * @param w The implicit w component of every vector.
+ */
+LX_API void lx_mat4_mul_vec3_array(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w);
+
+/**
+ * @brief Multiplies a matrix by an array of 4x4 matrices, such as a view
+ * projection matrix by every model matrix.
+ *
+ * @param a The matrix on the left of every product.
+ * @param in The matrices on the right of each product.
+ * @param out The products a * in[i], this may be the same array as in.
+ * @param count The number of matrices.
+ */
+LX_API void lx_mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count);
+
+/**
+ * @brief Computes the normal matrix for an array of model matrices.
+ *
+ * @param in The model matrices.
+ * @param out The normal matrices, singular models produce a zero matrix.
+ * @param count The number of matrices.
+ */
+LX_API void lx_mat4_normal_matrix_array(const lx_mat4* in, lx_mat3* out, size_t count);
+
+/**
+ * @brief Builds model matrices from arrays of translations, rotations and
+ * scales, as lx_mat4_from_trs.
+ *
+ * @param translations The translations.
+ * @param rotations The rotations, unit quaternions.
+ * @param scales The scales.
+ * @param out The model matrices.
+ * @param count The number of transforms.
+ */
+LX_API void lx_mat4_from_trs_array(const lx_vec3* translations, const lx_quat* rotations, const lx_vec3* scales, lx_mat4* out, size_t count);
+
+// streams
+// ----------------------------------------------------------------
+
+/**
+ * @brief Allocates a 2D vector stream, with one array per component.
+ *
+ * @param count The number of vectors in the stream.
+ *
+ * @return The stream, its arrays are uninitialised and NULL if the allocation
+ * failed.
+ */
+LX_API lx_vec2_stream lx_vec2_stream_create(size_t count);
+
+/**
+ * @brief Frees a 2D vector stream allocated with lx_vec2_stream_create.
+ *
+ * @param s The stream to free, its arrays are set to NULL.
+ */
+LX_API void lx_vec2_stream_destroy(lx_vec2_stream* s);
+
+/**
+ * @brief Adds two 2D vector streams.
+ *
+ * Every stream passed to a stream function must have the same count, any
+ * output may be the same stream as an input.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out The stream receiving a + b.
+ */
+LX_API void lx_vec2_stream_add(const lx_vec2_stream* a, const lx_vec2_stream* b, lx_vec2_stream* out);
+
+/**
+ * @brief Subtracts one 2D vector stream from another.
+ *
+ * @param a The stream to subtract from.
+ * @param b The stream to subtract.
+ * @param out The stream receiving a - b.
+ */
+LX_API void lx_vec2_stream_sub(const lx_vec2_stream* a, const lx_vec2_stream* b, lx_vec2_stream* out);
+
+/**
+ * @brief Scales every vector in a 2D vector stream.
+ *
+ * @param v The stream to scale.
+ * @param scale The scalar to multiply by.
+ * @param out The scaled stream.
+ */
+LX_API void lx_vec2_stream_scale(const lx_vec2_stream* v, float scale, lx_vec2_stream* out);
+
+/**
+ * @brief Computes the dot product of each pair of vectors in two 2D vector
+ * streams.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out An array of a->count dot products.
+ */
+LX_API void lx_vec2_stream_dot(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out);
+
+/**
+ * @brief Normalizes every vector in a 2D vector stream.
+ *
+ * @param v The stream to normalize.
+ * @param out The normalized stream, zero length vectors stay zero.
+ */
+LX_API void lx_vec2_stream_normalize(const lx_vec2_stream* v, lx_vec2_stream* out);
+
+/**
+ * @brief Linearly interpolates between each pair of vectors in two 2D vector
+ * streams.
+ *
+ * @param a The stream at t = 0.
+ * @param b The stream at t = 1.
+ * @param t The interpolation factor.
+ * @param out The interpolated stream.
+ */
+LX_API void lx_vec2_stream_lerp(const lx_vec2_stream* a, const lx_vec2_stream* b, float t, lx_vec2_stream* out);
+
+/**
+ * @brief Clamps every vector in a 2D vector stream between a minimum and
+ * maximum, per component.
+ *
+ * @param v The stream to clamp.
+ * @param min The minimum vector.
+ * @param max The maximum vector.
+ * @param out The clamped stream.
+ */
+LX_API void lx_vec2_stream_clamp(const lx_vec2_stream* v, lx_vec2 min, lx_vec2 max, lx_vec2_stream* out);
+
+/**
+ * @brief Computes the distance between each pair of vectors in two 2D vector
+ * streams.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out An array of a->count distances.
+ */
+LX_API void lx_vec2_stream_distance(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out);
+
+/**
+ * @brief Finds the per component minimum of a 2D vector stream.
+ *
+ * @param v The stream to reduce.
+ *
+ * @return The minimum of each component, or infinity if the stream is empty.
+ */
+LX_API lx_vec2 lx_vec2_stream_min(const lx_vec2_stream* v);
+
+/**
+ * @brief Finds the per component maximum of a 2D vector stream.
+ *
+ * @param v The stream to reduce.
+ *
+ * @return The maximum of each component, or negative infinity if the stream is
+ * empty.
+ */
+LX_API lx_vec2 lx_vec2_stream_max(const lx_vec2_stream* v);
+
+/**
+ * @brief Allocates a 3D vector stream, with one array per component.
+ *
+ * @param count The number of vectors in the stream.
+ *
+ * @return The stream, its arrays are uninitialised and NULL if the allocation
+ * failed.
+ */
+LX_API lx_vec3_stream lx_vec3_stream_create(size_t count);
+
+/**
+ * @brief Frees a 3D vector stream allocated with lx_vec3_stream_create.
+ *
+ * @param s The stream to free, its arrays are set to NULL.
+ */
+LX_API void lx_vec3_stream_destroy(lx_vec3_stream* s);
+
+/**
+ * @brief Adds two 3D vector streams.
+ *
+ * Every stream passed to a stream function must have the same count, any
+ * output may be the same stream as an input.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out The stream receiving a + b.
+ */
+LX_API void lx_vec3_stream_add(const lx_vec3_stream* a, const lx_vec3_stream* b, lx_vec3_stream* out);
+
+/**
+ * @brief Subtracts one 3D vector stream from another.
+ *
+ * @param a The stream to subtract from.
+ * @param b The stream to subtract.
+ * @param out The stream receiving a - b.
+ */
+LX_API void lx_vec3_stream_sub(const lx_vec3_stream* a, const lx_vec3_stream* b, lx_vec3_stream* out);
+
+/**
+ * @brief Scales every vector in a 3D vector stream.
+ *
+ * @param v The stream to scale.
+ * @param scale The scalar to multiply by.
+ * @param out The scaled stream.
+ */
+LX_API void lx_vec3_stream_scale(const lx_vec3_stream* v, float scale, lx_vec3_stream* out);
+
+/**
+ * @brief Computes the dot product of each pair of vectors in two 3D vector
+ * streams.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out An array of a->count dot products.
+ */
+LX_API void lx_vec3_stream_dot(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out);
+
+/**
+ * @brief Computes the cross product of each pair of vectors in two 3D vector
+ * streams.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out The stream receiving a x b.
+ */
+LX_API void lx_vec3_stream_cross(const lx_vec3_stream* a, const lx_vec3_stream* b, lx_vec3_stream* out);
+
+/**
+ * @brief Normalizes every vector in a 3D vector stream.
+ *
+ * @param v The stream to normalize.
+ * @param out The normalized stream, zero length vectors stay zero.
+ */
+LX_API void lx_vec3_stream_normalize(const lx_vec3_stream* v, lx_vec3_stream* out);
+
+/**
+ * @brief Linearly interpolates between each pair of vectors in two 3D vector
+ * streams.
+ *
+ * @param a The stream at t = 0.
+ * @param b The stream at t = 1.
+ * @param t The interpolation factor.
+ * @param out The interpolated stream.
+ */
+LX_API void lx_vec3_stream_lerp(const lx_vec3_stream* a, const lx_vec3_stream* b, float t, lx_vec3_stream* out);
+
+/**
+ * @brief Clamps every vector in a 3D vector stream between a minimum and
+ * maximum, per component.
+ *
+ * @param v The stream to clamp.
+ * @param min The minimum vector.
+ * @param max The maximum vector.
+ * @param out The clamped stream.
+ */
+LX_API void lx_vec3_stream_clamp(const lx_vec3_stream* v, lx_vec3 min, lx_vec3 max, lx_vec3_stream* out);
+
+/**
+ * @brief Computes the distance between each pair of vectors in two 3D vector
+ * streams.
+ *
+ * @param a The first stream.
+ * @param b The second stream.
+ * @param out An array of a->count distances.
+ */
+LX_API void lx_vec3_stream_distance(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out);
+
+/**
+ * @brief Finds the per component minimum of a 3D vector stream.
+ *
+ * @param v The stream to reduce.
+ *
+ * @return The minimum of each component, or infinity if the stream is empty.
+ */
+LX_API lx_vec3 lx_vec3_stream_min(const lx_vec3_stream* v);
+
+/**
+ * @brief Finds the per component maximum of a 3D vector stream.
+ *
+ * @param v The stream to reduce.
+ *
+ * @return The maximum of each component, or negative infinity if the stream is
+ * empty.
+ */
+LX_API lx_vec3 lx_vec3_stream_max(const lx_vec3_stream* v);
+
+// packing
+// ----------------------------------------------------------------
+
+// compact vertex attribute formats. each pack function has an unpack to check
+// its results against, the packed arrays may be uploaded as they are
+
+/**
+ * @brief Converts floats to half floats, rounding to nearest even. Vector
+ * arrays are packed as arrays of 2 or 3 times as many floats.
+ *
+ * @param in The floats.
+ * @param out The half floats, count of them.
+ * @param count The number of floats.
+ */
+LX_API void lx_pack_half(const float* in, uint16_t* out, size_t count);
+
+/**
+ * @brief Converts half floats back to floats.
+ *
+ * @param in The half floats.
+ * @param out The floats, count of them.
+ * @param count The number of half floats.
+ */
+LX_API void lx_unpack_half(const uint16_t* in, float* out, size_t count);
+
+/**
+ * @brief Packs positions as four snorm16 components, relative to the bounds
+ * of the array. The fourth is always 1, so the attribute may be read as a
+ * homogeneous position.
+ *
+ * The original positions are offset + scale * snorm, for the vertex shader or
+ * a model matrix to apply.
+ *
+ * @param in The positions.
+ * @param out The packed positions, 4 * count of them.
+ * @param count The number of positions.
+ * @param scale Receives the half extent of the bounds, 1 on axes without any.
+ * @param offset Receives the center of the bounds.
+ */
+LX_API void lx_pack_positions(const lx_vec3* in, int16_t* out, size_t count, lx_vec3* scale, lx_vec3* offset);
+
+/**
+ * @brief Unpacks positions packed by lx_pack_positions.
+ *
+ * @param in The packed positions.
+ * @param out The positions, count of them.
+ * @param count The number of positions.
+ * @param scale The scale given by lx_pack_positions.
+ * @param offset The offset given by lx_pack_positions.
+ */
+LX_API void lx_unpack_positions(const int16_t* in, lx_vec3* out, size_t count, lx_vec3 scale, lx_vec3 offset);
+
+/**
+ * @brief Packs unit normals as two snorm16 components, by octahedral mapping.
+ *
+ * @param in The normals.
+ * @param out The packed normals, 2 * count of them.
+ * @param count The number of normals.
+ */
+LX_API void lx_pack_normals(const lx_vec3* in, int16_t* out, size_t count);
+
+/**
+ * @brief Unpacks normals packed by lx_pack_normals.
+ *
+ * @param in The packed normals.
+ * @param out The unit normals, count of them.
+ * @param count The number of normals.
+ */
+LX_API void lx_unpack_normals(const int16_t* in, lx_vec3* out, size_t count);
+
+/**
+ * @brief Packs tangents into the GL_INT_2_10_10_10_REV format, x, y and z as
+ * snorm10 and the sign of w, the handedness of the bitangent, as snorm2.
+ *
+ * @param in The tangents, with w of 1 or -1.
+ * @param out The packed tangents, count of them.
+ * @param count The number of tangents.
+ */
+LX_API void lx_pack_tangents(const lx_vec4* in, uint32_t* out, size_t count);
+
+/**
+ * @brief Unpacks tangents packed by lx_pack_tangents.
+ *
+ * @param in The packed tangents.
+ * @param out The tangents, count of them.
+ * @param count The number of tangents.
+ */
+LX_API void lx_unpack_tangents(const uint32_t* in, lx_vec4* out, size_t count);
+
+/**
+ * @brief Packs colors as four unorm8 components, in the order r, g, b, a.
+ * Components are clamped to 0 to 1.
+ *
+ * @param in The colors.
+ * @param out The packed colors, 4 * count of them.
+ * @param count The number of colors.
+ */
+LX_API void lx_pack_colors(const lx_vec4* in, uint8_t* out, size_t count);
+
+/**
+ * @brief Unpacks colors packed by lx_pack_colors.
+ *
+ * @param in The packed colors.
+ * @param out The colors, count of them.
+ * @param count The number of colors.
+ */
+LX_API void lx_unpack_colors(const uint8_t* in, lx_vec4* out, size_t count);
+
+// random
+// ----------------------------------------------------------------
+
+// a seed and stream give the same integers and floats from 0 to 1 whatever
+// the simd level, values derived from them agree to rounding. the fills step
+// every generator once per 8 values, the single value calls take turns
+// between them, so the two may be mixed freely
+
+/**
+ * @brief Seeds a random number generator. Generators sharing a seed with
+ * different streams are independent, give each thread or job its own.
+ *
+ * @param rng The generator.
+ * @param seed The seed.
+ * @param stream The stream.
+ */
+LX_API void lx_rng_seed(lx_rng* rng, uint64_t seed, uint64_t stream);
+
+/**
+ * @brief Draws a random 32 bit integer.
+ *
+ * @param rng The generator.
+ * @return The integer.
+ */
+LX_API uint32_t lx_rng_next_u32(lx_rng* rng);
+
+/**
+ * @brief Draws a random float from 0 up to but excluding 1.
+ *
+ * @param rng The generator.
+ * @return The float.
+ */
+LX_API float lx_rng_next_float(lx_rng* rng);
+
+/**
+ * @brief Draws a random float from min up to max.
+ *
+ * @param rng The generator.
+ * @param min The lower bound.
+ * @param max The upper bound.
+ * @return The float.
+ */
+LX_API float lx_rng_next_range(lx_rng* rng, float min, float max);
+
+/**
+ * @brief Fills an array with random floats from 0 up to but excluding 1.
+ *
+ * @param rng The generator.
+ * @param out The floats, count of them.
+ * @param count The number of floats.
+ */
+LX_API void lx_rng_fill_floats(lx_rng* rng, float* out, size_t count);
+
+/**
+ * @brief Fills an array with random floats from min up to max.
+ *
+ * @param rng The generator.
+ * @param out The floats, count of them.
+ * @param count The number of floats.
+ * @param min The lower bound.
+ * @param max The upper bound.
+ */
+LX_API void lx_rng_fill_range(lx_rng* rng, float* out, size_t count, float min, float max);
+
+/**
+ * @brief Fills an array with random directions, spread evenly over the unit
+ * sphere.
+ *
+ * @param rng The generator.
+ * @param out The unit vectors, count of them.
+ * @param count The number of vectors.
+ */
+LX_API void lx_rng_fill_unit_vec3(lx_rng* rng, lx_vec3* out, size_t count);
+
+/**
+ * @brief Fills an array with random points spread evenly through the unit
+ * ball.
+ *
+ * @param rng The generator.
+ * @param out The points, count of them.
+ * @param count The number of points.
+ */
+LX_API void lx_rng_fill_in_sphere(lx_rng* rng, lx_vec3* out, size_t count);
+
+// noise
+// ----------------------------------------------------------------
+
+// simplex noise, smooth and roughly from -1 to 1 with features about a unit
+// apart. positions are scaled for frequency and offset for a different field
+
+/**
+ * @brief Evaluates 2D simplex noise at an array of positions.
+ *
+ * @param in The positions.
+ * @param out The noise values, count of them.
+ * @param count The number of positions.
+ */
+LX_API void lx_noise_simplex2(const lx_vec2* in, float* out, size_t count);
+
+/**
+ * @brief Evaluates 3D simplex noise at an array of positions.
+ *
+ * @param in The positions.
+ * @param out The noise values, count of them.
+ * @param count The number of positions.
+ */
+LX_API void lx_noise_simplex3(const lx_vec3* in, float* out, size_t count);
+
+// inline definitions
+// ----------------------------------------------------------------
+
+#ifdef LX_MATH_INLINE_DEFINITIONS
+    #include "inline/math_utility.h"
+    #include "inline/math_vector.h"
+    #include "inline/math_matrix.h"
+    #include "inline/math_quat.h"
+#endif
 
 LX_END_HEADER
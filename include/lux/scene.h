@@ -0,0 +1,491 @@
+#pragma once
+
+#include "api.h"
+#include "math.h"
+#include "spatial.h"
+LX_BEGIN_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+
+// types
+// ----------------------------------------------------------------
+
+typedef struct _lx_hierarchy lx_hierarchy;
+typedef uint32_t lx_node;
+
+#define LX_NODE_NONE UINT32_MAX
+
+// a vertex bound to up to four bones of a palette, unused influences have a
+// weight of 0 and the weights of each vertex sum to 1
+typedef struct _lx_skin_vertex { lx_vec3 position; lx_vec3 normal; uint16_t bones[4]; float weights[4]; } lx_skin_vertex;
+
+// the keys of one animated node, each channel with its own ascending key
+// times, a channel without keys holds the identity
+typedef struct _lx_anim_track
+{
+    const float* translation_times;
+    const lx_vec3* translations;
+    size_t translation_count;
+
+    const float* rotation_times;
+    const lx_quat* rotations;
+    size_t rotation_count;
+
+    const float* scale_times;
+    const lx_vec3* scales;
+    size_t scale_count;
+}
+lx_anim_track;
+
+typedef struct _lx_anim_clip lx_anim_clip;
+typedef struct _lx_anim_cursors lx_anim_cursors;
+
+typedef struct _lx_camera lx_camera;
+
+// hierarchy
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates an empty transform hierarchy.
+ *
+ * Nodes are stored in one flat array with every parent before its children,
+ * so world matrices can be updated in a single pass over it.
+ *
+ * @param capacity The number of nodes to allocate space for, the hierarchy
+ * grows past this as needed.
+ *
+ * @return The hierarchy, or NULL on failure.
+ */
+LX_API lx_hierarchy* lx_hierarchy_create(size_t capacity);
+
+/**
+ * @brief Destroys a transform hierarchy, freeing all of its nodes.
+ *
+ * @param h The hierarchy to destroy.
+ */
+LX_API void lx_hierarchy_destroy(lx_hierarchy* h);
+
+/**
+ * @brief Adds a node to a transform hierarchy. The node starts dirty, so its
+ * world matrix is valid after the next update.
+ *
+ * @param h The hierarchy.
+ * @param parent The parent node, or LX_NODE_NONE for a root.
+ * @param translation The local translation.
+ * @param rotation The local rotation, a unit quaternion.
+ * @param scale The local scale.
+ *
+ * @return The new node, or LX_NODE_NONE on failure.
+ */
+LX_API lx_node lx_hierarchy_add(lx_hierarchy* h, lx_node parent, lx_vec3 translation, lx_quat rotation, lx_vec3 scale);
+
+/**
+ * @brief Removes every node from a transform hierarchy, keeping its memory.
+ *
+ * @param h The hierarchy.
+ */
+LX_API void lx_hierarchy_clear(lx_hierarchy* h);
+
+/**
+ * @brief Sets the local translation of a node, marking it dirty.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ * @param translation The local translation.
+ */
+LX_API void lx_hierarchy_set_translation(lx_hierarchy* h, lx_node node, lx_vec3 translation);
+
+/**
+ * @brief Sets the local rotation of a node, marking it dirty.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ * @param rotation The local rotation, a unit quaternion.
+ */
+LX_API void lx_hierarchy_set_rotation(lx_hierarchy* h, lx_node node, lx_quat rotation);
+
+/**
+ * @brief Sets the local scale of a node, marking it dirty.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ * @param scale The local scale.
+ */
+LX_API void lx_hierarchy_set_scale(lx_hierarchy* h, lx_node node, lx_vec3 scale);
+
+/**
+ * @brief Returns the local translation of a node.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ *
+ * @return The local translation.
+ */
+LX_API lx_vec3 lx_hierarchy_get_translation(const lx_hierarchy* h, lx_node node);
+
+/**
+ * @brief Returns the local rotation of a node.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ *
+ * @return The local rotation.
+ */
+LX_API lx_quat lx_hierarchy_get_rotation(const lx_hierarchy* h, lx_node node);
+
+/**
+ * @brief Returns the local scale of a node.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ *
+ * @return The local scale.
+ */
+LX_API lx_vec3 lx_hierarchy_get_scale(const lx_hierarchy* h, lx_node node);
+
+/**
+ * @brief Returns the parent of a node.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ *
+ * @return The parent, or LX_NODE_NONE for a root.
+ */
+LX_API lx_node lx_hierarchy_get_parent(const lx_hierarchy* h, lx_node node);
+
+/**
+ * @brief Returns the number of nodes in a transform hierarchy.
+ *
+ * @param h The hierarchy.
+ *
+ * @return The node count.
+ */
+LX_API size_t lx_hierarchy_get_count(const lx_hierarchy* h);
+
+/**
+ * @brief Recomputes the world matrices of every dirty node and of all nodes
+ * below them, leaving unchanged subtrees untouched.
+ *
+ * @param h The hierarchy.
+ *
+ * @return The number of world matrices recomputed.
+ */
+LX_API size_t lx_hierarchy_update(lx_hierarchy* h);
+
+/**
+ * @brief Checks if the world matrix of a node was recomputed by the last
+ * update, for example to only upload changed matrices.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ *
+ * @return 1 if recomputed, otherwise 0.
+ */
+LX_API int lx_hierarchy_was_updated(const lx_hierarchy* h, lx_node node);
+
+/**
+ * @brief Returns the world matrix of a node as of the last update.
+ *
+ * @param h The hierarchy.
+ * @param node The node.
+ *
+ * @return The world matrix.
+ */
+LX_API lx_mat4 lx_hierarchy_get_world(const lx_hierarchy* h, lx_node node);
+
+/**
+ * @brief Returns every world matrix, indexed by node, as of the last update.
+ *
+ * The array is invalidated when nodes are added.
+ *
+ * @param h The hierarchy.
+ *
+ * @return The world matrices.
+ */
+LX_API const lx_mat4* lx_hierarchy_get_worlds(const lx_hierarchy* h);
+
+// skinning
+// ----------------------------------------------------------------
+
+/**
+ * @brief Skins vertices on the cpu with linear blend skinning, for software
+ * renderers and as a reference for skinning in shaders.
+ *
+ * Each vertex is transformed by the weighted sum of its bones' matrices, its
+ * normal by the upper 3x3 of that sum and renormalized, which assumes bones
+ * without non uniform scale. Influences naming a bone past the palette are
+ * ignored. Large meshes are split across the worker threads set by
+ * lx_set_worker_count.
+ *
+ * @param palette The bone matrices, each the bone's world matrix times its
+ * inverse bind matrix.
+ * @param bone_count The number of matrices in the palette.
+ * @param vertices The vertices in bind pose.
+ * @param count The number of vertices.
+ * @param positions The skinned positions, count of them.
+ * @param normals The skinned normals, count of them, or NULL to skip them.
+ */
+LX_API void lx_skin_vertices(const lx_mat4* palette, size_t bone_count, const lx_skin_vertex* vertices, size_t count, lx_vec3* positions, lx_vec3* normals);
+
+// animation
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates an animation clip from keyframe tracks, copying the keys.
+ *
+ * Keys are quantized to 8 bytes each, with times to 1 / 65535 of the clip,
+ * translations and scales to 16 bits across each channel's range and
+ * rotations to their smallest three components. Each track's keys are stored
+ * together, so sampling a track stays within a few cache lines.
+ *
+ * @param tracks The tracks, one per animated node.
+ * @param track_count The number of tracks.
+ *
+ * @return The clip, or NULL on failure.
+ */
+LX_API lx_anim_clip* lx_anim_clip_create(const lx_anim_track* tracks, size_t track_count);
+
+/**
+ * @brief Destroys an animation clip.
+ *
+ * @param clip The clip.
+ */
+LX_API void lx_anim_clip_destroy(lx_anim_clip* clip);
+
+/**
+ * @brief Returns the duration of an animation clip, the time of its last key.
+ *
+ * @param clip The clip.
+ *
+ * @return The duration in the units of the key times.
+ */
+LX_API float lx_anim_clip_get_duration(const lx_anim_clip* clip);
+
+/**
+ * @brief Returns the number of tracks in an animation clip.
+ *
+ * @param clip The clip.
+ *
+ * @return The track count.
+ */
+LX_API size_t lx_anim_clip_get_track_count(const lx_anim_clip* clip);
+
+/**
+ * @brief Creates playback cursors for a number of instances of a clip.
+ *
+ * Each instance remembers the keys it last sampled, so playing forward finds
+ * the next keys in constant time, other jumps fall back to a binary search.
+ *
+ * @param clip The clip the cursors are used with.
+ * @param count The number of instances.
+ *
+ * @return The cursors, or NULL on failure.
+ */
+LX_API lx_anim_cursors* lx_anim_cursors_create(const lx_anim_clip* clip, size_t count);
+
+/**
+ * @brief Destroys animation cursors.
+ *
+ * @param cursors The cursors.
+ */
+LX_API void lx_anim_cursors_destroy(lx_anim_cursors* cursors);
+
+/**
+ * @brief Samples every track of a clip for every instance of a set of
+ * cursors, lerping translations and scales and nlerping rotations between
+ * keys.
+ *
+ * Results are written per instance, the track t of instance i at index
+ * i * track_count + t, ready for lx_mat4_from_trs_array. Large batches are
+ * split across the worker threads set by lx_set_worker_count.
+ *
+ * @param clip The clip.
+ * @param cursors The cursors, created for this clip.
+ * @param times The time of each instance, clamped to the clip.
+ * @param translations The sampled translations.
+ * @param rotations The sampled rotations.
+ * @param scales The sampled scales.
+ */
+LX_API void lx_anim_sample(const lx_anim_clip* clip, lx_anim_cursors* cursors, const float* times, lx_vec3* translations, lx_quat* rotations, lx_vec3* scales);
+
+// camera
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates a camera at the origin looking down -z, with a perspective
+ * projection of a 60 degree field of view, an aspect of 1 and depth from 0.1
+ * to 100.
+ *
+ * The camera caches its matrices and frustum, each getter recomputes only
+ * what the setters called since its last use have changed.
+ *
+ * @return The camera, or NULL on failure.
+ */
+LX_API lx_camera* lx_camera_create();
+
+/**
+ * @brief Destroys a camera.
+ *
+ * @param cam The camera.
+ */
+LX_API void lx_camera_destroy(lx_camera* cam);
+
+/**
+ * @brief Sets the position of a camera.
+ *
+ * @param cam The camera.
+ * @param position The position in world space.
+ */
+LX_API void lx_camera_set_position(lx_camera* cam, lx_vec3 position);
+
+/**
+ * @brief Sets the orientation of a camera, which looks down its local -z with
+ * its local +y up.
+ *
+ * @param cam The camera.
+ * @param rotation The rotation, a unit quaternion.
+ */
+LX_API void lx_camera_set_rotation(lx_camera* cam, lx_quat rotation);
+
+/**
+ * @brief Moves a camera to eye and turns it towards center, as
+ * lx_mat4_look_at.
+ *
+ * @param cam The camera.
+ * @param eye The position of the camera.
+ * @param center The point to look at.
+ * @param up The up direction, which must not be parallel to the view.
+ */
+LX_API void lx_camera_look_at(lx_camera* cam, lx_vec3 eye, lx_vec3 center, lx_vec3 up);
+
+/**
+ * @brief Returns the position of a camera.
+ *
+ * @param cam The camera.
+ *
+ * @return The position in world space.
+ */
+LX_API lx_vec3 lx_camera_get_position(const lx_camera* cam);
+
+/**
+ * @brief Returns the orientation of a camera.
+ *
+ * @param cam The camera.
+ *
+ * @return The rotation.
+ */
+LX_API lx_quat lx_camera_get_rotation(const lx_camera* cam);
+
+/**
+ * @brief Gives a camera a perspective projection, as lx_mat4_perspective.
+ *
+ * @param cam The camera.
+ * @param fov The vertical field of view in degrees.
+ * @param near The near clipping plane distance.
+ * @param far The far clipping plane distance.
+ */
+LX_API void lx_camera_set_perspective(lx_camera* cam, float fov, float near, float far);
+
+/**
+ * @brief Gives a camera a reversed depth perspective projection without a far
+ * plane, as lx_mat4_perspective_reversed. Its frustum's far plane then culls
+ * nothing.
+ *
+ * @param cam The camera.
+ * @param fov The vertical field of view in degrees.
+ * @param near The near clipping plane distance.
+ */
+LX_API void lx_camera_set_perspective_reversed(lx_camera* cam, float fov, float near);
+
+/**
+ * @brief Sets the aspect ratio of a camera from the size of its viewport, as
+ * from the on_resize callback. A zero size, as for a minimised window, keeps
+ * the current aspect.
+ *
+ * @param cam The camera.
+ * @param width The viewport width.
+ * @param height The viewport height.
+ */
+LX_API void lx_camera_set_viewport(lx_camera* cam, int width, int height);
+
+/**
+ * @brief Returns the view matrix of a camera, the inverse of its transform.
+ *
+ * @param cam The camera.
+ *
+ * @return The view matrix, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_mat4* lx_camera_get_view(lx_camera* cam);
+
+/**
+ * @brief Returns the inverse view matrix of a camera, its transform.
+ *
+ * @param cam The camera.
+ *
+ * @return The inverse view matrix, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_mat4* lx_camera_get_view_inverse(lx_camera* cam);
+
+/**
+ * @brief Returns the projection matrix of a camera.
+ *
+ * @param cam The camera.
+ *
+ * @return The projection matrix, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_mat4* lx_camera_get_projection(lx_camera* cam);
+
+/**
+ * @brief Returns the inverse projection matrix of a camera.
+ *
+ * @param cam The camera.
+ *
+ * @return The inverse projection matrix, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_mat4* lx_camera_get_projection_inverse(lx_camera* cam);
+
+/**
+ * @brief Returns the view projection matrix of a camera, projection * view.
+ *
+ * @param cam The camera.
+ *
+ * @return The view projection matrix, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_mat4* lx_camera_get_view_projection(lx_camera* cam);
+
+/**
+ * @brief Returns the inverse view projection matrix of a camera, as used to
+ * unproject screen points.
+ *
+ * @param cam The camera.
+ *
+ * @return The inverse view projection matrix, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_mat4* lx_camera_get_view_projection_inverse(lx_camera* cam);
+
+/**
+ * @brief Returns the frustum of a camera, in world space.
+ *
+ * @param cam The camera.
+ *
+ * @return The frustum, valid until the camera is changed or destroyed.
+ */
+LX_API const lx_frustum* lx_camera_get_frustum(lx_camera* cam);
+
+/**
+ * @brief Unprojects a point on the screen into a world space ray through a
+ * camera, as lx_ray_from_screen but with the camera's cached inverse and the
+ * depth range of its projection, so it also works with reversed depth.
+ *
+ * @param cam The camera.
+ * @param x The x position in pixels, from the left of the screen.
+ * @param y The y position in pixels, from the top of the screen.
+ * @param width The width of the screen in pixels.
+ * @param height The height of the screen in pixels.
+ *
+ * @return The ray, starting on the near plane with a normalized direction.
+ */
+LX_API lx_ray lx_camera_get_ray(lx_camera* cam, float x, float y, float width, float height);
+
+LX_END_HEADER
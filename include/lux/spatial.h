@@ -0,0 +1,516 @@
+#pragma once
+
+#include "api.h"
+#include "math.h"
+LX_BEGIN_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+
+// types
+// ----------------------------------------------------------------
+
+typedef struct _lx_sphere { lx_vec3 center; float radius; } lx_sphere;
+typedef struct _lx_aabb { lx_vec3 min; lx_vec3 max; } lx_aabb;
+
+// each plane is stored as (normal, distance), with the normal pointing into
+// the frustum, in the order left, right, bottom, top, near and far
+typedef struct _lx_frustum { lx_vec4 planes[6]; } lx_frustum;
+
+// the direction of a ray need not be normalized, distances along it are then
+// measured in multiples of its length
+typedef struct _lx_ray { lx_vec3 origin; lx_vec3 direction; } lx_ray;
+
+// u and v are the barycentric coordinates of a triangle hit, weighting the
+// second and third vertices, and are 0 for boxes
+typedef struct _lx_ray_hit { float t; float u; float v; uint32_t primitive; } lx_ray_hit;
+
+#define LX_BVH_NO_HIT UINT32_MAX
+
+typedef struct _lx_bvh lx_bvh;
+
+// a pair of overlapping objects, with a less than b
+typedef struct _lx_pair { uint32_t a; uint32_t b; } lx_pair;
+
+typedef struct _lx_aabb_tree lx_aabb_tree;
+typedef struct _lx_sweep_prune lx_sweep_prune;
+typedef struct _lx_hash_grid lx_hash_grid;
+typedef uint32_t lx_proxy;
+
+#define LX_PROXY_NONE UINT32_MAX
+
+// aabb
+// ----------------------------------------------------------------
+
+/**
+ * @brief Transforms an axis aligned bounding box, giving the smallest axis
+ * aligned box around the transformed one.
+ *
+ * @param b The bounding box.
+ * @param m The affine transform, usually a model matrix.
+ *
+ * @return The transformed bounding box.
+ */
+LX_API lx_aabb lx_aabb_transform(lx_aabb b, lx_mat4 m);
+
+// frustum
+// ----------------------------------------------------------------
+
+/**
+ * @brief Extracts the six normalized clipping planes of a view projection
+ * matrix, with OpenGL's -1 to 1 clip space depth.
+ *
+ * @param view_projection The combined projection * view matrix, or a full
+ * model view projection matrix to get planes in model space.
+ *
+ * @return The frustum.
+ */
+LX_API lx_frustum lx_frustum_from_mat4(lx_mat4 view_projection);
+
+/**
+ * @brief Tests a sphere against a frustum.
+ *
+ * @param f The frustum.
+ * @param s The sphere.
+ *
+ * @return 1 if the sphere may be visible, 0 if it is fully outside a plane.
+ */
+LX_API int lx_frustum_test_sphere(const lx_frustum* f, lx_sphere s);
+
+/**
+ * @brief Tests an axis aligned bounding box against a frustum.
+ *
+ * @param f The frustum.
+ * @param b The bounding box.
+ *
+ * @return 1 if the box may be visible, 0 if it is fully outside a plane.
+ */
+LX_API int lx_frustum_test_aabb(const lx_frustum* f, lx_aabb b);
+
+/**
+ * @brief Tests an array of spheres against a frustum, writing a visibility
+ * bitmask.
+ *
+ * The spheres are tested several at a time with simd, and split across the
+ * worker threads set by lx_set_worker_count for large arrays.
+ *
+ * @param f The frustum.
+ * @param spheres The spheres to test.
+ * @param count The number of spheres.
+ * @param mask The bitmask, bit i % 32 of mask[i / 32] is set if sphere i may be
+ * visible. This must hold (count + 31) / 32 words.
+ */
+LX_API void lx_frustum_cull_spheres(const lx_frustum* f, const lx_sphere* spheres, size_t count, uint32_t* mask);
+
+/**
+ * @brief Tests an array of spheres against a frustum, writing the indices of
+ * those which may be visible in ascending order.
+ *
+ * @param f The frustum.
+ * @param spheres The spheres to test.
+ * @param count The number of spheres.
+ * @param indices The visible indices, this must be able to hold count indices.
+ *
+ * @return The number of visible indices written.
+ */
+LX_API size_t lx_frustum_cull_spheres_indices(const lx_frustum* f, const lx_sphere* spheres, size_t count, uint32_t* indices);
+
+/**
+ * @brief Tests an array of axis aligned bounding boxes against a frustum,
+ * writing a visibility bitmask as lx_frustum_cull_spheres.
+ *
+ * @param f The frustum.
+ * @param boxes The boxes to test.
+ * @param count The number of boxes.
+ * @param mask The bitmask, which must hold (count + 31) / 32 words.
+ */
+LX_API void lx_frustum_cull_aabbs(const lx_frustum* f, const lx_aabb* boxes, size_t count, uint32_t* mask);
+
+/**
+ * @brief Tests an array of axis aligned bounding boxes against a frustum,
+ * writing the indices of those which may be visible in ascending order.
+ *
+ * @param f The frustum.
+ * @param boxes The boxes to test.
+ * @param count The number of boxes.
+ * @param indices The visible indices, this must be able to hold count indices.
+ *
+ * @return The number of visible indices written.
+ */
+LX_API size_t lx_frustum_cull_aabbs_indices(const lx_frustum* f, const lx_aabb* boxes, size_t count, uint32_t* indices);
+
+// rays
+// ----------------------------------------------------------------
+
+/**
+ * @brief Unprojects a point on the screen into a world space ray, with
+ * OpenGL's -1 to 1 clip space depth. Reversed depth projections, as
+ * lx_mat4_perspective_reversed, need lx_camera_get_ray instead.
+ *
+ * @param x The x position in pixels, from the left of the screen.
+ * @param y The y position in pixels, from the top of the screen.
+ * @param width The width of the screen in pixels.
+ * @param height The height of the screen in pixels.
+ * @param view The view matrix.
+ * @param projection The projection matrix.
+ *
+ * @return The ray, starting on the near plane with a normalized direction.
+ */
+LX_API lx_ray lx_ray_from_screen(float x, float y, float width, float height, lx_mat4 view, lx_mat4 projection);
+
+/**
+ * @brief Unprojects the mouse position into a world space ray, as
+ * lx_ray_from_screen with the size of the window.
+ *
+ * @param view The view matrix.
+ * @param projection The projection matrix.
+ *
+ * @return The ray, starting on the near plane with a normalized direction.
+ */
+LX_API lx_ray lx_ray_from_mouse(lx_mat4 view, lx_mat4 projection);
+
+/**
+ * @brief Intersects a ray with an axis aligned bounding box.
+ *
+ * @param r The ray.
+ * @param b The bounding box.
+ * @param t The distance at which the ray enters the box, or 0 if it starts
+ * inside. This may be NULL.
+ *
+ * @return 1 if the ray hits the box, 0 otherwise.
+ */
+LX_API int lx_ray_test_aabb(lx_ray r, lx_aabb b, float* t);
+
+/**
+ * @brief Intersects a ray with a triangle, hitting either side.
+ *
+ * @param r The ray.
+ * @param v0 The first vertex.
+ * @param v1 The second vertex.
+ * @param v2 The third vertex.
+ * @param hit The hit, primitive is left unchanged. This may be NULL.
+ *
+ * @return 1 if the ray hits the triangle, 0 otherwise.
+ */
+LX_API int lx_ray_test_triangle(lx_ray r, lx_vec3 v0, lx_vec3 v1, lx_vec3 v2, lx_ray_hit* hit);
+
+// bvh
+// ----------------------------------------------------------------
+
+/**
+ * @brief Builds a bounding volume hierarchy over an indexed triangle mesh,
+ * for casting rays against it. The triangles are copied, so the arrays may be
+ * freed afterwards.
+ *
+ * @param vertices The vertex positions.
+ * @param vertex_count The number of vertices.
+ * @param indices Three indices per triangle.
+ * @param triangle_count The number of triangles.
+ *
+ * @return The bvh, or NULL if an index is out of range or it could not be
+ * allocated.
+ */
+LX_API lx_bvh* lx_bvh_create_triangles(const lx_vec3* vertices, size_t vertex_count, const uint32_t* indices, size_t triangle_count);
+
+/**
+ * @brief Builds a bounding volume hierarchy over a set of axis aligned
+ * bounding boxes, for instance those of the objects in a scene. The boxes
+ * are copied.
+ *
+ * @param boxes The boxes.
+ * @param count The number of boxes.
+ *
+ * @return The bvh, or NULL if it could not be allocated.
+ */
+LX_API lx_bvh* lx_bvh_create_aabbs(const lx_aabb* boxes, size_t count);
+
+/**
+ * @brief Destroys a bounding volume hierarchy.
+ *
+ * @param bvh The bvh.
+ */
+LX_API void lx_bvh_destroy(lx_bvh* bvh);
+
+/**
+ * @brief Finds the closest primitive hit by a ray.
+ *
+ * @param bvh The bvh.
+ * @param r The ray.
+ * @param max_distance The distance beyond which hits are ignored.
+ * @param hit The closest hit, with primitive set to the index of the
+ * triangle or box, or to LX_BVH_NO_HIT and t to max_distance on a miss.
+ *
+ * @return 1 if a primitive was hit, 0 otherwise.
+ */
+LX_API int lx_bvh_raycast(const lx_bvh* bvh, lx_ray r, float max_distance, lx_ray_hit* hit);
+
+/**
+ * @brief Finds the closest primitive hit by each of an array of rays, as
+ * lx_bvh_raycast.
+ *
+ * The rays are traversed together in packets as wide as the active simd
+ * level, 8 with avx2 and 4 with sse or neon, so rays which start close
+ * together and point the same way are much cheaper than separate casts.
+ *
+ * @param bvh The bvh.
+ * @param rays The rays.
+ * @param count The number of rays.
+ * @param max_distance The distance beyond which hits are ignored.
+ * @param hits The closest hit of each ray.
+ *
+ * @return The number of rays which hit a primitive.
+ */
+LX_API size_t lx_bvh_raycast_packet(const lx_bvh* bvh, const lx_ray* rays, size_t count, float max_distance, lx_ray_hit* hits);
+
+// aabb tree
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates an empty dynamic bounding volume tree, for objects which move
+ * every frame.
+ *
+ * Each object is stored with a fat box, its bounds grown by a margin, and only
+ * has to be reinserted once it leaves that box. Inserts refit the boxes above
+ * them and rotate nodes on the way up to keep the tree cheap to query.
+ *
+ * @param margin The distance the fat boxes extend past the bounds of their
+ * objects.
+ *
+ * @return The tree, or NULL on failure.
+ */
+LX_API lx_aabb_tree* lx_aabb_tree_create(float margin);
+
+/**
+ * @brief Destroys a dynamic bounding volume tree.
+ *
+ * @param tree The tree.
+ */
+LX_API void lx_aabb_tree_destroy(lx_aabb_tree* tree);
+
+/**
+ * @brief Adds an object to a dynamic bounding volume tree.
+ *
+ * @param tree The tree.
+ * @param box The bounds of the object.
+ * @param id The id queries report for the object, usually its index.
+ *
+ * @return The proxy of the object, or LX_PROXY_NONE on failure.
+ */
+LX_API lx_proxy lx_aabb_tree_insert(lx_aabb_tree* tree, lx_aabb box, uint32_t id);
+
+/**
+ * @brief Removes an object from a dynamic bounding volume tree. Its proxy may
+ * be reused by later inserts.
+ *
+ * @param tree The tree.
+ * @param proxy The proxy of the object.
+ */
+LX_API void lx_aabb_tree_remove(lx_aabb_tree* tree, lx_proxy proxy);
+
+/**
+ * @brief Updates the bounds of an object, reinserting it if they have left its
+ * fat box.
+ *
+ * @param tree The tree.
+ * @param proxy The proxy of the object.
+ * @param box The new bounds of the object.
+ *
+ * @return 1 if the object was reinserted, 0 if its fat box still held it.
+ */
+LX_API int lx_aabb_tree_move(lx_aabb_tree* tree, lx_proxy proxy, lx_aabb box);
+
+/**
+ * @brief Updates the bounds of an array of objects from their model space
+ * bounds and transforms, as lx_aabb_tree_move with lx_aabb_transform.
+ *
+ * @param tree The tree.
+ * @param proxies The proxies of the objects.
+ * @param boxes The model space bounds of the objects.
+ * @param transforms The model matrices of the objects.
+ * @param count The number of objects.
+ *
+ * @return The number of objects which were reinserted.
+ */
+LX_API size_t lx_aabb_tree_update(lx_aabb_tree* tree, const lx_proxy* proxies, const lx_aabb* boxes, const lx_mat4* transforms, size_t count);
+
+/**
+ * @brief Gets the fat box of an object in a dynamic bounding volume tree.
+ *
+ * @param tree The tree.
+ * @param proxy The proxy of the object.
+ *
+ * @return The fat box.
+ */
+LX_API lx_aabb lx_aabb_tree_get_fat_aabb(const lx_aabb_tree* tree, lx_proxy proxy);
+
+/**
+ * @brief Finds the objects whose fat boxes overlap a box.
+ *
+ * @param tree The tree.
+ * @param box The box.
+ * @param ids The ids of the objects found. Only the first capacity are
+ * written, this may be NULL if capacity is 0.
+ * @param capacity The number of ids that fit in the array.
+ *
+ * @return The number of objects found, which may be more than capacity.
+ */
+LX_API size_t lx_aabb_tree_query_aabb(const lx_aabb_tree* tree, lx_aabb box, uint32_t* ids, size_t capacity);
+
+/**
+ * @brief Finds the objects whose fat boxes may be visible in a frustum. Whole
+ * subtrees inside the frustum are taken without testing their objects.
+ *
+ * @param tree The tree.
+ * @param f The frustum.
+ * @param ids The ids of the objects found, as lx_aabb_tree_query_aabb.
+ * @param capacity The number of ids that fit in the array.
+ *
+ * @return The number of objects found, which may be more than capacity.
+ */
+LX_API size_t lx_aabb_tree_query_frustum(const lx_aabb_tree* tree, const lx_frustum* f, uint32_t* ids, size_t capacity);
+
+/**
+ * @brief Finds the objects whose fat boxes are crossed by a ray, as candidates
+ * for exact tests.
+ *
+ * @param tree The tree.
+ * @param r The ray.
+ * @param max_distance The distance beyond which boxes are ignored.
+ * @param ids The ids of the objects found, as lx_aabb_tree_query_aabb.
+ * @param capacity The number of ids that fit in the array.
+ *
+ * @return The number of objects found, which may be more than capacity.
+ */
+LX_API size_t lx_aabb_tree_query_ray(const lx_aabb_tree* tree, lx_ray r, float max_distance, uint32_t* ids, size_t capacity);
+
+/**
+ * @brief Finds every pair of objects whose fat boxes overlap, each once.
+ *
+ * @param tree The tree.
+ * @param pairs The pairs of ids found. Only the first capacity are written,
+ * this may be NULL if capacity is 0.
+ * @param capacity The number of pairs that fit in the array.
+ *
+ * @return The number of pairs found, which may be more than capacity.
+ */
+LX_API size_t lx_aabb_tree_query_pairs(const lx_aabb_tree* tree, lx_pair* pairs, size_t capacity);
+
+// sweep and prune
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates a sweep and prune broadphase, which finds the overlapping
+ * pairs in an array of boxes by sorting them along one axis.
+ *
+ * The sorted order is kept between updates, so boxes which move a little each
+ * frame are resorted with a few swaps of an insertion sort.
+ *
+ * @return The broadphase, or NULL on failure.
+ */
+LX_API lx_sweep_prune* lx_sweep_prune_create();
+
+/**
+ * @brief Destroys a sweep and prune broadphase.
+ *
+ * @param sp The broadphase.
+ */
+LX_API void lx_sweep_prune_destroy(lx_sweep_prune* sp);
+
+/**
+ * @brief Finds every pair of overlapping boxes, each once.
+ *
+ * Boxes are expected to keep their index from one update to the next. When
+ * the count changes the boxes are sorted from scratch, along the axis their
+ * centers are most spread over.
+ *
+ * @param sp The broadphase.
+ * @param mins The minimum corner of each box.
+ * @param maxs The maximum corner of each box.
+ * @param count The number of boxes.
+ * @param pairs The pairs of indices found. Only the first capacity are
+ * written, this may be NULL if capacity is 0.
+ * @param capacity The number of pairs that fit in the array.
+ *
+ * @return The number of pairs found, which may be more than capacity.
+ */
+LX_API size_t lx_sweep_prune_update(lx_sweep_prune* sp, const lx_vec3* mins, const lx_vec3* maxs, size_t count, lx_pair* pairs, size_t capacity);
+
+// hash grid
+// ----------------------------------------------------------------
+
+/**
+ * @brief Creates an empty spatial hash grid, for neighbour queries over large
+ * point sets which are rebuilt every frame.
+ *
+ * Points are bucketed by a hash of the uniform cell they fall in and counting
+ * sorted, so each bucket's points are contiguous in memory. Queries should use
+ * a radius around the cell size, larger radii visit more cells.
+ *
+ * @param cell_size The edge length of each cell.
+ *
+ * @return The grid, or NULL on failure.
+ */
+LX_API lx_hash_grid* lx_hash_grid_create(float cell_size);
+
+/**
+ * @brief Destroys a spatial hash grid.
+ *
+ * @param grid The grid.
+ */
+LX_API void lx_hash_grid_destroy(lx_hash_grid* grid);
+
+/**
+ * @brief Builds a spatial hash grid over a set of 3d points, replacing its
+ * previous contents. The points are copied.
+ *
+ * Large sets are split across the worker threads set by lx_set_worker_count.
+ *
+ * @param grid The grid.
+ * @param points The points.
+ * @param count The number of points.
+ *
+ * @return 1 on success, 0 if the grid could not be allocated.
+ */
+LX_API int lx_hash_grid_build(lx_hash_grid* grid, const lx_vec3* points, size_t count);
+
+/**
+ * @brief Builds a spatial hash grid over a set of 2d points, as
+ * lx_hash_grid_build. Queries on the grid ignore the z of their center.
+ *
+ * @param grid The grid.
+ * @param points The points.
+ * @param count The number of points.
+ *
+ * @return 1 on success, 0 if the grid could not be allocated.
+ */
+LX_API int lx_hash_grid_build_vec2(lx_hash_grid* grid, const lx_vec2* points, size_t count);
+
+/**
+ * @brief Finds the points within a radius of a center.
+ *
+ * @param grid The grid.
+ * @param center The center.
+ * @param radius The radius.
+ * @param ids The indices of the points found, in no particular order. Only the
+ * first capacity are written, this may be NULL if capacity is 0.
+ * @param capacity The number of ids that fit in the array.
+ *
+ * @return The number of points found, which may be more than capacity.
+ */
+LX_API size_t lx_hash_grid_query_radius(const lx_hash_grid* grid, lx_vec3 center, float radius, uint32_t* ids, size_t capacity);
+
+/**
+ * @brief Finds the k points nearest a center.
+ *
+ * @param grid The grid.
+ * @param center The center.
+ * @param k The number of points to find.
+ * @param ids The indices of the points found, nearest first. This must hold k
+ * indices.
+ * @param distances The distance to each point found, this may be NULL.
+ *
+ * @return The number of points found, k unless the grid holds fewer points.
+ */
+LX_API size_t lx_hash_grid_query_nearest(const lx_hash_grid* grid, lx_vec3 center, size_t k, uint32_t* ids, float* distances);
+
+LX_END_HEADER
@@ -19,4 +19,24 @@ LX_BEGIN_HEADER
  */
 LX_API char* lx_read_file(const char* file);
 
+// workers
+// ---------------------------------------------------------------- 
+
+/**
+ * @brief Sets how many threads the batched functions which support it may
+ * split their work across, the calling thread being one of them. Threads are
+ * only used for arrays large enough to benefit.
+ *
+ * @param count The number of threads, 1 by default which keeps all work on the
+ * calling thread. 0 or less uses one per hardware thread.
+ */
+LX_API void lx_set_worker_count(int count);
+
+/**
+ * @brief Returns the number of threads the batched functions may use.
+ *
+ * @return The worker count.
+ */
+LX_API int lx_get_worker_count();
+
 LX_END_HEADER
@@ -13,6 +13,9 @@ typedef struct _global_store
     int alive;
     int gl_version;
 
+    // running on a null gl backend, without a window
+    int headless;
+
     lx_keystate key_tracker[LX_KEY_COUNT];
     lx_mousepos mouse_tracker;
     double scroll_amount;
@@ -50,3 +53,14 @@ double window_get_fps();
 
 // gets the delta time between frames
 double window_get_delta();
+
+// headless
+// ----------------------------------------------------------------
+
+// stands in for the window on the null gl backends, only keeping frame times
+int headless_create();
+void headless_destroy();
+void headless_poll_events();
+double headless_get_time();
+double headless_get_fps();
+double headless_get_delta();
@@ -2,10 +2,25 @@
 #include "core.h"
 #include "../debug/debug.h"
 #include "../gl/gl.h"
+#include "../math/math.h"
 
 #include <stdlib.h>
 #include <string.h>
 
+// private source
+// ----------------------------------------------------------------
+
+// 0.0 asks for the newest version
+static int is_valid_gl_version(int major, int minor)
+{
+    static const int newest_minor[] = { 0, 5, 1, 3, 6 };
+
+    if (major == 0)
+        return minor == 0;
+
+    return major > 0 && major <= 4 && minor >= 0 && minor <= newest_minor[major];
+}
+
 // private header 
 // ---------------------------------------------------------------- 
 
@@ -19,12 +34,18 @@ int lx_init(lx_init_props props)
 {
     lt_props = props;
     
-    GUARD(lt_store != NULL, ("failed to initialise lux, it has already been initialised"), 0);
-    GUARD(props.title == NULL, ("failed to initialise lux with a null title"), 0);
-    GUARD(props.width > 8192 || props.width <= 0, ("failed to initialise lux with invalid width of %d (0-8192)", props.width), 0);
-    GUARD(props.height > 4320 || props.height <= 0, ("failed to initialise lux with invalid height of %d (0-4320)", props.height), 0);
-    GUARD(props.on_resize == NULL, ("failed to initialise lux with null resize callback"), 0);
-    GUARD(props.on_error == NULL, ("failed to initialise lux with null error callback"), 0);
+    GUARD(lt_store != NULL, ("failed to initialise lux, it has already been initialised"), 1);
+    GUARD(props.title == NULL, ("failed to initialise lux with a null title"), 1);
+    GUARD(props.width > 8192 || props.width <= 0, ("failed to initialise lux with invalid width of %d (0-8192)", props.width), 1);
+    GUARD(props.height > 4320 || props.height <= 0, ("failed to initialise lux with invalid height of %d (0-4320)", props.height), 1);
+    GUARD(props.on_resize == NULL, ("failed to initialise lux with null resize callback"), 1);
+    GUARD(props.on_error == NULL, ("failed to initialise lux with null error callback"), 1);
+    GUARD(!is_valid_gl_version(props.gl_major, props.gl_minor), ("failed to initialise lux with invalid opengl version %d.%d", props.gl_major, props.gl_minor), 1);
+    GUARD(props.gl_profile < LX_GL_PROFILE_DEFAULT || props.gl_profile > LX_GL_PROFILE_COMPATIBILITY, ("failed to initialise lux with invalid opengl profile %d", (int)props.gl_profile), 1);
+    GUARD(props.gl_profile == LX_GL_PROFILE_CORE && props.gl_major != 0 && props.gl_major * 10 + props.gl_minor < 32, ("failed to initialise lux with a core profile of opengl %d.%d (3.2+)", props.gl_major, props.gl_minor), 1);
+    GUARD(props.gl_no_error && props.gl_debug, ("failed to initialise lux with both a no error and a debug context"), 1);
+
+    math_init();
 
     lt_store = malloc(sizeof(global_store));
     if (lt_store == NULL)
@@ -33,7 +54,8 @@ int lx_init(lx_init_props props)
         return 1;
     }
 
-    if (!window_create() || !gl_load())
+    lt_store->headless = props.gl_backend != LX_GL_BACKEND_DRIVER;
+    if (!(lt_store->headless ? headless_create() : window_create()) || !gl_load(props.gl_backend, props.gl_lazy_loading))
         return 1;
 
     memset(lt_store->key_tracker, LX_RELEASED, sizeof(lt_store->key_tracker));
@@ -49,7 +71,11 @@ void lx_quit()
     GUARD(lt_store == NULL, ("failed to quit lux, it has not been initialised"));
 
     gl_unload();
-    window_destroy();
+
+    if (lt_store->headless)
+        headless_destroy();
+    else
+        window_destroy();
 
     free(lt_store);
     lt_store = NULL;
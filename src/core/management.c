@@ -10,31 +10,35 @@
 void lx_poll_events()
 {
     GUARD(lt_store == NULL, ("failed to poll events, lux has not been initialised"));
-    window_poll_events();
+    if (lt_store->headless)
+        headless_poll_events();
+    else
+        window_poll_events();
 }
 
 void lx_swap_buffers()
 {
     GUARD(lt_store == NULL, ("failed to swap buffers, lux has not been initialised"));
-    window_swap_buffers();
+    if (!lt_store->headless)
+        window_swap_buffers();
 }
 
 double lx_get_fps()
 {
     GUARD(lt_store == NULL, ("failed to get fps, lux has not been initialised"), 0);
-    return window_get_fps();
+    return lt_store->headless ? headless_get_fps() : window_get_fps();
 }
 
 double lx_get_delta()
 {
     GUARD(lt_store == NULL, ("failed to get delta time, lux has not been initialised"), 0);
-    return window_get_delta();
+    return lt_store->headless ? headless_get_delta() : window_get_delta();
 }
 
 double lx_get_time()
 {
     GUARD(lt_store == NULL, ("failed to get time elapsed, lux has not been initialised"), 0);
-    return window_get_time();
+    return lt_store->headless ? headless_get_time() : window_get_time();
 }
 
 int lx_get_width()
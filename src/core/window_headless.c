@@ -0,0 +1,66 @@
+#include "lux/core.h"
+#include "core.h"
+#include "../input/input.h"
+
+#include <time.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// frame timing for the null gl backends, which run without a window
+static double time_began;
+static double last_frame_time;
+static double cur_frame_time;
+static double delta_time;
+
+static double get_time()
+{
+    struct timespec time;
+    timespec_get(&time, TIME_UTC);
+    return time.tv_sec + (time.tv_nsec / 1000000000.0);
+}
+
+// private header
+// ----------------------------------------------------------------
+
+int headless_create()
+{
+    double now = get_time();
+    time_began = now;
+    last_frame_time = now;
+    cur_frame_time = now;
+    delta_time = 0.0;
+
+    return 1;
+}
+
+void headless_destroy()
+{
+}
+
+void headless_poll_events()
+{
+    last_frame_time = cur_frame_time;
+    cur_frame_time = get_time();
+    delta_time = cur_frame_time - last_frame_time;
+
+    reset_mouse_scroll();
+}
+
+double headless_get_time()
+{
+    return get_time() - time_began;
+}
+
+double headless_get_fps()
+{
+    if (delta_time == 0.0)
+        return 0;
+
+    return 1.0 / delta_time;
+}
+
+double headless_get_delta()
+{
+    return delta_time;
+}
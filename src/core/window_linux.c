@@ -9,6 +9,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 #include <wayland-client-core.h>
 #include <wayland-client.h>
 #include <wayland-egl.h>
@@ -386,6 +387,75 @@ static void destroy_xdg_shell()
         xdg_wm_base_destroy(lt_store->window->xdg_wm_base);
 }
 
+static int has_egl_extension(const char* name)
+{
+    const char* list = eglQueryString(lt_store->window->egl_display, EGL_EXTENSIONS);
+    size_t length = strlen(name);
+
+    for (const char* c = list; c != NULL && (c = strstr(c, name)) != NULL; c += length)
+    {
+        if ((c == list || c[-1] == ' ') && (c[length] == ' ' || c[length] == '\0'))
+            return 1;
+    }
+
+    return 0;
+}
+
+static EGLContext try_egl_context(EGLConfig config, int major, int minor)
+{
+    EGLint attribs[16];
+    int count = 0;
+
+    if (major != 0)
+    {
+        attribs[count++] = EGL_CONTEXT_MAJOR_VERSION_KHR;
+        attribs[count++] = major;
+        attribs[count++] = EGL_CONTEXT_MINOR_VERSION_KHR;
+        attribs[count++] = minor;
+    }
+
+    if (lt_props.gl_profile != LX_GL_PROFILE_DEFAULT)
+    {
+        attribs[count++] = EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR;
+        attribs[count++] = lt_props.gl_profile == LX_GL_PROFILE_CORE ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR;
+    }
+
+    if (lt_props.gl_debug)
+    {
+        attribs[count++] = EGL_CONTEXT_FLAGS_KHR;
+        attribs[count++] = EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR;
+    }
+
+    // egl rejects attributes it does not know, rather than ignoring them
+    if (lt_props.gl_no_error && has_egl_extension("EGL_KHR_create_context_no_error"))
+    {
+        attribs[count++] = EGL_CONTEXT_OPENGL_NO_ERROR_KHR;
+        attribs[count++] = EGL_TRUE;
+    }
+
+    attribs[count] = EGL_NONE;
+    return eglCreateContext(lt_store->window->egl_display, config, EGL_NO_CONTEXT, attribs);
+}
+
+// a core profile without a version would get version 1.0, which has no
+// profiles, so each version with one is tried from the newest down
+static EGLContext create_egl_context(EGLConfig config)
+{
+    static const int versions[][2] = { { 4, 6 }, { 4, 5 }, { 4, 4 }, { 4, 3 }, { 4, 2 }, { 4, 1 }, { 4, 0 }, { 3, 3 }, { 3, 2 } };
+
+    if (lt_props.gl_major != 0 || lt_props.gl_profile != LX_GL_PROFILE_CORE)
+        return try_egl_context(config, lt_props.gl_major, lt_props.gl_minor);
+
+    for (int i = 0; i < (int)(sizeof(versions) / sizeof(versions[0])); i++)
+    {
+        EGLContext context = try_egl_context(config, versions[i][0], versions[i][1]);
+        if (context != EGL_NO_CONTEXT)
+            return context;
+    }
+
+    return EGL_NO_CONTEXT;
+}
+
 static int create_egl_surface()
 {
     lt_store->window->egl_display = eglGetDisplay((EGLNativeDisplayType)lt_store->window->wl_display); 
@@ -405,7 +475,7 @@ static int create_egl_surface()
     EGLint num_configs;
     EGLint attribs[] =
     {
-        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES2_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
         EGL_SURFACE_TYPE, EGL_WINDOW_BIT,
         EGL_DEPTH_SIZE, 24,
         EGL_NONE
@@ -417,13 +487,12 @@ static int create_egl_surface()
         return 0;
     }
 
-    EGLint context_attribs[] = { EGL_NONE };
     eglBindAPI(EGL_OPENGL_API);
     
-    lt_store->window->egl_context = eglCreateContext(lt_store->window->egl_display, config, EGL_NO_CONTEXT, context_attribs);
+    lt_store->window->egl_context = create_egl_context(config);
     if (!lt_store->window->egl_context)
     {
-        lx_error("failed to create egl context");
+        lx_error("failed to create egl context for opengl %d.%d", lt_props.gl_major, lt_props.gl_minor);
         return 0;
     }
 
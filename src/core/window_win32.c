@@ -5,6 +5,7 @@
 #include <windows.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <wingdi.h>
 
 #define _CRT_SECURE_NO_WARNINGS
@@ -26,6 +27,7 @@ window_store;
 typedef HGLRC (WINAPI* PFNWGLCREATECONTEXTATTRIBSARBPROC)(HDC, HGLRC, const int*);
 typedef unsigned char* (WINAPI* PFNGLGETSTRINGPROC)(unsigned int);
 typedef BOOL (WINAPI* PFNWGLSWAPINTERVALEXTPROC)(int);
+typedef const char* (WINAPI* PFNWGLGETEXTENSIONSSTRINGARBPROC)(HDC);
 
 // private source
 // ---------------------------------------------------------------- 
@@ -196,18 +198,35 @@ static int create_gl_context()
         return 0;
     }
 
+    // the newest version the driver offers, unless one was asked for
+    if (lt_props.gl_major != 0)
+    {
+        major = lt_props.gl_major;
+        minor = lt_props.gl_minor;
+    }
+
     int context_attribs[] =
     {
         0x2091, major,
         0x2092, minor,
-        0x9126, 0x00000001,
+        0x9126, lt_props.gl_profile == LX_GL_PROFILE_COMPATIBILITY ? 0x00000002 : 0x00000001,
+        0x2094, lt_props.gl_debug ? 0x00000001 : 0,
+        0, 0,
         0
     };
 
+    // wgl rejects attributes it does not know, rather than ignoring them
+    PFNWGLGETEXTENSIONSSTRINGARBPROC wglGetExtensionsStringARB = (PFNWGLGETEXTENSIONSSTRINGARBPROC) wglGetProcAddress("wglGetExtensionsStringARB");
+    if (lt_props.gl_no_error && wglGetExtensionsStringARB != NULL && strstr(wglGetExtensionsStringARB(lt_store->window->w32_dc), "WGL_ARB_create_context_no_error") != NULL)
+    {
+        context_attribs[8] = 0x31B3;
+        context_attribs[9] = 1;
+    }
+
     lt_store->window->w32_gl_ctx = wglCreateContextAttribsARB(lt_store->window->w32_dc, 0, context_attribs);
     if (lt_store->window->w32_gl_ctx == NULL)
     {
-        lx_error("failed to create opengl context");
+        lx_error("failed to create opengl %d.%d context", major, minor);
         return 0;
     }
 
@@ -0,0 +1,201 @@
+#include "lux/gl.h"
+#include "lux/core.h"
+#include "lux/debug.h"
+#include "gl.h"
+#include "../core/core.h"
+#include "../debug/debug.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// the names point into the driver's strings, which live as long as the
+// context, so the set never copies them. older contexts list every
+// extension in one string, so the names are not terminated where they end
+typedef struct _extension
+{
+    const char* name;
+    uint32_t length;
+    uint32_t hash;
+}
+extension;
+
+static lx_gl_caps caps = {};
+
+// an open addressed table with linear probing, a power of two in size and
+// at most half full, where a NULL name marks an empty slot
+static extension* extensions = NULL;
+static size_t extension_mask = 0;
+
+// fnv-1a
+static uint32_t hash_name(const char* name, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+
+    return hash;
+}
+
+static int create_extension_set(size_t count)
+{
+    size_t size = 16;
+    while (size < count * 2)
+        size *= 2;
+
+    extensions = calloc(size, sizeof(extension));
+    if (extensions == NULL)
+    {
+        lx_error("failed to allocate the set of %zu gl extensions", count);
+        return 0;
+    }
+
+    extension_mask = size - 1;
+    return 1;
+}
+
+static void insert_extension(const char* name, size_t length)
+{
+    if (length == 0)
+        return;
+
+    uint32_t hash = hash_name(name, length);
+    size_t i = hash & extension_mask;
+
+    // drivers have been known to list an extension twice
+    for (; extensions[i].name != NULL; i = (i + 1) & extension_mask)
+    {
+        if (extensions[i].hash == hash && extensions[i].length == length && memcmp(extensions[i].name, name, length) == 0)
+            return;
+    }
+
+    extensions[i] = (extension){ name, (uint32_t)length, hash };
+}
+
+static int load_extensions()
+{
+    if (lt_store->gl_version >= 30000)
+    {
+        GLint count = 0;
+        lx_glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+
+        if (!create_extension_set((size_t)count))
+            return 0;
+
+        for (GLint i = 0; i < count; i++)
+        {
+            const char* name = (const char*)lx_glGetStringi(GL_EXTENSIONS, (GLuint)i);
+            if (name != NULL)
+                insert_extension(name, strlen(name));
+        }
+
+        return 1;
+    }
+
+    // before 3.0 the extensions are one string separated by spaces
+    const char* list = (const char*)lx_glGetString(GL_EXTENSIONS);
+    if (list == NULL)
+        list = "";
+
+    size_t count = 1;
+    for (const char* c = list; *c != '\0'; c++)
+        count += *c == ' ';
+
+    if (!create_extension_set(count))
+        return 0;
+
+    while (*list != '\0')
+    {
+        size_t length = strcspn(list, " ");
+        insert_extension(list, length);
+        list += length + (list[length] == ' ');
+    }
+
+    return 1;
+}
+
+static int get_integer(GLenum pname, int since)
+{
+    if (lt_store->gl_version < since)
+        return 0;
+
+    GLint value = 0;
+    lx_glGetIntegerv(pname, &value);
+    return value;
+}
+
+static void load_limits()
+{
+    caps.max_texture_size = get_integer(GL_MAX_TEXTURE_SIZE, 10000);
+    caps.max_3d_texture_size = get_integer(GL_MAX_3D_TEXTURE_SIZE, 10002);
+    caps.max_cube_map_texture_size = get_integer(GL_MAX_CUBE_MAP_TEXTURE_SIZE, 10003);
+    caps.max_texture_image_units = get_integer(GL_MAX_TEXTURE_IMAGE_UNITS, 20000);
+    caps.max_combined_texture_image_units = get_integer(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, 20000);
+    caps.max_vertex_attribs = get_integer(GL_MAX_VERTEX_ATTRIBS, 20000);
+    caps.max_draw_buffers = get_integer(GL_MAX_DRAW_BUFFERS, 20000);
+    caps.max_array_texture_layers = get_integer(GL_MAX_ARRAY_TEXTURE_LAYERS, 30000);
+    caps.max_renderbuffer_size = get_integer(GL_MAX_RENDERBUFFER_SIZE, 30000);
+    caps.max_samples = get_integer(GL_MAX_SAMPLES, 30000);
+    caps.max_color_attachments = get_integer(GL_MAX_COLOR_ATTACHMENTS, 30000);
+    caps.max_uniform_block_size = get_integer(GL_MAX_UNIFORM_BLOCK_SIZE, 30001);
+    caps.max_uniform_buffer_bindings = get_integer(GL_MAX_UNIFORM_BUFFER_BINDINGS, 30001);
+    caps.uniform_buffer_offset_alignment = get_integer(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, 30001);
+    caps.max_shader_storage_block_size = get_integer(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, 40003);
+    caps.max_shader_storage_buffer_bindings = get_integer(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, 40003);
+    caps.shader_storage_buffer_offset_alignment = get_integer(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, 40003);
+
+    // core in 4.6, and the same enum under both extensions before it
+    caps.max_texture_max_anisotropy = 0.0f;
+    if (lt_store->gl_version >= 40006 || lx_gl_has_extension("GL_ARB_texture_filter_anisotropic") || lx_gl_has_extension("GL_EXT_texture_filter_anisotropic"))
+        lx_glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &caps.max_texture_max_anisotropy);
+}
+
+// private header
+// ----------------------------------------------------------------
+
+int gl_caps_load()
+{
+    if (!load_extensions())
+        return 0;
+
+    load_limits();
+    return 1;
+}
+
+void gl_caps_unload()
+{
+    free(extensions);
+    extensions = NULL;
+    extension_mask = 0;
+
+    caps = (lx_gl_caps){};
+}
+
+// public header
+// ----------------------------------------------------------------
+
+int lx_gl_has_extension(const char* name)
+{
+    GUARD(name == NULL, ("failed to query a null gl extension"), 0);
+    GUARD(extensions == NULL, ("failed to query gl extension %s, lux has not been initialised", name), 0);
+
+    size_t length = strlen(name);
+    uint32_t hash = hash_name(name, length);
+
+    for (size_t i = hash & extension_mask; extensions[i].name != NULL; i = (i + 1) & extension_mask)
+    {
+        if (extensions[i].hash == hash && extensions[i].length == length && memcmp(extensions[i].name, name, length) == 0)
+            return 1;
+    }
+
+    return 0;
+}
+
+const lx_gl_caps* lx_gl_get_caps()
+{
+    GUARD(lt_store == NULL, ("failed to get gl caps, lux has not been initialised"), NULL);
+    return &caps;
+}
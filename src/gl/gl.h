@@ -1,10 +1,54 @@
 #pragma once
 
+#include "lux/core.h"
+
 // loader
 // ----------------------------------------------------------------
 
-// load the highest support opengl version functions, leaving the rest as NULL
-int gl_load();
+// load the highest support opengl version functions, leaving the rest as NULL.
+// lazy loading defers looking each function up until its first call, the null
+// backends load every function as a stub and ignore it
+int gl_load(lx_gl_backend backend, int lazy);
 
 // unload all opengl functions, setting them to NULL so they cannot be used
 void gl_unload();
+
+typedef void (*gl_proc)(void);
+
+// the function a pointer currently holding current should call. for lazily
+// loaded functions this looks the function up now, as layers which keep
+// their own copy of a pointer would otherwise call its stub forever
+gl_proc gl_resolve(const char* name, gl_proc current);
+
+// caps
+// ----------------------------------------------------------------
+
+// snapshots the extensions and limits of the loaded context, after the
+// functions have been loaded
+int gl_caps_load();
+
+// frees the extension set and zeroes the limits
+void gl_caps_unload();
+
+// null backend
+// ----------------------------------------------------------------
+
+// replaces the stubs of functions which must answer like a working context,
+// handing out names and successful statuses, and starts recording if asked
+void gl_null_install(int record);
+
+// stops recording and frees the recorded calls and mapped memory
+void gl_null_uninstall();
+
+// appends a call to the recording, when recording
+void gl_null_record(const char* name);
+
+// state cache
+// ----------------------------------------------------------------
+
+// wraps the binding and state functions with ones which skip calls that
+// would not change the driver's state
+void gl_state_install();
+
+// forgets the wrapped functions and the cached state
+void gl_state_uninstall();
@@ -18,6 +18,58 @@
 // private source
 // ----------------------------------------------------------------
 
+// how the load functions below set each pointer of their version
+#define GL_UNLOAD 0
+#define GL_LOAD_EAGER 1
+#define GL_LOAD_LAZY 2
+#define GL_LOAD_NULL 3
+
+#define LOAD(type, name)                                                    \
+    (mode == GL_LOAD_EAGER ? (type) load_proc(#name) :                      \
+     mode == GL_LOAD_LAZY ? lazy_##name :                                   \
+     mode == GL_LOAD_NULL ? null_##name : NULL)
+
+// every function gets two stubs. lazy loading points it at one which looks
+// the real function up on its first call, replaces itself in the pointer and
+// forwards the call, a function the driver lacks reports an error and stays
+// on its stub. the null backends point it at one which only records the call
+#define STUB(ret, type, name, params, args)                                 \
+    static ret LX_GL_API lazy_##name params                                 \
+    {                                                                       \
+        type proc = (type) load_proc(#name);                                \
+        if (proc == NULL)                                                   \
+        {                                                                   \
+            lx_error("failed to resolve gl function %s", #name);            \
+            return (ret)0;                                                  \
+        }                                                                   \
+        lx_##name = proc;                                                   \
+        return proc args;                                                   \
+    }                                                                       \
+                                                                            \
+    static ret LX_GL_API null_##name params                                 \
+    {                                                                       \
+        gl_null_record(#name);                                              \
+        return (ret)0;                                                      \
+    }
+
+#define STUB_VOID(type, name, params, args)                                 \
+    static void LX_GL_API lazy_##name params                                \
+    {                                                                       \
+        type proc = (type) load_proc(#name);                                \
+        if (proc == NULL)                                                   \
+        {                                                                   \
+            lx_error("failed to resolve gl function %s", #name);            \
+            return;                                                         \
+        }                                                                   \
+        lx_##name = proc;                                                   \
+        proc args;                                                          \
+    }                                                                       \
+                                                                            \
+    static void LX_GL_API null_##name params                                \
+    {                                                                       \
+        gl_null_record(#name);                                              \
+    }
+
 static int v1_0 = 0;
 static int v1_1 = 0;
 static int v1_2 = 0;
@@ -38,15 +90,8 @@ static int v4_4 = 0;
 static int v4_5 = 0;
 static int v4_6 = 0;
 
-static int query_supported_gl_version()
+static int set_supported_gl_version(int major, int minor)
 {
-    GLubyte* version = lx_glGetString(GL_VERSION);
-    if (!version) return 0;
-    
-    int major = 0;
-    int minor = 0;
-    sscanf((const char*)version, "%d.%d", &major, &minor);
-
     v1_0 = (major == 1 && minor >= 0) || major > 1;
     v1_1 = (major == 1 && minor >= 1) || major > 1;
     v1_2 = (major == 1 && minor >= 2) || major > 1;
@@ -73,6 +118,26 @@ static int query_supported_gl_version()
     return (major * 10000) + minor;
 }
 
+static int query_supported_gl_version()
+{
+    GLubyte* version = lx_glGetString(GL_VERSION);
+    if (!version) return 0;
+    
+    int major = 0;
+    int minor = 0;
+    sscanf((const char*)version, "%d.%d", &major, &minor);
+
+    // drivers may hand back a newer context than was asked for, but only the
+    // functions of the requested version are loaded
+    if (major != 0 && lt_props.gl_major != 0 && major * 10 + minor > lt_props.gl_major * 10 + lt_props.gl_minor)
+    {
+        major = lt_props.gl_major;
+        minor = lt_props.gl_minor;
+    }
+
+    return set_supported_gl_version(major, minor);
+}
+
 PFNGLBLENDFUNCPROC lx_glBlendFunc = NULL;
 PFNGLCLEARPROC lx_glClear = NULL;
 PFNGLCLEARCOLORPROC lx_glClearColor = NULL;
@@ -122,57 +187,106 @@ PFNGLTEXPARAMETERIPROC lx_glTexParameteri = NULL;
 PFNGLTEXPARAMETERIVPROC lx_glTexParameteriv = NULL;
 PFNGLVIEWPORTPROC lx_glViewport = NULL;
 
-static void load_1_0(int load)
+STUB_VOID(PFNGLBLENDFUNCPROC, glBlendFunc, (GLenum sfactor, GLenum dfactor), (sfactor, dfactor))
+STUB_VOID(PFNGLCLEARPROC, glClear, (GLbitfield mask), (mask))
+STUB_VOID(PFNGLCLEARCOLORPROC, glClearColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+STUB_VOID(PFNGLCLEARDEPTHPROC, glClearDepth, (GLdouble depth), (depth))
+STUB_VOID(PFNGLCLEARSTENCILPROC, glClearStencil, (GLint s), (s))
+STUB_VOID(PFNGLCOLORMASKPROC, glColorMask, (GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha), (red, green, blue, alpha))
+STUB_VOID(PFNGLCULLFACEPROC, glCullFace, (GLenum mode), (mode))
+STUB_VOID(PFNGLDEPTHFUNCPROC, glDepthFunc, (GLenum func), (func))
+STUB_VOID(PFNGLDEPTHMASKPROC, glDepthMask, (GLboolean flag), (flag))
+STUB_VOID(PFNGLDEPTHRANGEPROC, glDepthRange, (GLdouble n, GLdouble f), (n, f))
+STUB_VOID(PFNGLDISABLEPROC, glDisable, (GLenum cap), (cap))
+STUB_VOID(PFNGLDRAWBUFFERPROC, glDrawBuffer, (GLenum buf), (buf))
+STUB_VOID(PFNGLENABLEPROC, glEnable, (GLenum cap), (cap))
+STUB_VOID(PFNGLFINISHPROC, glFinish, (void), ())
+STUB_VOID(PFNGLFLUSHPROC, glFlush, (void), ())
+STUB_VOID(PFNGLFRONTFACEPROC, glFrontFace, (GLenum mode), (mode))
+STUB_VOID(PFNGLGETBOOLEANVPROC, glGetBooleanv, (GLenum pname, GLboolean* data), (pname, data))
+STUB_VOID(PFNGLGETDOUBLEVPROC, glGetDoublev, (GLenum pname, GLdouble* data), (pname, data))
+STUB(GLenum, PFNGLGETERRORPROC, glGetError, (void), ())
+STUB_VOID(PFNGLGETFLOATVPROC, glGetFloatv, (GLenum pname, GLfloat* data), (pname, data))
+STUB_VOID(PFNGLGETINTEGERVPROC, glGetIntegerv, (GLenum pname, GLint* data), (pname, data))
+STUB(GLubyte*, PFNGLGETSTRINGPROC, glGetString, (GLenum name), (name))
+STUB_VOID(PFNGLGETTEXIMAGEPROC, glGetTexImage, (GLenum target, GLint level, GLenum format, GLenum type, void* pixels), (target, level, format, type, pixels))
+STUB_VOID(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv, (GLenum target, GLint level, GLenum pname, GLfloat* params), (target, level, pname, params))
+STUB_VOID(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv, (GLenum target, GLint level, GLenum pname, GLint* params), (target, level, pname, params))
+STUB_VOID(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv, (GLenum target, GLenum pname, GLfloat* params), (target, pname, params))
+STUB_VOID(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv, (GLenum target, GLenum pname, GLint* params), (target, pname, params))
+STUB_VOID(PFNGLHINTPROC, glHint, (GLenum target, GLenum mode), (target, mode))
+STUB(GLboolean, PFNGLISENABLEDPROC, glIsEnabled, (GLenum cap), (cap))
+STUB_VOID(PFNGLLINEWIDTHPROC, glLineWidth, (GLfloat width), (width))
+STUB_VOID(PFNGLLOGICOPPROC, glLogicOp, (GLenum opcode), (opcode))
+STUB_VOID(PFNGLPIXELSTOREFPROC, glPixelStoref, (GLenum pname, GLfloat param), (pname, param))
+STUB_VOID(PFNGLPIXELSTOREIPROC, glPixelStorei, (GLenum pname, GLint param), (pname, param))
+STUB_VOID(PFNGLPOINTSIZEPROC, glPointSize, (GLfloat size), (size))
+STUB_VOID(PFNGLPOLYGONMODEPROC, glPolygonMode, (GLenum face, GLenum mode), (face, mode))
+STUB_VOID(PFNGLREADBUFFERPROC, glReadBuffer, (GLenum src), (src))
+STUB_VOID(PFNGLREADPIXELSPROC, glReadPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels), (x, y, width, height, format, type, pixels))
+STUB_VOID(PFNGLSCISSORPROC, glScissor, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+STUB_VOID(PFNGLSTENCILFUNCPROC, glStencilFunc, (GLenum func, GLint ref, GLuint mask), (func, ref, mask))
+STUB_VOID(PFNGLSTENCILMASKPROC, glStencilMask, (GLuint mask), (mask))
+STUB_VOID(PFNGLSTENCILOPPROC, glStencilOp, (GLenum fail, GLenum zfail, GLenum zpass), (fail, zfail, zpass))
+STUB_VOID(PFNGLTEXIMAGE1DPROC, glTexImage1D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, border, format, type, pixels))
+STUB_VOID(PFNGLTEXIMAGE2DPROC, glTexImage2D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, border, format, type, pixels))
+STUB_VOID(PFNGLTEXPARAMETERFPROC, glTexParameterf, (GLenum target, GLenum pname, GLfloat param), (target, pname, param))
+STUB_VOID(PFNGLTEXPARAMETERFVPROC, glTexParameterfv, (GLenum target, GLenum pname, const GLfloat* params), (target, pname, params))
+STUB_VOID(PFNGLTEXPARAMETERIPROC, glTexParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+STUB_VOID(PFNGLTEXPARAMETERIVPROC, glTexParameteriv, (GLenum target, GLenum pname, const GLint* params), (target, pname, params))
+STUB_VOID(PFNGLVIEWPORTPROC, glViewport, (GLint x, GLint y, GLsizei width, GLsizei height), (x, y, width, height))
+
+static void load_1_0(int mode)
 {
     if (!v1_0) return;
-    lx_glBlendFunc = load ? (PFNGLBLENDFUNCPROC) load_proc("glBlendFunc") : NULL;
-    lx_glClear = load ? (PFNGLCLEARPROC) load_proc("glClear") : NULL;
-    lx_glClearColor = load ? (PFNGLCLEARCOLORPROC) load_proc("glClearColor") : NULL;
-    lx_glClearDepth = load ? (PFNGLCLEARDEPTHPROC) load_proc("glClearDepth") : NULL;
-    lx_glClearStencil = load ? (PFNGLCLEARSTENCILPROC) load_proc("glClearStencil") : NULL;
-    lx_glColorMask = load ? (PFNGLCOLORMASKPROC) load_proc("glColorMask") : NULL;
-    lx_glCullFace = load ? (PFNGLCULLFACEPROC) load_proc("glCullFace") : NULL;
-    lx_glDepthFunc = load ? (PFNGLDEPTHFUNCPROC) load_proc("glDepthFunc") : NULL;
-    lx_glDepthMask = load ? (PFNGLDEPTHMASKPROC) load_proc("glDepthMask") : NULL;
-    lx_glDepthRange = load ? (PFNGLDEPTHRANGEPROC) load_proc("glDepthRange") : NULL;
-    lx_glDisable = load ? (PFNGLDISABLEPROC) load_proc("glDisable") : NULL;
-    lx_glDrawBuffer = load ? (PFNGLDRAWBUFFERPROC) load_proc("glDrawBuffer") : NULL;
-    lx_glEnable = load ? (PFNGLENABLEPROC) load_proc("glEnable") : NULL;
-    lx_glFinish = load ? (PFNGLFINISHPROC) load_proc("glFinish") : NULL;
-    lx_glFlush = load ? (PFNGLFLUSHPROC) load_proc("glFlush") : NULL;
-    lx_glFrontFace = load ? (PFNGLFRONTFACEPROC) load_proc("glFrontFace") : NULL;
-    lx_glGetBooleanv = load ? (PFNGLGETBOOLEANVPROC) load_proc("glGetBooleanv") : NULL;
-    lx_glGetDoublev = load ? (PFNGLGETDOUBLEVPROC) load_proc("glGetDoublev") : NULL;
-    lx_glGetError = load ? (PFNGLGETERRORPROC) load_proc("glGetError") : NULL;
-    lx_glGetFloatv = load ? (PFNGLGETFLOATVPROC) load_proc("glGetFloatv") : NULL;
-    lx_glGetIntegerv = load ? (PFNGLGETINTEGERVPROC) load_proc("glGetIntegerv") : NULL;
-    lx_glGetString = load ? (PFNGLGETSTRINGPROC) load_proc("glGetString") : NULL;
-    lx_glGetTexImage = load ? (PFNGLGETTEXIMAGEPROC) load_proc("glGetTexImage") : NULL;
-    lx_glGetTexLevelParameterfv = load ? (PFNGLGETTEXLEVELPARAMETERFVPROC) load_proc("glGetTexLevelParameterfv") : NULL;
-    lx_glGetTexLevelParameteriv = load ? (PFNGLGETTEXLEVELPARAMETERIVPROC) load_proc("glGetTexLevelParameteriv") : NULL;
-    lx_glGetTexParameterfv = load ? (PFNGLGETTEXPARAMETERFVPROC) load_proc("glGetTexParameterfv") : NULL;
-    lx_glGetTexParameteriv = load ? (PFNGLGETTEXPARAMETERIVPROC) load_proc("glGetTexParameteriv") : NULL;
-    lx_glHint = load ? (PFNGLHINTPROC) load_proc("glHint") : NULL;
-    lx_glIsEnabled = load ? (PFNGLISENABLEDPROC) load_proc("glIsEnabled") : NULL;
-    lx_glLineWidth = load ? (PFNGLLINEWIDTHPROC) load_proc("glLineWidth") : NULL;
-    lx_glLogicOp = load ? (PFNGLLOGICOPPROC) load_proc("glLogicOp") : NULL;
-    lx_glPixelStoref = load ? (PFNGLPIXELSTOREFPROC) load_proc("glPixelStoref") : NULL;
-    lx_glPixelStorei = load ? (PFNGLPIXELSTOREIPROC) load_proc("glPixelStorei") : NULL;
-    lx_glPointSize = load ? (PFNGLPOINTSIZEPROC) load_proc("glPointSize") : NULL;
-    lx_glPolygonMode = load ? (PFNGLPOLYGONMODEPROC) load_proc("glPolygonMode") : NULL;
-    lx_glReadBuffer = load ? (PFNGLREADBUFFERPROC) load_proc("glReadBuffer") : NULL;
-    lx_glReadPixels = load ? (PFNGLREADPIXELSPROC) load_proc("glReadPixels") : NULL;
-    lx_glScissor = load ? (PFNGLSCISSORPROC) load_proc("glScissor") : NULL;
-    lx_glStencilFunc = load ? (PFNGLSTENCILFUNCPROC) load_proc("glStencilFunc") : NULL;
-    lx_glStencilMask = load ? (PFNGLSTENCILMASKPROC) load_proc("glStencilMask") : NULL;
-    lx_glStencilOp = load ? (PFNGLSTENCILOPPROC) load_proc("glStencilOp") : NULL;
-    lx_glTexImage1D = load ? (PFNGLTEXIMAGE1DPROC) load_proc("glTexImage1D") : NULL;
-    lx_glTexImage2D = load ? (PFNGLTEXIMAGE2DPROC) load_proc("glTexImage2D") : NULL;
-    lx_glTexParameterf = load ? (PFNGLTEXPARAMETERFPROC) load_proc("glTexParameterf") : NULL;
-    lx_glTexParameterfv = load ? (PFNGLTEXPARAMETERFVPROC) load_proc("glTexParameterfv") : NULL;
-    lx_glTexParameteri = load ? (PFNGLTEXPARAMETERIPROC) load_proc("glTexParameteri") : NULL;
-    lx_glTexParameteriv = load ? (PFNGLTEXPARAMETERIVPROC) load_proc("glTexParameteriv") : NULL;
-    lx_glViewport = load ? (PFNGLVIEWPORTPROC) load_proc("glViewport") : NULL;
+    lx_glBlendFunc = LOAD(PFNGLBLENDFUNCPROC, glBlendFunc);
+    lx_glClear = LOAD(PFNGLCLEARPROC, glClear);
+    lx_glClearColor = LOAD(PFNGLCLEARCOLORPROC, glClearColor);
+    lx_glClearDepth = LOAD(PFNGLCLEARDEPTHPROC, glClearDepth);
+    lx_glClearStencil = LOAD(PFNGLCLEARSTENCILPROC, glClearStencil);
+    lx_glColorMask = LOAD(PFNGLCOLORMASKPROC, glColorMask);
+    lx_glCullFace = LOAD(PFNGLCULLFACEPROC, glCullFace);
+    lx_glDepthFunc = LOAD(PFNGLDEPTHFUNCPROC, glDepthFunc);
+    lx_glDepthMask = LOAD(PFNGLDEPTHMASKPROC, glDepthMask);
+    lx_glDepthRange = LOAD(PFNGLDEPTHRANGEPROC, glDepthRange);
+    lx_glDisable = LOAD(PFNGLDISABLEPROC, glDisable);
+    lx_glDrawBuffer = LOAD(PFNGLDRAWBUFFERPROC, glDrawBuffer);
+    lx_glEnable = LOAD(PFNGLENABLEPROC, glEnable);
+    lx_glFinish = LOAD(PFNGLFINISHPROC, glFinish);
+    lx_glFlush = LOAD(PFNGLFLUSHPROC, glFlush);
+    lx_glFrontFace = LOAD(PFNGLFRONTFACEPROC, glFrontFace);
+    lx_glGetBooleanv = LOAD(PFNGLGETBOOLEANVPROC, glGetBooleanv);
+    lx_glGetDoublev = LOAD(PFNGLGETDOUBLEVPROC, glGetDoublev);
+    lx_glGetError = LOAD(PFNGLGETERRORPROC, glGetError);
+    lx_glGetFloatv = LOAD(PFNGLGETFLOATVPROC, glGetFloatv);
+    lx_glGetIntegerv = LOAD(PFNGLGETINTEGERVPROC, glGetIntegerv);
+    lx_glGetString = LOAD(PFNGLGETSTRINGPROC, glGetString);
+    lx_glGetTexImage = LOAD(PFNGLGETTEXIMAGEPROC, glGetTexImage);
+    lx_glGetTexLevelParameterfv = LOAD(PFNGLGETTEXLEVELPARAMETERFVPROC, glGetTexLevelParameterfv);
+    lx_glGetTexLevelParameteriv = LOAD(PFNGLGETTEXLEVELPARAMETERIVPROC, glGetTexLevelParameteriv);
+    lx_glGetTexParameterfv = LOAD(PFNGLGETTEXPARAMETERFVPROC, glGetTexParameterfv);
+    lx_glGetTexParameteriv = LOAD(PFNGLGETTEXPARAMETERIVPROC, glGetTexParameteriv);
+    lx_glHint = LOAD(PFNGLHINTPROC, glHint);
+    lx_glIsEnabled = LOAD(PFNGLISENABLEDPROC, glIsEnabled);
+    lx_glLineWidth = LOAD(PFNGLLINEWIDTHPROC, glLineWidth);
+    lx_glLogicOp = LOAD(PFNGLLOGICOPPROC, glLogicOp);
+    lx_glPixelStoref = LOAD(PFNGLPIXELSTOREFPROC, glPixelStoref);
+    lx_glPixelStorei = LOAD(PFNGLPIXELSTOREIPROC, glPixelStorei);
+    lx_glPointSize = LOAD(PFNGLPOINTSIZEPROC, glPointSize);
+    lx_glPolygonMode = LOAD(PFNGLPOLYGONMODEPROC, glPolygonMode);
+    lx_glReadBuffer = LOAD(PFNGLREADBUFFERPROC, glReadBuffer);
+    lx_glReadPixels = LOAD(PFNGLREADPIXELSPROC, glReadPixels);
+    lx_glScissor = LOAD(PFNGLSCISSORPROC, glScissor);
+    lx_glStencilFunc = LOAD(PFNGLSTENCILFUNCPROC, glStencilFunc);
+    lx_glStencilMask = LOAD(PFNGLSTENCILMASKPROC, glStencilMask);
+    lx_glStencilOp = LOAD(PFNGLSTENCILOPPROC, glStencilOp);
+    lx_glTexImage1D = LOAD(PFNGLTEXIMAGE1DPROC, glTexImage1D);
+    lx_glTexImage2D = LOAD(PFNGLTEXIMAGE2DPROC, glTexImage2D);
+    lx_glTexParameterf = LOAD(PFNGLTEXPARAMETERFPROC, glTexParameterf);
+    lx_glTexParameterfv = LOAD(PFNGLTEXPARAMETERFVPROC, glTexParameterfv);
+    lx_glTexParameteri = LOAD(PFNGLTEXPARAMETERIPROC, glTexParameteri);
+    lx_glTexParameteriv = LOAD(PFNGLTEXPARAMETERIVPROC, glTexParameteriv);
+    lx_glViewport = LOAD(PFNGLVIEWPORTPROC, glViewport);
 }
 
 PFNGLBINDTEXTUREPROC lx_glBindTexture = NULL;
@@ -190,23 +304,38 @@ PFNGLPOLYGONOFFSETPROC lx_glPolygonOffset = NULL;
 PFNGLTEXSUBIMAGE1DPROC lx_glTexSubImage1D = NULL;
 PFNGLTEXSUBIMAGE2DPROC lx_glTexSubImage2D = NULL;
 
-static void load_1_1(int load)
+STUB_VOID(PFNGLBINDTEXTUREPROC, glBindTexture, (GLenum target, GLuint texture), (target, texture))
+STUB_VOID(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border), (target, level, internalformat, x, y, width, border))
+STUB_VOID(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border), (target, level, internalformat, x, y, width, height, border))
+STUB_VOID(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (target, level, xoffset, x, y, width))
+STUB_VOID(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, x, y, width, height))
+STUB_VOID(PFNGLDELETETEXTURESPROC, glDeleteTextures, (GLsizei n, const GLuint* textures), (n, textures))
+STUB_VOID(PFNGLDRAWARRAYSPROC, glDrawArrays, (GLenum mode, GLint first, GLsizei count), (mode, first, count))
+STUB_VOID(PFNGLDRAWELEMENTSPROC, glDrawElements, (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices))
+STUB_VOID(PFNGLGENTEXTURESPROC, glGenTextures, (GLsizei n, GLuint* textures), (n, textures))
+STUB_VOID(PFNGLGETPOINTERVPROC, glGetPointerv, (GLenum pname, void ** params), (pname, params))
+STUB(GLboolean, PFNGLISTEXTUREPROC, glIsTexture, (GLuint texture), (texture))
+STUB_VOID(PFNGLPOLYGONOFFSETPROC, glPolygonOffset, (GLfloat factor, GLfloat units), (factor, units))
+STUB_VOID(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, width, format, type, pixels))
+STUB_VOID(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, width, height, format, type, pixels))
+
+static void load_1_1(int mode)
 {
     if (!v1_1) return;
-    lx_glBindTexture = load ? (PFNGLBINDTEXTUREPROC) load_proc("glBindTexture") : NULL;
-    lx_glCopyTexImage1D = load ? (PFNGLCOPYTEXIMAGE1DPROC) load_proc("glCopyTexImage1D") : NULL;
-    lx_glCopyTexImage2D = load ? (PFNGLCOPYTEXIMAGE2DPROC) load_proc("glCopyTexImage2D") : NULL;
-    lx_glCopyTexSubImage1D = load ? (PFNGLCOPYTEXSUBIMAGE1DPROC) load_proc("glCopyTexSubImage1D") : NULL;
-    lx_glCopyTexSubImage2D = load ? (PFNGLCOPYTEXSUBIMAGE2DPROC) load_proc("glCopyTexSubImage2D") : NULL;
-    lx_glDeleteTextures = load ? (PFNGLDELETETEXTURESPROC) load_proc("glDeleteTextures") : NULL;
-    lx_glDrawArrays = load ? (PFNGLDRAWARRAYSPROC) load_proc("glDrawArrays") : NULL;
-    lx_glDrawElements = load ? (PFNGLDRAWELEMENTSPROC) load_proc("glDrawElements") : NULL;
-    lx_glGenTextures = load ? (PFNGLGENTEXTURESPROC) load_proc("glGenTextures") : NULL;
-    lx_glGetPointerv = load ? (PFNGLGETPOINTERVPROC) load_proc("glGetPointerv") : NULL;
-    lx_glIsTexture = load ? (PFNGLISTEXTUREPROC) load_proc("glIsTexture") : NULL;
-    lx_glPolygonOffset = load ? (PFNGLPOLYGONOFFSETPROC) load_proc("glPolygonOffset") : NULL;
-    lx_glTexSubImage1D = load ? (PFNGLTEXSUBIMAGE1DPROC) load_proc("glTexSubImage1D") : NULL;
-    lx_glTexSubImage2D = load ? (PFNGLTEXSUBIMAGE2DPROC) load_proc("glTexSubImage2D") : NULL;
+    lx_glBindTexture = LOAD(PFNGLBINDTEXTUREPROC, glBindTexture);
+    lx_glCopyTexImage1D = LOAD(PFNGLCOPYTEXIMAGE1DPROC, glCopyTexImage1D);
+    lx_glCopyTexImage2D = LOAD(PFNGLCOPYTEXIMAGE2DPROC, glCopyTexImage2D);
+    lx_glCopyTexSubImage1D = LOAD(PFNGLCOPYTEXSUBIMAGE1DPROC, glCopyTexSubImage1D);
+    lx_glCopyTexSubImage2D = LOAD(PFNGLCOPYTEXSUBIMAGE2DPROC, glCopyTexSubImage2D);
+    lx_glDeleteTextures = LOAD(PFNGLDELETETEXTURESPROC, glDeleteTextures);
+    lx_glDrawArrays = LOAD(PFNGLDRAWARRAYSPROC, glDrawArrays);
+    lx_glDrawElements = LOAD(PFNGLDRAWELEMENTSPROC, glDrawElements);
+    lx_glGenTextures = LOAD(PFNGLGENTEXTURESPROC, glGenTextures);
+    lx_glGetPointerv = LOAD(PFNGLGETPOINTERVPROC, glGetPointerv);
+    lx_glIsTexture = LOAD(PFNGLISTEXTUREPROC, glIsTexture);
+    lx_glPolygonOffset = LOAD(PFNGLPOLYGONOFFSETPROC, glPolygonOffset);
+    lx_glTexSubImage1D = LOAD(PFNGLTEXSUBIMAGE1DPROC, glTexSubImage1D);
+    lx_glTexSubImage2D = LOAD(PFNGLTEXSUBIMAGE2DPROC, glTexSubImage2D);
 }
 
 PFNGLCOPYTEXSUBIMAGE3DPROC lx_glCopyTexSubImage3D = NULL;
@@ -214,13 +343,18 @@ PFNGLDRAWRANGEELEMENTSPROC lx_glDrawRangeElements = NULL;
 PFNGLTEXIMAGE3DPROC lx_glTexImage3D = NULL;
 PFNGLTEXSUBIMAGE3DPROC lx_glTexSubImage3D = NULL;
 
-static void load_1_2(int load)
+STUB_VOID(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (target, level, xoffset, yoffset, zoffset, x, y, width, height))
+STUB_VOID(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices), (mode, start, end, count, type, indices))
+STUB_VOID(PFNGLTEXIMAGE3DPROC, glTexImage3D, (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void* pixels), (target, level, internalformat, width, height, depth, border, format, type, pixels))
+STUB_VOID(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+
+static void load_1_2(int mode)
 {
     if (!v1_2) return;
-    lx_glCopyTexSubImage3D = load ? (PFNGLCOPYTEXSUBIMAGE3DPROC) load_proc("glCopyTexSubImage3D") : NULL;
-    lx_glDrawRangeElements = load ? (PFNGLDRAWRANGEELEMENTSPROC) load_proc("glDrawRangeElements") : NULL;
-    lx_glTexImage3D = load ? (PFNGLTEXIMAGE3DPROC) load_proc("glTexImage3D") : NULL;
-    lx_glTexSubImage3D = load ? (PFNGLTEXSUBIMAGE3DPROC) load_proc("glTexSubImage3D") : NULL;
+    lx_glCopyTexSubImage3D = LOAD(PFNGLCOPYTEXSUBIMAGE3DPROC, glCopyTexSubImage3D);
+    lx_glDrawRangeElements = LOAD(PFNGLDRAWRANGEELEMENTSPROC, glDrawRangeElements);
+    lx_glTexImage3D = LOAD(PFNGLTEXIMAGE3DPROC, glTexImage3D);
+    lx_glTexSubImage3D = LOAD(PFNGLTEXSUBIMAGE3DPROC, glTexSubImage3D);
 }
 
 PFNGLACTIVETEXTUREPROC lx_glActiveTexture = NULL;
@@ -233,18 +367,28 @@ PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC lx_glCompressedTexSubImage3D = NULL;
 PFNGLGETCOMPRESSEDTEXIMAGEPROC lx_glGetCompressedTexImage = NULL;
 PFNGLSAMPLECOVERAGEPROC lx_glSampleCoverage = NULL;
 
-static void load_1_3(int load)
+STUB_VOID(PFNGLACTIVETEXTUREPROC, glActiveTexture, (GLenum texture), (texture))
+STUB_VOID(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, border, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, border, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D, (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void* data), (target, level, internalformat, width, height, depth, border, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D, (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, width, format, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, width, height, format, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D, (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data), (target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+STUB_VOID(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage, (GLenum target, GLint level, void* img), (target, level, img))
+STUB_VOID(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage, (GLfloat value, GLboolean invert), (value, invert))
+
+static void load_1_3(int mode)
 {
     if (!v1_3) return;
-    lx_glActiveTexture = load ? (PFNGLACTIVETEXTUREPROC) load_proc("glActiveTexture") : NULL;
-    lx_glCompressedTexImage1D = load ? (PFNGLCOMPRESSEDTEXIMAGE1DPROC) load_proc("glCompressedTexImage1D") : NULL;
-    lx_glCompressedTexImage2D = load ? (PFNGLCOMPRESSEDTEXIMAGE2DPROC) load_proc("glCompressedTexImage2D") : NULL;
-    lx_glCompressedTexImage3D = load ? (PFNGLCOMPRESSEDTEXIMAGE3DPROC) load_proc("glCompressedTexImage3D") : NULL;
-    lx_glCompressedTexSubImage1D = load ? (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC) load_proc("glCompressedTexSubImage1D") : NULL;
-    lx_glCompressedTexSubImage2D = load ? (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC) load_proc("glCompressedTexSubImage2D") : NULL;
-    lx_glCompressedTexSubImage3D = load ? (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC) load_proc("glCompressedTexSubImage3D") : NULL;
-    lx_glGetCompressedTexImage = load ? (PFNGLGETCOMPRESSEDTEXIMAGEPROC) load_proc("glGetCompressedTexImage") : NULL;
-    lx_glSampleCoverage = load ? (PFNGLSAMPLECOVERAGEPROC) load_proc("glSampleCoverage") : NULL;
+    lx_glActiveTexture = LOAD(PFNGLACTIVETEXTUREPROC, glActiveTexture);
+    lx_glCompressedTexImage1D = LOAD(PFNGLCOMPRESSEDTEXIMAGE1DPROC, glCompressedTexImage1D);
+    lx_glCompressedTexImage2D = LOAD(PFNGLCOMPRESSEDTEXIMAGE2DPROC, glCompressedTexImage2D);
+    lx_glCompressedTexImage3D = LOAD(PFNGLCOMPRESSEDTEXIMAGE3DPROC, glCompressedTexImage3D);
+    lx_glCompressedTexSubImage1D = LOAD(PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC, glCompressedTexSubImage1D);
+    lx_glCompressedTexSubImage2D = LOAD(PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC, glCompressedTexSubImage2D);
+    lx_glCompressedTexSubImage3D = LOAD(PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC, glCompressedTexSubImage3D);
+    lx_glGetCompressedTexImage = LOAD(PFNGLGETCOMPRESSEDTEXIMAGEPROC, glGetCompressedTexImage);
+    lx_glSampleCoverage = LOAD(PFNGLSAMPLECOVERAGEPROC, glSampleCoverage);
 }
 
 PFNGLBLENDCOLORPROC lx_glBlendColor = NULL;
@@ -257,18 +401,28 @@ PFNGLPOINTPARAMETERFVPROC lx_glPointParameterfv = NULL;
 PFNGLPOINTPARAMETERIPROC lx_glPointParameteri = NULL;
 PFNGLPOINTPARAMETERIVPROC lx_glPointParameteriv = NULL;
 
-static void load_1_4(int load)
+STUB_VOID(PFNGLBLENDCOLORPROC, glBlendColor, (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha), (red, green, blue, alpha))
+STUB_VOID(PFNGLBLENDEQUATIONPROC, glBlendEquation, (GLenum mode), (mode))
+STUB_VOID(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate, (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha), (sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+STUB_VOID(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays, (GLenum mode, const GLint* first, const GLsizei* count, GLsizei drawcount), (mode, first, count, drawcount))
+STUB_VOID(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements, (GLenum mode, const GLsizei* count, GLenum type, const void *const* indices, GLsizei drawcount), (mode, count, type, indices, drawcount))
+STUB_VOID(PFNGLPOINTPARAMETERFPROC, glPointParameterf, (GLenum pname, GLfloat param), (pname, param))
+STUB_VOID(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv, (GLenum pname, const GLfloat* params), (pname, params))
+STUB_VOID(PFNGLPOINTPARAMETERIPROC, glPointParameteri, (GLenum pname, GLint param), (pname, param))
+STUB_VOID(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv, (GLenum pname, const GLint* params), (pname, params))
+
+static void load_1_4(int mode)
 {
     if (!v1_4) return;
-    lx_glBlendColor = load ? (PFNGLBLENDCOLORPROC) load_proc("glBlendColor") : NULL;
-    lx_glBlendEquation = load ? (PFNGLBLENDEQUATIONPROC) load_proc("glBlendEquation") : NULL;
-    lx_glBlendFuncSeparate = load ? (PFNGLBLENDFUNCSEPARATEPROC) load_proc("glBlendFuncSeparate") : NULL;
-    lx_glMultiDrawArrays = load ? (PFNGLMULTIDRAWARRAYSPROC) load_proc("glMultiDrawArrays") : NULL;
-    lx_glMultiDrawElements = load ? (PFNGLMULTIDRAWELEMENTSPROC) load_proc("glMultiDrawElements") : NULL;
-    lx_glPointParameterf = load ? (PFNGLPOINTPARAMETERFPROC) load_proc("glPointParameterf") : NULL;
-    lx_glPointParameterfv = load ? (PFNGLPOINTPARAMETERFVPROC) load_proc("glPointParameterfv") : NULL;
-    lx_glPointParameteri = load ? (PFNGLPOINTPARAMETERIPROC) load_proc("glPointParameteri") : NULL;
-    lx_glPointParameteriv = load ? (PFNGLPOINTPARAMETERIVPROC) load_proc("glPointParameteriv") : NULL;
+    lx_glBlendColor = LOAD(PFNGLBLENDCOLORPROC, glBlendColor);
+    lx_glBlendEquation = LOAD(PFNGLBLENDEQUATIONPROC, glBlendEquation);
+    lx_glBlendFuncSeparate = LOAD(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate);
+    lx_glMultiDrawArrays = LOAD(PFNGLMULTIDRAWARRAYSPROC, glMultiDrawArrays);
+    lx_glMultiDrawElements = LOAD(PFNGLMULTIDRAWELEMENTSPROC, glMultiDrawElements);
+    lx_glPointParameterf = LOAD(PFNGLPOINTPARAMETERFPROC, glPointParameterf);
+    lx_glPointParameterfv = LOAD(PFNGLPOINTPARAMETERFVPROC, glPointParameterfv);
+    lx_glPointParameteri = LOAD(PFNGLPOINTPARAMETERIPROC, glPointParameteri);
+    lx_glPointParameteriv = LOAD(PFNGLPOINTPARAMETERIVPROC, glPointParameteriv);
 }
 
 PFNGLBEGINQUERYPROC lx_glBeginQuery = NULL;
@@ -291,28 +445,48 @@ PFNGLISQUERYPROC lx_glIsQuery = NULL;
 PFNGLMAPBUFFERPROC lx_glMapBuffer = NULL;
 PFNGLUNMAPBUFFERPROC lx_glUnmapBuffer = NULL;
 
-static void load_1_5(int load)
+STUB_VOID(PFNGLBEGINQUERYPROC, glBeginQuery, (GLenum target, GLuint id), (target, id))
+STUB_VOID(PFNGLBINDBUFFERPROC, glBindBuffer, (GLenum target, GLuint buffer), (target, buffer))
+STUB_VOID(PFNGLBUFFERDATAPROC, glBufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), (target, size, data, usage))
+STUB_VOID(PFNGLBUFFERSUBDATAPROC, glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), (target, offset, size, data))
+STUB_VOID(PFNGLDELETEBUFFERSPROC, glDeleteBuffers, (GLsizei n, const GLuint* buffers), (n, buffers))
+STUB_VOID(PFNGLDELETEQUERIESPROC, glDeleteQueries, (GLsizei n, const GLuint* ids), (n, ids))
+STUB_VOID(PFNGLENDQUERYPROC, glEndQuery, (GLenum target), (target))
+STUB_VOID(PFNGLGENBUFFERSPROC, glGenBuffers, (GLsizei n, GLuint* buffers), (n, buffers))
+STUB_VOID(PFNGLGENQUERIESPROC, glGenQueries, (GLsizei n, GLuint* ids), (n, ids))
+STUB_VOID(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv, (GLenum target, GLenum pname, GLint* params), (target, pname, params))
+STUB_VOID(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv, (GLenum target, GLenum pname, void ** params), (target, pname, params))
+STUB_VOID(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, void* data), (target, offset, size, data))
+STUB_VOID(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv, (GLuint id, GLenum pname, GLint* params), (id, pname, params))
+STUB_VOID(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv, (GLuint id, GLenum pname, GLuint* params), (id, pname, params))
+STUB_VOID(PFNGLGETQUERYIVPROC, glGetQueryiv, (GLenum target, GLenum pname, GLint* params), (target, pname, params))
+STUB(GLboolean, PFNGLISBUFFERPROC, glIsBuffer, (GLuint buffer), (buffer))
+STUB(GLboolean, PFNGLISQUERYPROC, glIsQuery, (GLuint id), (id))
+STUB(void*, PFNGLMAPBUFFERPROC, glMapBuffer, (GLenum target, GLenum access), (target, access))
+STUB(GLboolean, PFNGLUNMAPBUFFERPROC, glUnmapBuffer, (GLenum target), (target))
+
+static void load_1_5(int mode)
 {
     if (!v1_5) return;
-    lx_glBeginQuery = load ? (PFNGLBEGINQUERYPROC) load_proc("glBeginQuery") : NULL;
-    lx_glBindBuffer = load ? (PFNGLBINDBUFFERPROC) load_proc("glBindBuffer") : NULL;
-    lx_glBufferData = load ? (PFNGLBUFFERDATAPROC) load_proc("glBufferData") : NULL;
-    lx_glBufferSubData = load ? (PFNGLBUFFERSUBDATAPROC) load_proc("glBufferSubData") : NULL;
-    lx_glDeleteBuffers = load ? (PFNGLDELETEBUFFERSPROC) load_proc("glDeleteBuffers") : NULL;
-    lx_glDeleteQueries = load ? (PFNGLDELETEQUERIESPROC) load_proc("glDeleteQueries") : NULL;
-    lx_glEndQuery = load ? (PFNGLENDQUERYPROC) load_proc("glEndQuery") : NULL;
-    lx_glGenBuffers = load ? (PFNGLGENBUFFERSPROC) load_proc("glGenBuffers") : NULL;
-    lx_glGenQueries = load ? (PFNGLGENQUERIESPROC) load_proc("glGenQueries") : NULL;
-    lx_glGetBufferParameteriv = load ? (PFNGLGETBUFFERPARAMETERIVPROC) load_proc("glGetBufferParameteriv") : NULL;
-    lx_glGetBufferPointerv = load ? (PFNGLGETBUFFERPOINTERVPROC) load_proc("glGetBufferPointerv") : NULL;
-    lx_glGetBufferSubData = load ? (PFNGLGETBUFFERSUBDATAPROC) load_proc("glGetBufferSubData") : NULL;
-    lx_glGetQueryObjectiv = load ? (PFNGLGETQUERYOBJECTIVPROC) load_proc("glGetQueryObjectiv") : NULL;
-    lx_glGetQueryObjectuiv = load ? (PFNGLGETQUERYOBJECTUIVPROC) load_proc("glGetQueryObjectuiv") : NULL;
-    lx_glGetQueryiv = load ? (PFNGLGETQUERYIVPROC) load_proc("glGetQueryiv") : NULL;
-    lx_glIsBuffer = load ? (PFNGLISBUFFERPROC) load_proc("glIsBuffer") : NULL;
-    lx_glIsQuery = load ? (PFNGLISQUERYPROC) load_proc("glIsQuery") : NULL;
-    lx_glMapBuffer = load ? (PFNGLMAPBUFFERPROC) load_proc("glMapBuffer") : NULL;
-    lx_glUnmapBuffer = load ? (PFNGLUNMAPBUFFERPROC) load_proc("glUnmapBuffer") : NULL;
+    lx_glBeginQuery = LOAD(PFNGLBEGINQUERYPROC, glBeginQuery);
+    lx_glBindBuffer = LOAD(PFNGLBINDBUFFERPROC, glBindBuffer);
+    lx_glBufferData = LOAD(PFNGLBUFFERDATAPROC, glBufferData);
+    lx_glBufferSubData = LOAD(PFNGLBUFFERSUBDATAPROC, glBufferSubData);
+    lx_glDeleteBuffers = LOAD(PFNGLDELETEBUFFERSPROC, glDeleteBuffers);
+    lx_glDeleteQueries = LOAD(PFNGLDELETEQUERIESPROC, glDeleteQueries);
+    lx_glEndQuery = LOAD(PFNGLENDQUERYPROC, glEndQuery);
+    lx_glGenBuffers = LOAD(PFNGLGENBUFFERSPROC, glGenBuffers);
+    lx_glGenQueries = LOAD(PFNGLGENQUERIESPROC, glGenQueries);
+    lx_glGetBufferParameteriv = LOAD(PFNGLGETBUFFERPARAMETERIVPROC, glGetBufferParameteriv);
+    lx_glGetBufferPointerv = LOAD(PFNGLGETBUFFERPOINTERVPROC, glGetBufferPointerv);
+    lx_glGetBufferSubData = LOAD(PFNGLGETBUFFERSUBDATAPROC, glGetBufferSubData);
+    lx_glGetQueryObjectiv = LOAD(PFNGLGETQUERYOBJECTIVPROC, glGetQueryObjectiv);
+    lx_glGetQueryObjectuiv = LOAD(PFNGLGETQUERYOBJECTUIVPROC, glGetQueryObjectuiv);
+    lx_glGetQueryiv = LOAD(PFNGLGETQUERYIVPROC, glGetQueryiv);
+    lx_glIsBuffer = LOAD(PFNGLISBUFFERPROC, glIsBuffer);
+    lx_glIsQuery = LOAD(PFNGLISQUERYPROC, glIsQuery);
+    lx_glMapBuffer = LOAD(PFNGLMAPBUFFERPROC, glMapBuffer);
+    lx_glUnmapBuffer = LOAD(PFNGLUNMAPBUFFERPROC, glUnmapBuffer);
 }
 
 PFNGLATTACHSHADERPROC lx_glAttachShader = NULL;
@@ -409,102 +583,196 @@ PFNGLVERTEXATTRIB4UIVPROC lx_glVertexAttrib4uiv = NULL;
 PFNGLVERTEXATTRIB4USVPROC lx_glVertexAttrib4usv = NULL;
 PFNGLVERTEXATTRIBPOINTERPROC lx_glVertexAttribPointer = NULL;
 
-static void load_2_0(int load)
+STUB_VOID(PFNGLATTACHSHADERPROC, glAttachShader, (GLuint program, GLuint shader), (program, shader))
+STUB_VOID(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation, (GLuint program, GLuint index, const GLchar* name), (program, index, name))
+STUB_VOID(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate, (GLenum modeRGB, GLenum modeAlpha), (modeRGB, modeAlpha))
+STUB_VOID(PFNGLCOMPILESHADERPROC, glCompileShader, (GLuint shader), (shader))
+STUB(GLuint, PFNGLCREATEPROGRAMPROC, glCreateProgram, (void), ())
+STUB(GLuint, PFNGLCREATESHADERPROC, glCreateShader, (GLenum type), (type))
+STUB_VOID(PFNGLDELETEPROGRAMPROC, glDeleteProgram, (GLuint program), (program))
+STUB_VOID(PFNGLDELETESHADERPROC, glDeleteShader, (GLuint shader), (shader))
+STUB_VOID(PFNGLDETACHSHADERPROC, glDetachShader, (GLuint program, GLuint shader), (program, shader))
+STUB_VOID(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray, (GLuint index), (index))
+STUB_VOID(PFNGLDRAWBUFFERSPROC, glDrawBuffers, (GLsizei n, const GLenum* bufs), (n, bufs))
+STUB_VOID(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray, (GLuint index), (index))
+STUB_VOID(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name))
+STUB_VOID(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLint* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name))
+STUB_VOID(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders, (GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders), (program, maxCount, count, shaders))
+STUB(GLint, PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation, (GLuint program, const GLchar* name), (program, name))
+STUB_VOID(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog, (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (program, bufSize, length, infoLog))
+STUB_VOID(PFNGLGETPROGRAMIVPROC, glGetProgramiv, (GLuint program, GLenum pname, GLint* params), (program, pname, params))
+STUB_VOID(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (shader, bufSize, length, infoLog))
+STUB_VOID(PFNGLGETSHADERSOURCEPROC, glGetShaderSource, (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* source), (shader, bufSize, length, source))
+STUB_VOID(PFNGLGETSHADERIVPROC, glGetShaderiv, (GLuint shader, GLenum pname, GLint* params), (shader, pname, params))
+STUB(GLint, PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation, (GLuint program, const GLchar* name), (program, name))
+STUB_VOID(PFNGLGETUNIFORMFVPROC, glGetUniformfv, (GLuint program, GLint location, GLfloat* params), (program, location, params))
+STUB_VOID(PFNGLGETUNIFORMIVPROC, glGetUniformiv, (GLuint program, GLint location, GLint* params), (program, location, params))
+STUB_VOID(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv, (GLuint index, GLenum pname, void ** pointer), (index, pname, pointer))
+STUB_VOID(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv, (GLuint index, GLenum pname, GLdouble* params), (index, pname, params))
+STUB_VOID(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv, (GLuint index, GLenum pname, GLfloat* params), (index, pname, params))
+STUB_VOID(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv, (GLuint index, GLenum pname, GLint* params), (index, pname, params))
+STUB(GLboolean, PFNGLISPROGRAMPROC, glIsProgram, (GLuint program), (program))
+STUB(GLboolean, PFNGLISSHADERPROC, glIsShader, (GLuint shader), (shader))
+STUB_VOID(PFNGLLINKPROGRAMPROC, glLinkProgram, (GLuint program), (program))
+STUB_VOID(PFNGLSHADERSOURCEPROC, glShaderSource, (GLuint shader, GLsizei count, const GLchar *const* string, const GLint* length), (shader, count, string, length))
+STUB_VOID(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate, (GLenum face, GLenum func, GLint ref, GLuint mask), (face, func, ref, mask))
+STUB_VOID(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate, (GLenum face, GLuint mask), (face, mask))
+STUB_VOID(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate, (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass), (face, sfail, dpfail, dppass))
+STUB_VOID(PFNGLUNIFORM1FPROC, glUniform1f, (GLint location, GLfloat v0), (location, v0))
+STUB_VOID(PFNGLUNIFORM1FVPROC, glUniform1fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM1IPROC, glUniform1i, (GLint location, GLint v0), (location, v0))
+STUB_VOID(PFNGLUNIFORM1IVPROC, glUniform1iv, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM2FPROC, glUniform2f, (GLint location, GLfloat v0, GLfloat v1), (location, v0, v1))
+STUB_VOID(PFNGLUNIFORM2FVPROC, glUniform2fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM2IPROC, glUniform2i, (GLint location, GLint v0, GLint v1), (location, v0, v1))
+STUB_VOID(PFNGLUNIFORM2IVPROC, glUniform2iv, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM3FPROC, glUniform3f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (location, v0, v1, v2))
+STUB_VOID(PFNGLUNIFORM3FVPROC, glUniform3fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM3IPROC, glUniform3i, (GLint location, GLint v0, GLint v1, GLint v2), (location, v0, v1, v2))
+STUB_VOID(PFNGLUNIFORM3IVPROC, glUniform3iv, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM4FPROC, glUniform4f, (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (location, v0, v1, v2, v3))
+STUB_VOID(PFNGLUNIFORM4FVPROC, glUniform4fv, (GLint location, GLsizei count, const GLfloat* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM4IPROC, glUniform4i, (GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (location, v0, v1, v2, v3))
+STUB_VOID(PFNGLUNIFORM4IVPROC, glUniform4iv, (GLint location, GLsizei count, const GLint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUSEPROGRAMPROC, glUseProgram, (GLuint program), (program))
+STUB_VOID(PFNGLVALIDATEPROGRAMPROC, glValidateProgram, (GLuint program), (program))
+STUB_VOID(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d, (GLuint index, GLdouble x), (index, x))
+STUB_VOID(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f, (GLuint index, GLfloat x), (index, x))
+STUB_VOID(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv, (GLuint index, const GLfloat* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s, (GLuint index, GLshort x), (index, x))
+STUB_VOID(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv, (GLuint index, const GLshort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+STUB_VOID(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f, (GLuint index, GLfloat x, GLfloat y), (index, x, y))
+STUB_VOID(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv, (GLuint index, const GLfloat* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s, (GLuint index, GLshort x, GLshort y), (index, x, y))
+STUB_VOID(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv, (GLuint index, const GLshort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+STUB_VOID(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f, (GLuint index, GLfloat x, GLfloat y, GLfloat z), (index, x, y, z))
+STUB_VOID(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv, (GLuint index, const GLfloat* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s, (GLuint index, GLshort x, GLshort y, GLshort z), (index, x, y, z))
+STUB_VOID(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv, (GLuint index, const GLshort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv, (GLuint index, const GLbyte* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv, (GLuint index, const GLshort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub, (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv, (GLuint index, const GLubyte* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv, (GLuint index, const GLuint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv, (GLuint index, const GLushort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv, (GLuint index, const GLbyte* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f, (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv, (GLuint index, const GLfloat* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s, (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv, (GLuint index, const GLshort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv, (GLuint index, const GLubyte* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv, (GLuint index, const GLuint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv, (GLuint index, const GLushort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer, (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer), (index, size, type, normalized, stride, pointer))
+
+static void load_2_0(int mode)
 {
     if (!v2_0) return;
-    lx_glAttachShader = load ? (PFNGLATTACHSHADERPROC) load_proc("glAttachShader") : NULL;
-    lx_glBindAttribLocation = load ? (PFNGLBINDATTRIBLOCATIONPROC) load_proc("glBindAttribLocation") : NULL;
-    lx_glBlendEquationSeparate = load ? (PFNGLBLENDEQUATIONSEPARATEPROC) load_proc("glBlendEquationSeparate") : NULL;
-    lx_glCompileShader = load ? (PFNGLCOMPILESHADERPROC) load_proc("glCompileShader") : NULL;
-    lx_glCreateProgram = load ? (PFNGLCREATEPROGRAMPROC) load_proc("glCreateProgram") : NULL;
-    lx_glCreateShader = load ? (PFNGLCREATESHADERPROC) load_proc("glCreateShader") : NULL;
-    lx_glDeleteProgram = load ? (PFNGLDELETEPROGRAMPROC) load_proc("glDeleteProgram") : NULL;
-    lx_glDeleteShader = load ? (PFNGLDELETESHADERPROC) load_proc("glDeleteShader") : NULL;
-    lx_glDetachShader = load ? (PFNGLDETACHSHADERPROC) load_proc("glDetachShader") : NULL;
-    lx_glDisableVertexAttribArray = load ? (PFNGLDISABLEVERTEXATTRIBARRAYPROC) load_proc("glDisableVertexAttribArray") : NULL;
-    lx_glDrawBuffers = load ? (PFNGLDRAWBUFFERSPROC) load_proc("glDrawBuffers") : NULL;
-    lx_glEnableVertexAttribArray = load ? (PFNGLENABLEVERTEXATTRIBARRAYPROC) load_proc("glEnableVertexAttribArray") : NULL;
-    lx_glGetActiveAttrib = load ? (PFNGLGETACTIVEATTRIBPROC) load_proc("glGetActiveAttrib") : NULL;
-    lx_glGetActiveUniform = load ? (PFNGLGETACTIVEUNIFORMPROC) load_proc("glGetActiveUniform") : NULL;
-    lx_glGetAttachedShaders = load ? (PFNGLGETATTACHEDSHADERSPROC) load_proc("glGetAttachedShaders") : NULL;
-    lx_glGetAttribLocation = load ? (PFNGLGETATTRIBLOCATIONPROC) load_proc("glGetAttribLocation") : NULL;
-    lx_glGetProgramInfoLog = load ? (PFNGLGETPROGRAMINFOLOGPROC) load_proc("glGetProgramInfoLog") : NULL;
-    lx_glGetProgramiv = load ? (PFNGLGETPROGRAMIVPROC) load_proc("glGetProgramiv") : NULL;
-    lx_glGetShaderInfoLog = load ? (PFNGLGETSHADERINFOLOGPROC) load_proc("glGetShaderInfoLog") : NULL;
-    lx_glGetShaderSource = load ? (PFNGLGETSHADERSOURCEPROC) load_proc("glGetShaderSource") : NULL;
-    lx_glGetShaderiv = load ? (PFNGLGETSHADERIVPROC) load_proc("glGetShaderiv") : NULL;
-    lx_glGetUniformLocation = load ? (PFNGLGETUNIFORMLOCATIONPROC) load_proc("glGetUniformLocation") : NULL;
-    lx_glGetUniformfv = load ? (PFNGLGETUNIFORMFVPROC) load_proc("glGetUniformfv") : NULL;
-    lx_glGetUniformiv = load ? (PFNGLGETUNIFORMIVPROC) load_proc("glGetUniformiv") : NULL;
-    lx_glGetVertexAttribPointerv = load ? (PFNGLGETVERTEXATTRIBPOINTERVPROC) load_proc("glGetVertexAttribPointerv") : NULL;
-    lx_glGetVertexAttribdv = load ? (PFNGLGETVERTEXATTRIBDVPROC) load_proc("glGetVertexAttribdv") : NULL;
-    lx_glGetVertexAttribfv = load ? (PFNGLGETVERTEXATTRIBFVPROC) load_proc("glGetVertexAttribfv") : NULL;
-    lx_glGetVertexAttribiv = load ? (PFNGLGETVERTEXATTRIBIVPROC) load_proc("glGetVertexAttribiv") : NULL;
-    lx_glIsProgram = load ? (PFNGLISPROGRAMPROC) load_proc("glIsProgram") : NULL;
-    lx_glIsShader = load ? (PFNGLISSHADERPROC) load_proc("glIsShader") : NULL;
-    lx_glLinkProgram = load ? (PFNGLLINKPROGRAMPROC) load_proc("glLinkProgram") : NULL;
-    lx_glShaderSource = load ? (PFNGLSHADERSOURCEPROC) load_proc("glShaderSource") : NULL;
-    lx_glStencilFuncSeparate = load ? (PFNGLSTENCILFUNCSEPARATEPROC) load_proc("glStencilFuncSeparate") : NULL;
-    lx_glStencilMaskSeparate = load ? (PFNGLSTENCILMASKSEPARATEPROC) load_proc("glStencilMaskSeparate") : NULL;
-    lx_glStencilOpSeparate = load ? (PFNGLSTENCILOPSEPARATEPROC) load_proc("glStencilOpSeparate") : NULL;
-    lx_glUniform1f = load ? (PFNGLUNIFORM1FPROC) load_proc("glUniform1f") : NULL;
-    lx_glUniform1fv = load ? (PFNGLUNIFORM1FVPROC) load_proc("glUniform1fv") : NULL;
-    lx_glUniform1i = load ? (PFNGLUNIFORM1IPROC) load_proc("glUniform1i") : NULL;
-    lx_glUniform1iv = load ? (PFNGLUNIFORM1IVPROC) load_proc("glUniform1iv") : NULL;
-    lx_glUniform2f = load ? (PFNGLUNIFORM2FPROC) load_proc("glUniform2f") : NULL;
-    lx_glUniform2fv = load ? (PFNGLUNIFORM2FVPROC) load_proc("glUniform2fv") : NULL;
-    lx_glUniform2i = load ? (PFNGLUNIFORM2IPROC) load_proc("glUniform2i") : NULL;
-    lx_glUniform2iv = load ? (PFNGLUNIFORM2IVPROC) load_proc("glUniform2iv") : NULL;
-    lx_glUniform3f = load ? (PFNGLUNIFORM3FPROC) load_proc("glUniform3f") : NULL;
-    lx_glUniform3fv = load ? (PFNGLUNIFORM3FVPROC) load_proc("glUniform3fv") : NULL;
-    lx_glUniform3i = load ? (PFNGLUNIFORM3IPROC) load_proc("glUniform3i") : NULL;
-    lx_glUniform3iv = load ? (PFNGLUNIFORM3IVPROC) load_proc("glUniform3iv") : NULL;
-    lx_glUniform4f = load ? (PFNGLUNIFORM4FPROC) load_proc("glUniform4f") : NULL;
-    lx_glUniform4fv = load ? (PFNGLUNIFORM4FVPROC) load_proc("glUniform4fv") : NULL;
-    lx_glUniform4i = load ? (PFNGLUNIFORM4IPROC) load_proc("glUniform4i") : NULL;
-    lx_glUniform4iv = load ? (PFNGLUNIFORM4IVPROC) load_proc("glUniform4iv") : NULL;
-    lx_glUniformMatrix2fv = load ? (PFNGLUNIFORMMATRIX2FVPROC) load_proc("glUniformMatrix2fv") : NULL;
-    lx_glUniformMatrix3fv = load ? (PFNGLUNIFORMMATRIX3FVPROC) load_proc("glUniformMatrix3fv") : NULL;
-    lx_glUniformMatrix4fv = load ? (PFNGLUNIFORMMATRIX4FVPROC) load_proc("glUniformMatrix4fv") : NULL;
-    lx_glUseProgram = load ? (PFNGLUSEPROGRAMPROC) load_proc("glUseProgram") : NULL;
-    lx_glValidateProgram = load ? (PFNGLVALIDATEPROGRAMPROC) load_proc("glValidateProgram") : NULL;
-    lx_glVertexAttrib1d = load ? (PFNGLVERTEXATTRIB1DPROC) load_proc("glVertexAttrib1d") : NULL;
-    lx_glVertexAttrib1dv = load ? (PFNGLVERTEXATTRIB1DVPROC) load_proc("glVertexAttrib1dv") : NULL;
-    lx_glVertexAttrib1f = load ? (PFNGLVERTEXATTRIB1FPROC) load_proc("glVertexAttrib1f") : NULL;
-    lx_glVertexAttrib1fv = load ? (PFNGLVERTEXATTRIB1FVPROC) load_proc("glVertexAttrib1fv") : NULL;
-    lx_glVertexAttrib1s = load ? (PFNGLVERTEXATTRIB1SPROC) load_proc("glVertexAttrib1s") : NULL;
-    lx_glVertexAttrib1sv = load ? (PFNGLVERTEXATTRIB1SVPROC) load_proc("glVertexAttrib1sv") : NULL;
-    lx_glVertexAttrib2d = load ? (PFNGLVERTEXATTRIB2DPROC) load_proc("glVertexAttrib2d") : NULL;
-    lx_glVertexAttrib2dv = load ? (PFNGLVERTEXATTRIB2DVPROC) load_proc("glVertexAttrib2dv") : NULL;
-    lx_glVertexAttrib2f = load ? (PFNGLVERTEXATTRIB2FPROC) load_proc("glVertexAttrib2f") : NULL;
-    lx_glVertexAttrib2fv = load ? (PFNGLVERTEXATTRIB2FVPROC) load_proc("glVertexAttrib2fv") : NULL;
-    lx_glVertexAttrib2s = load ? (PFNGLVERTEXATTRIB2SPROC) load_proc("glVertexAttrib2s") : NULL;
-    lx_glVertexAttrib2sv = load ? (PFNGLVERTEXATTRIB2SVPROC) load_proc("glVertexAttrib2sv") : NULL;
-    lx_glVertexAttrib3d = load ? (PFNGLVERTEXATTRIB3DPROC) load_proc("glVertexAttrib3d") : NULL;
-    lx_glVertexAttrib3dv = load ? (PFNGLVERTEXATTRIB3DVPROC) load_proc("glVertexAttrib3dv") : NULL;
-    lx_glVertexAttrib3f = load ? (PFNGLVERTEXATTRIB3FPROC) load_proc("glVertexAttrib3f") : NULL;
-    lx_glVertexAttrib3fv = load ? (PFNGLVERTEXATTRIB3FVPROC) load_proc("glVertexAttrib3fv") : NULL;
-    lx_glVertexAttrib3s = load ? (PFNGLVERTEXATTRIB3SPROC) load_proc("glVertexAttrib3s") : NULL;
-    lx_glVertexAttrib3sv = load ? (PFNGLVERTEXATTRIB3SVPROC) load_proc("glVertexAttrib3sv") : NULL;
-    lx_glVertexAttrib4Nbv = load ? (PFNGLVERTEXATTRIB4NBVPROC) load_proc("glVertexAttrib4Nbv") : NULL;
-    lx_glVertexAttrib4Niv = load ? (PFNGLVERTEXATTRIB4NIVPROC) load_proc("glVertexAttrib4Niv") : NULL;
-    lx_glVertexAttrib4Nsv = load ? (PFNGLVERTEXATTRIB4NSVPROC) load_proc("glVertexAttrib4Nsv") : NULL;
-    lx_glVertexAttrib4Nub = load ? (PFNGLVERTEXATTRIB4NUBPROC) load_proc("glVertexAttrib4Nub") : NULL;
-    lx_glVertexAttrib4Nubv = load ? (PFNGLVERTEXATTRIB4NUBVPROC) load_proc("glVertexAttrib4Nubv") : NULL;
-    lx_glVertexAttrib4Nuiv = load ? (PFNGLVERTEXATTRIB4NUIVPROC) load_proc("glVertexAttrib4Nuiv") : NULL;
-    lx_glVertexAttrib4Nusv = load ? (PFNGLVERTEXATTRIB4NUSVPROC) load_proc("glVertexAttrib4Nusv") : NULL;
-    lx_glVertexAttrib4bv = load ? (PFNGLVERTEXATTRIB4BVPROC) load_proc("glVertexAttrib4bv") : NULL;
-    lx_glVertexAttrib4d = load ? (PFNGLVERTEXATTRIB4DPROC) load_proc("glVertexAttrib4d") : NULL;
-    lx_glVertexAttrib4dv = load ? (PFNGLVERTEXATTRIB4DVPROC) load_proc("glVertexAttrib4dv") : NULL;
-    lx_glVertexAttrib4f = load ? (PFNGLVERTEXATTRIB4FPROC) load_proc("glVertexAttrib4f") : NULL;
-    lx_glVertexAttrib4fv = load ? (PFNGLVERTEXATTRIB4FVPROC) load_proc("glVertexAttrib4fv") : NULL;
-    lx_glVertexAttrib4iv = load ? (PFNGLVERTEXATTRIB4IVPROC) load_proc("glVertexAttrib4iv") : NULL;
-    lx_glVertexAttrib4s = load ? (PFNGLVERTEXATTRIB4SPROC) load_proc("glVertexAttrib4s") : NULL;
-    lx_glVertexAttrib4sv = load ? (PFNGLVERTEXATTRIB4SVPROC) load_proc("glVertexAttrib4sv") : NULL;
-    lx_glVertexAttrib4ubv = load ? (PFNGLVERTEXATTRIB4UBVPROC) load_proc("glVertexAttrib4ubv") : NULL;
-    lx_glVertexAttrib4uiv = load ? (PFNGLVERTEXATTRIB4UIVPROC) load_proc("glVertexAttrib4uiv") : NULL;
-    lx_glVertexAttrib4usv = load ? (PFNGLVERTEXATTRIB4USVPROC) load_proc("glVertexAttrib4usv") : NULL;
-    lx_glVertexAttribPointer = load ? (PFNGLVERTEXATTRIBPOINTERPROC) load_proc("glVertexAttribPointer") : NULL;
+    lx_glAttachShader = LOAD(PFNGLATTACHSHADERPROC, glAttachShader);
+    lx_glBindAttribLocation = LOAD(PFNGLBINDATTRIBLOCATIONPROC, glBindAttribLocation);
+    lx_glBlendEquationSeparate = LOAD(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate);
+    lx_glCompileShader = LOAD(PFNGLCOMPILESHADERPROC, glCompileShader);
+    lx_glCreateProgram = LOAD(PFNGLCREATEPROGRAMPROC, glCreateProgram);
+    lx_glCreateShader = LOAD(PFNGLCREATESHADERPROC, glCreateShader);
+    lx_glDeleteProgram = LOAD(PFNGLDELETEPROGRAMPROC, glDeleteProgram);
+    lx_glDeleteShader = LOAD(PFNGLDELETESHADERPROC, glDeleteShader);
+    lx_glDetachShader = LOAD(PFNGLDETACHSHADERPROC, glDetachShader);
+    lx_glDisableVertexAttribArray = LOAD(PFNGLDISABLEVERTEXATTRIBARRAYPROC, glDisableVertexAttribArray);
+    lx_glDrawBuffers = LOAD(PFNGLDRAWBUFFERSPROC, glDrawBuffers);
+    lx_glEnableVertexAttribArray = LOAD(PFNGLENABLEVERTEXATTRIBARRAYPROC, glEnableVertexAttribArray);
+    lx_glGetActiveAttrib = LOAD(PFNGLGETACTIVEATTRIBPROC, glGetActiveAttrib);
+    lx_glGetActiveUniform = LOAD(PFNGLGETACTIVEUNIFORMPROC, glGetActiveUniform);
+    lx_glGetAttachedShaders = LOAD(PFNGLGETATTACHEDSHADERSPROC, glGetAttachedShaders);
+    lx_glGetAttribLocation = LOAD(PFNGLGETATTRIBLOCATIONPROC, glGetAttribLocation);
+    lx_glGetProgramInfoLog = LOAD(PFNGLGETPROGRAMINFOLOGPROC, glGetProgramInfoLog);
+    lx_glGetProgramiv = LOAD(PFNGLGETPROGRAMIVPROC, glGetProgramiv);
+    lx_glGetShaderInfoLog = LOAD(PFNGLGETSHADERINFOLOGPROC, glGetShaderInfoLog);
+    lx_glGetShaderSource = LOAD(PFNGLGETSHADERSOURCEPROC, glGetShaderSource);
+    lx_glGetShaderiv = LOAD(PFNGLGETSHADERIVPROC, glGetShaderiv);
+    lx_glGetUniformLocation = LOAD(PFNGLGETUNIFORMLOCATIONPROC, glGetUniformLocation);
+    lx_glGetUniformfv = LOAD(PFNGLGETUNIFORMFVPROC, glGetUniformfv);
+    lx_glGetUniformiv = LOAD(PFNGLGETUNIFORMIVPROC, glGetUniformiv);
+    lx_glGetVertexAttribPointerv = LOAD(PFNGLGETVERTEXATTRIBPOINTERVPROC, glGetVertexAttribPointerv);
+    lx_glGetVertexAttribdv = LOAD(PFNGLGETVERTEXATTRIBDVPROC, glGetVertexAttribdv);
+    lx_glGetVertexAttribfv = LOAD(PFNGLGETVERTEXATTRIBFVPROC, glGetVertexAttribfv);
+    lx_glGetVertexAttribiv = LOAD(PFNGLGETVERTEXATTRIBIVPROC, glGetVertexAttribiv);
+    lx_glIsProgram = LOAD(PFNGLISPROGRAMPROC, glIsProgram);
+    lx_glIsShader = LOAD(PFNGLISSHADERPROC, glIsShader);
+    lx_glLinkProgram = LOAD(PFNGLLINKPROGRAMPROC, glLinkProgram);
+    lx_glShaderSource = LOAD(PFNGLSHADERSOURCEPROC, glShaderSource);
+    lx_glStencilFuncSeparate = LOAD(PFNGLSTENCILFUNCSEPARATEPROC, glStencilFuncSeparate);
+    lx_glStencilMaskSeparate = LOAD(PFNGLSTENCILMASKSEPARATEPROC, glStencilMaskSeparate);
+    lx_glStencilOpSeparate = LOAD(PFNGLSTENCILOPSEPARATEPROC, glStencilOpSeparate);
+    lx_glUniform1f = LOAD(PFNGLUNIFORM1FPROC, glUniform1f);
+    lx_glUniform1fv = LOAD(PFNGLUNIFORM1FVPROC, glUniform1fv);
+    lx_glUniform1i = LOAD(PFNGLUNIFORM1IPROC, glUniform1i);
+    lx_glUniform1iv = LOAD(PFNGLUNIFORM1IVPROC, glUniform1iv);
+    lx_glUniform2f = LOAD(PFNGLUNIFORM2FPROC, glUniform2f);
+    lx_glUniform2fv = LOAD(PFNGLUNIFORM2FVPROC, glUniform2fv);
+    lx_glUniform2i = LOAD(PFNGLUNIFORM2IPROC, glUniform2i);
+    lx_glUniform2iv = LOAD(PFNGLUNIFORM2IVPROC, glUniform2iv);
+    lx_glUniform3f = LOAD(PFNGLUNIFORM3FPROC, glUniform3f);
+    lx_glUniform3fv = LOAD(PFNGLUNIFORM3FVPROC, glUniform3fv);
+    lx_glUniform3i = LOAD(PFNGLUNIFORM3IPROC, glUniform3i);
+    lx_glUniform3iv = LOAD(PFNGLUNIFORM3IVPROC, glUniform3iv);
+    lx_glUniform4f = LOAD(PFNGLUNIFORM4FPROC, glUniform4f);
+    lx_glUniform4fv = LOAD(PFNGLUNIFORM4FVPROC, glUniform4fv);
+    lx_glUniform4i = LOAD(PFNGLUNIFORM4IPROC, glUniform4i);
+    lx_glUniform4iv = LOAD(PFNGLUNIFORM4IVPROC, glUniform4iv);
+    lx_glUniformMatrix2fv = LOAD(PFNGLUNIFORMMATRIX2FVPROC, glUniformMatrix2fv);
+    lx_glUniformMatrix3fv = LOAD(PFNGLUNIFORMMATRIX3FVPROC, glUniformMatrix3fv);
+    lx_glUniformMatrix4fv = LOAD(PFNGLUNIFORMMATRIX4FVPROC, glUniformMatrix4fv);
+    lx_glUseProgram = LOAD(PFNGLUSEPROGRAMPROC, glUseProgram);
+    lx_glValidateProgram = LOAD(PFNGLVALIDATEPROGRAMPROC, glValidateProgram);
+    lx_glVertexAttrib1d = LOAD(PFNGLVERTEXATTRIB1DPROC, glVertexAttrib1d);
+    lx_glVertexAttrib1dv = LOAD(PFNGLVERTEXATTRIB1DVPROC, glVertexAttrib1dv);
+    lx_glVertexAttrib1f = LOAD(PFNGLVERTEXATTRIB1FPROC, glVertexAttrib1f);
+    lx_glVertexAttrib1fv = LOAD(PFNGLVERTEXATTRIB1FVPROC, glVertexAttrib1fv);
+    lx_glVertexAttrib1s = LOAD(PFNGLVERTEXATTRIB1SPROC, glVertexAttrib1s);
+    lx_glVertexAttrib1sv = LOAD(PFNGLVERTEXATTRIB1SVPROC, glVertexAttrib1sv);
+    lx_glVertexAttrib2d = LOAD(PFNGLVERTEXATTRIB2DPROC, glVertexAttrib2d);
+    lx_glVertexAttrib2dv = LOAD(PFNGLVERTEXATTRIB2DVPROC, glVertexAttrib2dv);
+    lx_glVertexAttrib2f = LOAD(PFNGLVERTEXATTRIB2FPROC, glVertexAttrib2f);
+    lx_glVertexAttrib2fv = LOAD(PFNGLVERTEXATTRIB2FVPROC, glVertexAttrib2fv);
+    lx_glVertexAttrib2s = LOAD(PFNGLVERTEXATTRIB2SPROC, glVertexAttrib2s);
+    lx_glVertexAttrib2sv = LOAD(PFNGLVERTEXATTRIB2SVPROC, glVertexAttrib2sv);
+    lx_glVertexAttrib3d = LOAD(PFNGLVERTEXATTRIB3DPROC, glVertexAttrib3d);
+    lx_glVertexAttrib3dv = LOAD(PFNGLVERTEXATTRIB3DVPROC, glVertexAttrib3dv);
+    lx_glVertexAttrib3f = LOAD(PFNGLVERTEXATTRIB3FPROC, glVertexAttrib3f);
+    lx_glVertexAttrib3fv = LOAD(PFNGLVERTEXATTRIB3FVPROC, glVertexAttrib3fv);
+    lx_glVertexAttrib3s = LOAD(PFNGLVERTEXATTRIB3SPROC, glVertexAttrib3s);
+    lx_glVertexAttrib3sv = LOAD(PFNGLVERTEXATTRIB3SVPROC, glVertexAttrib3sv);
+    lx_glVertexAttrib4Nbv = LOAD(PFNGLVERTEXATTRIB4NBVPROC, glVertexAttrib4Nbv);
+    lx_glVertexAttrib4Niv = LOAD(PFNGLVERTEXATTRIB4NIVPROC, glVertexAttrib4Niv);
+    lx_glVertexAttrib4Nsv = LOAD(PFNGLVERTEXATTRIB4NSVPROC, glVertexAttrib4Nsv);
+    lx_glVertexAttrib4Nub = LOAD(PFNGLVERTEXATTRIB4NUBPROC, glVertexAttrib4Nub);
+    lx_glVertexAttrib4Nubv = LOAD(PFNGLVERTEXATTRIB4NUBVPROC, glVertexAttrib4Nubv);
+    lx_glVertexAttrib4Nuiv = LOAD(PFNGLVERTEXATTRIB4NUIVPROC, glVertexAttrib4Nuiv);
+    lx_glVertexAttrib4Nusv = LOAD(PFNGLVERTEXATTRIB4NUSVPROC, glVertexAttrib4Nusv);
+    lx_glVertexAttrib4bv = LOAD(PFNGLVERTEXATTRIB4BVPROC, glVertexAttrib4bv);
+    lx_glVertexAttrib4d = LOAD(PFNGLVERTEXATTRIB4DPROC, glVertexAttrib4d);
+    lx_glVertexAttrib4dv = LOAD(PFNGLVERTEXATTRIB4DVPROC, glVertexAttrib4dv);
+    lx_glVertexAttrib4f = LOAD(PFNGLVERTEXATTRIB4FPROC, glVertexAttrib4f);
+    lx_glVertexAttrib4fv = LOAD(PFNGLVERTEXATTRIB4FVPROC, glVertexAttrib4fv);
+    lx_glVertexAttrib4iv = LOAD(PFNGLVERTEXATTRIB4IVPROC, glVertexAttrib4iv);
+    lx_glVertexAttrib4s = LOAD(PFNGLVERTEXATTRIB4SPROC, glVertexAttrib4s);
+    lx_glVertexAttrib4sv = LOAD(PFNGLVERTEXATTRIB4SVPROC, glVertexAttrib4sv);
+    lx_glVertexAttrib4ubv = LOAD(PFNGLVERTEXATTRIB4UBVPROC, glVertexAttrib4ubv);
+    lx_glVertexAttrib4uiv = LOAD(PFNGLVERTEXATTRIB4UIVPROC, glVertexAttrib4uiv);
+    lx_glVertexAttrib4usv = LOAD(PFNGLVERTEXATTRIB4USVPROC, glVertexAttrib4usv);
+    lx_glVertexAttribPointer = LOAD(PFNGLVERTEXATTRIBPOINTERPROC, glVertexAttribPointer);
 }
 
 PFNGLUNIFORMMATRIX2X3FVPROC lx_glUniformMatrix2x3fv = NULL;
@@ -514,15 +782,22 @@ PFNGLUNIFORMMATRIX3X4FVPROC lx_glUniformMatrix3x4fv = NULL;
 PFNGLUNIFORMMATRIX4X2FVPROC lx_glUniformMatrix4x2fv = NULL;
 PFNGLUNIFORMMATRIX4X3FVPROC lx_glUniformMatrix4x3fv = NULL;
 
-static void load_2_1(int load)
+STUB_VOID(PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv, (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (location, count, transpose, value))
+
+static void load_2_1(int mode)
 {
     if (!v2_1) return;
-    lx_glUniformMatrix2x3fv = load ? (PFNGLUNIFORMMATRIX2X3FVPROC) load_proc("glUniformMatrix2x3fv") : NULL;
-    lx_glUniformMatrix2x4fv = load ? (PFNGLUNIFORMMATRIX2X4FVPROC) load_proc("glUniformMatrix2x4fv") : NULL;
-    lx_glUniformMatrix3x2fv = load ? (PFNGLUNIFORMMATRIX3X2FVPROC) load_proc("glUniformMatrix3x2fv") : NULL;
-    lx_glUniformMatrix3x4fv = load ? (PFNGLUNIFORMMATRIX3X4FVPROC) load_proc("glUniformMatrix3x4fv") : NULL;
-    lx_glUniformMatrix4x2fv = load ? (PFNGLUNIFORMMATRIX4X2FVPROC) load_proc("glUniformMatrix4x2fv") : NULL;
-    lx_glUniformMatrix4x3fv = load ? (PFNGLUNIFORMMATRIX4X3FVPROC) load_proc("glUniformMatrix4x3fv") : NULL;
+    lx_glUniformMatrix2x3fv = LOAD(PFNGLUNIFORMMATRIX2X3FVPROC, glUniformMatrix2x3fv);
+    lx_glUniformMatrix2x4fv = LOAD(PFNGLUNIFORMMATRIX2X4FVPROC, glUniformMatrix2x4fv);
+    lx_glUniformMatrix3x2fv = LOAD(PFNGLUNIFORMMATRIX3X2FVPROC, glUniformMatrix3x2fv);
+    lx_glUniformMatrix3x4fv = LOAD(PFNGLUNIFORMMATRIX3X4FVPROC, glUniformMatrix3x4fv);
+    lx_glUniformMatrix4x2fv = LOAD(PFNGLUNIFORMMATRIX4X2FVPROC, glUniformMatrix4x2fv);
+    lx_glUniformMatrix4x3fv = LOAD(PFNGLUNIFORMMATRIX4X3FVPROC, glUniformMatrix4x3fv);
 }
 
 PFNGLBEGINCONDITIONALRENDERPROC lx_glBeginConditionalRender = NULL;
@@ -610,93 +885,178 @@ PFNGLVERTEXATTRIBI4UIVPROC lx_glVertexAttribI4uiv = NULL;
 PFNGLVERTEXATTRIBI4USVPROC lx_glVertexAttribI4usv = NULL;
 PFNGLVERTEXATTRIBIPOINTERPROC lx_glVertexAttribIPointer = NULL;
 
-static void load_3_0(int load)
+STUB_VOID(PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender, (GLuint id, GLenum mode), (id, mode))
+STUB_VOID(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback, (GLenum primitiveMode), (primitiveMode))
+STUB_VOID(PFNGLBINDBUFFERBASEPROC, glBindBufferBase, (GLenum target, GLuint index, GLuint buffer), (target, index, buffer))
+STUB_VOID(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange, (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, index, buffer, offset, size))
+STUB_VOID(PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation, (GLuint program, GLuint color, const GLchar* name), (program, color, name))
+STUB_VOID(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer, (GLenum target, GLuint framebuffer), (target, framebuffer))
+STUB_VOID(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer, (GLenum target, GLuint renderbuffer), (target, renderbuffer))
+STUB_VOID(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray, (GLuint array), (array))
+STUB_VOID(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer, (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+STUB(GLenum, PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus, (GLenum target), (target))
+STUB_VOID(PFNGLCLAMPCOLORPROC, glClampColor, (GLenum target, GLenum clamp), (target, clamp))
+STUB_VOID(PFNGLCLEARBUFFERFIPROC, glClearBufferfi, (GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (buffer, drawbuffer, depth, stencil))
+STUB_VOID(PFNGLCLEARBUFFERFVPROC, glClearBufferfv, (GLenum buffer, GLint drawbuffer, const GLfloat* value), (buffer, drawbuffer, value))
+STUB_VOID(PFNGLCLEARBUFFERIVPROC, glClearBufferiv, (GLenum buffer, GLint drawbuffer, const GLint* value), (buffer, drawbuffer, value))
+STUB_VOID(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv, (GLenum buffer, GLint drawbuffer, const GLuint* value), (buffer, drawbuffer, value))
+STUB_VOID(PFNGLCOLORMASKIPROC, glColorMaski, (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a), (index, r, g, b, a))
+STUB_VOID(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers, (GLsizei n, const GLuint* framebuffers), (n, framebuffers))
+STUB_VOID(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers, (GLsizei n, const GLuint* renderbuffers), (n, renderbuffers))
+STUB_VOID(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays, (GLsizei n, const GLuint* arrays), (n, arrays))
+STUB_VOID(PFNGLDISABLEIPROC, glDisablei, (GLenum target, GLuint index), (target, index))
+STUB_VOID(PFNGLENABLEIPROC, glEnablei, (GLenum target, GLuint index), (target, index))
+STUB_VOID(PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender, (void), ())
+STUB_VOID(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback, (void), ())
+STUB_VOID(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length))
+STUB_VOID(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer, (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (target, attachment, renderbuffertarget, renderbuffer))
+STUB_VOID(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+STUB_VOID(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level), (target, attachment, textarget, texture, level))
+STUB_VOID(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D, (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset), (target, attachment, textarget, texture, level, zoffset))
+STUB_VOID(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer, (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer), (target, attachment, texture, level, layer))
+STUB_VOID(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers, (GLsizei n, GLuint* framebuffers), (n, framebuffers))
+STUB_VOID(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers, (GLsizei n, GLuint* renderbuffers), (n, renderbuffers))
+STUB_VOID(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays, (GLsizei n, GLuint* arrays), (n, arrays))
+STUB_VOID(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap, (GLenum target), (target))
+STUB_VOID(PFNGLGETBOOLEANI_VPROC, glGetBooleani_v, (GLenum target, GLuint index, GLboolean* data), (target, index, data))
+STUB(GLint, PFNGLGETFRAGDATALOCATIONPROC, glGetFragDataLocation, (GLuint program, const GLchar* name), (program, name))
+STUB_VOID(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv, (GLenum target, GLenum attachment, GLenum pname, GLint* params), (target, attachment, pname, params))
+STUB_VOID(PFNGLGETINTEGERI_VPROC, glGetIntegeri_v, (GLenum target, GLuint index, GLint* data), (target, index, data))
+STUB_VOID(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv, (GLenum target, GLenum pname, GLint* params), (target, pname, params))
+STUB(GLubyte*, PFNGLGETSTRINGIPROC, glGetStringi, (GLenum name, GLuint index), (name, index))
+STUB_VOID(PFNGLGETTEXPARAMETERIIVPROC, glGetTexParameterIiv, (GLenum target, GLenum pname, GLint* params), (target, pname, params))
+STUB_VOID(PFNGLGETTEXPARAMETERIUIVPROC, glGetTexParameterIuiv, (GLenum target, GLenum pname, GLuint* params), (target, pname, params))
+STUB_VOID(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, glGetTransformFeedbackVarying, (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei* size, GLenum* type, GLchar* name), (program, index, bufSize, length, size, type, name))
+STUB_VOID(PFNGLGETUNIFORMUIVPROC, glGetUniformuiv, (GLuint program, GLint location, GLuint* params), (program, location, params))
+STUB_VOID(PFNGLGETVERTEXATTRIBIIVPROC, glGetVertexAttribIiv, (GLuint index, GLenum pname, GLint* params), (index, pname, params))
+STUB_VOID(PFNGLGETVERTEXATTRIBIUIVPROC, glGetVertexAttribIuiv, (GLuint index, GLenum pname, GLuint* params), (index, pname, params))
+STUB(GLboolean, PFNGLISENABLEDIPROC, glIsEnabledi, (GLenum target, GLuint index), (target, index))
+STUB(GLboolean, PFNGLISFRAMEBUFFERPROC, glIsFramebuffer, (GLuint framebuffer), (framebuffer))
+STUB(GLboolean, PFNGLISRENDERBUFFERPROC, glIsRenderbuffer, (GLuint renderbuffer), (renderbuffer))
+STUB(GLboolean, PFNGLISVERTEXARRAYPROC, glIsVertexArray, (GLuint array), (array))
+STUB(void*, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange, (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access), (target, offset, length, access))
+STUB_VOID(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage, (GLenum target, GLenum internalformat, GLsizei width, GLsizei height), (target, internalformat, width, height))
+STUB_VOID(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (target, samples, internalformat, width, height))
+STUB_VOID(PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv, (GLenum target, GLenum pname, const GLint* params), (target, pname, params))
+STUB_VOID(PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv, (GLenum target, GLenum pname, const GLuint* params), (target, pname, params))
+STUB_VOID(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings, (GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode), (program, count, varyings, bufferMode))
+STUB_VOID(PFNGLUNIFORM1UIPROC, glUniform1ui, (GLint location, GLuint v0), (location, v0))
+STUB_VOID(PFNGLUNIFORM1UIVPROC, glUniform1uiv, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM2UIPROC, glUniform2ui, (GLint location, GLuint v0, GLuint v1), (location, v0, v1))
+STUB_VOID(PFNGLUNIFORM2UIVPROC, glUniform2uiv, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM3UIPROC, glUniform3ui, (GLint location, GLuint v0, GLuint v1, GLuint v2), (location, v0, v1, v2))
+STUB_VOID(PFNGLUNIFORM3UIVPROC, glUniform3uiv, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM4UIPROC, glUniform4ui, (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (location, v0, v1, v2, v3))
+STUB_VOID(PFNGLUNIFORM4UIVPROC, glUniform4uiv, (GLint location, GLsizei count, const GLuint* value), (location, count, value))
+STUB_VOID(PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i, (GLuint index, GLint x), (index, x))
+STUB_VOID(PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui, (GLuint index, GLuint x), (index, x))
+STUB_VOID(PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv, (GLuint index, const GLuint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i, (GLuint index, GLint x, GLint y), (index, x, y))
+STUB_VOID(PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui, (GLuint index, GLuint x, GLuint y), (index, x, y))
+STUB_VOID(PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv, (GLuint index, const GLuint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i, (GLuint index, GLint x, GLint y, GLint z), (index, x, y, z))
+STUB_VOID(PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui, (GLuint index, GLuint x, GLuint y, GLuint z), (index, x, y, z))
+STUB_VOID(PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv, (GLuint index, const GLuint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv, (GLuint index, const GLbyte* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i, (GLuint index, GLint x, GLint y, GLint z, GLint w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv, (GLuint index, const GLshort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv, (GLuint index, const GLubyte* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui, (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv, (GLuint index, const GLuint* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv, (GLuint index, const GLushort* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer), (index, size, type, stride, pointer))
+
+static void load_3_0(int mode)
 {
     if (!v3_0) return;
-    lx_glBeginConditionalRender = load ? (PFNGLBEGINCONDITIONALRENDERPROC) load_proc("glBeginConditionalRender") : NULL;
-    lx_glBeginTransformFeedback = load ? (PFNGLBEGINTRANSFORMFEEDBACKPROC) load_proc("glBeginTransformFeedback") : NULL;
-    lx_glBindBufferBase = load ? (PFNGLBINDBUFFERBASEPROC) load_proc("glBindBufferBase") : NULL;
-    lx_glBindBufferRange = load ? (PFNGLBINDBUFFERRANGEPROC) load_proc("glBindBufferRange") : NULL;
-    lx_glBindFragDataLocation = load ? (PFNGLBINDFRAGDATALOCATIONPROC) load_proc("glBindFragDataLocation") : NULL;
-    lx_glBindFramebuffer = load ? (PFNGLBINDFRAMEBUFFERPROC) load_proc("glBindFramebuffer") : NULL;
-    lx_glBindRenderbuffer = load ? (PFNGLBINDRENDERBUFFERPROC) load_proc("glBindRenderbuffer") : NULL;
-    lx_glBindVertexArray = load ? (PFNGLBINDVERTEXARRAYPROC) load_proc("glBindVertexArray") : NULL;
-    lx_glBlitFramebuffer = load ? (PFNGLBLITFRAMEBUFFERPROC) load_proc("glBlitFramebuffer") : NULL;
-    lx_glCheckFramebufferStatus = load ? (PFNGLCHECKFRAMEBUFFERSTATUSPROC) load_proc("glCheckFramebufferStatus") : NULL;
-    lx_glClampColor = load ? (PFNGLCLAMPCOLORPROC) load_proc("glClampColor") : NULL;
-    lx_glClearBufferfi = load ? (PFNGLCLEARBUFFERFIPROC) load_proc("glClearBufferfi") : NULL;
-    lx_glClearBufferfv = load ? (PFNGLCLEARBUFFERFVPROC) load_proc("glClearBufferfv") : NULL;
-    lx_glClearBufferiv = load ? (PFNGLCLEARBUFFERIVPROC) load_proc("glClearBufferiv") : NULL;
-    lx_glClearBufferuiv = load ? (PFNGLCLEARBUFFERUIVPROC) load_proc("glClearBufferuiv") : NULL;
-    lx_glColorMaski = load ? (PFNGLCOLORMASKIPROC) load_proc("glColorMaski") : NULL;
-    lx_glDeleteFramebuffers = load ? (PFNGLDELETEFRAMEBUFFERSPROC) load_proc("glDeleteFramebuffers") : NULL;
-    lx_glDeleteRenderbuffers = load ? (PFNGLDELETERENDERBUFFERSPROC) load_proc("glDeleteRenderbuffers") : NULL;
-    lx_glDeleteVertexArrays = load ? (PFNGLDELETEVERTEXARRAYSPROC) load_proc("glDeleteVertexArrays") : NULL;
-    lx_glDisablei = load ? (PFNGLDISABLEIPROC) load_proc("glDisablei") : NULL;
-    lx_glEnablei = load ? (PFNGLENABLEIPROC) load_proc("glEnablei") : NULL;
-    lx_glEndConditionalRender = load ? (PFNGLENDCONDITIONALRENDERPROC) load_proc("glEndConditionalRender") : NULL;
-    lx_glEndTransformFeedback = load ? (PFNGLENDTRANSFORMFEEDBACKPROC) load_proc("glEndTransformFeedback") : NULL;
-    lx_glFlushMappedBufferRange = load ? (PFNGLFLUSHMAPPEDBUFFERRANGEPROC) load_proc("glFlushMappedBufferRange") : NULL;
-    lx_glFramebufferRenderbuffer = load ? (PFNGLFRAMEBUFFERRENDERBUFFERPROC) load_proc("glFramebufferRenderbuffer") : NULL;
-    lx_glFramebufferTexture1D = load ? (PFNGLFRAMEBUFFERTEXTURE1DPROC) load_proc("glFramebufferTexture1D") : NULL;
-    lx_glFramebufferTexture2D = load ? (PFNGLFRAMEBUFFERTEXTURE2DPROC) load_proc("glFramebufferTexture2D") : NULL;
-    lx_glFramebufferTexture3D = load ? (PFNGLFRAMEBUFFERTEXTURE3DPROC) load_proc("glFramebufferTexture3D") : NULL;
-    lx_glFramebufferTextureLayer = load ? (PFNGLFRAMEBUFFERTEXTURELAYERPROC) load_proc("glFramebufferTextureLayer") : NULL;
-    lx_glGenFramebuffers = load ? (PFNGLGENFRAMEBUFFERSPROC) load_proc("glGenFramebuffers") : NULL;
-    lx_glGenRenderbuffers = load ? (PFNGLGENRENDERBUFFERSPROC) load_proc("glGenRenderbuffers") : NULL;
-    lx_glGenVertexArrays = load ? (PFNGLGENVERTEXARRAYSPROC) load_proc("glGenVertexArrays") : NULL;
-    lx_glGenerateMipmap = load ? (PFNGLGENERATEMIPMAPPROC) load_proc("glGenerateMipmap") : NULL;
-    lx_glGetBooleani_v = load ? (PFNGLGETBOOLEANI_VPROC) load_proc("glGetBooleani_v") : NULL;
-    lx_glGetFragDataLocation = load ? (PFNGLGETFRAGDATALOCATIONPROC) load_proc("glGetFragDataLocation") : NULL;
-    lx_glGetFramebufferAttachmentParameteriv = load ? (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC) load_proc("glGetFramebufferAttachmentParameteriv") : NULL;
-    lx_glGetIntegeri_v = load ? (PFNGLGETINTEGERI_VPROC) load_proc("glGetIntegeri_v") : NULL;
-    lx_glGetRenderbufferParameteriv = load ? (PFNGLGETRENDERBUFFERPARAMETERIVPROC) load_proc("glGetRenderbufferParameteriv") : NULL;
-    lx_glGetStringi = load ? (PFNGLGETSTRINGIPROC) load_proc("glGetStringi") : NULL;
-    lx_glGetTexParameterIiv = load ? (PFNGLGETTEXPARAMETERIIVPROC) load_proc("glGetTexParameterIiv") : NULL;
-    lx_glGetTexParameterIuiv = load ? (PFNGLGETTEXPARAMETERIUIVPROC) load_proc("glGetTexParameterIuiv") : NULL;
-    lx_glGetTransformFeedbackVarying = load ? (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC) load_proc("glGetTransformFeedbackVarying") : NULL;
-    lx_glGetUniformuiv = load ? (PFNGLGETUNIFORMUIVPROC) load_proc("glGetUniformuiv") : NULL;
-    lx_glGetVertexAttribIiv = load ? (PFNGLGETVERTEXATTRIBIIVPROC) load_proc("glGetVertexAttribIiv") : NULL;
-    lx_glGetVertexAttribIuiv = load ? (PFNGLGETVERTEXATTRIBIUIVPROC) load_proc("glGetVertexAttribIuiv") : NULL;
-    lx_glIsEnabledi = load ? (PFNGLISENABLEDIPROC) load_proc("glIsEnabledi") : NULL;
-    lx_glIsFramebuffer = load ? (PFNGLISFRAMEBUFFERPROC) load_proc("glIsFramebuffer") : NULL;
-    lx_glIsRenderbuffer = load ? (PFNGLISRENDERBUFFERPROC) load_proc("glIsRenderbuffer") : NULL;
-    lx_glIsVertexArray = load ? (PFNGLISVERTEXARRAYPROC) load_proc("glIsVertexArray") : NULL;
-    lx_glMapBufferRange = load ? (PFNGLMAPBUFFERRANGEPROC) load_proc("glMapBufferRange") : NULL;
-    lx_glRenderbufferStorage = load ? (PFNGLRENDERBUFFERSTORAGEPROC) load_proc("glRenderbufferStorage") : NULL;
-    lx_glRenderbufferStorageMultisample = load ? (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC) load_proc("glRenderbufferStorageMultisample") : NULL;
-    lx_glTexParameterIiv = load ? (PFNGLTEXPARAMETERIIVPROC) load_proc("glTexParameterIiv") : NULL;
-    lx_glTexParameterIuiv = load ? (PFNGLTEXPARAMETERIUIVPROC) load_proc("glTexParameterIuiv") : NULL;
-    lx_glTransformFeedbackVaryings = load ? (PFNGLTRANSFORMFEEDBACKVARYINGSPROC) load_proc("glTransformFeedbackVaryings") : NULL;
-    lx_glUniform1ui = load ? (PFNGLUNIFORM1UIPROC) load_proc("glUniform1ui") : NULL;
-    lx_glUniform1uiv = load ? (PFNGLUNIFORM1UIVPROC) load_proc("glUniform1uiv") : NULL;
-    lx_glUniform2ui = load ? (PFNGLUNIFORM2UIPROC) load_proc("glUniform2ui") : NULL;
-    lx_glUniform2uiv = load ? (PFNGLUNIFORM2UIVPROC) load_proc("glUniform2uiv") : NULL;
-    lx_glUniform3ui = load ? (PFNGLUNIFORM3UIPROC) load_proc("glUniform3ui") : NULL;
-    lx_glUniform3uiv = load ? (PFNGLUNIFORM3UIVPROC) load_proc("glUniform3uiv") : NULL;
-    lx_glUniform4ui = load ? (PFNGLUNIFORM4UIPROC) load_proc("glUniform4ui") : NULL;
-    lx_glUniform4uiv = load ? (PFNGLUNIFORM4UIVPROC) load_proc("glUniform4uiv") : NULL;
-    lx_glVertexAttribI1i = load ? (PFNGLVERTEXATTRIBI1IPROC) load_proc("glVertexAttribI1i") : NULL;
-    lx_glVertexAttribI1iv = load ? (PFNGLVERTEXATTRIBI1IVPROC) load_proc("glVertexAttribI1iv") : NULL;
-    lx_glVertexAttribI1ui = load ? (PFNGLVERTEXATTRIBI1UIPROC) load_proc("glVertexAttribI1ui") : NULL;
-    lx_glVertexAttribI1uiv = load ? (PFNGLVERTEXATTRIBI1UIVPROC) load_proc("glVertexAttribI1uiv") : NULL;
-    lx_glVertexAttribI2i = load ? (PFNGLVERTEXATTRIBI2IPROC) load_proc("glVertexAttribI2i") : NULL;
-    lx_glVertexAttribI2iv = load ? (PFNGLVERTEXATTRIBI2IVPROC) load_proc("glVertexAttribI2iv") : NULL;
-    lx_glVertexAttribI2ui = load ? (PFNGLVERTEXATTRIBI2UIPROC) load_proc("glVertexAttribI2ui") : NULL;
-    lx_glVertexAttribI2uiv = load ? (PFNGLVERTEXATTRIBI2UIVPROC) load_proc("glVertexAttribI2uiv") : NULL;
-    lx_glVertexAttribI3i = load ? (PFNGLVERTEXATTRIBI3IPROC) load_proc("glVertexAttribI3i") : NULL;
-    lx_glVertexAttribI3iv = load ? (PFNGLVERTEXATTRIBI3IVPROC) load_proc("glVertexAttribI3iv") : NULL;
-    lx_glVertexAttribI3ui = load ? (PFNGLVERTEXATTRIBI3UIPROC) load_proc("glVertexAttribI3ui") : NULL;
-    lx_glVertexAttribI3uiv = load ? (PFNGLVERTEXATTRIBI3UIVPROC) load_proc("glVertexAttribI3uiv") : NULL;
-    lx_glVertexAttribI4bv = load ? (PFNGLVERTEXATTRIBI4BVPROC) load_proc("glVertexAttribI4bv") : NULL;
-    lx_glVertexAttribI4i = load ? (PFNGLVERTEXATTRIBI4IPROC) load_proc("glVertexAttribI4i") : NULL;
-    lx_glVertexAttribI4iv = load ? (PFNGLVERTEXATTRIBI4IVPROC) load_proc("glVertexAttribI4iv") : NULL;
-    lx_glVertexAttribI4sv = load ? (PFNGLVERTEXATTRIBI4SVPROC) load_proc("glVertexAttribI4sv") : NULL;
-    lx_glVertexAttribI4ubv = load ? (PFNGLVERTEXATTRIBI4UBVPROC) load_proc("glVertexAttribI4ubv") : NULL;
-    lx_glVertexAttribI4ui = load ? (PFNGLVERTEXATTRIBI4UIPROC) load_proc("glVertexAttribI4ui") : NULL;
-    lx_glVertexAttribI4uiv = load ? (PFNGLVERTEXATTRIBI4UIVPROC) load_proc("glVertexAttribI4uiv") : NULL;
-    lx_glVertexAttribI4usv = load ? (PFNGLVERTEXATTRIBI4USVPROC) load_proc("glVertexAttribI4usv") : NULL;
-    lx_glVertexAttribIPointer = load ? (PFNGLVERTEXATTRIBIPOINTERPROC) load_proc("glVertexAttribIPointer") : NULL;
+    lx_glBeginConditionalRender = LOAD(PFNGLBEGINCONDITIONALRENDERPROC, glBeginConditionalRender);
+    lx_glBeginTransformFeedback = LOAD(PFNGLBEGINTRANSFORMFEEDBACKPROC, glBeginTransformFeedback);
+    lx_glBindBufferBase = LOAD(PFNGLBINDBUFFERBASEPROC, glBindBufferBase);
+    lx_glBindBufferRange = LOAD(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);
+    lx_glBindFragDataLocation = LOAD(PFNGLBINDFRAGDATALOCATIONPROC, glBindFragDataLocation);
+    lx_glBindFramebuffer = LOAD(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer);
+    lx_glBindRenderbuffer = LOAD(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer);
+    lx_glBindVertexArray = LOAD(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);
+    lx_glBlitFramebuffer = LOAD(PFNGLBLITFRAMEBUFFERPROC, glBlitFramebuffer);
+    lx_glCheckFramebufferStatus = LOAD(PFNGLCHECKFRAMEBUFFERSTATUSPROC, glCheckFramebufferStatus);
+    lx_glClampColor = LOAD(PFNGLCLAMPCOLORPROC, glClampColor);
+    lx_glClearBufferfi = LOAD(PFNGLCLEARBUFFERFIPROC, glClearBufferfi);
+    lx_glClearBufferfv = LOAD(PFNGLCLEARBUFFERFVPROC, glClearBufferfv);
+    lx_glClearBufferiv = LOAD(PFNGLCLEARBUFFERIVPROC, glClearBufferiv);
+    lx_glClearBufferuiv = LOAD(PFNGLCLEARBUFFERUIVPROC, glClearBufferuiv);
+    lx_glColorMaski = LOAD(PFNGLCOLORMASKIPROC, glColorMaski);
+    lx_glDeleteFramebuffers = LOAD(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers);
+    lx_glDeleteRenderbuffers = LOAD(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers);
+    lx_glDeleteVertexArrays = LOAD(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);
+    lx_glDisablei = LOAD(PFNGLDISABLEIPROC, glDisablei);
+    lx_glEnablei = LOAD(PFNGLENABLEIPROC, glEnablei);
+    lx_glEndConditionalRender = LOAD(PFNGLENDCONDITIONALRENDERPROC, glEndConditionalRender);
+    lx_glEndTransformFeedback = LOAD(PFNGLENDTRANSFORMFEEDBACKPROC, glEndTransformFeedback);
+    lx_glFlushMappedBufferRange = LOAD(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange);
+    lx_glFramebufferRenderbuffer = LOAD(PFNGLFRAMEBUFFERRENDERBUFFERPROC, glFramebufferRenderbuffer);
+    lx_glFramebufferTexture1D = LOAD(PFNGLFRAMEBUFFERTEXTURE1DPROC, glFramebufferTexture1D);
+    lx_glFramebufferTexture2D = LOAD(PFNGLFRAMEBUFFERTEXTURE2DPROC, glFramebufferTexture2D);
+    lx_glFramebufferTexture3D = LOAD(PFNGLFRAMEBUFFERTEXTURE3DPROC, glFramebufferTexture3D);
+    lx_glFramebufferTextureLayer = LOAD(PFNGLFRAMEBUFFERTEXTURELAYERPROC, glFramebufferTextureLayer);
+    lx_glGenFramebuffers = LOAD(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers);
+    lx_glGenRenderbuffers = LOAD(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers);
+    lx_glGenVertexArrays = LOAD(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays);
+    lx_glGenerateMipmap = LOAD(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap);
+    lx_glGetBooleani_v = LOAD(PFNGLGETBOOLEANI_VPROC, glGetBooleani_v);
+    lx_glGetFragDataLocation = LOAD(PFNGLGETFRAGDATALOCATIONPROC, glGetFragDataLocation);
+    lx_glGetFramebufferAttachmentParameteriv = LOAD(PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetFramebufferAttachmentParameteriv);
+    lx_glGetIntegeri_v = LOAD(PFNGLGETINTEGERI_VPROC, glGetIntegeri_v);
+    lx_glGetRenderbufferParameteriv = LOAD(PFNGLGETRENDERBUFFERPARAMETERIVPROC, glGetRenderbufferParameteriv);
+    lx_glGetStringi = LOAD(PFNGLGETSTRINGIPROC, glGetStringi);
+    lx_glGetTexParameterIiv = LOAD(PFNGLGETTEXPARAMETERIIVPROC, glGetTexParameterIiv);
+    lx_glGetTexParameterIuiv = LOAD(PFNGLGETTEXPARAMETERIUIVPROC, glGetTexParameterIuiv);
+    lx_glGetTransformFeedbackVarying = LOAD(PFNGLGETTRANSFORMFEEDBACKVARYINGPROC, glGetTransformFeedbackVarying);
+    lx_glGetUniformuiv = LOAD(PFNGLGETUNIFORMUIVPROC, glGetUniformuiv);
+    lx_glGetVertexAttribIiv = LOAD(PFNGLGETVERTEXATTRIBIIVPROC, glGetVertexAttribIiv);
+    lx_glGetVertexAttribIuiv = LOAD(PFNGLGETVERTEXATTRIBIUIVPROC, glGetVertexAttribIuiv);
+    lx_glIsEnabledi = LOAD(PFNGLISENABLEDIPROC, glIsEnabledi);
+    lx_glIsFramebuffer = LOAD(PFNGLISFRAMEBUFFERPROC, glIsFramebuffer);
+    lx_glIsRenderbuffer = LOAD(PFNGLISRENDERBUFFERPROC, glIsRenderbuffer);
+    lx_glIsVertexArray = LOAD(PFNGLISVERTEXARRAYPROC, glIsVertexArray);
+    lx_glMapBufferRange = LOAD(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);
+    lx_glRenderbufferStorage = LOAD(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage);
+    lx_glRenderbufferStorageMultisample = LOAD(PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC, glRenderbufferStorageMultisample);
+    lx_glTexParameterIiv = LOAD(PFNGLTEXPARAMETERIIVPROC, glTexParameterIiv);
+    lx_glTexParameterIuiv = LOAD(PFNGLTEXPARAMETERIUIVPROC, glTexParameterIuiv);
+    lx_glTransformFeedbackVaryings = LOAD(PFNGLTRANSFORMFEEDBACKVARYINGSPROC, glTransformFeedbackVaryings);
+    lx_glUniform1ui = LOAD(PFNGLUNIFORM1UIPROC, glUniform1ui);
+    lx_glUniform1uiv = LOAD(PFNGLUNIFORM1UIVPROC, glUniform1uiv);
+    lx_glUniform2ui = LOAD(PFNGLUNIFORM2UIPROC, glUniform2ui);
+    lx_glUniform2uiv = LOAD(PFNGLUNIFORM2UIVPROC, glUniform2uiv);
+    lx_glUniform3ui = LOAD(PFNGLUNIFORM3UIPROC, glUniform3ui);
+    lx_glUniform3uiv = LOAD(PFNGLUNIFORM3UIVPROC, glUniform3uiv);
+    lx_glUniform4ui = LOAD(PFNGLUNIFORM4UIPROC, glUniform4ui);
+    lx_glUniform4uiv = LOAD(PFNGLUNIFORM4UIVPROC, glUniform4uiv);
+    lx_glVertexAttribI1i = LOAD(PFNGLVERTEXATTRIBI1IPROC, glVertexAttribI1i);
+    lx_glVertexAttribI1iv = LOAD(PFNGLVERTEXATTRIBI1IVPROC, glVertexAttribI1iv);
+    lx_glVertexAttribI1ui = LOAD(PFNGLVERTEXATTRIBI1UIPROC, glVertexAttribI1ui);
+    lx_glVertexAttribI1uiv = LOAD(PFNGLVERTEXATTRIBI1UIVPROC, glVertexAttribI1uiv);
+    lx_glVertexAttribI2i = LOAD(PFNGLVERTEXATTRIBI2IPROC, glVertexAttribI2i);
+    lx_glVertexAttribI2iv = LOAD(PFNGLVERTEXATTRIBI2IVPROC, glVertexAttribI2iv);
+    lx_glVertexAttribI2ui = LOAD(PFNGLVERTEXATTRIBI2UIPROC, glVertexAttribI2ui);
+    lx_glVertexAttribI2uiv = LOAD(PFNGLVERTEXATTRIBI2UIVPROC, glVertexAttribI2uiv);
+    lx_glVertexAttribI3i = LOAD(PFNGLVERTEXATTRIBI3IPROC, glVertexAttribI3i);
+    lx_glVertexAttribI3iv = LOAD(PFNGLVERTEXATTRIBI3IVPROC, glVertexAttribI3iv);
+    lx_glVertexAttribI3ui = LOAD(PFNGLVERTEXATTRIBI3UIPROC, glVertexAttribI3ui);
+    lx_glVertexAttribI3uiv = LOAD(PFNGLVERTEXATTRIBI3UIVPROC, glVertexAttribI3uiv);
+    lx_glVertexAttribI4bv = LOAD(PFNGLVERTEXATTRIBI4BVPROC, glVertexAttribI4bv);
+    lx_glVertexAttribI4i = LOAD(PFNGLVERTEXATTRIBI4IPROC, glVertexAttribI4i);
+    lx_glVertexAttribI4iv = LOAD(PFNGLVERTEXATTRIBI4IVPROC, glVertexAttribI4iv);
+    lx_glVertexAttribI4sv = LOAD(PFNGLVERTEXATTRIBI4SVPROC, glVertexAttribI4sv);
+    lx_glVertexAttribI4ubv = LOAD(PFNGLVERTEXATTRIBI4UBVPROC, glVertexAttribI4ubv);
+    lx_glVertexAttribI4ui = LOAD(PFNGLVERTEXATTRIBI4UIPROC, glVertexAttribI4ui);
+    lx_glVertexAttribI4uiv = LOAD(PFNGLVERTEXATTRIBI4UIVPROC, glVertexAttribI4uiv);
+    lx_glVertexAttribI4usv = LOAD(PFNGLVERTEXATTRIBI4USVPROC, glVertexAttribI4usv);
+    lx_glVertexAttribIPointer = LOAD(PFNGLVERTEXATTRIBIPOINTERPROC, glVertexAttribIPointer);
 }
 
 PFNGLCOPYBUFFERSUBDATAPROC lx_glCopyBufferSubData = NULL;
@@ -712,21 +1072,34 @@ PFNGLPRIMITIVERESTARTINDEXPROC lx_glPrimitiveRestartIndex = NULL;
 PFNGLTEXBUFFERPROC lx_glTexBuffer = NULL;
 PFNGLUNIFORMBLOCKBINDINGPROC lx_glUniformBlockBinding = NULL;
 
-static void load_3_1(int load)
+STUB_VOID(PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData, (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readTarget, writeTarget, readOffset, writeOffset, size))
+STUB_VOID(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount), (mode, first, count, instancecount))
+STUB_VOID(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount), (mode, count, type, indices, instancecount))
+STUB_VOID(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName, (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName), (program, uniformBlockIndex, bufSize, length, uniformBlockName))
+STUB_VOID(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv, (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params), (program, uniformBlockIndex, pname, params))
+STUB_VOID(PFNGLGETACTIVEUNIFORMNAMEPROC, glGetActiveUniformName, (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName), (program, uniformIndex, bufSize, length, uniformName))
+STUB_VOID(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv, (GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params), (program, uniformCount, uniformIndices, pname, params))
+STUB(GLuint, PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex, (GLuint program, const GLchar* uniformBlockName), (program, uniformBlockName))
+STUB_VOID(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices, (GLuint program, GLsizei uniformCount, const GLchar *const* uniformNames, GLuint* uniformIndices), (program, uniformCount, uniformNames, uniformIndices))
+STUB_VOID(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex, (GLuint index), (index))
+STUB_VOID(PFNGLTEXBUFFERPROC, glTexBuffer, (GLenum target, GLenum internalformat, GLuint buffer), (target, internalformat, buffer))
+STUB_VOID(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding, (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding), (program, uniformBlockIndex, uniformBlockBinding))
+
+static void load_3_1(int mode)
 {
     if (!v3_1) return;
-    lx_glCopyBufferSubData = load ? (PFNGLCOPYBUFFERSUBDATAPROC) load_proc("glCopyBufferSubData") : NULL;
-    lx_glDrawArraysInstanced = load ? (PFNGLDRAWARRAYSINSTANCEDPROC) load_proc("glDrawArraysInstanced") : NULL;
-    lx_glDrawElementsInstanced = load ? (PFNGLDRAWELEMENTSINSTANCEDPROC) load_proc("glDrawElementsInstanced") : NULL;
-    lx_glGetActiveUniformBlockName = load ? (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC) load_proc("glGetActiveUniformBlockName") : NULL;
-    lx_glGetActiveUniformBlockiv = load ? (PFNGLGETACTIVEUNIFORMBLOCKIVPROC) load_proc("glGetActiveUniformBlockiv") : NULL;
-    lx_glGetActiveUniformName = load ? (PFNGLGETACTIVEUNIFORMNAMEPROC) load_proc("glGetActiveUniformName") : NULL;
-    lx_glGetActiveUniformsiv = load ? (PFNGLGETACTIVEUNIFORMSIVPROC) load_proc("glGetActiveUniformsiv") : NULL;
-    lx_glGetUniformBlockIndex = load ? (PFNGLGETUNIFORMBLOCKINDEXPROC) load_proc("glGetUniformBlockIndex") : NULL;
-    lx_glGetUniformIndices = load ? (PFNGLGETUNIFORMINDICESPROC) load_proc("glGetUniformIndices") : NULL;
-    lx_glPrimitiveRestartIndex = load ? (PFNGLPRIMITIVERESTARTINDEXPROC) load_proc("glPrimitiveRestartIndex") : NULL;
-    lx_glTexBuffer = load ? (PFNGLTEXBUFFERPROC) load_proc("glTexBuffer") : NULL;
-    lx_glUniformBlockBinding = load ? (PFNGLUNIFORMBLOCKBINDINGPROC) load_proc("glUniformBlockBinding") : NULL;
+    lx_glCopyBufferSubData = LOAD(PFNGLCOPYBUFFERSUBDATAPROC, glCopyBufferSubData);
+    lx_glDrawArraysInstanced = LOAD(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced);
+    lx_glDrawElementsInstanced = LOAD(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced);
+    lx_glGetActiveUniformBlockName = LOAD(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC, glGetActiveUniformBlockName);
+    lx_glGetActiveUniformBlockiv = LOAD(PFNGLGETACTIVEUNIFORMBLOCKIVPROC, glGetActiveUniformBlockiv);
+    lx_glGetActiveUniformName = LOAD(PFNGLGETACTIVEUNIFORMNAMEPROC, glGetActiveUniformName);
+    lx_glGetActiveUniformsiv = LOAD(PFNGLGETACTIVEUNIFORMSIVPROC, glGetActiveUniformsiv);
+    lx_glGetUniformBlockIndex = LOAD(PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex);
+    lx_glGetUniformIndices = LOAD(PFNGLGETUNIFORMINDICESPROC, glGetUniformIndices);
+    lx_glPrimitiveRestartIndex = LOAD(PFNGLPRIMITIVERESTARTINDEXPROC, glPrimitiveRestartIndex);
+    lx_glTexBuffer = LOAD(PFNGLTEXBUFFERPROC, glTexBuffer);
+    lx_glUniformBlockBinding = LOAD(PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);
 }
 
 PFNGLCLIENTWAITSYNCPROC lx_glClientWaitSync = NULL;
@@ -749,28 +1122,48 @@ PFNGLTEXIMAGE2DMULTISAMPLEPROC lx_glTexImage2DMultisample = NULL;
 PFNGLTEXIMAGE3DMULTISAMPLEPROC lx_glTexImage3DMultisample = NULL;
 PFNGLWAITSYNCPROC lx_glWaitSync = NULL;
 
-static void load_3_2(int load)
+STUB(GLenum, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+STUB_VOID(PFNGLDELETESYNCPROC, glDeleteSync, (GLsync sync), (sync))
+STUB_VOID(PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, count, type, indices, basevertex))
+STUB_VOID(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex), (mode, count, type, indices, instancecount, basevertex))
+STUB_VOID(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex, (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void* indices, GLint basevertex), (mode, start, end, count, type, indices, basevertex))
+STUB(GLsync, PFNGLFENCESYNCPROC, glFenceSync, (GLenum condition, GLbitfield flags), (condition, flags))
+STUB_VOID(PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture, (GLenum target, GLenum attachment, GLuint texture, GLint level), (target, attachment, texture, level))
+STUB_VOID(PFNGLGETBUFFERPARAMETERI64VPROC, glGetBufferParameteri64v, (GLenum target, GLenum pname, GLint64* params), (target, pname, params))
+STUB_VOID(PFNGLGETINTEGER64I_VPROC, glGetInteger64i_v, (GLenum target, GLuint index, GLint64* data), (target, index, data))
+STUB_VOID(PFNGLGETINTEGER64VPROC, glGetInteger64v, (GLenum pname, GLint64* data), (pname, data))
+STUB_VOID(PFNGLGETMULTISAMPLEFVPROC, glGetMultisamplefv, (GLenum pname, GLuint index, GLfloat* val), (pname, index, val))
+STUB_VOID(PFNGLGETSYNCIVPROC, glGetSynciv, (GLsync sync, GLenum pname, GLsizei count, GLsizei* length, GLint* values), (sync, pname, count, length, values))
+STUB(GLboolean, PFNGLISSYNCPROC, glIsSync, (GLsync sync), (sync))
+STUB_VOID(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex, (GLenum mode, const GLsizei* count, GLenum type, const void *const* indices, GLsizei drawcount, const GLint* basevertex), (mode, count, type, indices, drawcount, basevertex))
+STUB_VOID(PFNGLPROVOKINGVERTEXPROC, glProvokingVertex, (GLenum mode), (mode))
+STUB_VOID(PFNGLSAMPLEMASKIPROC, glSampleMaski, (GLuint maskNumber, GLbitfield mask), (maskNumber, mask))
+STUB_VOID(PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+STUB_VOID(PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+STUB_VOID(PFNGLWAITSYNCPROC, glWaitSync, (GLsync sync, GLbitfield flags, GLuint64 timeout), (sync, flags, timeout))
+
+static void load_3_2(int mode)
 {
     if (!v3_2) return;
-    lx_glClientWaitSync = load ? (PFNGLCLIENTWAITSYNCPROC) load_proc("glClientWaitSync") : NULL;
-    lx_glDeleteSync = load ? (PFNGLDELETESYNCPROC) load_proc("glDeleteSync") : NULL;
-    lx_glDrawElementsBaseVertex = load ? (PFNGLDRAWELEMENTSBASEVERTEXPROC) load_proc("glDrawElementsBaseVertex") : NULL;
-    lx_glDrawElementsInstancedBaseVertex = load ? (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC) load_proc("glDrawElementsInstancedBaseVertex") : NULL;
-    lx_glDrawRangeElementsBaseVertex = load ? (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC) load_proc("glDrawRangeElementsBaseVertex") : NULL;
-    lx_glFenceSync = load ? (PFNGLFENCESYNCPROC) load_proc("glFenceSync") : NULL;
-    lx_glFramebufferTexture = load ? (PFNGLFRAMEBUFFERTEXTUREPROC) load_proc("glFramebufferTexture") : NULL;
-    lx_glGetBufferParameteri64v = load ? (PFNGLGETBUFFERPARAMETERI64VPROC) load_proc("glGetBufferParameteri64v") : NULL;
-    lx_glGetInteger64i_v = load ? (PFNGLGETINTEGER64I_VPROC) load_proc("glGetInteger64i_v") : NULL;
-    lx_glGetInteger64v = load ? (PFNGLGETINTEGER64VPROC) load_proc("glGetInteger64v") : NULL;
-    lx_glGetMultisamplefv = load ? (PFNGLGETMULTISAMPLEFVPROC) load_proc("glGetMultisamplefv") : NULL;
-    lx_glGetSynciv = load ? (PFNGLGETSYNCIVPROC) load_proc("glGetSynciv") : NULL;
-    lx_glIsSync = load ? (PFNGLISSYNCPROC) load_proc("glIsSync") : NULL;
-    lx_glMultiDrawElementsBaseVertex = load ? (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC) load_proc("glMultiDrawElementsBaseVertex") : NULL;
-    lx_glProvokingVertex = load ? (PFNGLPROVOKINGVERTEXPROC) load_proc("glProvokingVertex") : NULL;
-    lx_glSampleMaski = load ? (PFNGLSAMPLEMASKIPROC) load_proc("glSampleMaski") : NULL;
-    lx_glTexImage2DMultisample = load ? (PFNGLTEXIMAGE2DMULTISAMPLEPROC) load_proc("glTexImage2DMultisample") : NULL;
-    lx_glTexImage3DMultisample = load ? (PFNGLTEXIMAGE3DMULTISAMPLEPROC) load_proc("glTexImage3DMultisample") : NULL;
-    lx_glWaitSync = load ? (PFNGLWAITSYNCPROC) load_proc("glWaitSync") : NULL;
+    lx_glClientWaitSync = LOAD(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+    lx_glDeleteSync = LOAD(PFNGLDELETESYNCPROC, glDeleteSync);
+    lx_glDrawElementsBaseVertex = LOAD(PFNGLDRAWELEMENTSBASEVERTEXPROC, glDrawElementsBaseVertex);
+    lx_glDrawElementsInstancedBaseVertex = LOAD(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC, glDrawElementsInstancedBaseVertex);
+    lx_glDrawRangeElementsBaseVertex = LOAD(PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC, glDrawRangeElementsBaseVertex);
+    lx_glFenceSync = LOAD(PFNGLFENCESYNCPROC, glFenceSync);
+    lx_glFramebufferTexture = LOAD(PFNGLFRAMEBUFFERTEXTUREPROC, glFramebufferTexture);
+    lx_glGetBufferParameteri64v = LOAD(PFNGLGETBUFFERPARAMETERI64VPROC, glGetBufferParameteri64v);
+    lx_glGetInteger64i_v = LOAD(PFNGLGETINTEGER64I_VPROC, glGetInteger64i_v);
+    lx_glGetInteger64v = LOAD(PFNGLGETINTEGER64VPROC, glGetInteger64v);
+    lx_glGetMultisamplefv = LOAD(PFNGLGETMULTISAMPLEFVPROC, glGetMultisamplefv);
+    lx_glGetSynciv = LOAD(PFNGLGETSYNCIVPROC, glGetSynciv);
+    lx_glIsSync = LOAD(PFNGLISSYNCPROC, glIsSync);
+    lx_glMultiDrawElementsBaseVertex = LOAD(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC, glMultiDrawElementsBaseVertex);
+    lx_glProvokingVertex = LOAD(PFNGLPROVOKINGVERTEXPROC, glProvokingVertex);
+    lx_glSampleMaski = LOAD(PFNGLSAMPLEMASKIPROC, glSampleMaski);
+    lx_glTexImage2DMultisample = LOAD(PFNGLTEXIMAGE2DMULTISAMPLEPROC, glTexImage2DMultisample);
+    lx_glTexImage3DMultisample = LOAD(PFNGLTEXIMAGE3DMULTISAMPLEPROC, glTexImage3DMultisample);
+    lx_glWaitSync = LOAD(PFNGLWAITSYNCPROC, glWaitSync);
 }
 
 PFNGLBINDFRAGDATALOCATIONINDEXEDPROC lx_glBindFragDataLocationIndexed = NULL;
@@ -802,37 +1195,66 @@ PFNGLVERTEXATTRIBP3UIVPROC lx_glVertexAttribP3uiv = NULL;
 PFNGLVERTEXATTRIBP4UIPROC lx_glVertexAttribP4ui = NULL;
 PFNGLVERTEXATTRIBP4UIVPROC lx_glVertexAttribP4uiv = NULL;
 
-static void load_3_3(int load)
+STUB_VOID(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed, (GLuint program, GLuint colorNumber, GLuint index, const GLchar* name), (program, colorNumber, index, name))
+STUB_VOID(PFNGLBINDSAMPLERPROC, glBindSampler, (GLuint unit, GLuint sampler), (unit, sampler))
+STUB_VOID(PFNGLDELETESAMPLERSPROC, glDeleteSamplers, (GLsizei count, const GLuint* samplers), (count, samplers))
+STUB_VOID(PFNGLGENSAMPLERSPROC, glGenSamplers, (GLsizei count, GLuint* samplers), (count, samplers))
+STUB(GLint, PFNGLGETFRAGDATAINDEXPROC, glGetFragDataIndex, (GLuint program, const GLchar* name), (program, name))
+STUB_VOID(PFNGLGETQUERYOBJECTI64VPROC, glGetQueryObjecti64v, (GLuint id, GLenum pname, GLint64* params), (id, pname, params))
+STUB_VOID(PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v, (GLuint id, GLenum pname, GLuint64* params), (id, pname, params))
+STUB_VOID(PFNGLGETSAMPLERPARAMETERIIVPROC, glGetSamplerParameterIiv, (GLuint sampler, GLenum pname, GLint* params), (sampler, pname, params))
+STUB_VOID(PFNGLGETSAMPLERPARAMETERIUIVPROC, glGetSamplerParameterIuiv, (GLuint sampler, GLenum pname, GLuint* params), (sampler, pname, params))
+STUB_VOID(PFNGLGETSAMPLERPARAMETERFVPROC, glGetSamplerParameterfv, (GLuint sampler, GLenum pname, GLfloat* params), (sampler, pname, params))
+STUB_VOID(PFNGLGETSAMPLERPARAMETERIVPROC, glGetSamplerParameteriv, (GLuint sampler, GLenum pname, GLint* params), (sampler, pname, params))
+STUB(GLboolean, PFNGLISSAMPLERPROC, glIsSampler, (GLuint sampler), (sampler))
+STUB_VOID(PFNGLQUERYCOUNTERPROC, glQueryCounter, (GLuint id, GLenum target), (id, target))
+STUB_VOID(PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv, (GLuint sampler, GLenum pname, const GLint* param), (sampler, pname, param))
+STUB_VOID(PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv, (GLuint sampler, GLenum pname, const GLuint* param), (sampler, pname, param))
+STUB_VOID(PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf, (GLuint sampler, GLenum pname, GLfloat param), (sampler, pname, param))
+STUB_VOID(PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv, (GLuint sampler, GLenum pname, const GLfloat* param), (sampler, pname, param))
+STUB_VOID(PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri, (GLuint sampler, GLenum pname, GLint param), (sampler, pname, param))
+STUB_VOID(PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv, (GLuint sampler, GLenum pname, const GLint* param), (sampler, pname, param))
+STUB_VOID(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor, (GLuint index, GLuint divisor), (index, divisor))
+STUB_VOID(PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui, (GLuint index, GLenum type, GLboolean normalized, GLuint value), (index, type, normalized, value))
+STUB_VOID(PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv, (GLuint index, GLenum type, GLboolean normalized, const GLuint* value), (index, type, normalized, value))
+
+static void load_3_3(int mode)
 {
     if (!v3_3) return;
-    lx_glBindFragDataLocationIndexed = load ? (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC) load_proc("glBindFragDataLocationIndexed") : NULL;
-    lx_glBindSampler = load ? (PFNGLBINDSAMPLERPROC) load_proc("glBindSampler") : NULL;
-    lx_glDeleteSamplers = load ? (PFNGLDELETESAMPLERSPROC) load_proc("glDeleteSamplers") : NULL;
-    lx_glGenSamplers = load ? (PFNGLGENSAMPLERSPROC) load_proc("glGenSamplers") : NULL;
-    lx_glGetFragDataIndex = load ? (PFNGLGETFRAGDATAINDEXPROC) load_proc("glGetFragDataIndex") : NULL;
-    lx_glGetQueryObjecti64v = load ? (PFNGLGETQUERYOBJECTI64VPROC) load_proc("glGetQueryObjecti64v") : NULL;
-    lx_glGetQueryObjectui64v = load ? (PFNGLGETQUERYOBJECTUI64VPROC) load_proc("glGetQueryObjectui64v") : NULL;
-    lx_glGetSamplerParameterIiv = load ? (PFNGLGETSAMPLERPARAMETERIIVPROC) load_proc("glGetSamplerParameterIiv") : NULL;
-    lx_glGetSamplerParameterIuiv = load ? (PFNGLGETSAMPLERPARAMETERIUIVPROC) load_proc("glGetSamplerParameterIuiv") : NULL;
-    lx_glGetSamplerParameterfv = load ? (PFNGLGETSAMPLERPARAMETERFVPROC) load_proc("glGetSamplerParameterfv") : NULL;
-    lx_glGetSamplerParameteriv = load ? (PFNGLGETSAMPLERPARAMETERIVPROC) load_proc("glGetSamplerParameteriv") : NULL;
-    lx_glIsSampler = load ? (PFNGLISSAMPLERPROC) load_proc("glIsSampler") : NULL;
-    lx_glQueryCounter = load ? (PFNGLQUERYCOUNTERPROC) load_proc("glQueryCounter") : NULL;
-    lx_glSamplerParameterIiv = load ? (PFNGLSAMPLERPARAMETERIIVPROC) load_proc("glSamplerParameterIiv") : NULL;
-    lx_glSamplerParameterIuiv = load ? (PFNGLSAMPLERPARAMETERIUIVPROC) load_proc("glSamplerParameterIuiv") : NULL;
-    lx_glSamplerParameterf = load ? (PFNGLSAMPLERPARAMETERFPROC) load_proc("glSamplerParameterf") : NULL;
-    lx_glSamplerParameterfv = load ? (PFNGLSAMPLERPARAMETERFVPROC) load_proc("glSamplerParameterfv") : NULL;
-    lx_glSamplerParameteri = load ? (PFNGLSAMPLERPARAMETERIPROC) load_proc("glSamplerParameteri") : NULL;
-    lx_glSamplerParameteriv = load ? (PFNGLSAMPLERPARAMETERIVPROC) load_proc("glSamplerParameteriv") : NULL;
-    lx_glVertexAttribDivisor = load ? (PFNGLVERTEXATTRIBDIVISORPROC) load_proc("glVertexAttribDivisor") : NULL;
-    lx_glVertexAttribP1ui = load ? (PFNGLVERTEXATTRIBP1UIPROC) load_proc("glVertexAttribP1ui") : NULL;
-    lx_glVertexAttribP1uiv = load ? (PFNGLVERTEXATTRIBP1UIVPROC) load_proc("glVertexAttribP1uiv") : NULL;
-    lx_glVertexAttribP2ui = load ? (PFNGLVERTEXATTRIBP2UIPROC) load_proc("glVertexAttribP2ui") : NULL;
-    lx_glVertexAttribP2uiv = load ? (PFNGLVERTEXATTRIBP2UIVPROC) load_proc("glVertexAttribP2uiv") : NULL;
-    lx_glVertexAttribP3ui = load ? (PFNGLVERTEXATTRIBP3UIPROC) load_proc("glVertexAttribP3ui") : NULL;
-    lx_glVertexAttribP3uiv = load ? (PFNGLVERTEXATTRIBP3UIVPROC) load_proc("glVertexAttribP3uiv") : NULL;
-    lx_glVertexAttribP4ui = load ? (PFNGLVERTEXATTRIBP4UIPROC) load_proc("glVertexAttribP4ui") : NULL;
-    lx_glVertexAttribP4uiv = load ? (PFNGLVERTEXATTRIBP4UIVPROC) load_proc("glVertexAttribP4uiv") : NULL;
+    lx_glBindFragDataLocationIndexed = LOAD(PFNGLBINDFRAGDATALOCATIONINDEXEDPROC, glBindFragDataLocationIndexed);
+    lx_glBindSampler = LOAD(PFNGLBINDSAMPLERPROC, glBindSampler);
+    lx_glDeleteSamplers = LOAD(PFNGLDELETESAMPLERSPROC, glDeleteSamplers);
+    lx_glGenSamplers = LOAD(PFNGLGENSAMPLERSPROC, glGenSamplers);
+    lx_glGetFragDataIndex = LOAD(PFNGLGETFRAGDATAINDEXPROC, glGetFragDataIndex);
+    lx_glGetQueryObjecti64v = LOAD(PFNGLGETQUERYOBJECTI64VPROC, glGetQueryObjecti64v);
+    lx_glGetQueryObjectui64v = LOAD(PFNGLGETQUERYOBJECTUI64VPROC, glGetQueryObjectui64v);
+    lx_glGetSamplerParameterIiv = LOAD(PFNGLGETSAMPLERPARAMETERIIVPROC, glGetSamplerParameterIiv);
+    lx_glGetSamplerParameterIuiv = LOAD(PFNGLGETSAMPLERPARAMETERIUIVPROC, glGetSamplerParameterIuiv);
+    lx_glGetSamplerParameterfv = LOAD(PFNGLGETSAMPLERPARAMETERFVPROC, glGetSamplerParameterfv);
+    lx_glGetSamplerParameteriv = LOAD(PFNGLGETSAMPLERPARAMETERIVPROC, glGetSamplerParameteriv);
+    lx_glIsSampler = LOAD(PFNGLISSAMPLERPROC, glIsSampler);
+    lx_glQueryCounter = LOAD(PFNGLQUERYCOUNTERPROC, glQueryCounter);
+    lx_glSamplerParameterIiv = LOAD(PFNGLSAMPLERPARAMETERIIVPROC, glSamplerParameterIiv);
+    lx_glSamplerParameterIuiv = LOAD(PFNGLSAMPLERPARAMETERIUIVPROC, glSamplerParameterIuiv);
+    lx_glSamplerParameterf = LOAD(PFNGLSAMPLERPARAMETERFPROC, glSamplerParameterf);
+    lx_glSamplerParameterfv = LOAD(PFNGLSAMPLERPARAMETERFVPROC, glSamplerParameterfv);
+    lx_glSamplerParameteri = LOAD(PFNGLSAMPLERPARAMETERIPROC, glSamplerParameteri);
+    lx_glSamplerParameteriv = LOAD(PFNGLSAMPLERPARAMETERIVPROC, glSamplerParameteriv);
+    lx_glVertexAttribDivisor = LOAD(PFNGLVERTEXATTRIBDIVISORPROC, glVertexAttribDivisor);
+    lx_glVertexAttribP1ui = LOAD(PFNGLVERTEXATTRIBP1UIPROC, glVertexAttribP1ui);
+    lx_glVertexAttribP1uiv = LOAD(PFNGLVERTEXATTRIBP1UIVPROC, glVertexAttribP1uiv);
+    lx_glVertexAttribP2ui = LOAD(PFNGLVERTEXATTRIBP2UIPROC, glVertexAttribP2ui);
+    lx_glVertexAttribP2uiv = LOAD(PFNGLVERTEXATTRIBP2UIVPROC, glVertexAttribP2uiv);
+    lx_glVertexAttribP3ui = LOAD(PFNGLVERTEXATTRIBP3UIPROC, glVertexAttribP3ui);
+    lx_glVertexAttribP3uiv = LOAD(PFNGLVERTEXATTRIBP3UIVPROC, glVertexAttribP3uiv);
+    lx_glVertexAttribP4ui = LOAD(PFNGLVERTEXATTRIBP4UIPROC, glVertexAttribP4ui);
+    lx_glVertexAttribP4uiv = LOAD(PFNGLVERTEXATTRIBP4UIVPROC, glVertexAttribP4uiv);
 }
 
 PFNGLBEGINQUERYINDEXEDPROC lx_glBeginQueryIndexed = NULL;
@@ -882,55 +1304,102 @@ PFNGLUNIFORMMATRIX4X2DVPROC lx_glUniformMatrix4x2dv = NULL;
 PFNGLUNIFORMMATRIX4X3DVPROC lx_glUniformMatrix4x3dv = NULL;
 PFNGLUNIFORMSUBROUTINESUIVPROC lx_glUniformSubroutinesuiv = NULL;
 
-static void load_4_0(int load)
+STUB_VOID(PFNGLBEGINQUERYINDEXEDPROC, glBeginQueryIndexed, (GLenum target, GLuint index, GLuint id), (target, index, id))
+STUB_VOID(PFNGLBINDTRANSFORMFEEDBACKPROC, glBindTransformFeedback, (GLenum target, GLuint id), (target, id))
+STUB_VOID(PFNGLBLENDEQUATIONSEPARATEIPROC, glBlendEquationSeparatei, (GLuint buf, GLenum modeRGB, GLenum modeAlpha), (buf, modeRGB, modeAlpha))
+STUB_VOID(PFNGLBLENDEQUATIONIPROC, glBlendEquationi, (GLuint buf, GLenum mode), (buf, mode))
+STUB_VOID(PFNGLBLENDFUNCSEPARATEIPROC, glBlendFuncSeparatei, (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha), (buf, srcRGB, dstRGB, srcAlpha, dstAlpha))
+STUB_VOID(PFNGLBLENDFUNCIPROC, glBlendFunci, (GLuint buf, GLenum src, GLenum dst), (buf, src, dst))
+STUB_VOID(PFNGLDELETETRANSFORMFEEDBACKSPROC, glDeleteTransformFeedbacks, (GLsizei n, const GLuint* ids), (n, ids))
+STUB_VOID(PFNGLDRAWARRAYSINDIRECTPROC, glDrawArraysIndirect, (GLenum mode, const void* indirect), (mode, indirect))
+STUB_VOID(PFNGLDRAWELEMENTSINDIRECTPROC, glDrawElementsIndirect, (GLenum mode, GLenum type, const void* indirect), (mode, type, indirect))
+STUB_VOID(PFNGLDRAWTRANSFORMFEEDBACKPROC, glDrawTransformFeedback, (GLenum mode, GLuint id), (mode, id))
+STUB_VOID(PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, glDrawTransformFeedbackStream, (GLenum mode, GLuint id, GLuint stream), (mode, id, stream))
+STUB_VOID(PFNGLENDQUERYINDEXEDPROC, glEndQueryIndexed, (GLenum target, GLuint index), (target, index))
+STUB_VOID(PFNGLGENTRANSFORMFEEDBACKSPROC, glGenTransformFeedbacks, (GLsizei n, GLuint* ids), (n, ids))
+STUB_VOID(PFNGLGETACTIVESUBROUTINENAMEPROC, glGetActiveSubroutineName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name), (program, shadertype, index, bufSize, length, name))
+STUB_VOID(PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, glGetActiveSubroutineUniformName, (GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name), (program, shadertype, index, bufSize, length, name))
+STUB_VOID(PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, glGetActiveSubroutineUniformiv, (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint* values), (program, shadertype, index, pname, values))
+STUB_VOID(PFNGLGETPROGRAMSTAGEIVPROC, glGetProgramStageiv, (GLuint program, GLenum shadertype, GLenum pname, GLint* values), (program, shadertype, pname, values))
+STUB_VOID(PFNGLGETQUERYINDEXEDIVPROC, glGetQueryIndexediv, (GLenum target, GLuint index, GLenum pname, GLint* params), (target, index, pname, params))
+STUB(GLuint, PFNGLGETSUBROUTINEINDEXPROC, glGetSubroutineIndex, (GLuint program, GLenum shadertype, const GLchar* name), (program, shadertype, name))
+STUB(GLint, PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, glGetSubroutineUniformLocation, (GLuint program, GLenum shadertype, const GLchar* name), (program, shadertype, name))
+STUB_VOID(PFNGLGETUNIFORMSUBROUTINEUIVPROC, glGetUniformSubroutineuiv, (GLenum shadertype, GLint location, GLuint* params), (shadertype, location, params))
+STUB_VOID(PFNGLGETUNIFORMDVPROC, glGetUniformdv, (GLuint program, GLint location, GLdouble* params), (program, location, params))
+STUB(GLboolean, PFNGLISTRANSFORMFEEDBACKPROC, glIsTransformFeedback, (GLuint id), (id))
+STUB_VOID(PFNGLMINSAMPLESHADINGPROC, glMinSampleShading, (GLfloat value), (value))
+STUB_VOID(PFNGLPATCHPARAMETERFVPROC, glPatchParameterfv, (GLenum pname, const GLfloat* values), (pname, values))
+STUB_VOID(PFNGLPATCHPARAMETERIPROC, glPatchParameteri, (GLenum pname, GLint value), (pname, value))
+STUB_VOID(PFNGLPAUSETRANSFORMFEEDBACKPROC, glPauseTransformFeedback, (void), ())
+STUB_VOID(PFNGLRESUMETRANSFORMFEEDBACKPROC, glResumeTransformFeedback, (void), ())
+STUB_VOID(PFNGLUNIFORM1DPROC, glUniform1d, (GLint location, GLdouble x), (location, x))
+STUB_VOID(PFNGLUNIFORM1DVPROC, glUniform1dv, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM2DPROC, glUniform2d, (GLint location, GLdouble x, GLdouble y), (location, x, y))
+STUB_VOID(PFNGLUNIFORM2DVPROC, glUniform2dv, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM3DPROC, glUniform3d, (GLint location, GLdouble x, GLdouble y, GLdouble z), (location, x, y, z))
+STUB_VOID(PFNGLUNIFORM3DVPROC, glUniform3dv, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORM4DPROC, glUniform4d, (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (location, x, y, z, w))
+STUB_VOID(PFNGLUNIFORM4DVPROC, glUniform4dv, (GLint location, GLsizei count, const GLdouble* value), (location, count, value))
+STUB_VOID(PFNGLUNIFORMMATRIX2DVPROC, glUniformMatrix2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX2X3DVPROC, glUniformMatrix2x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX2X4DVPROC, glUniformMatrix2x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX3DVPROC, glUniformMatrix3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX3X2DVPROC, glUniformMatrix3x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX3X4DVPROC, glUniformMatrix3x4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX4DVPROC, glUniformMatrix4dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX4X2DVPROC, glUniformMatrix4x2dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMMATRIX4X3DVPROC, glUniformMatrix4x3dv, (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (location, count, transpose, value))
+STUB_VOID(PFNGLUNIFORMSUBROUTINESUIVPROC, glUniformSubroutinesuiv, (GLenum shadertype, GLsizei count, const GLuint* indices), (shadertype, count, indices))
+
+static void load_4_0(int mode)
 {
     if (!v4_0) return;
-    lx_glBeginQueryIndexed = load ? (PFNGLBEGINQUERYINDEXEDPROC) load_proc("glBeginQueryIndexed") : NULL;
-    lx_glBindTransformFeedback = load ? (PFNGLBINDTRANSFORMFEEDBACKPROC) load_proc("glBindTransformFeedback") : NULL;
-    lx_glBlendEquationSeparatei = load ? (PFNGLBLENDEQUATIONSEPARATEIPROC) load_proc("glBlendEquationSeparatei") : NULL;
-    lx_glBlendEquationi = load ? (PFNGLBLENDEQUATIONIPROC) load_proc("glBlendEquationi") : NULL;
-    lx_glBlendFuncSeparatei = load ? (PFNGLBLENDFUNCSEPARATEIPROC) load_proc("glBlendFuncSeparatei") : NULL;
-    lx_glBlendFunci = load ? (PFNGLBLENDFUNCIPROC) load_proc("glBlendFunci") : NULL;
-    lx_glDeleteTransformFeedbacks = load ? (PFNGLDELETETRANSFORMFEEDBACKSPROC) load_proc("glDeleteTransformFeedbacks") : NULL;
-    lx_glDrawArraysIndirect = load ? (PFNGLDRAWARRAYSINDIRECTPROC) load_proc("glDrawArraysIndirect") : NULL;
-    lx_glDrawElementsIndirect = load ? (PFNGLDRAWELEMENTSINDIRECTPROC) load_proc("glDrawElementsIndirect") : NULL;
-    lx_glDrawTransformFeedback = load ? (PFNGLDRAWTRANSFORMFEEDBACKPROC) load_proc("glDrawTransformFeedback") : NULL;
-    lx_glDrawTransformFeedbackStream = load ? (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC) load_proc("glDrawTransformFeedbackStream") : NULL;
-    lx_glEndQueryIndexed = load ? (PFNGLENDQUERYINDEXEDPROC) load_proc("glEndQueryIndexed") : NULL;
-    lx_glGenTransformFeedbacks = load ? (PFNGLGENTRANSFORMFEEDBACKSPROC) load_proc("glGenTransformFeedbacks") : NULL;
-    lx_glGetActiveSubroutineName = load ? (PFNGLGETACTIVESUBROUTINENAMEPROC) load_proc("glGetActiveSubroutineName") : NULL;
-    lx_glGetActiveSubroutineUniformName = load ? (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC) load_proc("glGetActiveSubroutineUniformName") : NULL;
-    lx_glGetActiveSubroutineUniformiv = load ? (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC) load_proc("glGetActiveSubroutineUniformiv") : NULL;
-    lx_glGetProgramStageiv = load ? (PFNGLGETPROGRAMSTAGEIVPROC) load_proc("glGetProgramStageiv") : NULL;
-    lx_glGetQueryIndexediv = load ? (PFNGLGETQUERYINDEXEDIVPROC) load_proc("glGetQueryIndexediv") : NULL;
-    lx_glGetSubroutineIndex = load ? (PFNGLGETSUBROUTINEINDEXPROC) load_proc("glGetSubroutineIndex") : NULL;
-    lx_glGetSubroutineUniformLocation = load ? (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC) load_proc("glGetSubroutineUniformLocation") : NULL;
-    lx_glGetUniformSubroutineuiv = load ? (PFNGLGETUNIFORMSUBROUTINEUIVPROC) load_proc("glGetUniformSubroutineuiv") : NULL;
-    lx_glGetUniformdv = load ? (PFNGLGETUNIFORMDVPROC) load_proc("glGetUniformdv") : NULL;
-    lx_glIsTransformFeedback = load ? (PFNGLISTRANSFORMFEEDBACKPROC) load_proc("glIsTransformFeedback") : NULL;
-    lx_glMinSampleShading = load ? (PFNGLMINSAMPLESHADINGPROC) load_proc("glMinSampleShading") : NULL;
-    lx_glPatchParameterfv = load ? (PFNGLPATCHPARAMETERFVPROC) load_proc("glPatchParameterfv") : NULL;
-    lx_glPatchParameteri = load ? (PFNGLPATCHPARAMETERIPROC) load_proc("glPatchParameteri") : NULL;
-    lx_glPauseTransformFeedback = load ? (PFNGLPAUSETRANSFORMFEEDBACKPROC) load_proc("glPauseTransformFeedback") : NULL;
-    lx_glResumeTransformFeedback = load ? (PFNGLRESUMETRANSFORMFEEDBACKPROC) load_proc("glResumeTransformFeedback") : NULL;
-    lx_glUniform1d = load ? (PFNGLUNIFORM1DPROC) load_proc("glUniform1d") : NULL;
-    lx_glUniform1dv = load ? (PFNGLUNIFORM1DVPROC) load_proc("glUniform1dv") : NULL;
-    lx_glUniform2d = load ? (PFNGLUNIFORM2DPROC) load_proc("glUniform2d") : NULL;
-    lx_glUniform2dv = load ? (PFNGLUNIFORM2DVPROC) load_proc("glUniform2dv") : NULL;
-    lx_glUniform3d = load ? (PFNGLUNIFORM3DPROC) load_proc("glUniform3d") : NULL;
-    lx_glUniform3dv = load ? (PFNGLUNIFORM3DVPROC) load_proc("glUniform3dv") : NULL;
-    lx_glUniform4d = load ? (PFNGLUNIFORM4DPROC) load_proc("glUniform4d") : NULL;
-    lx_glUniform4dv = load ? (PFNGLUNIFORM4DVPROC) load_proc("glUniform4dv") : NULL;
-    lx_glUniformMatrix2dv = load ? (PFNGLUNIFORMMATRIX2DVPROC) load_proc("glUniformMatrix2dv") : NULL;
-    lx_glUniformMatrix2x3dv = load ? (PFNGLUNIFORMMATRIX2X3DVPROC) load_proc("glUniformMatrix2x3dv") : NULL;
-    lx_glUniformMatrix2x4dv = load ? (PFNGLUNIFORMMATRIX2X4DVPROC) load_proc("glUniformMatrix2x4dv") : NULL;
-    lx_glUniformMatrix3dv = load ? (PFNGLUNIFORMMATRIX3DVPROC) load_proc("glUniformMatrix3dv") : NULL;
-    lx_glUniformMatrix3x2dv = load ? (PFNGLUNIFORMMATRIX3X2DVPROC) load_proc("glUniformMatrix3x2dv") : NULL;
-    lx_glUniformMatrix3x4dv = load ? (PFNGLUNIFORMMATRIX3X4DVPROC) load_proc("glUniformMatrix3x4dv") : NULL;
-    lx_glUniformMatrix4dv = load ? (PFNGLUNIFORMMATRIX4DVPROC) load_proc("glUniformMatrix4dv") : NULL;
-    lx_glUniformMatrix4x2dv = load ? (PFNGLUNIFORMMATRIX4X2DVPROC) load_proc("glUniformMatrix4x2dv") : NULL;
-    lx_glUniformMatrix4x3dv = load ? (PFNGLUNIFORMMATRIX4X3DVPROC) load_proc("glUniformMatrix4x3dv") : NULL;
-    lx_glUniformSubroutinesuiv = load ? (PFNGLUNIFORMSUBROUTINESUIVPROC) load_proc("glUniformSubroutinesuiv") : NULL;
+    lx_glBeginQueryIndexed = LOAD(PFNGLBEGINQUERYINDEXEDPROC, glBeginQueryIndexed);
+    lx_glBindTransformFeedback = LOAD(PFNGLBINDTRANSFORMFEEDBACKPROC, glBindTransformFeedback);
+    lx_glBlendEquationSeparatei = LOAD(PFNGLBLENDEQUATIONSEPARATEIPROC, glBlendEquationSeparatei);
+    lx_glBlendEquationi = LOAD(PFNGLBLENDEQUATIONIPROC, glBlendEquationi);
+    lx_glBlendFuncSeparatei = LOAD(PFNGLBLENDFUNCSEPARATEIPROC, glBlendFuncSeparatei);
+    lx_glBlendFunci = LOAD(PFNGLBLENDFUNCIPROC, glBlendFunci);
+    lx_glDeleteTransformFeedbacks = LOAD(PFNGLDELETETRANSFORMFEEDBACKSPROC, glDeleteTransformFeedbacks);
+    lx_glDrawArraysIndirect = LOAD(PFNGLDRAWARRAYSINDIRECTPROC, glDrawArraysIndirect);
+    lx_glDrawElementsIndirect = LOAD(PFNGLDRAWELEMENTSINDIRECTPROC, glDrawElementsIndirect);
+    lx_glDrawTransformFeedback = LOAD(PFNGLDRAWTRANSFORMFEEDBACKPROC, glDrawTransformFeedback);
+    lx_glDrawTransformFeedbackStream = LOAD(PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC, glDrawTransformFeedbackStream);
+    lx_glEndQueryIndexed = LOAD(PFNGLENDQUERYINDEXEDPROC, glEndQueryIndexed);
+    lx_glGenTransformFeedbacks = LOAD(PFNGLGENTRANSFORMFEEDBACKSPROC, glGenTransformFeedbacks);
+    lx_glGetActiveSubroutineName = LOAD(PFNGLGETACTIVESUBROUTINENAMEPROC, glGetActiveSubroutineName);
+    lx_glGetActiveSubroutineUniformName = LOAD(PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC, glGetActiveSubroutineUniformName);
+    lx_glGetActiveSubroutineUniformiv = LOAD(PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC, glGetActiveSubroutineUniformiv);
+    lx_glGetProgramStageiv = LOAD(PFNGLGETPROGRAMSTAGEIVPROC, glGetProgramStageiv);
+    lx_glGetQueryIndexediv = LOAD(PFNGLGETQUERYINDEXEDIVPROC, glGetQueryIndexediv);
+    lx_glGetSubroutineIndex = LOAD(PFNGLGETSUBROUTINEINDEXPROC, glGetSubroutineIndex);
+    lx_glGetSubroutineUniformLocation = LOAD(PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC, glGetSubroutineUniformLocation);
+    lx_glGetUniformSubroutineuiv = LOAD(PFNGLGETUNIFORMSUBROUTINEUIVPROC, glGetUniformSubroutineuiv);
+    lx_glGetUniformdv = LOAD(PFNGLGETUNIFORMDVPROC, glGetUniformdv);
+    lx_glIsTransformFeedback = LOAD(PFNGLISTRANSFORMFEEDBACKPROC, glIsTransformFeedback);
+    lx_glMinSampleShading = LOAD(PFNGLMINSAMPLESHADINGPROC, glMinSampleShading);
+    lx_glPatchParameterfv = LOAD(PFNGLPATCHPARAMETERFVPROC, glPatchParameterfv);
+    lx_glPatchParameteri = LOAD(PFNGLPATCHPARAMETERIPROC, glPatchParameteri);
+    lx_glPauseTransformFeedback = LOAD(PFNGLPAUSETRANSFORMFEEDBACKPROC, glPauseTransformFeedback);
+    lx_glResumeTransformFeedback = LOAD(PFNGLRESUMETRANSFORMFEEDBACKPROC, glResumeTransformFeedback);
+    lx_glUniform1d = LOAD(PFNGLUNIFORM1DPROC, glUniform1d);
+    lx_glUniform1dv = LOAD(PFNGLUNIFORM1DVPROC, glUniform1dv);
+    lx_glUniform2d = LOAD(PFNGLUNIFORM2DPROC, glUniform2d);
+    lx_glUniform2dv = LOAD(PFNGLUNIFORM2DVPROC, glUniform2dv);
+    lx_glUniform3d = LOAD(PFNGLUNIFORM3DPROC, glUniform3d);
+    lx_glUniform3dv = LOAD(PFNGLUNIFORM3DVPROC, glUniform3dv);
+    lx_glUniform4d = LOAD(PFNGLUNIFORM4DPROC, glUniform4d);
+    lx_glUniform4dv = LOAD(PFNGLUNIFORM4DVPROC, glUniform4dv);
+    lx_glUniformMatrix2dv = LOAD(PFNGLUNIFORMMATRIX2DVPROC, glUniformMatrix2dv);
+    lx_glUniformMatrix2x3dv = LOAD(PFNGLUNIFORMMATRIX2X3DVPROC, glUniformMatrix2x3dv);
+    lx_glUniformMatrix2x4dv = LOAD(PFNGLUNIFORMMATRIX2X4DVPROC, glUniformMatrix2x4dv);
+    lx_glUniformMatrix3dv = LOAD(PFNGLUNIFORMMATRIX3DVPROC, glUniformMatrix3dv);
+    lx_glUniformMatrix3x2dv = LOAD(PFNGLUNIFORMMATRIX3X2DVPROC, glUniformMatrix3x2dv);
+    lx_glUniformMatrix3x4dv = LOAD(PFNGLUNIFORMMATRIX3X4DVPROC, glUniformMatrix3x4dv);
+    lx_glUniformMatrix4dv = LOAD(PFNGLUNIFORMMATRIX4DVPROC, glUniformMatrix4dv);
+    lx_glUniformMatrix4x2dv = LOAD(PFNGLUNIFORMMATRIX4X2DVPROC, glUniformMatrix4x2dv);
+    lx_glUniformMatrix4x3dv = LOAD(PFNGLUNIFORMMATRIX4X3DVPROC, glUniformMatrix4x3dv);
+    lx_glUniformSubroutinesuiv = LOAD(PFNGLUNIFORMSUBROUTINESUIVPROC, glUniformSubroutinesuiv);
 }
 
 PFNGLACTIVESHADERPROGRAMPROC lx_glActiveShaderProgram = NULL;
@@ -1022,97 +1491,186 @@ PFNGLVIEWPORTARRAYVPROC lx_glViewportArrayv = NULL;
 PFNGLVIEWPORTINDEXEDFPROC lx_glViewportIndexedf = NULL;
 PFNGLVIEWPORTINDEXEDFVPROC lx_glViewportIndexedfv = NULL;
 
-static void load_4_1(int load)
+STUB_VOID(PFNGLACTIVESHADERPROGRAMPROC, glActiveShaderProgram, (GLuint pipeline, GLuint program), (pipeline, program))
+STUB_VOID(PFNGLBINDPROGRAMPIPELINEPROC, glBindProgramPipeline, (GLuint pipeline), (pipeline))
+STUB_VOID(PFNGLCLEARDEPTHFPROC, glClearDepthf, (GLfloat d), (d))
+STUB(GLuint, PFNGLCREATESHADERPROGRAMVPROC, glCreateShaderProgramv, (GLenum type, GLsizei count, const GLchar *const* strings), (type, count, strings))
+STUB_VOID(PFNGLDELETEPROGRAMPIPELINESPROC, glDeleteProgramPipelines, (GLsizei n, const GLuint* pipelines), (n, pipelines))
+STUB_VOID(PFNGLDEPTHRANGEARRAYVPROC, glDepthRangeArrayv, (GLuint first, GLsizei count, const GLdouble* v), (first, count, v))
+STUB_VOID(PFNGLDEPTHRANGEINDEXEDPROC, glDepthRangeIndexed, (GLuint index, GLdouble n, GLdouble f), (index, n, f))
+STUB_VOID(PFNGLDEPTHRANGEFPROC, glDepthRangef, (GLfloat n, GLfloat f), (n, f))
+STUB_VOID(PFNGLGENPROGRAMPIPELINESPROC, glGenProgramPipelines, (GLsizei n, GLuint* pipelines), (n, pipelines))
+STUB_VOID(PFNGLGETDOUBLEI_VPROC, glGetDoublei_v, (GLenum target, GLuint index, GLdouble* data), (target, index, data))
+STUB_VOID(PFNGLGETFLOATI_VPROC, glGetFloati_v, (GLenum target, GLuint index, GLfloat* data), (target, index, data))
+STUB_VOID(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary, (GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary), (program, bufSize, length, binaryFormat, binary))
+STUB_VOID(PFNGLGETPROGRAMPIPELINEINFOLOGPROC, glGetProgramPipelineInfoLog, (GLuint pipeline, GLsizei bufSize, GLsizei* length, GLchar* infoLog), (pipeline, bufSize, length, infoLog))
+STUB_VOID(PFNGLGETPROGRAMPIPELINEIVPROC, glGetProgramPipelineiv, (GLuint pipeline, GLenum pname, GLint* params), (pipeline, pname, params))
+STUB_VOID(PFNGLGETSHADERPRECISIONFORMATPROC, glGetShaderPrecisionFormat, (GLenum shadertype, GLenum precisiontype, GLint* range, GLint* precision), (shadertype, precisiontype, range, precision))
+STUB_VOID(PFNGLGETVERTEXATTRIBLDVPROC, glGetVertexAttribLdv, (GLuint index, GLenum pname, GLdouble* params), (index, pname, params))
+STUB(GLboolean, PFNGLISPROGRAMPIPELINEPROC, glIsProgramPipeline, (GLuint pipeline), (pipeline))
+STUB_VOID(PFNGLPROGRAMBINARYPROC, glProgramBinary, (GLuint program, GLenum binaryFormat, const void* binary, GLsizei length), (program, binaryFormat, binary, length))
+STUB_VOID(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri, (GLuint program, GLenum pname, GLint value), (program, pname, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM1DPROC, glProgramUniform1d, (GLuint program, GLint location, GLdouble v0), (program, location, v0))
+STUB_VOID(PFNGLPROGRAMUNIFORM1DVPROC, glProgramUniform1dv, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM1FPROC, glProgramUniform1f, (GLuint program, GLint location, GLfloat v0), (program, location, v0))
+STUB_VOID(PFNGLPROGRAMUNIFORM1FVPROC, glProgramUniform1fv, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM1IPROC, glProgramUniform1i, (GLuint program, GLint location, GLint v0), (program, location, v0))
+STUB_VOID(PFNGLPROGRAMUNIFORM1IVPROC, glProgramUniform1iv, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM1UIPROC, glProgramUniform1ui, (GLuint program, GLint location, GLuint v0), (program, location, v0))
+STUB_VOID(PFNGLPROGRAMUNIFORM1UIVPROC, glProgramUniform1uiv, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM2DPROC, glProgramUniform2d, (GLuint program, GLint location, GLdouble v0, GLdouble v1), (program, location, v0, v1))
+STUB_VOID(PFNGLPROGRAMUNIFORM2DVPROC, glProgramUniform2dv, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM2FPROC, glProgramUniform2f, (GLuint program, GLint location, GLfloat v0, GLfloat v1), (program, location, v0, v1))
+STUB_VOID(PFNGLPROGRAMUNIFORM2FVPROC, glProgramUniform2fv, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM2IPROC, glProgramUniform2i, (GLuint program, GLint location, GLint v0, GLint v1), (program, location, v0, v1))
+STUB_VOID(PFNGLPROGRAMUNIFORM2IVPROC, glProgramUniform2iv, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM2UIPROC, glProgramUniform2ui, (GLuint program, GLint location, GLuint v0, GLuint v1), (program, location, v0, v1))
+STUB_VOID(PFNGLPROGRAMUNIFORM2UIVPROC, glProgramUniform2uiv, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM3DPROC, glProgramUniform3d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2), (program, location, v0, v1, v2))
+STUB_VOID(PFNGLPROGRAMUNIFORM3DVPROC, glProgramUniform3dv, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM3FPROC, glProgramUniform3f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2), (program, location, v0, v1, v2))
+STUB_VOID(PFNGLPROGRAMUNIFORM3FVPROC, glProgramUniform3fv, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM3IPROC, glProgramUniform3i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2), (program, location, v0, v1, v2))
+STUB_VOID(PFNGLPROGRAMUNIFORM3IVPROC, glProgramUniform3iv, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM3UIPROC, glProgramUniform3ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2), (program, location, v0, v1, v2))
+STUB_VOID(PFNGLPROGRAMUNIFORM3UIVPROC, glProgramUniform3uiv, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM4DPROC, glProgramUniform4d, (GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3), (program, location, v0, v1, v2, v3))
+STUB_VOID(PFNGLPROGRAMUNIFORM4DVPROC, glProgramUniform4dv, (GLuint program, GLint location, GLsizei count, const GLdouble* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM4FPROC, glProgramUniform4f, (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3), (program, location, v0, v1, v2, v3))
+STUB_VOID(PFNGLPROGRAMUNIFORM4FVPROC, glProgramUniform4fv, (GLuint program, GLint location, GLsizei count, const GLfloat* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM4IPROC, glProgramUniform4i, (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3), (program, location, v0, v1, v2, v3))
+STUB_VOID(PFNGLPROGRAMUNIFORM4IVPROC, glProgramUniform4iv, (GLuint program, GLint location, GLsizei count, const GLint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORM4UIPROC, glProgramUniform4ui, (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3), (program, location, v0, v1, v2, v3))
+STUB_VOID(PFNGLPROGRAMUNIFORM4UIVPROC, glProgramUniform4uiv, (GLuint program, GLint location, GLsizei count, const GLuint* value), (program, location, count, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX2DVPROC, glProgramUniformMatrix2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX2FVPROC, glProgramUniformMatrix2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, glProgramUniformMatrix2x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, glProgramUniformMatrix2x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, glProgramUniformMatrix2x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, glProgramUniformMatrix2x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX3DVPROC, glProgramUniformMatrix3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX3FVPROC, glProgramUniformMatrix3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, glProgramUniformMatrix3x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, glProgramUniformMatrix3x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, glProgramUniformMatrix3x4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, glProgramUniformMatrix3x4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX4DVPROC, glProgramUniformMatrix4dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX4FVPROC, glProgramUniformMatrix4fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, glProgramUniformMatrix4x2dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, glProgramUniformMatrix4x2fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, glProgramUniformMatrix4x3dv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, glProgramUniformMatrix4x3fv, (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value), (program, location, count, transpose, value))
+STUB_VOID(PFNGLRELEASESHADERCOMPILERPROC, glReleaseShaderCompiler, (void), ())
+STUB_VOID(PFNGLSCISSORARRAYVPROC, glScissorArrayv, (GLuint first, GLsizei count, const GLint* v), (first, count, v))
+STUB_VOID(PFNGLSCISSORINDEXEDPROC, glScissorIndexed, (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height), (index, left, bottom, width, height))
+STUB_VOID(PFNGLSCISSORINDEXEDVPROC, glScissorIndexedv, (GLuint index, const GLint* v), (index, v))
+STUB_VOID(PFNGLSHADERBINARYPROC, glShaderBinary, (GLsizei count, const GLuint* shaders, GLenum binaryFormat, const void* binary, GLsizei length), (count, shaders, binaryFormat, binary, length))
+STUB_VOID(PFNGLUSEPROGRAMSTAGESPROC, glUseProgramStages, (GLuint pipeline, GLbitfield stages, GLuint program), (pipeline, stages, program))
+STUB_VOID(PFNGLVALIDATEPROGRAMPIPELINEPROC, glValidateProgramPipeline, (GLuint pipeline), (pipeline))
+STUB_VOID(PFNGLVERTEXATTRIBL1DPROC, glVertexAttribL1d, (GLuint index, GLdouble x), (index, x))
+STUB_VOID(PFNGLVERTEXATTRIBL1DVPROC, glVertexAttribL1dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBL2DPROC, glVertexAttribL2d, (GLuint index, GLdouble x, GLdouble y), (index, x, y))
+STUB_VOID(PFNGLVERTEXATTRIBL2DVPROC, glVertexAttribL2dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBL3DPROC, glVertexAttribL3d, (GLuint index, GLdouble x, GLdouble y, GLdouble z), (index, x, y, z))
+STUB_VOID(PFNGLVERTEXATTRIBL3DVPROC, glVertexAttribL3dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBL4DPROC, glVertexAttribL4d, (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w), (index, x, y, z, w))
+STUB_VOID(PFNGLVERTEXATTRIBL4DVPROC, glVertexAttribL4dv, (GLuint index, const GLdouble* v), (index, v))
+STUB_VOID(PFNGLVERTEXATTRIBLPOINTERPROC, glVertexAttribLPointer, (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer), (index, size, type, stride, pointer))
+STUB_VOID(PFNGLVIEWPORTARRAYVPROC, glViewportArrayv, (GLuint first, GLsizei count, const GLfloat* v), (first, count, v))
+STUB_VOID(PFNGLVIEWPORTINDEXEDFPROC, glViewportIndexedf, (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h), (index, x, y, w, h))
+STUB_VOID(PFNGLVIEWPORTINDEXEDFVPROC, glViewportIndexedfv, (GLuint index, const GLfloat* v), (index, v))
+
+static void load_4_1(int mode)
 {
     if (!v4_1) return;
-    lx_glActiveShaderProgram = load ? (PFNGLACTIVESHADERPROGRAMPROC) load_proc("glActiveShaderProgram") : NULL;
-    lx_glBindProgramPipeline = load ? (PFNGLBINDPROGRAMPIPELINEPROC) load_proc("glBindProgramPipeline") : NULL;
-    lx_glClearDepthf = load ? (PFNGLCLEARDEPTHFPROC) load_proc("glClearDepthf") : NULL;
-    lx_glCreateShaderProgramv = load ? (PFNGLCREATESHADERPROGRAMVPROC) load_proc("glCreateShaderProgramv") : NULL;
-    lx_glDeleteProgramPipelines = load ? (PFNGLDELETEPROGRAMPIPELINESPROC) load_proc("glDeleteProgramPipelines") : NULL;
-    lx_glDepthRangeArrayv = load ? (PFNGLDEPTHRANGEARRAYVPROC) load_proc("glDepthRangeArrayv") : NULL;
-    lx_glDepthRangeIndexed = load ? (PFNGLDEPTHRANGEINDEXEDPROC) load_proc("glDepthRangeIndexed") : NULL;
-    lx_glDepthRangef = load ? (PFNGLDEPTHRANGEFPROC) load_proc("glDepthRangef") : NULL;
-    lx_glGenProgramPipelines = load ? (PFNGLGENPROGRAMPIPELINESPROC) load_proc("glGenProgramPipelines") : NULL;
-    lx_glGetDoublei_v = load ? (PFNGLGETDOUBLEI_VPROC) load_proc("glGetDoublei_v") : NULL;
-    lx_glGetFloati_v = load ? (PFNGLGETFLOATI_VPROC) load_proc("glGetFloati_v") : NULL;
-    lx_glGetProgramBinary = load ? (PFNGLGETPROGRAMBINARYPROC) load_proc("glGetProgramBinary") : NULL;
-    lx_glGetProgramPipelineInfoLog = load ? (PFNGLGETPROGRAMPIPELINEINFOLOGPROC) load_proc("glGetProgramPipelineInfoLog") : NULL;
-    lx_glGetProgramPipelineiv = load ? (PFNGLGETPROGRAMPIPELINEIVPROC) load_proc("glGetProgramPipelineiv") : NULL;
-    lx_glGetShaderPrecisionFormat = load ? (PFNGLGETSHADERPRECISIONFORMATPROC) load_proc("glGetShaderPrecisionFormat") : NULL;
-    lx_glGetVertexAttribLdv = load ? (PFNGLGETVERTEXATTRIBLDVPROC) load_proc("glGetVertexAttribLdv") : NULL;
-    lx_glIsProgramPipeline = load ? (PFNGLISPROGRAMPIPELINEPROC) load_proc("glIsProgramPipeline") : NULL;
-    lx_glProgramBinary = load ? (PFNGLPROGRAMBINARYPROC) load_proc("glProgramBinary") : NULL;
-    lx_glProgramParameteri = load ? (PFNGLPROGRAMPARAMETERIPROC) load_proc("glProgramParameteri") : NULL;
-    lx_glProgramUniform1d = load ? (PFNGLPROGRAMUNIFORM1DPROC) load_proc("glProgramUniform1d") : NULL;
-    lx_glProgramUniform1dv = load ? (PFNGLPROGRAMUNIFORM1DVPROC) load_proc("glProgramUniform1dv") : NULL;
-    lx_glProgramUniform1f = load ? (PFNGLPROGRAMUNIFORM1FPROC) load_proc("glProgramUniform1f") : NULL;
-    lx_glProgramUniform1fv = load ? (PFNGLPROGRAMUNIFORM1FVPROC) load_proc("glProgramUniform1fv") : NULL;
-    lx_glProgramUniform1i = load ? (PFNGLPROGRAMUNIFORM1IPROC) load_proc("glProgramUniform1i") : NULL;
-    lx_glProgramUniform1iv = load ? (PFNGLPROGRAMUNIFORM1IVPROC) load_proc("glProgramUniform1iv") : NULL;
-    lx_glProgramUniform1ui = load ? (PFNGLPROGRAMUNIFORM1UIPROC) load_proc("glProgramUniform1ui") : NULL;
-    lx_glProgramUniform1uiv = load ? (PFNGLPROGRAMUNIFORM1UIVPROC) load_proc("glProgramUniform1uiv") : NULL;
-    lx_glProgramUniform2d = load ? (PFNGLPROGRAMUNIFORM2DPROC) load_proc("glProgramUniform2d") : NULL;
-    lx_glProgramUniform2dv = load ? (PFNGLPROGRAMUNIFORM2DVPROC) load_proc("glProgramUniform2dv") : NULL;
-    lx_glProgramUniform2f = load ? (PFNGLPROGRAMUNIFORM2FPROC) load_proc("glProgramUniform2f") : NULL;
-    lx_glProgramUniform2fv = load ? (PFNGLPROGRAMUNIFORM2FVPROC) load_proc("glProgramUniform2fv") : NULL;
-    lx_glProgramUniform2i = load ? (PFNGLPROGRAMUNIFORM2IPROC) load_proc("glProgramUniform2i") : NULL;
-    lx_glProgramUniform2iv = load ? (PFNGLPROGRAMUNIFORM2IVPROC) load_proc("glProgramUniform2iv") : NULL;
-    lx_glProgramUniform2ui = load ? (PFNGLPROGRAMUNIFORM2UIPROC) load_proc("glProgramUniform2ui") : NULL;
-    lx_glProgramUniform2uiv = load ? (PFNGLPROGRAMUNIFORM2UIVPROC) load_proc("glProgramUniform2uiv") : NULL;
-    lx_glProgramUniform3d = load ? (PFNGLPROGRAMUNIFORM3DPROC) load_proc("glProgramUniform3d") : NULL;
-    lx_glProgramUniform3dv = load ? (PFNGLPROGRAMUNIFORM3DVPROC) load_proc("glProgramUniform3dv") : NULL;
-    lx_glProgramUniform3f = load ? (PFNGLPROGRAMUNIFORM3FPROC) load_proc("glProgramUniform3f") : NULL;
-    lx_glProgramUniform3fv = load ? (PFNGLPROGRAMUNIFORM3FVPROC) load_proc("glProgramUniform3fv") : NULL;
-    lx_glProgramUniform3i = load ? (PFNGLPROGRAMUNIFORM3IPROC) load_proc("glProgramUniform3i") : NULL;
-    lx_glProgramUniform3iv = load ? (PFNGLPROGRAMUNIFORM3IVPROC) load_proc("glProgramUniform3iv") : NULL;
-    lx_glProgramUniform3ui = load ? (PFNGLPROGRAMUNIFORM3UIPROC) load_proc("glProgramUniform3ui") : NULL;
-    lx_glProgramUniform3uiv = load ? (PFNGLPROGRAMUNIFORM3UIVPROC) load_proc("glProgramUniform3uiv") : NULL;
-    lx_glProgramUniform4d = load ? (PFNGLPROGRAMUNIFORM4DPROC) load_proc("glProgramUniform4d") : NULL;
-    lx_glProgramUniform4dv = load ? (PFNGLPROGRAMUNIFORM4DVPROC) load_proc("glProgramUniform4dv") : NULL;
-    lx_glProgramUniform4f = load ? (PFNGLPROGRAMUNIFORM4FPROC) load_proc("glProgramUniform4f") : NULL;
-    lx_glProgramUniform4fv = load ? (PFNGLPROGRAMUNIFORM4FVPROC) load_proc("glProgramUniform4fv") : NULL;
-    lx_glProgramUniform4i = load ? (PFNGLPROGRAMUNIFORM4IPROC) load_proc("glProgramUniform4i") : NULL;
-    lx_glProgramUniform4iv = load ? (PFNGLPROGRAMUNIFORM4IVPROC) load_proc("glProgramUniform4iv") : NULL;
-    lx_glProgramUniform4ui = load ? (PFNGLPROGRAMUNIFORM4UIPROC) load_proc("glProgramUniform4ui") : NULL;
-    lx_glProgramUniform4uiv = load ? (PFNGLPROGRAMUNIFORM4UIVPROC) load_proc("glProgramUniform4uiv") : NULL;
-    lx_glProgramUniformMatrix2dv = load ? (PFNGLPROGRAMUNIFORMMATRIX2DVPROC) load_proc("glProgramUniformMatrix2dv") : NULL;
-    lx_glProgramUniformMatrix2fv = load ? (PFNGLPROGRAMUNIFORMMATRIX2FVPROC) load_proc("glProgramUniformMatrix2fv") : NULL;
-    lx_glProgramUniformMatrix2x3dv = load ? (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC) load_proc("glProgramUniformMatrix2x3dv") : NULL;
-    lx_glProgramUniformMatrix2x3fv = load ? (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC) load_proc("glProgramUniformMatrix2x3fv") : NULL;
-    lx_glProgramUniformMatrix2x4dv = load ? (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC) load_proc("glProgramUniformMatrix2x4dv") : NULL;
-    lx_glProgramUniformMatrix2x4fv = load ? (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC) load_proc("glProgramUniformMatrix2x4fv") : NULL;
-    lx_glProgramUniformMatrix3dv = load ? (PFNGLPROGRAMUNIFORMMATRIX3DVPROC) load_proc("glProgramUniformMatrix3dv") : NULL;
-    lx_glProgramUniformMatrix3fv = load ? (PFNGLPROGRAMUNIFORMMATRIX3FVPROC) load_proc("glProgramUniformMatrix3fv") : NULL;
-    lx_glProgramUniformMatrix3x2dv = load ? (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC) load_proc("glProgramUniformMatrix3x2dv") : NULL;
-    lx_glProgramUniformMatrix3x2fv = load ? (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC) load_proc("glProgramUniformMatrix3x2fv") : NULL;
-    lx_glProgramUniformMatrix3x4dv = load ? (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC) load_proc("glProgramUniformMatrix3x4dv") : NULL;
-    lx_glProgramUniformMatrix3x4fv = load ? (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC) load_proc("glProgramUniformMatrix3x4fv") : NULL;
-    lx_glProgramUniformMatrix4dv = load ? (PFNGLPROGRAMUNIFORMMATRIX4DVPROC) load_proc("glProgramUniformMatrix4dv") : NULL;
-    lx_glProgramUniformMatrix4fv = load ? (PFNGLPROGRAMUNIFORMMATRIX4FVPROC) load_proc("glProgramUniformMatrix4fv") : NULL;
-    lx_glProgramUniformMatrix4x2dv = load ? (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC) load_proc("glProgramUniformMatrix4x2dv") : NULL;
-    lx_glProgramUniformMatrix4x2fv = load ? (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC) load_proc("glProgramUniformMatrix4x2fv") : NULL;
-    lx_glProgramUniformMatrix4x3dv = load ? (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC) load_proc("glProgramUniformMatrix4x3dv") : NULL;
-    lx_glProgramUniformMatrix4x3fv = load ? (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC) load_proc("glProgramUniformMatrix4x3fv") : NULL;
-    lx_glReleaseShaderCompiler = load ? (PFNGLRELEASESHADERCOMPILERPROC) load_proc("glReleaseShaderCompiler") : NULL;
-    lx_glScissorArrayv = load ? (PFNGLSCISSORARRAYVPROC) load_proc("glScissorArrayv") : NULL;
-    lx_glScissorIndexed = load ? (PFNGLSCISSORINDEXEDPROC) load_proc("glScissorIndexed") : NULL;
-    lx_glScissorIndexedv = load ? (PFNGLSCISSORINDEXEDVPROC) load_proc("glScissorIndexedv") : NULL;
-    lx_glShaderBinary = load ? (PFNGLSHADERBINARYPROC) load_proc("glShaderBinary") : NULL;
-    lx_glUseProgramStages = load ? (PFNGLUSEPROGRAMSTAGESPROC) load_proc("glUseProgramStages") : NULL;
-    lx_glValidateProgramPipeline = load ? (PFNGLVALIDATEPROGRAMPIPELINEPROC) load_proc("glValidateProgramPipeline") : NULL;
-    lx_glVertexAttribL1d = load ? (PFNGLVERTEXATTRIBL1DPROC) load_proc("glVertexAttribL1d") : NULL;
-    lx_glVertexAttribL1dv = load ? (PFNGLVERTEXATTRIBL1DVPROC) load_proc("glVertexAttribL1dv") : NULL;
-    lx_glVertexAttribL2d = load ? (PFNGLVERTEXATTRIBL2DPROC) load_proc("glVertexAttribL2d") : NULL;
-    lx_glVertexAttribL2dv = load ? (PFNGLVERTEXATTRIBL2DVPROC) load_proc("glVertexAttribL2dv") : NULL;
-    lx_glVertexAttribL3d = load ? (PFNGLVERTEXATTRIBL3DPROC) load_proc("glVertexAttribL3d") : NULL;
-    lx_glVertexAttribL3dv = load ? (PFNGLVERTEXATTRIBL3DVPROC) load_proc("glVertexAttribL3dv") : NULL;
-    lx_glVertexAttribL4d = load ? (PFNGLVERTEXATTRIBL4DPROC) load_proc("glVertexAttribL4d") : NULL;
-    lx_glVertexAttribL4dv = load ? (PFNGLVERTEXATTRIBL4DVPROC) load_proc("glVertexAttribL4dv") : NULL;
-    lx_glVertexAttribLPointer = load ? (PFNGLVERTEXATTRIBLPOINTERPROC) load_proc("glVertexAttribLPointer") : NULL;
-    lx_glViewportArrayv = load ? (PFNGLVIEWPORTARRAYVPROC) load_proc("glViewportArrayv") : NULL;
-    lx_glViewportIndexedf = load ? (PFNGLVIEWPORTINDEXEDFPROC) load_proc("glViewportIndexedf") : NULL;
-    lx_glViewportIndexedfv = load ? (PFNGLVIEWPORTINDEXEDFVPROC) load_proc("glViewportIndexedfv") : NULL;
+    lx_glActiveShaderProgram = LOAD(PFNGLACTIVESHADERPROGRAMPROC, glActiveShaderProgram);
+    lx_glBindProgramPipeline = LOAD(PFNGLBINDPROGRAMPIPELINEPROC, glBindProgramPipeline);
+    lx_glClearDepthf = LOAD(PFNGLCLEARDEPTHFPROC, glClearDepthf);
+    lx_glCreateShaderProgramv = LOAD(PFNGLCREATESHADERPROGRAMVPROC, glCreateShaderProgramv);
+    lx_glDeleteProgramPipelines = LOAD(PFNGLDELETEPROGRAMPIPELINESPROC, glDeleteProgramPipelines);
+    lx_glDepthRangeArrayv = LOAD(PFNGLDEPTHRANGEARRAYVPROC, glDepthRangeArrayv);
+    lx_glDepthRangeIndexed = LOAD(PFNGLDEPTHRANGEINDEXEDPROC, glDepthRangeIndexed);
+    lx_glDepthRangef = LOAD(PFNGLDEPTHRANGEFPROC, glDepthRangef);
+    lx_glGenProgramPipelines = LOAD(PFNGLGENPROGRAMPIPELINESPROC, glGenProgramPipelines);
+    lx_glGetDoublei_v = LOAD(PFNGLGETDOUBLEI_VPROC, glGetDoublei_v);
+    lx_glGetFloati_v = LOAD(PFNGLGETFLOATI_VPROC, glGetFloati_v);
+    lx_glGetProgramBinary = LOAD(PFNGLGETPROGRAMBINARYPROC, glGetProgramBinary);
+    lx_glGetProgramPipelineInfoLog = LOAD(PFNGLGETPROGRAMPIPELINEINFOLOGPROC, glGetProgramPipelineInfoLog);
+    lx_glGetProgramPipelineiv = LOAD(PFNGLGETPROGRAMPIPELINEIVPROC, glGetProgramPipelineiv);
+    lx_glGetShaderPrecisionFormat = LOAD(PFNGLGETSHADERPRECISIONFORMATPROC, glGetShaderPrecisionFormat);
+    lx_glGetVertexAttribLdv = LOAD(PFNGLGETVERTEXATTRIBLDVPROC, glGetVertexAttribLdv);
+    lx_glIsProgramPipeline = LOAD(PFNGLISPROGRAMPIPELINEPROC, glIsProgramPipeline);
+    lx_glProgramBinary = LOAD(PFNGLPROGRAMBINARYPROC, glProgramBinary);
+    lx_glProgramParameteri = LOAD(PFNGLPROGRAMPARAMETERIPROC, glProgramParameteri);
+    lx_glProgramUniform1d = LOAD(PFNGLPROGRAMUNIFORM1DPROC, glProgramUniform1d);
+    lx_glProgramUniform1dv = LOAD(PFNGLPROGRAMUNIFORM1DVPROC, glProgramUniform1dv);
+    lx_glProgramUniform1f = LOAD(PFNGLPROGRAMUNIFORM1FPROC, glProgramUniform1f);
+    lx_glProgramUniform1fv = LOAD(PFNGLPROGRAMUNIFORM1FVPROC, glProgramUniform1fv);
+    lx_glProgramUniform1i = LOAD(PFNGLPROGRAMUNIFORM1IPROC, glProgramUniform1i);
+    lx_glProgramUniform1iv = LOAD(PFNGLPROGRAMUNIFORM1IVPROC, glProgramUniform1iv);
+    lx_glProgramUniform1ui = LOAD(PFNGLPROGRAMUNIFORM1UIPROC, glProgramUniform1ui);
+    lx_glProgramUniform1uiv = LOAD(PFNGLPROGRAMUNIFORM1UIVPROC, glProgramUniform1uiv);
+    lx_glProgramUniform2d = LOAD(PFNGLPROGRAMUNIFORM2DPROC, glProgramUniform2d);
+    lx_glProgramUniform2dv = LOAD(PFNGLPROGRAMUNIFORM2DVPROC, glProgramUniform2dv);
+    lx_glProgramUniform2f = LOAD(PFNGLPROGRAMUNIFORM2FPROC, glProgramUniform2f);
+    lx_glProgramUniform2fv = LOAD(PFNGLPROGRAMUNIFORM2FVPROC, glProgramUniform2fv);
+    lx_glProgramUniform2i = LOAD(PFNGLPROGRAMUNIFORM2IPROC, glProgramUniform2i);
+    lx_glProgramUniform2iv = LOAD(PFNGLPROGRAMUNIFORM2IVPROC, glProgramUniform2iv);
+    lx_glProgramUniform2ui = LOAD(PFNGLPROGRAMUNIFORM2UIPROC, glProgramUniform2ui);
+    lx_glProgramUniform2uiv = LOAD(PFNGLPROGRAMUNIFORM2UIVPROC, glProgramUniform2uiv);
+    lx_glProgramUniform3d = LOAD(PFNGLPROGRAMUNIFORM3DPROC, glProgramUniform3d);
+    lx_glProgramUniform3dv = LOAD(PFNGLPROGRAMUNIFORM3DVPROC, glProgramUniform3dv);
+    lx_glProgramUniform3f = LOAD(PFNGLPROGRAMUNIFORM3FPROC, glProgramUniform3f);
+    lx_glProgramUniform3fv = LOAD(PFNGLPROGRAMUNIFORM3FVPROC, glProgramUniform3fv);
+    lx_glProgramUniform3i = LOAD(PFNGLPROGRAMUNIFORM3IPROC, glProgramUniform3i);
+    lx_glProgramUniform3iv = LOAD(PFNGLPROGRAMUNIFORM3IVPROC, glProgramUniform3iv);
+    lx_glProgramUniform3ui = LOAD(PFNGLPROGRAMUNIFORM3UIPROC, glProgramUniform3ui);
+    lx_glProgramUniform3uiv = LOAD(PFNGLPROGRAMUNIFORM3UIVPROC, glProgramUniform3uiv);
+    lx_glProgramUniform4d = LOAD(PFNGLPROGRAMUNIFORM4DPROC, glProgramUniform4d);
+    lx_glProgramUniform4dv = LOAD(PFNGLPROGRAMUNIFORM4DVPROC, glProgramUniform4dv);
+    lx_glProgramUniform4f = LOAD(PFNGLPROGRAMUNIFORM4FPROC, glProgramUniform4f);
+    lx_glProgramUniform4fv = LOAD(PFNGLPROGRAMUNIFORM4FVPROC, glProgramUniform4fv);
+    lx_glProgramUniform4i = LOAD(PFNGLPROGRAMUNIFORM4IPROC, glProgramUniform4i);
+    lx_glProgramUniform4iv = LOAD(PFNGLPROGRAMUNIFORM4IVPROC, glProgramUniform4iv);
+    lx_glProgramUniform4ui = LOAD(PFNGLPROGRAMUNIFORM4UIPROC, glProgramUniform4ui);
+    lx_glProgramUniform4uiv = LOAD(PFNGLPROGRAMUNIFORM4UIVPROC, glProgramUniform4uiv);
+    lx_glProgramUniformMatrix2dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX2DVPROC, glProgramUniformMatrix2dv);
+    lx_glProgramUniformMatrix2fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX2FVPROC, glProgramUniformMatrix2fv);
+    lx_glProgramUniformMatrix2x3dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC, glProgramUniformMatrix2x3dv);
+    lx_glProgramUniformMatrix2x3fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC, glProgramUniformMatrix2x3fv);
+    lx_glProgramUniformMatrix2x4dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC, glProgramUniformMatrix2x4dv);
+    lx_glProgramUniformMatrix2x4fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC, glProgramUniformMatrix2x4fv);
+    lx_glProgramUniformMatrix3dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX3DVPROC, glProgramUniformMatrix3dv);
+    lx_glProgramUniformMatrix3fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX3FVPROC, glProgramUniformMatrix3fv);
+    lx_glProgramUniformMatrix3x2dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC, glProgramUniformMatrix3x2dv);
+    lx_glProgramUniformMatrix3x2fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC, glProgramUniformMatrix3x2fv);
+    lx_glProgramUniformMatrix3x4dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC, glProgramUniformMatrix3x4dv);
+    lx_glProgramUniformMatrix3x4fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC, glProgramUniformMatrix3x4fv);
+    lx_glProgramUniformMatrix4dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX4DVPROC, glProgramUniformMatrix4dv);
+    lx_glProgramUniformMatrix4fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX4FVPROC, glProgramUniformMatrix4fv);
+    lx_glProgramUniformMatrix4x2dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC, glProgramUniformMatrix4x2dv);
+    lx_glProgramUniformMatrix4x2fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC, glProgramUniformMatrix4x2fv);
+    lx_glProgramUniformMatrix4x3dv = LOAD(PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC, glProgramUniformMatrix4x3dv);
+    lx_glProgramUniformMatrix4x3fv = LOAD(PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC, glProgramUniformMatrix4x3fv);
+    lx_glReleaseShaderCompiler = LOAD(PFNGLRELEASESHADERCOMPILERPROC, glReleaseShaderCompiler);
+    lx_glScissorArrayv = LOAD(PFNGLSCISSORARRAYVPROC, glScissorArrayv);
+    lx_glScissorIndexed = LOAD(PFNGLSCISSORINDEXEDPROC, glScissorIndexed);
+    lx_glScissorIndexedv = LOAD(PFNGLSCISSORINDEXEDVPROC, glScissorIndexedv);
+    lx_glShaderBinary = LOAD(PFNGLSHADERBINARYPROC, glShaderBinary);
+    lx_glUseProgramStages = LOAD(PFNGLUSEPROGRAMSTAGESPROC, glUseProgramStages);
+    lx_glValidateProgramPipeline = LOAD(PFNGLVALIDATEPROGRAMPIPELINEPROC, glValidateProgramPipeline);
+    lx_glVertexAttribL1d = LOAD(PFNGLVERTEXATTRIBL1DPROC, glVertexAttribL1d);
+    lx_glVertexAttribL1dv = LOAD(PFNGLVERTEXATTRIBL1DVPROC, glVertexAttribL1dv);
+    lx_glVertexAttribL2d = LOAD(PFNGLVERTEXATTRIBL2DPROC, glVertexAttribL2d);
+    lx_glVertexAttribL2dv = LOAD(PFNGLVERTEXATTRIBL2DVPROC, glVertexAttribL2dv);
+    lx_glVertexAttribL3d = LOAD(PFNGLVERTEXATTRIBL3DPROC, glVertexAttribL3d);
+    lx_glVertexAttribL3dv = LOAD(PFNGLVERTEXATTRIBL3DVPROC, glVertexAttribL3dv);
+    lx_glVertexAttribL4d = LOAD(PFNGLVERTEXATTRIBL4DPROC, glVertexAttribL4d);
+    lx_glVertexAttribL4dv = LOAD(PFNGLVERTEXATTRIBL4DVPROC, glVertexAttribL4dv);
+    lx_glVertexAttribLPointer = LOAD(PFNGLVERTEXATTRIBLPOINTERPROC, glVertexAttribLPointer);
+    lx_glViewportArrayv = LOAD(PFNGLVIEWPORTARRAYVPROC, glViewportArrayv);
+    lx_glViewportIndexedf = LOAD(PFNGLVIEWPORTINDEXEDFPROC, glViewportIndexedf);
+    lx_glViewportIndexedfv = LOAD(PFNGLVIEWPORTINDEXEDFVPROC, glViewportIndexedfv);
 }
 
 PFNGLBINDIMAGETEXTUREPROC lx_glBindImageTexture = NULL;
@@ -1128,21 +1686,34 @@ PFNGLTEXSTORAGE1DPROC lx_glTexStorage1D = NULL;
 PFNGLTEXSTORAGE2DPROC lx_glTexStorage2D = NULL;
 PFNGLTEXSTORAGE3DPROC lx_glTexStorage3D = NULL;
 
-static void load_4_2(int load)
+STUB_VOID(PFNGLBINDIMAGETEXTUREPROC, glBindImageTexture, (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format), (unit, texture, level, layered, layer, access, format))
+STUB_VOID(PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, glDrawArraysInstancedBaseInstance, (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance), (mode, first, count, instancecount, baseinstance))
+STUB_VOID(PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, glDrawElementsInstancedBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLuint baseinstance), (mode, count, type, indices, instancecount, baseinstance))
+STUB_VOID(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, glDrawElementsInstancedBaseVertexBaseInstance, (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance), (mode, count, type, indices, instancecount, basevertex, baseinstance))
+STUB_VOID(PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, glDrawTransformFeedbackInstanced, (GLenum mode, GLuint id, GLsizei instancecount), (mode, id, instancecount))
+STUB_VOID(PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, glDrawTransformFeedbackStreamInstanced, (GLenum mode, GLuint id, GLuint stream, GLsizei instancecount), (mode, id, stream, instancecount))
+STUB_VOID(PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, glGetActiveAtomicCounterBufferiv, (GLuint program, GLuint bufferIndex, GLenum pname, GLint* params), (program, bufferIndex, pname, params))
+STUB_VOID(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint* params), (target, internalformat, pname, count, params))
+STUB_VOID(PFNGLMEMORYBARRIERPROC, glMemoryBarrier, (GLbitfield barriers), (barriers))
+STUB_VOID(PFNGLTEXSTORAGE1DPROC, glTexStorage1D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width), (target, levels, internalformat, width))
+STUB_VOID(PFNGLTEXSTORAGE2DPROC, glTexStorage2D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (target, levels, internalformat, width, height))
+STUB_VOID(PFNGLTEXSTORAGE3DPROC, glTexStorage3D, (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (target, levels, internalformat, width, height, depth))
+
+static void load_4_2(int mode)
 {
     if (!v4_2) return;
-    lx_glBindImageTexture = load ? (PFNGLBINDIMAGETEXTUREPROC) load_proc("glBindImageTexture") : NULL;
-    lx_glDrawArraysInstancedBaseInstance = load ? (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC) load_proc("glDrawArraysInstancedBaseInstance") : NULL;
-    lx_glDrawElementsInstancedBaseInstance = load ? (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC) load_proc("glDrawElementsInstancedBaseInstance") : NULL;
-    lx_glDrawElementsInstancedBaseVertexBaseInstance = load ? (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC) load_proc("glDrawElementsInstancedBaseVertexBaseInstance") : NULL;
-    lx_glDrawTransformFeedbackInstanced = load ? (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC) load_proc("glDrawTransformFeedbackInstanced") : NULL;
-    lx_glDrawTransformFeedbackStreamInstanced = load ? (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC) load_proc("glDrawTransformFeedbackStreamInstanced") : NULL;
-    lx_glGetActiveAtomicCounterBufferiv = load ? (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC) load_proc("glGetActiveAtomicCounterBufferiv") : NULL;
-    lx_glGetInternalformativ = load ? (PFNGLGETINTERNALFORMATIVPROC) load_proc("glGetInternalformativ") : NULL;
-    lx_glMemoryBarrier = load ? (PFNGLMEMORYBARRIERPROC) load_proc("glMemoryBarrier") : NULL;
-    lx_glTexStorage1D = load ? (PFNGLTEXSTORAGE1DPROC) load_proc("glTexStorage1D") : NULL;
-    lx_glTexStorage2D = load ? (PFNGLTEXSTORAGE2DPROC) load_proc("glTexStorage2D") : NULL;
-    lx_glTexStorage3D = load ? (PFNGLTEXSTORAGE3DPROC) load_proc("glTexStorage3D") : NULL;
+    lx_glBindImageTexture = LOAD(PFNGLBINDIMAGETEXTUREPROC, glBindImageTexture);
+    lx_glDrawArraysInstancedBaseInstance = LOAD(PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC, glDrawArraysInstancedBaseInstance);
+    lx_glDrawElementsInstancedBaseInstance = LOAD(PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC, glDrawElementsInstancedBaseInstance);
+    lx_glDrawElementsInstancedBaseVertexBaseInstance = LOAD(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC, glDrawElementsInstancedBaseVertexBaseInstance);
+    lx_glDrawTransformFeedbackInstanced = LOAD(PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC, glDrawTransformFeedbackInstanced);
+    lx_glDrawTransformFeedbackStreamInstanced = LOAD(PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC, glDrawTransformFeedbackStreamInstanced);
+    lx_glGetActiveAtomicCounterBufferiv = LOAD(PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC, glGetActiveAtomicCounterBufferiv);
+    lx_glGetInternalformativ = LOAD(PFNGLGETINTERNALFORMATIVPROC, glGetInternalformativ);
+    lx_glMemoryBarrier = LOAD(PFNGLMEMORYBARRIERPROC, glMemoryBarrier);
+    lx_glTexStorage1D = LOAD(PFNGLTEXSTORAGE1DPROC, glTexStorage1D);
+    lx_glTexStorage2D = LOAD(PFNGLTEXSTORAGE2DPROC, glTexStorage2D);
+    lx_glTexStorage3D = LOAD(PFNGLTEXSTORAGE3DPROC, glTexStorage3D);
 }
 
 PFNGLBINDVERTEXBUFFERPROC lx_glBindVertexBuffer = NULL;
@@ -1189,52 +1760,96 @@ PFNGLVERTEXATTRIBIFORMATPROC lx_glVertexAttribIFormat = NULL;
 PFNGLVERTEXATTRIBLFORMATPROC lx_glVertexAttribLFormat = NULL;
 PFNGLVERTEXBINDINGDIVISORPROC lx_glVertexBindingDivisor = NULL;
 
-static void load_4_3(int load)
+STUB_VOID(PFNGLBINDVERTEXBUFFERPROC, glBindVertexBuffer, (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (bindingindex, buffer, offset, stride))
+STUB_VOID(PFNGLCLEARBUFFERDATAPROC, glClearBufferData, (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void* data), (target, internalformat, format, type, data))
+STUB_VOID(PFNGLCLEARBUFFERSUBDATAPROC, glClearBufferSubData, (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data), (target, internalformat, offset, size, format, type, data))
+STUB_VOID(PFNGLCOPYIMAGESUBDATAPROC, glCopyImageSubData, (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth), (srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth))
+STUB_VOID(PFNGLDEBUGMESSAGECALLBACKPROC, glDebugMessageCallback, (GLDEBUGPROC callback, const void* userParam), (callback, userParam))
+STUB_VOID(PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl, (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled), (source, type, severity, count, ids, enabled))
+STUB_VOID(PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert, (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* buf), (source, type, id, severity, length, buf))
+STUB_VOID(PFNGLDISPATCHCOMPUTEPROC, glDispatchCompute, (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z), (num_groups_x, num_groups_y, num_groups_z))
+STUB_VOID(PFNGLDISPATCHCOMPUTEINDIRECTPROC, glDispatchComputeIndirect, (GLintptr indirect), (indirect))
+STUB_VOID(PFNGLFRAMEBUFFERPARAMETERIPROC, glFramebufferParameteri, (GLenum target, GLenum pname, GLint param), (target, pname, param))
+STUB(GLuint, PFNGLGETDEBUGMESSAGELOGPROC, glGetDebugMessageLog, (GLuint count, GLsizei bufSize, GLenum* sources, GLenum* types, GLuint* ids, GLenum* severities, GLsizei* lengths, GLchar* messageLog), (count, bufSize, sources, types, ids, severities, lengths, messageLog))
+STUB_VOID(PFNGLGETFRAMEBUFFERPARAMETERIVPROC, glGetFramebufferParameteriv, (GLenum target, GLenum pname, GLint* params), (target, pname, params))
+STUB_VOID(PFNGLGETINTERNALFORMATI64VPROC, glGetInternalformati64v, (GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64* params), (target, internalformat, pname, count, params))
+STUB_VOID(PFNGLGETOBJECTLABELPROC, glGetObjectLabel, (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei* length, GLchar* label), (identifier, name, bufSize, length, label))
+STUB_VOID(PFNGLGETOBJECTPTRLABELPROC, glGetObjectPtrLabel, (const void* ptr, GLsizei bufSize, GLsizei* length, GLchar* label), (ptr, bufSize, length, label))
+STUB_VOID(PFNGLGETPROGRAMINTERFACEIVPROC, glGetProgramInterfaceiv, (GLuint program, GLenum programInterface, GLenum pname, GLint* params), (program, programInterface, pname, params))
+STUB(GLuint, PFNGLGETPROGRAMRESOURCEINDEXPROC, glGetProgramResourceIndex, (GLuint program, GLenum programInterface, const GLchar* name), (program, programInterface, name))
+STUB(GLint, PFNGLGETPROGRAMRESOURCELOCATIONPROC, glGetProgramResourceLocation, (GLuint program, GLenum programInterface, const GLchar* name), (program, programInterface, name))
+STUB(GLint, PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, glGetProgramResourceLocationIndex, (GLuint program, GLenum programInterface, const GLchar* name), (program, programInterface, name))
+STUB_VOID(PFNGLGETPROGRAMRESOURCENAMEPROC, glGetProgramResourceName, (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei* length, GLchar* name), (program, programInterface, index, bufSize, length, name))
+STUB_VOID(PFNGLGETPROGRAMRESOURCEIVPROC, glGetProgramResourceiv, (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum* props, GLsizei count, GLsizei* length, GLint* params), (program, programInterface, index, propCount, props, count, length, params))
+STUB_VOID(PFNGLINVALIDATEBUFFERDATAPROC, glInvalidateBufferData, (GLuint buffer), (buffer))
+STUB_VOID(PFNGLINVALIDATEBUFFERSUBDATAPROC, glInvalidateBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+STUB_VOID(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum* attachments), (target, numAttachments, attachments))
+STUB_VOID(PFNGLINVALIDATESUBFRAMEBUFFERPROC, glInvalidateSubFramebuffer, (GLenum target, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height), (target, numAttachments, attachments, x, y, width, height))
+STUB_VOID(PFNGLINVALIDATETEXIMAGEPROC, glInvalidateTexImage, (GLuint texture, GLint level), (texture, level))
+STUB_VOID(PFNGLINVALIDATETEXSUBIMAGEPROC, glInvalidateTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth), (texture, level, xoffset, yoffset, zoffset, width, height, depth))
+STUB_VOID(PFNGLMULTIDRAWARRAYSINDIRECTPROC, glMultiDrawArraysIndirect, (GLenum mode, const void* indirect, GLsizei drawcount, GLsizei stride), (mode, indirect, drawcount, stride))
+STUB_VOID(PFNGLMULTIDRAWELEMENTSINDIRECTPROC, glMultiDrawElementsIndirect, (GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride), (mode, type, indirect, drawcount, stride))
+STUB_VOID(PFNGLOBJECTLABELPROC, glObjectLabel, (GLenum identifier, GLuint name, GLsizei length, const GLchar* label), (identifier, name, length, label))
+STUB_VOID(PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel, (const void* ptr, GLsizei length, const GLchar* label), (ptr, length, label))
+STUB_VOID(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup, (void), ())
+STUB_VOID(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup, (GLenum source, GLuint id, GLsizei length, const GLchar* message), (source, id, length, message))
+STUB_VOID(PFNGLSHADERSTORAGEBLOCKBINDINGPROC, glShaderStorageBlockBinding, (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding), (program, storageBlockIndex, storageBlockBinding))
+STUB_VOID(PFNGLTEXBUFFERRANGEPROC, glTexBufferRange, (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (target, internalformat, buffer, offset, size))
+STUB_VOID(PFNGLTEXSTORAGE2DMULTISAMPLEPROC, glTexStorage2DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, fixedsamplelocations))
+STUB_VOID(PFNGLTEXSTORAGE3DMULTISAMPLEPROC, glTexStorage3DMultisample, (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (target, samples, internalformat, width, height, depth, fixedsamplelocations))
+STUB_VOID(PFNGLTEXTUREVIEWPROC, glTextureView, (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers), (texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers))
+STUB_VOID(PFNGLVERTEXATTRIBBINDINGPROC, glVertexAttribBinding, (GLuint attribindex, GLuint bindingindex), (attribindex, bindingindex))
+STUB_VOID(PFNGLVERTEXATTRIBFORMATPROC, glVertexAttribFormat, (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (attribindex, size, type, normalized, relativeoffset))
+STUB_VOID(PFNGLVERTEXATTRIBIFORMATPROC, glVertexAttribIFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+STUB_VOID(PFNGLVERTEXATTRIBLFORMATPROC, glVertexAttribLFormat, (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (attribindex, size, type, relativeoffset))
+STUB_VOID(PFNGLVERTEXBINDINGDIVISORPROC, glVertexBindingDivisor, (GLuint bindingindex, GLuint divisor), (bindingindex, divisor))
+
+static void load_4_3(int mode)
 {
     if (!v4_3) return;
-    lx_glBindVertexBuffer = load ? (PFNGLBINDVERTEXBUFFERPROC) load_proc("glBindVertexBuffer") : NULL;
-    lx_glClearBufferData = load ? (PFNGLCLEARBUFFERDATAPROC) load_proc("glClearBufferData") : NULL;
-    lx_glClearBufferSubData = load ? (PFNGLCLEARBUFFERSUBDATAPROC) load_proc("glClearBufferSubData") : NULL;
-    lx_glCopyImageSubData = load ? (PFNGLCOPYIMAGESUBDATAPROC) load_proc("glCopyImageSubData") : NULL;
-    lx_glDebugMessageCallback = load ? (PFNGLDEBUGMESSAGECALLBACKPROC) load_proc("glDebugMessageCallback") : NULL;
-    lx_glDebugMessageControl = load ? (PFNGLDEBUGMESSAGECONTROLPROC) load_proc("glDebugMessageControl") : NULL;
-    lx_glDebugMessageInsert = load ? (PFNGLDEBUGMESSAGEINSERTPROC) load_proc("glDebugMessageInsert") : NULL;
-    lx_glDispatchCompute = load ? (PFNGLDISPATCHCOMPUTEPROC) load_proc("glDispatchCompute") : NULL;
-    lx_glDispatchComputeIndirect = load ? (PFNGLDISPATCHCOMPUTEINDIRECTPROC) load_proc("glDispatchComputeIndirect") : NULL;
-    lx_glFramebufferParameteri = load ? (PFNGLFRAMEBUFFERPARAMETERIPROC) load_proc("glFramebufferParameteri") : NULL;
-    lx_glGetDebugMessageLog = load ? (PFNGLGETDEBUGMESSAGELOGPROC) load_proc("glGetDebugMessageLog") : NULL;
-    lx_glGetFramebufferParameteriv = load ? (PFNGLGETFRAMEBUFFERPARAMETERIVPROC) load_proc("glGetFramebufferParameteriv") : NULL;
-    lx_glGetInternalformati64v = load ? (PFNGLGETINTERNALFORMATI64VPROC) load_proc("glGetInternalformati64v") : NULL;
-    lx_glGetObjectLabel = load ? (PFNGLGETOBJECTLABELPROC) load_proc("glGetObjectLabel") : NULL;
-    lx_glGetObjectPtrLabel = load ? (PFNGLGETOBJECTPTRLABELPROC) load_proc("glGetObjectPtrLabel") : NULL;
-    lx_glGetProgramInterfaceiv = load ? (PFNGLGETPROGRAMINTERFACEIVPROC) load_proc("glGetProgramInterfaceiv") : NULL;
-    lx_glGetProgramResourceIndex = load ? (PFNGLGETPROGRAMRESOURCEINDEXPROC) load_proc("glGetProgramResourceIndex") : NULL;
-    lx_glGetProgramResourceLocation = load ? (PFNGLGETPROGRAMRESOURCELOCATIONPROC) load_proc("glGetProgramResourceLocation") : NULL;
-    lx_glGetProgramResourceLocationIndex = load ? (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC) load_proc("glGetProgramResourceLocationIndex") : NULL;
-    lx_glGetProgramResourceName = load ? (PFNGLGETPROGRAMRESOURCENAMEPROC) load_proc("glGetProgramResourceName") : NULL;
-    lx_glGetProgramResourceiv = load ? (PFNGLGETPROGRAMRESOURCEIVPROC) load_proc("glGetProgramResourceiv") : NULL;
-    lx_glInvalidateBufferData = load ? (PFNGLINVALIDATEBUFFERDATAPROC) load_proc("glInvalidateBufferData") : NULL;
-    lx_glInvalidateBufferSubData = load ? (PFNGLINVALIDATEBUFFERSUBDATAPROC) load_proc("glInvalidateBufferSubData") : NULL;
-    lx_glInvalidateFramebuffer = load ? (PFNGLINVALIDATEFRAMEBUFFERPROC) load_proc("glInvalidateFramebuffer") : NULL;
-    lx_glInvalidateSubFramebuffer = load ? (PFNGLINVALIDATESUBFRAMEBUFFERPROC) load_proc("glInvalidateSubFramebuffer") : NULL;
-    lx_glInvalidateTexImage = load ? (PFNGLINVALIDATETEXIMAGEPROC) load_proc("glInvalidateTexImage") : NULL;
-    lx_glInvalidateTexSubImage = load ? (PFNGLINVALIDATETEXSUBIMAGEPROC) load_proc("glInvalidateTexSubImage") : NULL;
-    lx_glMultiDrawArraysIndirect = load ? (PFNGLMULTIDRAWARRAYSINDIRECTPROC) load_proc("glMultiDrawArraysIndirect") : NULL;
-    lx_glMultiDrawElementsIndirect = load ? (PFNGLMULTIDRAWELEMENTSINDIRECTPROC) load_proc("glMultiDrawElementsIndirect") : NULL;
-    lx_glObjectLabel = load ? (PFNGLOBJECTLABELPROC) load_proc("glObjectLabel") : NULL;
-    lx_glObjectPtrLabel = load ? (PFNGLOBJECTPTRLABELPROC) load_proc("glObjectPtrLabel") : NULL;
-    lx_glPopDebugGroup = load ? (PFNGLPOPDEBUGGROUPPROC) load_proc("glPopDebugGroup") : NULL;
-    lx_glPushDebugGroup = load ? (PFNGLPUSHDEBUGGROUPPROC) load_proc("glPushDebugGroup") : NULL;
-    lx_glShaderStorageBlockBinding = load ? (PFNGLSHADERSTORAGEBLOCKBINDINGPROC) load_proc("glShaderStorageBlockBinding") : NULL;
-    lx_glTexBufferRange = load ? (PFNGLTEXBUFFERRANGEPROC) load_proc("glTexBufferRange") : NULL;
-    lx_glTexStorage2DMultisample = load ? (PFNGLTEXSTORAGE2DMULTISAMPLEPROC) load_proc("glTexStorage2DMultisample") : NULL;
-    lx_glTexStorage3DMultisample = load ? (PFNGLTEXSTORAGE3DMULTISAMPLEPROC) load_proc("glTexStorage3DMultisample") : NULL;
-    lx_glTextureView = load ? (PFNGLTEXTUREVIEWPROC) load_proc("glTextureView") : NULL;
-    lx_glVertexAttribBinding = load ? (PFNGLVERTEXATTRIBBINDINGPROC) load_proc("glVertexAttribBinding") : NULL;
-    lx_glVertexAttribFormat = load ? (PFNGLVERTEXATTRIBFORMATPROC) load_proc("glVertexAttribFormat") : NULL;
-    lx_glVertexAttribIFormat = load ? (PFNGLVERTEXATTRIBIFORMATPROC) load_proc("glVertexAttribIFormat") : NULL;
-    lx_glVertexAttribLFormat = load ? (PFNGLVERTEXATTRIBLFORMATPROC) load_proc("glVertexAttribLFormat") : NULL;
-    lx_glVertexBindingDivisor = load ? (PFNGLVERTEXBINDINGDIVISORPROC) load_proc("glVertexBindingDivisor") : NULL;
+    lx_glBindVertexBuffer = LOAD(PFNGLBINDVERTEXBUFFERPROC, glBindVertexBuffer);
+    lx_glClearBufferData = LOAD(PFNGLCLEARBUFFERDATAPROC, glClearBufferData);
+    lx_glClearBufferSubData = LOAD(PFNGLCLEARBUFFERSUBDATAPROC, glClearBufferSubData);
+    lx_glCopyImageSubData = LOAD(PFNGLCOPYIMAGESUBDATAPROC, glCopyImageSubData);
+    lx_glDebugMessageCallback = LOAD(PFNGLDEBUGMESSAGECALLBACKPROC, glDebugMessageCallback);
+    lx_glDebugMessageControl = LOAD(PFNGLDEBUGMESSAGECONTROLPROC, glDebugMessageControl);
+    lx_glDebugMessageInsert = LOAD(PFNGLDEBUGMESSAGEINSERTPROC, glDebugMessageInsert);
+    lx_glDispatchCompute = LOAD(PFNGLDISPATCHCOMPUTEPROC, glDispatchCompute);
+    lx_glDispatchComputeIndirect = LOAD(PFNGLDISPATCHCOMPUTEINDIRECTPROC, glDispatchComputeIndirect);
+    lx_glFramebufferParameteri = LOAD(PFNGLFRAMEBUFFERPARAMETERIPROC, glFramebufferParameteri);
+    lx_glGetDebugMessageLog = LOAD(PFNGLGETDEBUGMESSAGELOGPROC, glGetDebugMessageLog);
+    lx_glGetFramebufferParameteriv = LOAD(PFNGLGETFRAMEBUFFERPARAMETERIVPROC, glGetFramebufferParameteriv);
+    lx_glGetInternalformati64v = LOAD(PFNGLGETINTERNALFORMATI64VPROC, glGetInternalformati64v);
+    lx_glGetObjectLabel = LOAD(PFNGLGETOBJECTLABELPROC, glGetObjectLabel);
+    lx_glGetObjectPtrLabel = LOAD(PFNGLGETOBJECTPTRLABELPROC, glGetObjectPtrLabel);
+    lx_glGetProgramInterfaceiv = LOAD(PFNGLGETPROGRAMINTERFACEIVPROC, glGetProgramInterfaceiv);
+    lx_glGetProgramResourceIndex = LOAD(PFNGLGETPROGRAMRESOURCEINDEXPROC, glGetProgramResourceIndex);
+    lx_glGetProgramResourceLocation = LOAD(PFNGLGETPROGRAMRESOURCELOCATIONPROC, glGetProgramResourceLocation);
+    lx_glGetProgramResourceLocationIndex = LOAD(PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC, glGetProgramResourceLocationIndex);
+    lx_glGetProgramResourceName = LOAD(PFNGLGETPROGRAMRESOURCENAMEPROC, glGetProgramResourceName);
+    lx_glGetProgramResourceiv = LOAD(PFNGLGETPROGRAMRESOURCEIVPROC, glGetProgramResourceiv);
+    lx_glInvalidateBufferData = LOAD(PFNGLINVALIDATEBUFFERDATAPROC, glInvalidateBufferData);
+    lx_glInvalidateBufferSubData = LOAD(PFNGLINVALIDATEBUFFERSUBDATAPROC, glInvalidateBufferSubData);
+    lx_glInvalidateFramebuffer = LOAD(PFNGLINVALIDATEFRAMEBUFFERPROC, glInvalidateFramebuffer);
+    lx_glInvalidateSubFramebuffer = LOAD(PFNGLINVALIDATESUBFRAMEBUFFERPROC, glInvalidateSubFramebuffer);
+    lx_glInvalidateTexImage = LOAD(PFNGLINVALIDATETEXIMAGEPROC, glInvalidateTexImage);
+    lx_glInvalidateTexSubImage = LOAD(PFNGLINVALIDATETEXSUBIMAGEPROC, glInvalidateTexSubImage);
+    lx_glMultiDrawArraysIndirect = LOAD(PFNGLMULTIDRAWARRAYSINDIRECTPROC, glMultiDrawArraysIndirect);
+    lx_glMultiDrawElementsIndirect = LOAD(PFNGLMULTIDRAWELEMENTSINDIRECTPROC, glMultiDrawElementsIndirect);
+    lx_glObjectLabel = LOAD(PFNGLOBJECTLABELPROC, glObjectLabel);
+    lx_glObjectPtrLabel = LOAD(PFNGLOBJECTPTRLABELPROC, glObjectPtrLabel);
+    lx_glPopDebugGroup = LOAD(PFNGLPOPDEBUGGROUPPROC, glPopDebugGroup);
+    lx_glPushDebugGroup = LOAD(PFNGLPUSHDEBUGGROUPPROC, glPushDebugGroup);
+    lx_glShaderStorageBlockBinding = LOAD(PFNGLSHADERSTORAGEBLOCKBINDINGPROC, glShaderStorageBlockBinding);
+    lx_glTexBufferRange = LOAD(PFNGLTEXBUFFERRANGEPROC, glTexBufferRange);
+    lx_glTexStorage2DMultisample = LOAD(PFNGLTEXSTORAGE2DMULTISAMPLEPROC, glTexStorage2DMultisample);
+    lx_glTexStorage3DMultisample = LOAD(PFNGLTEXSTORAGE3DMULTISAMPLEPROC, glTexStorage3DMultisample);
+    lx_glTextureView = LOAD(PFNGLTEXTUREVIEWPROC, glTextureView);
+    lx_glVertexAttribBinding = LOAD(PFNGLVERTEXATTRIBBINDINGPROC, glVertexAttribBinding);
+    lx_glVertexAttribFormat = LOAD(PFNGLVERTEXATTRIBFORMATPROC, glVertexAttribFormat);
+    lx_glVertexAttribIFormat = LOAD(PFNGLVERTEXATTRIBIFORMATPROC, glVertexAttribIFormat);
+    lx_glVertexAttribLFormat = LOAD(PFNGLVERTEXATTRIBLFORMATPROC, glVertexAttribLFormat);
+    lx_glVertexBindingDivisor = LOAD(PFNGLVERTEXBINDINGDIVISORPROC, glVertexBindingDivisor);
 }
 
 PFNGLBINDBUFFERSBASEPROC lx_glBindBuffersBase = NULL;
@@ -1247,18 +1862,28 @@ PFNGLBUFFERSTORAGEPROC lx_glBufferStorage = NULL;
 PFNGLCLEARTEXIMAGEPROC lx_glClearTexImage = NULL;
 PFNGLCLEARTEXSUBIMAGEPROC lx_glClearTexSubImage = NULL;
 
-static void load_4_4(int load)
+STUB_VOID(PFNGLBINDBUFFERSBASEPROC, glBindBuffersBase, (GLenum target, GLuint first, GLsizei count, const GLuint* buffers), (target, first, count, buffers))
+STUB_VOID(PFNGLBINDBUFFERSRANGEPROC, glBindBuffersRange, (GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizeiptr* sizes), (target, first, count, buffers, offsets, sizes))
+STUB_VOID(PFNGLBINDIMAGETEXTURESPROC, glBindImageTextures, (GLuint first, GLsizei count, const GLuint* textures), (first, count, textures))
+STUB_VOID(PFNGLBINDSAMPLERSPROC, glBindSamplers, (GLuint first, GLsizei count, const GLuint* samplers), (first, count, samplers))
+STUB_VOID(PFNGLBINDTEXTURESPROC, glBindTextures, (GLuint first, GLsizei count, const GLuint* textures), (first, count, textures))
+STUB_VOID(PFNGLBINDVERTEXBUFFERSPROC, glBindVertexBuffers, (GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides), (first, count, buffers, offsets, strides))
+STUB_VOID(PFNGLBUFFERSTORAGEPROC, glBufferStorage, (GLenum target, GLsizeiptr size, const void* data, GLbitfield flags), (target, size, data, flags))
+STUB_VOID(PFNGLCLEARTEXIMAGEPROC, glClearTexImage, (GLuint texture, GLint level, GLenum format, GLenum type, const void* data), (texture, level, format, type, data))
+STUB_VOID(PFNGLCLEARTEXSUBIMAGEPROC, glClearTexSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data))
+
+static void load_4_4(int mode)
 {
     if (!v4_4) return;
-    lx_glBindBuffersBase = load ? (PFNGLBINDBUFFERSBASEPROC) load_proc("glBindBuffersBase") : NULL;
-    lx_glBindBuffersRange = load ? (PFNGLBINDBUFFERSRANGEPROC) load_proc("glBindBuffersRange") : NULL;
-    lx_glBindImageTextures = load ? (PFNGLBINDIMAGETEXTURESPROC) load_proc("glBindImageTextures") : NULL;
-    lx_glBindSamplers = load ? (PFNGLBINDSAMPLERSPROC) load_proc("glBindSamplers") : NULL;
-    lx_glBindTextures = load ? (PFNGLBINDTEXTURESPROC) load_proc("glBindTextures") : NULL;
-    lx_glBindVertexBuffers = load ? (PFNGLBINDVERTEXBUFFERSPROC) load_proc("glBindVertexBuffers") : NULL;
-    lx_glBufferStorage = load ? (PFNGLBUFFERSTORAGEPROC) load_proc("glBufferStorage") : NULL;
-    lx_glClearTexImage = load ? (PFNGLCLEARTEXIMAGEPROC) load_proc("glClearTexImage") : NULL;
-    lx_glClearTexSubImage = load ? (PFNGLCLEARTEXSUBIMAGEPROC) load_proc("glClearTexSubImage") : NULL;
+    lx_glBindBuffersBase = LOAD(PFNGLBINDBUFFERSBASEPROC, glBindBuffersBase);
+    lx_glBindBuffersRange = LOAD(PFNGLBINDBUFFERSRANGEPROC, glBindBuffersRange);
+    lx_glBindImageTextures = LOAD(PFNGLBINDIMAGETEXTURESPROC, glBindImageTextures);
+    lx_glBindSamplers = LOAD(PFNGLBINDSAMPLERSPROC, glBindSamplers);
+    lx_glBindTextures = LOAD(PFNGLBINDTEXTURESPROC, glBindTextures);
+    lx_glBindVertexBuffers = LOAD(PFNGLBINDVERTEXBUFFERSPROC, glBindVertexBuffers);
+    lx_glBufferStorage = LOAD(PFNGLBUFFERSTORAGEPROC, glBufferStorage);
+    lx_glClearTexImage = LOAD(PFNGLCLEARTEXIMAGEPROC, glClearTexImage);
+    lx_glClearTexSubImage = LOAD(PFNGLCLEARTEXSUBIMAGEPROC, glClearTexSubImage);
 }
 
 PFNGLBINDTEXTUREUNITPROC lx_glBindTextureUnit = NULL;
@@ -1372,119 +1997,230 @@ PFNGLVERTEXARRAYELEMENTBUFFERPROC lx_glVertexArrayElementBuffer = NULL;
 PFNGLVERTEXARRAYVERTEXBUFFERPROC lx_glVertexArrayVertexBuffer = NULL;
 PFNGLVERTEXARRAYVERTEXBUFFERSPROC lx_glVertexArrayVertexBuffers = NULL;
 
-static void load_4_5(int load)
+STUB_VOID(PFNGLBINDTEXTUREUNITPROC, glBindTextureUnit, (GLuint unit, GLuint texture), (unit, texture))
+STUB_VOID(PFNGLBLITNAMEDFRAMEBUFFERPROC, glBlitNamedFramebuffer, (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter), (readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter))
+STUB(GLenum, PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, glCheckNamedFramebufferStatus, (GLuint framebuffer, GLenum target), (framebuffer, target))
+STUB_VOID(PFNGLCLEARNAMEDBUFFERDATAPROC, glClearNamedBufferData, (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void* data), (buffer, internalformat, format, type, data))
+STUB_VOID(PFNGLCLEARNAMEDBUFFERSUBDATAPROC, glClearNamedBufferSubData, (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data), (buffer, internalformat, offset, size, format, type, data))
+STUB_VOID(PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, glClearNamedFramebufferfi, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil), (framebuffer, buffer, drawbuffer, depth, stencil))
+STUB_VOID(PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, glClearNamedFramebufferfv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat* value), (framebuffer, buffer, drawbuffer, value))
+STUB_VOID(PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, glClearNamedFramebufferiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint* value), (framebuffer, buffer, drawbuffer, value))
+STUB_VOID(PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, glClearNamedFramebufferuiv, (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint* value), (framebuffer, buffer, drawbuffer, value))
+STUB_VOID(PFNGLCLIPCONTROLPROC, glClipControl, (GLenum origin, GLenum depth), (origin, depth))
+STUB_VOID(PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, glCompressedTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void* data), (texture, level, xoffset, width, format, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, glCompressedTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void* data), (texture, level, xoffset, yoffset, width, height, format, imageSize, data))
+STUB_VOID(PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, glCompressedTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void* data), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data))
+STUB_VOID(PFNGLCOPYNAMEDBUFFERSUBDATAPROC, glCopyNamedBufferSubData, (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size), (readBuffer, writeBuffer, readOffset, writeOffset, size))
+STUB_VOID(PFNGLCOPYTEXTURESUBIMAGE1DPROC, glCopyTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width), (texture, level, xoffset, x, y, width))
+STUB_VOID(PFNGLCOPYTEXTURESUBIMAGE2DPROC, glCopyTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, x, y, width, height))
+STUB_VOID(PFNGLCOPYTEXTURESUBIMAGE3DPROC, glCopyTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height), (texture, level, xoffset, yoffset, zoffset, x, y, width, height))
+STUB_VOID(PFNGLCREATEBUFFERSPROC, glCreateBuffers, (GLsizei n, GLuint* buffers), (n, buffers))
+STUB_VOID(PFNGLCREATEFRAMEBUFFERSPROC, glCreateFramebuffers, (GLsizei n, GLuint* framebuffers), (n, framebuffers))
+STUB_VOID(PFNGLCREATEPROGRAMPIPELINESPROC, glCreateProgramPipelines, (GLsizei n, GLuint* pipelines), (n, pipelines))
+STUB_VOID(PFNGLCREATEQUERIESPROC, glCreateQueries, (GLenum target, GLsizei n, GLuint* ids), (target, n, ids))
+STUB_VOID(PFNGLCREATERENDERBUFFERSPROC, glCreateRenderbuffers, (GLsizei n, GLuint* renderbuffers), (n, renderbuffers))
+STUB_VOID(PFNGLCREATESAMPLERSPROC, glCreateSamplers, (GLsizei n, GLuint* samplers), (n, samplers))
+STUB_VOID(PFNGLCREATETEXTURESPROC, glCreateTextures, (GLenum target, GLsizei n, GLuint* textures), (target, n, textures))
+STUB_VOID(PFNGLCREATETRANSFORMFEEDBACKSPROC, glCreateTransformFeedbacks, (GLsizei n, GLuint* ids), (n, ids))
+STUB_VOID(PFNGLCREATEVERTEXARRAYSPROC, glCreateVertexArrays, (GLsizei n, GLuint* arrays), (n, arrays))
+STUB_VOID(PFNGLDISABLEVERTEXARRAYATTRIBPROC, glDisableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index))
+STUB_VOID(PFNGLENABLEVERTEXARRAYATTRIBPROC, glEnableVertexArrayAttrib, (GLuint vaobj, GLuint index), (vaobj, index))
+STUB_VOID(PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, glFlushMappedNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length), (buffer, offset, length))
+STUB_VOID(PFNGLGENERATETEXTUREMIPMAPPROC, glGenerateTextureMipmap, (GLuint texture), (texture))
+STUB_VOID(PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, glGetCompressedTextureImage, (GLuint texture, GLint level, GLsizei bufSize, void* pixels), (texture, level, bufSize, pixels))
+STUB_VOID(PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, glGetCompressedTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void* pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels))
+STUB(GLenum, PFNGLGETGRAPHICSRESETSTATUSPROC, glGetGraphicsResetStatus, (void), ())
+STUB_VOID(PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, glGetNamedBufferParameteri64v, (GLuint buffer, GLenum pname, GLint64* params), (buffer, pname, params))
+STUB_VOID(PFNGLGETNAMEDBUFFERPARAMETERIVPROC, glGetNamedBufferParameteriv, (GLuint buffer, GLenum pname, GLint* params), (buffer, pname, params))
+STUB_VOID(PFNGLGETNAMEDBUFFERPOINTERVPROC, glGetNamedBufferPointerv, (GLuint buffer, GLenum pname, void ** params), (buffer, pname, params))
+STUB_VOID(PFNGLGETNAMEDBUFFERSUBDATAPROC, glGetNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, void* data), (buffer, offset, size, data))
+STUB_VOID(PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetNamedFramebufferAttachmentParameteriv, (GLuint framebuffer, GLenum attachment, GLenum pname, GLint* params), (framebuffer, attachment, pname, params))
+STUB_VOID(PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, glGetNamedFramebufferParameteriv, (GLuint framebuffer, GLenum pname, GLint* param), (framebuffer, pname, param))
+STUB_VOID(PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, glGetNamedRenderbufferParameteriv, (GLuint renderbuffer, GLenum pname, GLint* params), (renderbuffer, pname, params))
+STUB_VOID(PFNGLGETQUERYBUFFEROBJECTI64VPROC, glGetQueryBufferObjecti64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+STUB_VOID(PFNGLGETQUERYBUFFEROBJECTIVPROC, glGetQueryBufferObjectiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+STUB_VOID(PFNGLGETQUERYBUFFEROBJECTUI64VPROC, glGetQueryBufferObjectui64v, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+STUB_VOID(PFNGLGETQUERYBUFFEROBJECTUIVPROC, glGetQueryBufferObjectuiv, (GLuint id, GLuint buffer, GLenum pname, GLintptr offset), (id, buffer, pname, offset))
+STUB_VOID(PFNGLGETTEXTUREIMAGEPROC, glGetTextureImage, (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void* pixels), (texture, level, format, type, bufSize, pixels))
+STUB_VOID(PFNGLGETTEXTURELEVELPARAMETERFVPROC, glGetTextureLevelParameterfv, (GLuint texture, GLint level, GLenum pname, GLfloat* params), (texture, level, pname, params))
+STUB_VOID(PFNGLGETTEXTURELEVELPARAMETERIVPROC, glGetTextureLevelParameteriv, (GLuint texture, GLint level, GLenum pname, GLint* params), (texture, level, pname, params))
+STUB_VOID(PFNGLGETTEXTUREPARAMETERIIVPROC, glGetTextureParameterIiv, (GLuint texture, GLenum pname, GLint* params), (texture, pname, params))
+STUB_VOID(PFNGLGETTEXTUREPARAMETERIUIVPROC, glGetTextureParameterIuiv, (GLuint texture, GLenum pname, GLuint* params), (texture, pname, params))
+STUB_VOID(PFNGLGETTEXTUREPARAMETERFVPROC, glGetTextureParameterfv, (GLuint texture, GLenum pname, GLfloat* params), (texture, pname, params))
+STUB_VOID(PFNGLGETTEXTUREPARAMETERIVPROC, glGetTextureParameteriv, (GLuint texture, GLenum pname, GLint* params), (texture, pname, params))
+STUB_VOID(PFNGLGETTEXTURESUBIMAGEPROC, glGetTextureSubImage, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void* pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels))
+STUB_VOID(PFNGLGETTRANSFORMFEEDBACKI64_VPROC, glGetTransformFeedbacki64_v, (GLuint xfb, GLenum pname, GLuint index, GLint64* param), (xfb, pname, index, param))
+STUB_VOID(PFNGLGETTRANSFORMFEEDBACKI_VPROC, glGetTransformFeedbacki_v, (GLuint xfb, GLenum pname, GLuint index, GLint* param), (xfb, pname, index, param))
+STUB_VOID(PFNGLGETTRANSFORMFEEDBACKIVPROC, glGetTransformFeedbackiv, (GLuint xfb, GLenum pname, GLint* param), (xfb, pname, param))
+STUB_VOID(PFNGLGETVERTEXARRAYINDEXED64IVPROC, glGetVertexArrayIndexed64iv, (GLuint vaobj, GLuint index, GLenum pname, GLint64* param), (vaobj, index, pname, param))
+STUB_VOID(PFNGLGETVERTEXARRAYINDEXEDIVPROC, glGetVertexArrayIndexediv, (GLuint vaobj, GLuint index, GLenum pname, GLint* param), (vaobj, index, pname, param))
+STUB_VOID(PFNGLGETVERTEXARRAYIVPROC, glGetVertexArrayiv, (GLuint vaobj, GLenum pname, GLint* param), (vaobj, pname, param))
+STUB_VOID(PFNGLGETNCOMPRESSEDTEXIMAGEPROC, glGetnCompressedTexImage, (GLenum target, GLint lod, GLsizei bufSize, void* pixels), (target, lod, bufSize, pixels))
+STUB_VOID(PFNGLGETNTEXIMAGEPROC, glGetnTexImage, (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void* pixels), (target, level, format, type, bufSize, pixels))
+STUB_VOID(PFNGLGETNUNIFORMDVPROC, glGetnUniformdv, (GLuint program, GLint location, GLsizei bufSize, GLdouble* params), (program, location, bufSize, params))
+STUB_VOID(PFNGLGETNUNIFORMFVPROC, glGetnUniformfv, (GLuint program, GLint location, GLsizei bufSize, GLfloat* params), (program, location, bufSize, params))
+STUB_VOID(PFNGLGETNUNIFORMIVPROC, glGetnUniformiv, (GLuint program, GLint location, GLsizei bufSize, GLint* params), (program, location, bufSize, params))
+STUB_VOID(PFNGLGETNUNIFORMUIVPROC, glGetnUniformuiv, (GLuint program, GLint location, GLsizei bufSize, GLuint* params), (program, location, bufSize, params))
+STUB_VOID(PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, glInvalidateNamedFramebufferData, (GLuint framebuffer, GLsizei numAttachments, const GLenum* attachments), (framebuffer, numAttachments, attachments))
+STUB_VOID(PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, glInvalidateNamedFramebufferSubData, (GLuint framebuffer, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height), (framebuffer, numAttachments, attachments, x, y, width, height))
+STUB(void*, PFNGLMAPNAMEDBUFFERPROC, glMapNamedBuffer, (GLuint buffer, GLenum access), (buffer, access))
+STUB(void*, PFNGLMAPNAMEDBUFFERRANGEPROC, glMapNamedBufferRange, (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access), (buffer, offset, length, access))
+STUB_VOID(PFNGLMEMORYBARRIERBYREGIONPROC, glMemoryBarrierByRegion, (GLbitfield barriers), (barriers))
+STUB_VOID(PFNGLNAMEDBUFFERDATAPROC, glNamedBufferData, (GLuint buffer, GLsizeiptr size, const void* data, GLenum usage), (buffer, size, data, usage))
+STUB_VOID(PFNGLNAMEDBUFFERSTORAGEPROC, glNamedBufferStorage, (GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags), (buffer, size, data, flags))
+STUB_VOID(PFNGLNAMEDBUFFERSUBDATAPROC, glNamedBufferSubData, (GLuint buffer, GLintptr offset, GLsizeiptr size, const void* data), (buffer, offset, size, data))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, glNamedFramebufferDrawBuffer, (GLuint framebuffer, GLenum buf), (framebuffer, buf))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, glNamedFramebufferDrawBuffers, (GLuint framebuffer, GLsizei n, const GLenum* bufs), (framebuffer, n, bufs))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, glNamedFramebufferParameteri, (GLuint framebuffer, GLenum pname, GLint param), (framebuffer, pname, param))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, glNamedFramebufferReadBuffer, (GLuint framebuffer, GLenum src), (framebuffer, src))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, glNamedFramebufferRenderbuffer, (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer), (framebuffer, attachment, renderbuffertarget, renderbuffer))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, glNamedFramebufferTexture, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level), (framebuffer, attachment, texture, level))
+STUB_VOID(PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, glNamedFramebufferTextureLayer, (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer), (framebuffer, attachment, texture, level, layer))
+STUB_VOID(PFNGLNAMEDRENDERBUFFERSTORAGEPROC, glNamedRenderbufferStorage, (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, internalformat, width, height))
+STUB_VOID(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, glNamedRenderbufferStorageMultisample, (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height), (renderbuffer, samples, internalformat, width, height))
+STUB_VOID(PFNGLREADNPIXELSPROC, glReadnPixels, (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void* data), (x, y, width, height, format, type, bufSize, data))
+STUB_VOID(PFNGLTEXTUREBARRIERPROC, glTextureBarrier, (void), ())
+STUB_VOID(PFNGLTEXTUREBUFFERPROC, glTextureBuffer, (GLuint texture, GLenum internalformat, GLuint buffer), (texture, internalformat, buffer))
+STUB_VOID(PFNGLTEXTUREBUFFERRANGEPROC, glTextureBufferRange, (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size), (texture, internalformat, buffer, offset, size))
+STUB_VOID(PFNGLTEXTUREPARAMETERIIVPROC, glTextureParameterIiv, (GLuint texture, GLenum pname, const GLint* params), (texture, pname, params))
+STUB_VOID(PFNGLTEXTUREPARAMETERIUIVPROC, glTextureParameterIuiv, (GLuint texture, GLenum pname, const GLuint* params), (texture, pname, params))
+STUB_VOID(PFNGLTEXTUREPARAMETERFPROC, glTextureParameterf, (GLuint texture, GLenum pname, GLfloat param), (texture, pname, param))
+STUB_VOID(PFNGLTEXTUREPARAMETERFVPROC, glTextureParameterfv, (GLuint texture, GLenum pname, const GLfloat* param), (texture, pname, param))
+STUB_VOID(PFNGLTEXTUREPARAMETERIPROC, glTextureParameteri, (GLuint texture, GLenum pname, GLint param), (texture, pname, param))
+STUB_VOID(PFNGLTEXTUREPARAMETERIVPROC, glTextureParameteriv, (GLuint texture, GLenum pname, const GLint* param), (texture, pname, param))
+STUB_VOID(PFNGLTEXTURESTORAGE1DPROC, glTextureStorage1D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width), (texture, levels, internalformat, width))
+STUB_VOID(PFNGLTEXTURESTORAGE2DPROC, glTextureStorage2D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height), (texture, levels, internalformat, width, height))
+STUB_VOID(PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, glTextureStorage2DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, fixedsamplelocations))
+STUB_VOID(PFNGLTEXTURESTORAGE3DPROC, glTextureStorage3D, (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth), (texture, levels, internalformat, width, height, depth))
+STUB_VOID(PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, glTextureStorage3DMultisample, (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations), (texture, samples, internalformat, width, height, depth, fixedsamplelocations))
+STUB_VOID(PFNGLTEXTURESUBIMAGE1DPROC, glTextureSubImage1D, (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void* pixels), (texture, level, xoffset, width, format, type, pixels))
+STUB_VOID(PFNGLTEXTURESUBIMAGE2DPROC, glTextureSubImage2D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels), (texture, level, xoffset, yoffset, width, height, format, type, pixels))
+STUB_VOID(PFNGLTEXTURESUBIMAGE3DPROC, glTextureSubImage3D, (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void* pixels), (texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels))
+STUB_VOID(PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, glTransformFeedbackBufferBase, (GLuint xfb, GLuint index, GLuint buffer), (xfb, index, buffer))
+STUB_VOID(PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, glTransformFeedbackBufferRange, (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size), (xfb, index, buffer, offset, size))
+STUB(GLboolean, PFNGLUNMAPNAMEDBUFFERPROC, glUnmapNamedBuffer, (GLuint buffer), (buffer))
+STUB_VOID(PFNGLVERTEXARRAYATTRIBBINDINGPROC, glVertexArrayAttribBinding, (GLuint vaobj, GLuint attribindex, GLuint bindingindex), (vaobj, attribindex, bindingindex))
+STUB_VOID(PFNGLVERTEXARRAYATTRIBFORMATPROC, glVertexArrayAttribFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset), (vaobj, attribindex, size, type, normalized, relativeoffset))
+STUB_VOID(PFNGLVERTEXARRAYATTRIBIFORMATPROC, glVertexArrayAttribIFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+STUB_VOID(PFNGLVERTEXARRAYATTRIBLFORMATPROC, glVertexArrayAttribLFormat, (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset), (vaobj, attribindex, size, type, relativeoffset))
+STUB_VOID(PFNGLVERTEXARRAYBINDINGDIVISORPROC, glVertexArrayBindingDivisor, (GLuint vaobj, GLuint bindingindex, GLuint divisor), (vaobj, bindingindex, divisor))
+STUB_VOID(PFNGLVERTEXARRAYELEMENTBUFFERPROC, glVertexArrayElementBuffer, (GLuint vaobj, GLuint buffer), (vaobj, buffer))
+STUB_VOID(PFNGLVERTEXARRAYVERTEXBUFFERPROC, glVertexArrayVertexBuffer, (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride), (vaobj, bindingindex, buffer, offset, stride))
+STUB_VOID(PFNGLVERTEXARRAYVERTEXBUFFERSPROC, glVertexArrayVertexBuffers, (GLuint vaobj, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr* offsets, const GLsizei* strides), (vaobj, first, count, buffers, offsets, strides))
+
+static void load_4_5(int mode)
 {
     if (!v4_5) return;
-    lx_glBindTextureUnit = load ? (PFNGLBINDTEXTUREUNITPROC) load_proc("glBindTextureUnit") : NULL;
-    lx_glBlitNamedFramebuffer = load ? (PFNGLBLITNAMEDFRAMEBUFFERPROC) load_proc("glBlitNamedFramebuffer") : NULL;
-    lx_glCheckNamedFramebufferStatus = load ? (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC) load_proc("glCheckNamedFramebufferStatus") : NULL;
-    lx_glClearNamedBufferData = load ? (PFNGLCLEARNAMEDBUFFERDATAPROC) load_proc("glClearNamedBufferData") : NULL;
-    lx_glClearNamedBufferSubData = load ? (PFNGLCLEARNAMEDBUFFERSUBDATAPROC) load_proc("glClearNamedBufferSubData") : NULL;
-    lx_glClearNamedFramebufferfi = load ? (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC) load_proc("glClearNamedFramebufferfi") : NULL;
-    lx_glClearNamedFramebufferfv = load ? (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC) load_proc("glClearNamedFramebufferfv") : NULL;
-    lx_glClearNamedFramebufferiv = load ? (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC) load_proc("glClearNamedFramebufferiv") : NULL;
-    lx_glClearNamedFramebufferuiv = load ? (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC) load_proc("glClearNamedFramebufferuiv") : NULL;
-    lx_glClipControl = load ? (PFNGLCLIPCONTROLPROC) load_proc("glClipControl") : NULL;
-    lx_glCompressedTextureSubImage1D = load ? (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC) load_proc("glCompressedTextureSubImage1D") : NULL;
-    lx_glCompressedTextureSubImage2D = load ? (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC) load_proc("glCompressedTextureSubImage2D") : NULL;
-    lx_glCompressedTextureSubImage3D = load ? (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC) load_proc("glCompressedTextureSubImage3D") : NULL;
-    lx_glCopyNamedBufferSubData = load ? (PFNGLCOPYNAMEDBUFFERSUBDATAPROC) load_proc("glCopyNamedBufferSubData") : NULL;
-    lx_glCopyTextureSubImage1D = load ? (PFNGLCOPYTEXTURESUBIMAGE1DPROC) load_proc("glCopyTextureSubImage1D") : NULL;
-    lx_glCopyTextureSubImage2D = load ? (PFNGLCOPYTEXTURESUBIMAGE2DPROC) load_proc("glCopyTextureSubImage2D") : NULL;
-    lx_glCopyTextureSubImage3D = load ? (PFNGLCOPYTEXTURESUBIMAGE3DPROC) load_proc("glCopyTextureSubImage3D") : NULL;
-    lx_glCreateBuffers = load ? (PFNGLCREATEBUFFERSPROC) load_proc("glCreateBuffers") : NULL;
-    lx_glCreateFramebuffers = load ? (PFNGLCREATEFRAMEBUFFERSPROC) load_proc("glCreateFramebuffers") : NULL;
-    lx_glCreateProgramPipelines = load ? (PFNGLCREATEPROGRAMPIPELINESPROC) load_proc("glCreateProgramPipelines") : NULL;
-    lx_glCreateQueries = load ? (PFNGLCREATEQUERIESPROC) load_proc("glCreateQueries") : NULL;
-    lx_glCreateRenderbuffers = load ? (PFNGLCREATERENDERBUFFERSPROC) load_proc("glCreateRenderbuffers") : NULL;
-    lx_glCreateSamplers = load ? (PFNGLCREATESAMPLERSPROC) load_proc("glCreateSamplers") : NULL;
-    lx_glCreateTextures = load ? (PFNGLCREATETEXTURESPROC) load_proc("glCreateTextures") : NULL;
-    lx_glCreateTransformFeedbacks = load ? (PFNGLCREATETRANSFORMFEEDBACKSPROC) load_proc("glCreateTransformFeedbacks") : NULL;
-    lx_glCreateVertexArrays = load ? (PFNGLCREATEVERTEXARRAYSPROC) load_proc("glCreateVertexArrays") : NULL;
-    lx_glDisableVertexArrayAttrib = load ? (PFNGLDISABLEVERTEXARRAYATTRIBPROC) load_proc("glDisableVertexArrayAttrib") : NULL;
-    lx_glEnableVertexArrayAttrib = load ? (PFNGLENABLEVERTEXARRAYATTRIBPROC) load_proc("glEnableVertexArrayAttrib") : NULL;
-    lx_glFlushMappedNamedBufferRange = load ? (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC) load_proc("glFlushMappedNamedBufferRange") : NULL;
-    lx_glGenerateTextureMipmap = load ? (PFNGLGENERATETEXTUREMIPMAPPROC) load_proc("glGenerateTextureMipmap") : NULL;
-    lx_glGetCompressedTextureImage = load ? (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC) load_proc("glGetCompressedTextureImage") : NULL;
-    lx_glGetCompressedTextureSubImage = load ? (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC) load_proc("glGetCompressedTextureSubImage") : NULL;
-    lx_glGetGraphicsResetStatus = load ? (PFNGLGETGRAPHICSRESETSTATUSPROC) load_proc("glGetGraphicsResetStatus") : NULL;
-    lx_glGetNamedBufferParameteri64v = load ? (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC) load_proc("glGetNamedBufferParameteri64v") : NULL;
-    lx_glGetNamedBufferParameteriv = load ? (PFNGLGETNAMEDBUFFERPARAMETERIVPROC) load_proc("glGetNamedBufferParameteriv") : NULL;
-    lx_glGetNamedBufferPointerv = load ? (PFNGLGETNAMEDBUFFERPOINTERVPROC) load_proc("glGetNamedBufferPointerv") : NULL;
-    lx_glGetNamedBufferSubData = load ? (PFNGLGETNAMEDBUFFERSUBDATAPROC) load_proc("glGetNamedBufferSubData") : NULL;
-    lx_glGetNamedFramebufferAttachmentParameteriv = load ? (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC) load_proc("glGetNamedFramebufferAttachmentParameteriv") : NULL;
-    lx_glGetNamedFramebufferParameteriv = load ? (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC) load_proc("glGetNamedFramebufferParameteriv") : NULL;
-    lx_glGetNamedRenderbufferParameteriv = load ? (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC) load_proc("glGetNamedRenderbufferParameteriv") : NULL;
-    lx_glGetQueryBufferObjecti64v = load ? (PFNGLGETQUERYBUFFEROBJECTI64VPROC) load_proc("glGetQueryBufferObjecti64v") : NULL;
-    lx_glGetQueryBufferObjectiv = load ? (PFNGLGETQUERYBUFFEROBJECTIVPROC) load_proc("glGetQueryBufferObjectiv") : NULL;
-    lx_glGetQueryBufferObjectui64v = load ? (PFNGLGETQUERYBUFFEROBJECTUI64VPROC) load_proc("glGetQueryBufferObjectui64v") : NULL;
-    lx_glGetQueryBufferObjectuiv = load ? (PFNGLGETQUERYBUFFEROBJECTUIVPROC) load_proc("glGetQueryBufferObjectuiv") : NULL;
-    lx_glGetTextureImage = load ? (PFNGLGETTEXTUREIMAGEPROC) load_proc("glGetTextureImage") : NULL;
-    lx_glGetTextureLevelParameterfv = load ? (PFNGLGETTEXTURELEVELPARAMETERFVPROC) load_proc("glGetTextureLevelParameterfv") : NULL;
-    lx_glGetTextureLevelParameteriv = load ? (PFNGLGETTEXTURELEVELPARAMETERIVPROC) load_proc("glGetTextureLevelParameteriv") : NULL;
-    lx_glGetTextureParameterIiv = load ? (PFNGLGETTEXTUREPARAMETERIIVPROC) load_proc("glGetTextureParameterIiv") : NULL;
-    lx_glGetTextureParameterIuiv = load ? (PFNGLGETTEXTUREPARAMETERIUIVPROC) load_proc("glGetTextureParameterIuiv") : NULL;
-    lx_glGetTextureParameterfv = load ? (PFNGLGETTEXTUREPARAMETERFVPROC) load_proc("glGetTextureParameterfv") : NULL;
-    lx_glGetTextureParameteriv = load ? (PFNGLGETTEXTUREPARAMETERIVPROC) load_proc("glGetTextureParameteriv") : NULL;
-    lx_glGetTextureSubImage = load ? (PFNGLGETTEXTURESUBIMAGEPROC) load_proc("glGetTextureSubImage") : NULL;
-    lx_glGetTransformFeedbacki64_v = load ? (PFNGLGETTRANSFORMFEEDBACKI64_VPROC) load_proc("glGetTransformFeedbacki64_v") : NULL;
-    lx_glGetTransformFeedbacki_v = load ? (PFNGLGETTRANSFORMFEEDBACKI_VPROC) load_proc("glGetTransformFeedbacki_v") : NULL;
-    lx_glGetTransformFeedbackiv = load ? (PFNGLGETTRANSFORMFEEDBACKIVPROC) load_proc("glGetTransformFeedbackiv") : NULL;
-    lx_glGetVertexArrayIndexed64iv = load ? (PFNGLGETVERTEXARRAYINDEXED64IVPROC) load_proc("glGetVertexArrayIndexed64iv") : NULL;
-    lx_glGetVertexArrayIndexediv = load ? (PFNGLGETVERTEXARRAYINDEXEDIVPROC) load_proc("glGetVertexArrayIndexediv") : NULL;
-    lx_glGetVertexArrayiv = load ? (PFNGLGETVERTEXARRAYIVPROC) load_proc("glGetVertexArrayiv") : NULL;
-    lx_glGetnCompressedTexImage = load ? (PFNGLGETNCOMPRESSEDTEXIMAGEPROC) load_proc("glGetnCompressedTexImage") : NULL;
-    lx_glGetnTexImage = load ? (PFNGLGETNTEXIMAGEPROC) load_proc("glGetnTexImage") : NULL;
-    lx_glGetnUniformdv = load ? (PFNGLGETNUNIFORMDVPROC) load_proc("glGetnUniformdv") : NULL;
-    lx_glGetnUniformfv = load ? (PFNGLGETNUNIFORMFVPROC) load_proc("glGetnUniformfv") : NULL;
-    lx_glGetnUniformiv = load ? (PFNGLGETNUNIFORMIVPROC) load_proc("glGetnUniformiv") : NULL;
-    lx_glGetnUniformuiv = load ? (PFNGLGETNUNIFORMUIVPROC) load_proc("glGetnUniformuiv") : NULL;
-    lx_glInvalidateNamedFramebufferData = load ? (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC) load_proc("glInvalidateNamedFramebufferData") : NULL;
-    lx_glInvalidateNamedFramebufferSubData = load ? (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC) load_proc("glInvalidateNamedFramebufferSubData") : NULL;
-    lx_glMapNamedBuffer = load ? (PFNGLMAPNAMEDBUFFERPROC) load_proc("glMapNamedBuffer") : NULL;
-    lx_glMapNamedBufferRange = load ? (PFNGLMAPNAMEDBUFFERRANGEPROC) load_proc("glMapNamedBufferRange") : NULL;
-    lx_glMemoryBarrierByRegion = load ? (PFNGLMEMORYBARRIERBYREGIONPROC) load_proc("glMemoryBarrierByRegion") : NULL;
-    lx_glNamedBufferData = load ? (PFNGLNAMEDBUFFERDATAPROC) load_proc("glNamedBufferData") : NULL;
-    lx_glNamedBufferStorage = load ? (PFNGLNAMEDBUFFERSTORAGEPROC) load_proc("glNamedBufferStorage") : NULL;
-    lx_glNamedBufferSubData = load ? (PFNGLNAMEDBUFFERSUBDATAPROC) load_proc("glNamedBufferSubData") : NULL;
-    lx_glNamedFramebufferDrawBuffer = load ? (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC) load_proc("glNamedFramebufferDrawBuffer") : NULL;
-    lx_glNamedFramebufferDrawBuffers = load ? (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC) load_proc("glNamedFramebufferDrawBuffers") : NULL;
-    lx_glNamedFramebufferParameteri = load ? (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC) load_proc("glNamedFramebufferParameteri") : NULL;
-    lx_glNamedFramebufferReadBuffer = load ? (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC) load_proc("glNamedFramebufferReadBuffer") : NULL;
-    lx_glNamedFramebufferRenderbuffer = load ? (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC) load_proc("glNamedFramebufferRenderbuffer") : NULL;
-    lx_glNamedFramebufferTexture = load ? (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC) load_proc("glNamedFramebufferTexture") : NULL;
-    lx_glNamedFramebufferTextureLayer = load ? (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC) load_proc("glNamedFramebufferTextureLayer") : NULL;
-    lx_glNamedRenderbufferStorage = load ? (PFNGLNAMEDRENDERBUFFERSTORAGEPROC) load_proc("glNamedRenderbufferStorage") : NULL;
-    lx_glNamedRenderbufferStorageMultisample = load ? (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC) load_proc("glNamedRenderbufferStorageMultisample") : NULL;
-    lx_glReadnPixels = load ? (PFNGLREADNPIXELSPROC) load_proc("glReadnPixels") : NULL;
-    lx_glTextureBarrier = load ? (PFNGLTEXTUREBARRIERPROC) load_proc("glTextureBarrier") : NULL;
-    lx_glTextureBuffer = load ? (PFNGLTEXTUREBUFFERPROC) load_proc("glTextureBuffer") : NULL;
-    lx_glTextureBufferRange = load ? (PFNGLTEXTUREBUFFERRANGEPROC) load_proc("glTextureBufferRange") : NULL;
-    lx_glTextureParameterIiv = load ? (PFNGLTEXTUREPARAMETERIIVPROC) load_proc("glTextureParameterIiv") : NULL;
-    lx_glTextureParameterIuiv = load ? (PFNGLTEXTUREPARAMETERIUIVPROC) load_proc("glTextureParameterIuiv") : NULL;
-    lx_glTextureParameterf = load ? (PFNGLTEXTUREPARAMETERFPROC) load_proc("glTextureParameterf") : NULL;
-    lx_glTextureParameterfv = load ? (PFNGLTEXTUREPARAMETERFVPROC) load_proc("glTextureParameterfv") : NULL;
-    lx_glTextureParameteri = load ? (PFNGLTEXTUREPARAMETERIPROC) load_proc("glTextureParameteri") : NULL;
-    lx_glTextureParameteriv = load ? (PFNGLTEXTUREPARAMETERIVPROC) load_proc("glTextureParameteriv") : NULL;
-    lx_glTextureStorage1D = load ? (PFNGLTEXTURESTORAGE1DPROC) load_proc("glTextureStorage1D") : NULL;
-    lx_glTextureStorage2D = load ? (PFNGLTEXTURESTORAGE2DPROC) load_proc("glTextureStorage2D") : NULL;
-    lx_glTextureStorage2DMultisample = load ? (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC) load_proc("glTextureStorage2DMultisample") : NULL;
-    lx_glTextureStorage3D = load ? (PFNGLTEXTURESTORAGE3DPROC) load_proc("glTextureStorage3D") : NULL;
-    lx_glTextureStorage3DMultisample = load ? (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC) load_proc("glTextureStorage3DMultisample") : NULL;
-    lx_glTextureSubImage1D = load ? (PFNGLTEXTURESUBIMAGE1DPROC) load_proc("glTextureSubImage1D") : NULL;
-    lx_glTextureSubImage2D = load ? (PFNGLTEXTURESUBIMAGE2DPROC) load_proc("glTextureSubImage2D") : NULL;
-    lx_glTextureSubImage3D = load ? (PFNGLTEXTURESUBIMAGE3DPROC) load_proc("glTextureSubImage3D") : NULL;
-    lx_glTransformFeedbackBufferBase = load ? (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC) load_proc("glTransformFeedbackBufferBase") : NULL;
-    lx_glTransformFeedbackBufferRange = load ? (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC) load_proc("glTransformFeedbackBufferRange") : NULL;
-    lx_glUnmapNamedBuffer = load ? (PFNGLUNMAPNAMEDBUFFERPROC) load_proc("glUnmapNamedBuffer") : NULL;
-    lx_glVertexArrayAttribBinding = load ? (PFNGLVERTEXARRAYATTRIBBINDINGPROC) load_proc("glVertexArrayAttribBinding") : NULL;
-    lx_glVertexArrayAttribFormat = load ? (PFNGLVERTEXARRAYATTRIBFORMATPROC) load_proc("glVertexArrayAttribFormat") : NULL;
-    lx_glVertexArrayAttribIFormat = load ? (PFNGLVERTEXARRAYATTRIBIFORMATPROC) load_proc("glVertexArrayAttribIFormat") : NULL;
-    lx_glVertexArrayAttribLFormat = load ? (PFNGLVERTEXARRAYATTRIBLFORMATPROC) load_proc("glVertexArrayAttribLFormat") : NULL;
-    lx_glVertexArrayBindingDivisor = load ? (PFNGLVERTEXARRAYBINDINGDIVISORPROC) load_proc("glVertexArrayBindingDivisor") : NULL;
-    lx_glVertexArrayElementBuffer = load ? (PFNGLVERTEXARRAYELEMENTBUFFERPROC) load_proc("glVertexArrayElementBuffer") : NULL;
-    lx_glVertexArrayVertexBuffer = load ? (PFNGLVERTEXARRAYVERTEXBUFFERPROC) load_proc("glVertexArrayVertexBuffer") : NULL;
-    lx_glVertexArrayVertexBuffers = load ? (PFNGLVERTEXARRAYVERTEXBUFFERSPROC) load_proc("glVertexArrayVertexBuffers") : NULL;
+    lx_glBindTextureUnit = LOAD(PFNGLBINDTEXTUREUNITPROC, glBindTextureUnit);
+    lx_glBlitNamedFramebuffer = LOAD(PFNGLBLITNAMEDFRAMEBUFFERPROC, glBlitNamedFramebuffer);
+    lx_glCheckNamedFramebufferStatus = LOAD(PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC, glCheckNamedFramebufferStatus);
+    lx_glClearNamedBufferData = LOAD(PFNGLCLEARNAMEDBUFFERDATAPROC, glClearNamedBufferData);
+    lx_glClearNamedBufferSubData = LOAD(PFNGLCLEARNAMEDBUFFERSUBDATAPROC, glClearNamedBufferSubData);
+    lx_glClearNamedFramebufferfi = LOAD(PFNGLCLEARNAMEDFRAMEBUFFERFIPROC, glClearNamedFramebufferfi);
+    lx_glClearNamedFramebufferfv = LOAD(PFNGLCLEARNAMEDFRAMEBUFFERFVPROC, glClearNamedFramebufferfv);
+    lx_glClearNamedFramebufferiv = LOAD(PFNGLCLEARNAMEDFRAMEBUFFERIVPROC, glClearNamedFramebufferiv);
+    lx_glClearNamedFramebufferuiv = LOAD(PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC, glClearNamedFramebufferuiv);
+    lx_glClipControl = LOAD(PFNGLCLIPCONTROLPROC, glClipControl);
+    lx_glCompressedTextureSubImage1D = LOAD(PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC, glCompressedTextureSubImage1D);
+    lx_glCompressedTextureSubImage2D = LOAD(PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC, glCompressedTextureSubImage2D);
+    lx_glCompressedTextureSubImage3D = LOAD(PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC, glCompressedTextureSubImage3D);
+    lx_glCopyNamedBufferSubData = LOAD(PFNGLCOPYNAMEDBUFFERSUBDATAPROC, glCopyNamedBufferSubData);
+    lx_glCopyTextureSubImage1D = LOAD(PFNGLCOPYTEXTURESUBIMAGE1DPROC, glCopyTextureSubImage1D);
+    lx_glCopyTextureSubImage2D = LOAD(PFNGLCOPYTEXTURESUBIMAGE2DPROC, glCopyTextureSubImage2D);
+    lx_glCopyTextureSubImage3D = LOAD(PFNGLCOPYTEXTURESUBIMAGE3DPROC, glCopyTextureSubImage3D);
+    lx_glCreateBuffers = LOAD(PFNGLCREATEBUFFERSPROC, glCreateBuffers);
+    lx_glCreateFramebuffers = LOAD(PFNGLCREATEFRAMEBUFFERSPROC, glCreateFramebuffers);
+    lx_glCreateProgramPipelines = LOAD(PFNGLCREATEPROGRAMPIPELINESPROC, glCreateProgramPipelines);
+    lx_glCreateQueries = LOAD(PFNGLCREATEQUERIESPROC, glCreateQueries);
+    lx_glCreateRenderbuffers = LOAD(PFNGLCREATERENDERBUFFERSPROC, glCreateRenderbuffers);
+    lx_glCreateSamplers = LOAD(PFNGLCREATESAMPLERSPROC, glCreateSamplers);
+    lx_glCreateTextures = LOAD(PFNGLCREATETEXTURESPROC, glCreateTextures);
+    lx_glCreateTransformFeedbacks = LOAD(PFNGLCREATETRANSFORMFEEDBACKSPROC, glCreateTransformFeedbacks);
+    lx_glCreateVertexArrays = LOAD(PFNGLCREATEVERTEXARRAYSPROC, glCreateVertexArrays);
+    lx_glDisableVertexArrayAttrib = LOAD(PFNGLDISABLEVERTEXARRAYATTRIBPROC, glDisableVertexArrayAttrib);
+    lx_glEnableVertexArrayAttrib = LOAD(PFNGLENABLEVERTEXARRAYATTRIBPROC, glEnableVertexArrayAttrib);
+    lx_glFlushMappedNamedBufferRange = LOAD(PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC, glFlushMappedNamedBufferRange);
+    lx_glGenerateTextureMipmap = LOAD(PFNGLGENERATETEXTUREMIPMAPPROC, glGenerateTextureMipmap);
+    lx_glGetCompressedTextureImage = LOAD(PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC, glGetCompressedTextureImage);
+    lx_glGetCompressedTextureSubImage = LOAD(PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC, glGetCompressedTextureSubImage);
+    lx_glGetGraphicsResetStatus = LOAD(PFNGLGETGRAPHICSRESETSTATUSPROC, glGetGraphicsResetStatus);
+    lx_glGetNamedBufferParameteri64v = LOAD(PFNGLGETNAMEDBUFFERPARAMETERI64VPROC, glGetNamedBufferParameteri64v);
+    lx_glGetNamedBufferParameteriv = LOAD(PFNGLGETNAMEDBUFFERPARAMETERIVPROC, glGetNamedBufferParameteriv);
+    lx_glGetNamedBufferPointerv = LOAD(PFNGLGETNAMEDBUFFERPOINTERVPROC, glGetNamedBufferPointerv);
+    lx_glGetNamedBufferSubData = LOAD(PFNGLGETNAMEDBUFFERSUBDATAPROC, glGetNamedBufferSubData);
+    lx_glGetNamedFramebufferAttachmentParameteriv = LOAD(PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC, glGetNamedFramebufferAttachmentParameteriv);
+    lx_glGetNamedFramebufferParameteriv = LOAD(PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC, glGetNamedFramebufferParameteriv);
+    lx_glGetNamedRenderbufferParameteriv = LOAD(PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC, glGetNamedRenderbufferParameteriv);
+    lx_glGetQueryBufferObjecti64v = LOAD(PFNGLGETQUERYBUFFEROBJECTI64VPROC, glGetQueryBufferObjecti64v);
+    lx_glGetQueryBufferObjectiv = LOAD(PFNGLGETQUERYBUFFEROBJECTIVPROC, glGetQueryBufferObjectiv);
+    lx_glGetQueryBufferObjectui64v = LOAD(PFNGLGETQUERYBUFFEROBJECTUI64VPROC, glGetQueryBufferObjectui64v);
+    lx_glGetQueryBufferObjectuiv = LOAD(PFNGLGETQUERYBUFFEROBJECTUIVPROC, glGetQueryBufferObjectuiv);
+    lx_glGetTextureImage = LOAD(PFNGLGETTEXTUREIMAGEPROC, glGetTextureImage);
+    lx_glGetTextureLevelParameterfv = LOAD(PFNGLGETTEXTURELEVELPARAMETERFVPROC, glGetTextureLevelParameterfv);
+    lx_glGetTextureLevelParameteriv = LOAD(PFNGLGETTEXTURELEVELPARAMETERIVPROC, glGetTextureLevelParameteriv);
+    lx_glGetTextureParameterIiv = LOAD(PFNGLGETTEXTUREPARAMETERIIVPROC, glGetTextureParameterIiv);
+    lx_glGetTextureParameterIuiv = LOAD(PFNGLGETTEXTUREPARAMETERIUIVPROC, glGetTextureParameterIuiv);
+    lx_glGetTextureParameterfv = LOAD(PFNGLGETTEXTUREPARAMETERFVPROC, glGetTextureParameterfv);
+    lx_glGetTextureParameteriv = LOAD(PFNGLGETTEXTUREPARAMETERIVPROC, glGetTextureParameteriv);
+    lx_glGetTextureSubImage = LOAD(PFNGLGETTEXTURESUBIMAGEPROC, glGetTextureSubImage);
+    lx_glGetTransformFeedbacki64_v = LOAD(PFNGLGETTRANSFORMFEEDBACKI64_VPROC, glGetTransformFeedbacki64_v);
+    lx_glGetTransformFeedbacki_v = LOAD(PFNGLGETTRANSFORMFEEDBACKI_VPROC, glGetTransformFeedbacki_v);
+    lx_glGetTransformFeedbackiv = LOAD(PFNGLGETTRANSFORMFEEDBACKIVPROC, glGetTransformFeedbackiv);
+    lx_glGetVertexArrayIndexed64iv = LOAD(PFNGLGETVERTEXARRAYINDEXED64IVPROC, glGetVertexArrayIndexed64iv);
+    lx_glGetVertexArrayIndexediv = LOAD(PFNGLGETVERTEXARRAYINDEXEDIVPROC, glGetVertexArrayIndexediv);
+    lx_glGetVertexArrayiv = LOAD(PFNGLGETVERTEXARRAYIVPROC, glGetVertexArrayiv);
+    lx_glGetnCompressedTexImage = LOAD(PFNGLGETNCOMPRESSEDTEXIMAGEPROC, glGetnCompressedTexImage);
+    lx_glGetnTexImage = LOAD(PFNGLGETNTEXIMAGEPROC, glGetnTexImage);
+    lx_glGetnUniformdv = LOAD(PFNGLGETNUNIFORMDVPROC, glGetnUniformdv);
+    lx_glGetnUniformfv = LOAD(PFNGLGETNUNIFORMFVPROC, glGetnUniformfv);
+    lx_glGetnUniformiv = LOAD(PFNGLGETNUNIFORMIVPROC, glGetnUniformiv);
+    lx_glGetnUniformuiv = LOAD(PFNGLGETNUNIFORMUIVPROC, glGetnUniformuiv);
+    lx_glInvalidateNamedFramebufferData = LOAD(PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC, glInvalidateNamedFramebufferData);
+    lx_glInvalidateNamedFramebufferSubData = LOAD(PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC, glInvalidateNamedFramebufferSubData);
+    lx_glMapNamedBuffer = LOAD(PFNGLMAPNAMEDBUFFERPROC, glMapNamedBuffer);
+    lx_glMapNamedBufferRange = LOAD(PFNGLMAPNAMEDBUFFERRANGEPROC, glMapNamedBufferRange);
+    lx_glMemoryBarrierByRegion = LOAD(PFNGLMEMORYBARRIERBYREGIONPROC, glMemoryBarrierByRegion);
+    lx_glNamedBufferData = LOAD(PFNGLNAMEDBUFFERDATAPROC, glNamedBufferData);
+    lx_glNamedBufferStorage = LOAD(PFNGLNAMEDBUFFERSTORAGEPROC, glNamedBufferStorage);
+    lx_glNamedBufferSubData = LOAD(PFNGLNAMEDBUFFERSUBDATAPROC, glNamedBufferSubData);
+    lx_glNamedFramebufferDrawBuffer = LOAD(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC, glNamedFramebufferDrawBuffer);
+    lx_glNamedFramebufferDrawBuffers = LOAD(PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC, glNamedFramebufferDrawBuffers);
+    lx_glNamedFramebufferParameteri = LOAD(PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC, glNamedFramebufferParameteri);
+    lx_glNamedFramebufferReadBuffer = LOAD(PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC, glNamedFramebufferReadBuffer);
+    lx_glNamedFramebufferRenderbuffer = LOAD(PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC, glNamedFramebufferRenderbuffer);
+    lx_glNamedFramebufferTexture = LOAD(PFNGLNAMEDFRAMEBUFFERTEXTUREPROC, glNamedFramebufferTexture);
+    lx_glNamedFramebufferTextureLayer = LOAD(PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC, glNamedFramebufferTextureLayer);
+    lx_glNamedRenderbufferStorage = LOAD(PFNGLNAMEDRENDERBUFFERSTORAGEPROC, glNamedRenderbufferStorage);
+    lx_glNamedRenderbufferStorageMultisample = LOAD(PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC, glNamedRenderbufferStorageMultisample);
+    lx_glReadnPixels = LOAD(PFNGLREADNPIXELSPROC, glReadnPixels);
+    lx_glTextureBarrier = LOAD(PFNGLTEXTUREBARRIERPROC, glTextureBarrier);
+    lx_glTextureBuffer = LOAD(PFNGLTEXTUREBUFFERPROC, glTextureBuffer);
+    lx_glTextureBufferRange = LOAD(PFNGLTEXTUREBUFFERRANGEPROC, glTextureBufferRange);
+    lx_glTextureParameterIiv = LOAD(PFNGLTEXTUREPARAMETERIIVPROC, glTextureParameterIiv);
+    lx_glTextureParameterIuiv = LOAD(PFNGLTEXTUREPARAMETERIUIVPROC, glTextureParameterIuiv);
+    lx_glTextureParameterf = LOAD(PFNGLTEXTUREPARAMETERFPROC, glTextureParameterf);
+    lx_glTextureParameterfv = LOAD(PFNGLTEXTUREPARAMETERFVPROC, glTextureParameterfv);
+    lx_glTextureParameteri = LOAD(PFNGLTEXTUREPARAMETERIPROC, glTextureParameteri);
+    lx_glTextureParameteriv = LOAD(PFNGLTEXTUREPARAMETERIVPROC, glTextureParameteriv);
+    lx_glTextureStorage1D = LOAD(PFNGLTEXTURESTORAGE1DPROC, glTextureStorage1D);
+    lx_glTextureStorage2D = LOAD(PFNGLTEXTURESTORAGE2DPROC, glTextureStorage2D);
+    lx_glTextureStorage2DMultisample = LOAD(PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC, glTextureStorage2DMultisample);
+    lx_glTextureStorage3D = LOAD(PFNGLTEXTURESTORAGE3DPROC, glTextureStorage3D);
+    lx_glTextureStorage3DMultisample = LOAD(PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC, glTextureStorage3DMultisample);
+    lx_glTextureSubImage1D = LOAD(PFNGLTEXTURESUBIMAGE1DPROC, glTextureSubImage1D);
+    lx_glTextureSubImage2D = LOAD(PFNGLTEXTURESUBIMAGE2DPROC, glTextureSubImage2D);
+    lx_glTextureSubImage3D = LOAD(PFNGLTEXTURESUBIMAGE3DPROC, glTextureSubImage3D);
+    lx_glTransformFeedbackBufferBase = LOAD(PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC, glTransformFeedbackBufferBase);
+    lx_glTransformFeedbackBufferRange = LOAD(PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC, glTransformFeedbackBufferRange);
+    lx_glUnmapNamedBuffer = LOAD(PFNGLUNMAPNAMEDBUFFERPROC, glUnmapNamedBuffer);
+    lx_glVertexArrayAttribBinding = LOAD(PFNGLVERTEXARRAYATTRIBBINDINGPROC, glVertexArrayAttribBinding);
+    lx_glVertexArrayAttribFormat = LOAD(PFNGLVERTEXARRAYATTRIBFORMATPROC, glVertexArrayAttribFormat);
+    lx_glVertexArrayAttribIFormat = LOAD(PFNGLVERTEXARRAYATTRIBIFORMATPROC, glVertexArrayAttribIFormat);
+    lx_glVertexArrayAttribLFormat = LOAD(PFNGLVERTEXARRAYATTRIBLFORMATPROC, glVertexArrayAttribLFormat);
+    lx_glVertexArrayBindingDivisor = LOAD(PFNGLVERTEXARRAYBINDINGDIVISORPROC, glVertexArrayBindingDivisor);
+    lx_glVertexArrayElementBuffer = LOAD(PFNGLVERTEXARRAYELEMENTBUFFERPROC, glVertexArrayElementBuffer);
+    lx_glVertexArrayVertexBuffer = LOAD(PFNGLVERTEXARRAYVERTEXBUFFERPROC, glVertexArrayVertexBuffer);
+    lx_glVertexArrayVertexBuffers = LOAD(PFNGLVERTEXARRAYVERTEXBUFFERSPROC, glVertexArrayVertexBuffers);
 }
 
 PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC lx_glMultiDrawArraysIndirectCount = NULL;
@@ -1492,19 +2228,49 @@ PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC lx_glMultiDrawElementsIndirectCount = NU
 PFNGLPOLYGONOFFSETCLAMPPROC lx_glPolygonOffsetClamp = NULL;
 PFNGLSPECIALIZESHADERPROC lx_glSpecializeShader = NULL;
 
-static void load_4_6(int load)
+STUB_VOID(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, glMultiDrawArraysIndirectCount, (GLenum mode, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, indirect, drawcount, maxdrawcount, stride))
+STUB_VOID(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, glMultiDrawElementsIndirectCount, (GLenum mode, GLenum type, const void* indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride), (mode, type, indirect, drawcount, maxdrawcount, stride))
+STUB_VOID(PFNGLPOLYGONOFFSETCLAMPPROC, glPolygonOffsetClamp, (GLfloat factor, GLfloat units, GLfloat clamp), (factor, units, clamp))
+STUB_VOID(PFNGLSPECIALIZESHADERPROC, glSpecializeShader, (GLuint shader, const GLchar* pEntryPoint, GLuint numSpecializationConstants, const GLuint* pConstantIndex, const GLuint* pConstantValue), (shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue))
+
+static void load_4_6(int mode)
 {
     if (!v4_6) return;
-    lx_glMultiDrawArraysIndirectCount = load ? (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC) load_proc("glMultiDrawArraysIndirectCount") : NULL;
-    lx_glMultiDrawElementsIndirectCount = load ? (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC) load_proc("glMultiDrawElementsIndirectCount") : NULL;
-    lx_glPolygonOffsetClamp = load ? (PFNGLPOLYGONOFFSETCLAMPPROC) load_proc("glPolygonOffsetClamp") : NULL;
-    lx_glSpecializeShader = load ? (PFNGLSPECIALIZESHADERPROC) load_proc("glSpecializeShader") : NULL;
+    lx_glMultiDrawArraysIndirectCount = LOAD(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC, glMultiDrawArraysIndirectCount);
+    lx_glMultiDrawElementsIndirectCount = LOAD(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC, glMultiDrawElementsIndirectCount);
+    lx_glPolygonOffsetClamp = LOAD(PFNGLPOLYGONOFFSETCLAMPPROC, glPolygonOffsetClamp);
+    lx_glSpecializeShader = LOAD(PFNGLSPECIALIZESHADERPROC, glSpecializeShader);
 }
 
-// private header
-// ----------------------------------------------------------------
+// the mode the functions were last loaded with
+static int loaded_mode = GL_UNLOAD;
 
-int gl_load()
+static void load_all(int mode)
+{
+    loaded_mode = mode;
+
+    load_1_0(mode);
+    load_1_1(mode);
+    load_1_2(mode);
+    load_1_3(mode);
+    load_1_4(mode);
+    load_1_5(mode);
+    load_2_0(mode);
+    load_2_1(mode);
+    load_3_0(mode);
+    load_3_1(mode);
+    load_3_2(mode);
+    load_3_3(mode);
+    load_4_0(mode);
+    load_4_1(mode);
+    load_4_2(mode);
+    load_4_3(mode);
+    load_4_4(mode);
+    load_4_5(mode);
+    load_4_6(mode);
+}
+
+static int load_driver(int lazy)
 {
     lx_glGetString = (PFNGLGETSTRINGPROC) load_proc("glGetString");
     if (!lx_glGetString)
@@ -1519,51 +2285,54 @@ int gl_load()
         lx_error("failed to query supported opengl version");
         return 0;
     }
-    
-    load_1_0(1);
-    load_1_1(1);
-    load_1_2(1);
-    load_1_3(1);
-    load_1_4(1);
-    load_1_5(1);
-    load_2_0(1);
-    load_2_1(1);
-    load_3_0(1);
-    load_3_1(1);
-    load_3_2(1);
-    load_3_3(1);
-    load_4_0(1);
-    load_4_1(1);
-    load_4_2(1);
-    load_4_3(1);
-    load_4_4(1);
-    load_4_5(1);
-    load_4_6(1);
 
+    load_all(lazy ? GL_LOAD_LAZY : GL_LOAD_EAGER);
     return 1;
 }
 
+// private header
+// ----------------------------------------------------------------
+
+int gl_load(lx_gl_backend backend, int lazy)
+{
+    // without a driver to ask, the null backends claim the requested or the
+    // newest version
+    if (backend != LX_GL_BACKEND_DRIVER)
+    {
+        int major = lt_props.gl_major != 0 ? lt_props.gl_major : 4;
+        int minor = lt_props.gl_major != 0 ? lt_props.gl_minor : 6;
+        lt_store->gl_version = set_supported_gl_version(major, minor);
+        load_all(GL_LOAD_NULL);
+        gl_null_install(backend == LX_GL_BACKEND_RECORDING);
+    }
+    else if (!load_driver(lazy))
+        return 0;
+
+    if (!gl_caps_load())
+        return 0;
+
+    // the state cache wraps whichever functions were loaded
+    if (lt_props.gl_state_cache)
+        gl_state_install();
+
+    return 1;
+}
+
+gl_proc gl_resolve(const char* name, gl_proc current)
+{
+    if (loaded_mode != GL_LOAD_LAZY || current == NULL)
+        return current;
+
+    gl_proc proc = (gl_proc) load_proc(name);
+    return proc != NULL ? proc : current;
+}
+
 void gl_unload()
 {
+    gl_caps_unload();
     lt_store->gl_version = 0; 
-    
-    load_1_0(0);
-    load_1_1(0);
-    load_1_2(0);
-    load_1_3(0);
-    load_1_4(0);
-    load_1_5(0);
-    load_2_0(0);
-    load_2_1(0);
-    load_3_0(0);
-    load_3_1(0);
-    load_3_2(0);
-    load_3_3(0);
-    load_4_0(0);
-    load_4_1(0);
-    load_4_2(0);
-    load_4_3(0);
-    load_4_4(0);
-    load_4_5(0);
-    load_4_6(0);
+
+    load_all(GL_UNLOAD);
+    gl_null_uninstall();
+    gl_state_uninstall();
 }
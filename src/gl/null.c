@@ -0,0 +1,471 @@
+#include "lux/gl.h"
+#include "lux/core.h"
+#include "lux/debug.h"
+#include "gl.h"
+#include "../core/core.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+static int recording = 0;
+static const char** calls = NULL;
+static size_t call_count = 0;
+static size_t call_capacity = 0;
+
+// the version the loader settled on, which the context claims to be
+static GLint major_version = 0;
+static GLint minor_version = 0;
+static char version_string[32] = "";
+static char glsl_version_string[8] = "";
+
+// names handed out by every gen and create function, shared so no two
+// objects of any kind are given the same one
+static GLuint next_name = 0;
+
+// memory handed out by the map functions, grown to the largest range
+static void* mapped = NULL;
+static size_t mapped_size = 0;
+
+// the largest store given to any buffer, which a map of a whole buffer
+// never reaches past
+static GLsizeiptr largest_buffer = 0;
+
+static void gen_names(GLsizei n, GLuint* names)
+{
+    for (GLsizei i = 0; i < n; i++)
+        names[i] = ++next_name;
+}
+
+static void* map_range(GLsizeiptr length)
+{
+    if ((size_t)length > mapped_size)
+    {
+        void* grown = realloc(mapped, (size_t)length);
+        if (grown == NULL)
+        {
+            lx_error("failed to allocate %zu bytes of mapped buffer memory", (size_t)length);
+            return NULL;
+        }
+
+        mapped = grown;
+        mapped_size = (size_t)length;
+    }
+
+    return mapped;
+}
+
+// the functions whose results a caller goes on to use, the rest keep the
+// stubs returning zero, which is also GL_NO_ERROR and GL_FALSE
+
+#define GEN(name)                                                           \
+    static void LX_GL_API fake_##name(GLsizei n, GLuint* names)             \
+    {                                                                       \
+        gl_null_record(#name);                                              \
+        gen_names(n, names);                                                \
+    }
+
+#define GEN_TARGET(name)                                                    \
+    static void LX_GL_API fake_##name(GLenum target, GLsizei n, GLuint* names) \
+    {                                                                       \
+        (void)target;                                                       \
+        gl_null_record(#name);                                              \
+        gen_names(n, names);                                                \
+    }
+
+GEN(glGenBuffers)
+GEN(glGenTextures)
+GEN(glGenQueries)
+GEN(glGenFramebuffers)
+GEN(glGenRenderbuffers)
+GEN(glGenVertexArrays)
+GEN(glGenSamplers)
+GEN(glGenTransformFeedbacks)
+GEN(glGenProgramPipelines)
+GEN(glCreateBuffers)
+GEN(glCreateFramebuffers)
+GEN(glCreateProgramPipelines)
+GEN(glCreateRenderbuffers)
+GEN(glCreateSamplers)
+GEN(glCreateTransformFeedbacks)
+GEN(glCreateVertexArrays)
+GEN_TARGET(glCreateTextures)
+GEN_TARGET(glCreateQueries)
+
+static GLuint LX_GL_API fake_glCreateShader(GLenum type)
+{
+    (void)type;
+    gl_null_record("glCreateShader");
+    return ++next_name;
+}
+
+static GLuint LX_GL_API fake_glCreateProgram()
+{
+    gl_null_record("glCreateProgram");
+    return ++next_name;
+}
+
+static GLuint LX_GL_API fake_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar* const* strings)
+{
+    (void)type;
+    (void)count;
+    (void)strings;
+    gl_null_record("glCreateShaderProgramv");
+    return ++next_name;
+}
+
+static GLubyte* LX_GL_API fake_glGetString(GLenum name)
+{
+    gl_null_record("glGetString");
+
+    switch (name)
+    {
+    case GL_VERSION: return (GLubyte*)version_string;
+    case GL_VENDOR: return (GLubyte*)"lux";
+    case GL_RENDERER: return (GLubyte*)"lux null";
+    case GL_SHADING_LANGUAGE_VERSION: return (GLubyte*)glsl_version_string;
+    default: return (GLubyte*)"";
+    }
+}
+
+static GLubyte* LX_GL_API fake_glGetStringi(GLenum name, GLuint index)
+{
+    (void)name;
+    (void)index;
+    gl_null_record("glGetStringi");
+    return (GLubyte*)"";
+}
+
+static void LX_GL_API fake_glGetIntegerv(GLenum pname, GLint* data)
+{
+    gl_null_record("glGetIntegerv");
+
+    switch (pname)
+    {
+    case GL_MAJOR_VERSION: data[0] = major_version; break;
+    case GL_MINOR_VERSION: data[0] = minor_version; break;
+    case GL_MAX_TEXTURE_SIZE: data[0] = 16384; break;
+    case GL_MAX_3D_TEXTURE_SIZE: data[0] = 2048; break;
+    case GL_MAX_CUBE_MAP_TEXTURE_SIZE: data[0] = 16384; break;
+    case GL_MAX_ARRAY_TEXTURE_LAYERS: data[0] = 2048; break;
+    case GL_MAX_RENDERBUFFER_SIZE: data[0] = 16384; break;
+    case GL_MAX_SAMPLES: data[0] = 8; break;
+    case GL_MAX_COLOR_ATTACHMENTS: data[0] = 8; break;
+    case GL_MAX_DRAW_BUFFERS: data[0] = 8; break;
+    case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = 32; break;
+    case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS: data[0] = 192; break;
+    case GL_MAX_VERTEX_ATTRIBS: data[0] = 16; break;
+    case GL_MAX_UNIFORM_BLOCK_SIZE: data[0] = 65536; break;
+    case GL_MAX_UNIFORM_BUFFER_BINDINGS: data[0] = 84; break;
+    case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT: data[0] = 256; break;
+    case GL_MAX_SHADER_STORAGE_BLOCK_SIZE: data[0] = 134217728; break;
+    case GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS: data[0] = 16; break;
+    case GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT: data[0] = 16; break;
+    case GL_MAX_VIEWPORT_DIMS:
+    case GL_VIEWPORT_BOUNDS_RANGE:
+    case GL_DEPTH_RANGE:
+    case GL_POINT_SIZE_RANGE:
+    case GL_ALIASED_LINE_WIDTH_RANGE:
+    case GL_SMOOTH_LINE_WIDTH_RANGE:
+    case GL_POLYGON_MODE: memset(data, 0, 2 * sizeof(GLint)); break;
+    case GL_VIEWPORT:
+    case GL_SCISSOR_BOX:
+    case GL_COLOR_CLEAR_VALUE:
+    case GL_COLOR_WRITEMASK:
+    case GL_BLEND_COLOR: memset(data, 0, 4 * sizeof(GLint)); break;
+    default: data[0] = 0; break;
+    }
+}
+
+static void LX_GL_API fake_glGetFloatv(GLenum pname, GLfloat* data)
+{
+    gl_null_record("glGetFloatv");
+
+    switch (pname)
+    {
+    case GL_MAX_TEXTURE_MAX_ANISOTROPY: data[0] = 16.0f; break;
+    case GL_MAX_VIEWPORT_DIMS:
+    case GL_VIEWPORT_BOUNDS_RANGE:
+    case GL_DEPTH_RANGE:
+    case GL_POINT_SIZE_RANGE:
+    case GL_ALIASED_LINE_WIDTH_RANGE:
+    case GL_SMOOTH_LINE_WIDTH_RANGE:
+    case GL_POLYGON_MODE: memset(data, 0, 2 * sizeof(GLfloat)); break;
+    case GL_VIEWPORT:
+    case GL_SCISSOR_BOX:
+    case GL_COLOR_CLEAR_VALUE:
+    case GL_COLOR_WRITEMASK:
+    case GL_BLEND_COLOR: memset(data, 0, 4 * sizeof(GLfloat)); break;
+    default: data[0] = 0.0f; break;
+    }
+}
+
+// shaders compile, programs link and validate
+static GLint object_status(GLenum pname)
+{
+    return pname == GL_COMPILE_STATUS || pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS ? GL_TRUE : 0;
+}
+
+static void LX_GL_API fake_glGetShaderiv(GLuint shader, GLenum pname, GLint* params)
+{
+    (void)shader;
+    gl_null_record("glGetShaderiv");
+    params[0] = object_status(pname);
+}
+
+static void LX_GL_API fake_glGetProgramiv(GLuint program, GLenum pname, GLint* params)
+{
+    (void)program;
+    gl_null_record("glGetProgramiv");
+    params[0] = object_status(pname);
+}
+
+static GLenum LX_GL_API fake_glCheckFramebufferStatus(GLenum target)
+{
+    (void)target;
+    gl_null_record("glCheckFramebufferStatus");
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+static GLenum LX_GL_API fake_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target)
+{
+    (void)framebuffer;
+    (void)target;
+    gl_null_record("glCheckNamedFramebufferStatus");
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+static GLsync LX_GL_API fake_glFenceSync(GLenum condition, GLbitfield flags)
+{
+    (void)condition;
+    (void)flags;
+    gl_null_record("glFenceSync");
+    return (GLsync)(uintptr_t)++next_name;
+}
+
+static GLenum LX_GL_API fake_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+    (void)sync;
+    (void)flags;
+    (void)timeout;
+    gl_null_record("glClientWaitSync");
+    return GL_ALREADY_SIGNALED;
+}
+
+// buffer stores are only measured, for the maps of whole buffers
+static void store_buffer(GLsizeiptr size)
+{
+    if (size > largest_buffer)
+        largest_buffer = size;
+}
+
+static void LX_GL_API fake_glBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+    (void)target;
+    (void)data;
+    (void)usage;
+    gl_null_record("glBufferData");
+    store_buffer(size);
+}
+
+static void LX_GL_API fake_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void* data, GLenum usage)
+{
+    (void)buffer;
+    (void)data;
+    (void)usage;
+    gl_null_record("glNamedBufferData");
+    store_buffer(size);
+}
+
+static void LX_GL_API fake_glBufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+{
+    (void)target;
+    (void)data;
+    (void)flags;
+    gl_null_record("glBufferStorage");
+    store_buffer(size);
+}
+
+static void LX_GL_API fake_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void* data, GLbitfield flags)
+{
+    (void)buffer;
+    (void)data;
+    (void)flags;
+    gl_null_record("glNamedBufferStorage");
+    store_buffer(size);
+}
+
+static void* LX_GL_API fake_glMapBuffer(GLenum target, GLenum access)
+{
+    (void)target;
+    (void)access;
+    gl_null_record("glMapBuffer");
+    return map_range(largest_buffer);
+}
+
+static void* LX_GL_API fake_glMapNamedBuffer(GLuint buffer, GLenum access)
+{
+    (void)buffer;
+    (void)access;
+    gl_null_record("glMapNamedBuffer");
+    return map_range(largest_buffer);
+}
+
+static void* LX_GL_API fake_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    (void)target;
+    (void)offset;
+    (void)access;
+    gl_null_record("glMapBufferRange");
+    return map_range(length);
+}
+
+static void* LX_GL_API fake_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    (void)buffer;
+    (void)offset;
+    (void)access;
+    gl_null_record("glMapNamedBufferRange");
+    return map_range(length);
+}
+
+static GLboolean LX_GL_API fake_glUnmapBuffer(GLenum target)
+{
+    (void)target;
+    gl_null_record("glUnmapBuffer");
+    return GL_TRUE;
+}
+
+static GLboolean LX_GL_API fake_glUnmapNamedBuffer(GLuint buffer)
+{
+    (void)buffer;
+    gl_null_record("glUnmapNamedBuffer");
+    return GL_TRUE;
+}
+
+#define INSTALL(name)                                                       \
+    if (lx_##name != NULL)                                                  \
+        lx_##name = fake_##name
+
+// private header
+// ----------------------------------------------------------------
+
+void gl_null_install(int record)
+{
+    recording = record;
+    call_count = 0;
+    next_name = 0;
+    largest_buffer = 0;
+
+    int version = lt_store->gl_version;
+    major_version = version / 10000;
+    minor_version = version % 10000;
+    snprintf(version_string, sizeof(version_string), "%d.%d lux null", major_version, minor_version);
+
+    // glsl follows the gl version from 3.3, before it glsl had numbers of
+    // its own, and before 2.0 there was none
+    if (version >= 30003)
+        snprintf(glsl_version_string, sizeof(glsl_version_string), "%d.%d0", major_version, minor_version);
+    else if (version >= 20000)
+        snprintf(glsl_version_string, sizeof(glsl_version_string), "1.%d0", version >= 30000 ? 3 + minor_version : 1 + minor_version);
+    else
+        glsl_version_string[0] = '\0';
+
+    // functions past the version stay NULL, as the loader left them
+    INSTALL(glGenBuffers);
+    INSTALL(glGenTextures);
+    INSTALL(glGenQueries);
+    INSTALL(glGenFramebuffers);
+    INSTALL(glGenRenderbuffers);
+    INSTALL(glGenVertexArrays);
+    INSTALL(glGenSamplers);
+    INSTALL(glGenTransformFeedbacks);
+    INSTALL(glGenProgramPipelines);
+    INSTALL(glCreateBuffers);
+    INSTALL(glCreateFramebuffers);
+    INSTALL(glCreateProgramPipelines);
+    INSTALL(glCreateRenderbuffers);
+    INSTALL(glCreateSamplers);
+    INSTALL(glCreateTransformFeedbacks);
+    INSTALL(glCreateVertexArrays);
+    INSTALL(glCreateTextures);
+    INSTALL(glCreateQueries);
+    INSTALL(glCreateShader);
+    INSTALL(glCreateProgram);
+    INSTALL(glCreateShaderProgramv);
+    INSTALL(glGetString);
+    INSTALL(glGetStringi);
+    INSTALL(glGetIntegerv);
+    INSTALL(glGetFloatv);
+    INSTALL(glGetShaderiv);
+    INSTALL(glGetProgramiv);
+    INSTALL(glCheckFramebufferStatus);
+    INSTALL(glCheckNamedFramebufferStatus);
+    INSTALL(glFenceSync);
+    INSTALL(glClientWaitSync);
+    INSTALL(glBufferData);
+    INSTALL(glNamedBufferData);
+    INSTALL(glBufferStorage);
+    INSTALL(glNamedBufferStorage);
+    INSTALL(glMapBuffer);
+    INSTALL(glMapNamedBuffer);
+    INSTALL(glMapBufferRange);
+    INSTALL(glMapNamedBufferRange);
+    INSTALL(glUnmapBuffer);
+    INSTALL(glUnmapNamedBuffer);
+}
+
+void gl_null_uninstall()
+{
+    free(calls);
+    calls = NULL;
+    call_count = 0;
+    call_capacity = 0;
+    recording = 0;
+
+    free(mapped);
+    mapped = NULL;
+    mapped_size = 0;
+    largest_buffer = 0;
+}
+
+void gl_null_record(const char* name)
+{
+    if (!recording)
+        return;
+
+    if (call_count == call_capacity)
+    {
+        size_t capacity = call_capacity == 0 ? 1024 : call_capacity * 2;
+        const char** grown = realloc(calls, capacity * sizeof(const char*));
+        if (grown == NULL)
+        {
+            lx_error("failed to grow the recorded gl calls to %zu", capacity);
+            return;
+        }
+
+        calls = grown;
+        call_capacity = capacity;
+    }
+
+    calls[call_count++] = name;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+size_t lx_gl_get_recorded_calls(const char** names, size_t capacity)
+{
+    if (names != NULL && call_count > 0)
+        memcpy(names, calls, (capacity < call_count ? capacity : call_count) * sizeof(const char*));
+
+    return call_count;
+}
+
+void lx_gl_clear_recorded_calls()
+{
+    call_count = 0;
+}
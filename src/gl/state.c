@@ -0,0 +1,580 @@
+#include "lux/gl.h"
+#include "lux/core.h"
+#include "gl.h"
+
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// a name or enum no call can set, marking state the cache does not know
+#define UNKNOWN 0xffffffffu
+
+// textures are cached on this many units, calls beyond them pass through
+#define STATE_TEXTURE_UNITS 32
+
+#define BUFFER_TARGET_COUNT 14
+#define TEXTURE_TARGET_COUNT 11
+#define CAPABILITY_COUNT 16
+
+typedef struct _state_cache
+{
+    GLuint program;
+    GLuint vertex_array;
+    GLuint buffers[BUFFER_TARGET_COUNT];
+
+    GLuint active_texture;
+    GLuint textures[STATE_TEXTURE_UNITS][TEXTURE_TARGET_COUNT];
+
+    // 0 or 1 once known
+    GLuint capabilities[CAPABILITY_COUNT];
+
+    GLenum blend_src_rgb;
+    GLenum blend_dst_rgb;
+    GLenum blend_src_alpha;
+    GLenum blend_dst_alpha;
+    GLenum blend_equation_rgb;
+    GLenum blend_equation_alpha;
+
+    GLenum depth_func;
+    GLuint depth_mask;
+
+    int viewport_known;
+    GLint viewport[4];
+}
+state_cache;
+
+static int installed = 0;
+static state_cache cache;
+static lx_gl_state_counters counters = { 0, 0 };
+
+// the functions the wrappers forward to
+static PFNGLUSEPROGRAMPROC real_glUseProgram = NULL;
+static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray = NULL;
+static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays = NULL;
+static PFNGLBINDBUFFERPROC real_glBindBuffer = NULL;
+static PFNGLBINDBUFFERBASEPROC real_glBindBufferBase = NULL;
+static PFNGLBINDBUFFERRANGEPROC real_glBindBufferRange = NULL;
+static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers = NULL;
+static PFNGLACTIVETEXTUREPROC real_glActiveTexture = NULL;
+static PFNGLBINDTEXTUREPROC real_glBindTexture = NULL;
+static PFNGLBINDTEXTUREUNITPROC real_glBindTextureUnit = NULL;
+static PFNGLBINDTEXTURESPROC real_glBindTextures = NULL;
+static PFNGLDELETETEXTURESPROC real_glDeleteTextures = NULL;
+static PFNGLENABLEPROC real_glEnable = NULL;
+static PFNGLDISABLEPROC real_glDisable = NULL;
+static PFNGLENABLEIPROC real_glEnablei = NULL;
+static PFNGLDISABLEIPROC real_glDisablei = NULL;
+static PFNGLBLENDFUNCPROC real_glBlendFunc = NULL;
+static PFNGLBLENDFUNCSEPARATEPROC real_glBlendFuncSeparate = NULL;
+static PFNGLBLENDFUNCIPROC real_glBlendFunci = NULL;
+static PFNGLBLENDFUNCSEPARATEIPROC real_glBlendFuncSeparatei = NULL;
+static PFNGLBLENDEQUATIONPROC real_glBlendEquation = NULL;
+static PFNGLBLENDEQUATIONSEPARATEPROC real_glBlendEquationSeparate = NULL;
+static PFNGLBLENDEQUATIONIPROC real_glBlendEquationi = NULL;
+static PFNGLBLENDEQUATIONSEPARATEIPROC real_glBlendEquationSeparatei = NULL;
+static PFNGLDEPTHFUNCPROC real_glDepthFunc = NULL;
+static PFNGLDEPTHMASKPROC real_glDepthMask = NULL;
+static PFNGLVIEWPORTPROC real_glViewport = NULL;
+static PFNGLVIEWPORTINDEXEDFPROC real_glViewportIndexedf = NULL;
+static PFNGLVIEWPORTINDEXEDFVPROC real_glViewportIndexedfv = NULL;
+static PFNGLVIEWPORTARRAYVPROC real_glViewportArrayv = NULL;
+
+static void invalidate()
+{
+    memset(&cache, 0xff, sizeof(cache));
+    cache.viewport_known = 0;
+}
+
+// counts a call, returning 1 if it should reach the driver
+static int issue(int changed)
+{
+    if (changed)
+        counters.issued++;
+    else
+        counters.filtered++;
+
+    return changed;
+}
+
+static int buffer_target(GLenum target)
+{
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER: return 0;
+    case GL_ELEMENT_ARRAY_BUFFER: return 1;
+    case GL_UNIFORM_BUFFER: return 2;
+    case GL_SHADER_STORAGE_BUFFER: return 3;
+    case GL_COPY_READ_BUFFER: return 4;
+    case GL_COPY_WRITE_BUFFER: return 5;
+    case GL_PIXEL_PACK_BUFFER: return 6;
+    case GL_PIXEL_UNPACK_BUFFER: return 7;
+    case GL_DRAW_INDIRECT_BUFFER: return 8;
+    case GL_DISPATCH_INDIRECT_BUFFER: return 9;
+    case GL_TEXTURE_BUFFER: return 10;
+    case GL_TRANSFORM_FEEDBACK_BUFFER: return 11;
+    case GL_ATOMIC_COUNTER_BUFFER: return 12;
+    case GL_QUERY_BUFFER: return 13;
+    default: return -1;
+    }
+}
+
+static int texture_target(GLenum target)
+{
+    switch (target)
+    {
+    case GL_TEXTURE_2D: return 0;
+    case GL_TEXTURE_3D: return 1;
+    case GL_TEXTURE_CUBE_MAP: return 2;
+    case GL_TEXTURE_2D_ARRAY: return 3;
+    case GL_TEXTURE_CUBE_MAP_ARRAY: return 4;
+    case GL_TEXTURE_1D: return 5;
+    case GL_TEXTURE_1D_ARRAY: return 6;
+    case GL_TEXTURE_RECTANGLE: return 7;
+    case GL_TEXTURE_BUFFER: return 8;
+    case GL_TEXTURE_2D_MULTISAMPLE: return 9;
+    case GL_TEXTURE_2D_MULTISAMPLE_ARRAY: return 10;
+    default: return -1;
+    }
+}
+
+static int capability(GLenum cap)
+{
+    switch (cap)
+    {
+    case GL_BLEND: return 0;
+    case GL_DEPTH_TEST: return 1;
+    case GL_CULL_FACE: return 2;
+    case GL_SCISSOR_TEST: return 3;
+    case GL_STENCIL_TEST: return 4;
+    case GL_POLYGON_OFFSET_FILL: return 5;
+    case GL_MULTISAMPLE: return 6;
+    case GL_SAMPLE_ALPHA_TO_COVERAGE: return 7;
+    case GL_FRAMEBUFFER_SRGB: return 8;
+    case GL_DEPTH_CLAMP: return 9;
+    case GL_PRIMITIVE_RESTART: return 10;
+    case GL_PRIMITIVE_RESTART_FIXED_INDEX: return 11;
+    case GL_RASTERIZER_DISCARD: return 12;
+    case GL_PROGRAM_POINT_SIZE: return 13;
+    case GL_TEXTURE_CUBE_MAP_SEAMLESS: return 14;
+    case GL_DEBUG_OUTPUT: return 15;
+    default: return -1;
+    }
+}
+
+// the bindings of the active unit, or NULL beyond the cached units
+static GLuint* active_textures()
+{
+    GLuint unit = cache.active_texture - GL_TEXTURE0;
+    return cache.active_texture != UNKNOWN && unit < STATE_TEXTURE_UNITS ? cache.textures[unit] : NULL;
+}
+
+static void LX_GL_API cached_glUseProgram(GLuint program)
+{
+    if (issue(cache.program != program))
+    {
+        cache.program = program;
+        real_glUseProgram(program);
+    }
+}
+
+// the element array binding belongs to the vertex array
+static void LX_GL_API cached_glBindVertexArray(GLuint array)
+{
+    if (issue(cache.vertex_array != array))
+    {
+        cache.vertex_array = array;
+        cache.buffers[1] = UNKNOWN;
+        real_glBindVertexArray(array);
+    }
+}
+
+// deleting the bound vertex array reverts the binding to 0
+static void LX_GL_API cached_glDeleteVertexArrays(GLsizei n, const GLuint* arrays)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        if (arrays[i] != 0 && arrays[i] == cache.vertex_array)
+        {
+            cache.vertex_array = 0;
+            cache.buffers[1] = UNKNOWN;
+        }
+    }
+
+    real_glDeleteVertexArrays(n, arrays);
+}
+
+static void LX_GL_API cached_glBindBuffer(GLenum target, GLuint buffer)
+{
+    int t = buffer_target(target);
+    if (t < 0)
+    {
+        issue(1);
+        real_glBindBuffer(target, buffer);
+        return;
+    }
+
+    if (issue(cache.buffers[t] != buffer))
+    {
+        cache.buffers[t] = buffer;
+        real_glBindBuffer(target, buffer);
+    }
+}
+
+// the indexed bindings are not cached, but they also bind the generic one
+static void LX_GL_API cached_glBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    int t = buffer_target(target);
+    if (t >= 0)
+        cache.buffers[t] = buffer;
+
+    issue(1);
+    real_glBindBufferBase(target, index, buffer);
+}
+
+static void LX_GL_API cached_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+    int t = buffer_target(target);
+    if (t >= 0)
+        cache.buffers[t] = buffer;
+
+    issue(1);
+    real_glBindBufferRange(target, index, buffer, offset, size);
+}
+
+// deleted names are unbound and may be handed out again
+static void LX_GL_API cached_glDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        for (int t = 0; t < BUFFER_TARGET_COUNT; t++)
+        {
+            if (buffers[i] != 0 && cache.buffers[t] == buffers[i])
+                cache.buffers[t] = 0;
+        }
+    }
+
+    real_glDeleteBuffers(n, buffers);
+}
+
+static void LX_GL_API cached_glActiveTexture(GLenum texture)
+{
+    if (issue(cache.active_texture != texture))
+    {
+        cache.active_texture = texture;
+        real_glActiveTexture(texture);
+    }
+}
+
+static void LX_GL_API cached_glBindTexture(GLenum target, GLuint texture)
+{
+    GLuint* unit = active_textures();
+    int t = texture_target(target);
+    if (unit == NULL || t < 0)
+    {
+        issue(1);
+        real_glBindTexture(target, texture);
+        return;
+    }
+
+    if (issue(unit[t] != texture))
+    {
+        unit[t] = texture;
+        real_glBindTexture(target, texture);
+    }
+}
+
+// these bind by the texture's own target, which the cache does not know, so
+// the units they touch are forgotten
+static void LX_GL_API cached_glBindTextureUnit(GLuint unit, GLuint texture)
+{
+    if (unit < STATE_TEXTURE_UNITS)
+        memset(cache.textures[unit], 0xff, sizeof(cache.textures[unit]));
+
+    issue(1);
+    real_glBindTextureUnit(unit, texture);
+}
+
+static void LX_GL_API cached_glBindTextures(GLuint first, GLsizei count, const GLuint* textures)
+{
+    for (GLsizei i = 0; i < count; i++)
+    {
+        if (first + i < STATE_TEXTURE_UNITS)
+            memset(cache.textures[first + i], 0xff, sizeof(cache.textures[first + i]));
+    }
+
+    issue(1);
+    real_glBindTextures(first, count, textures);
+}
+
+static void LX_GL_API cached_glDeleteTextures(GLsizei n, const GLuint* textures)
+{
+    for (GLsizei i = 0; i < n; i++)
+    {
+        for (int u = 0; u < STATE_TEXTURE_UNITS; u++)
+        {
+            for (int t = 0; t < TEXTURE_TARGET_COUNT; t++)
+            {
+                if (textures[i] != 0 && cache.textures[u][t] == textures[i])
+                    cache.textures[u][t] = 0;
+            }
+        }
+    }
+
+    real_glDeleteTextures(n, textures);
+}
+
+static void LX_GL_API cached_glEnable(GLenum cap)
+{
+    int c = capability(cap);
+    if (issue(c < 0 || cache.capabilities[c] != 1))
+    {
+        if (c >= 0)
+            cache.capabilities[c] = 1;
+
+        real_glEnable(cap);
+    }
+}
+
+static void LX_GL_API cached_glDisable(GLenum cap)
+{
+    int c = capability(cap);
+    if (issue(c < 0 || cache.capabilities[c] != 0))
+    {
+        if (c >= 0)
+            cache.capabilities[c] = 0;
+
+        real_glDisable(cap);
+    }
+}
+
+// the indexed versions split a capability between draw buffers, after which
+// it is no longer one cached value
+static void LX_GL_API cached_glEnablei(GLenum target, GLuint index)
+{
+    int c = capability(target);
+    if (c >= 0)
+        cache.capabilities[c] = UNKNOWN;
+
+    issue(1);
+    real_glEnablei(target, index);
+}
+
+static void LX_GL_API cached_glDisablei(GLenum target, GLuint index)
+{
+    int c = capability(target);
+    if (c >= 0)
+        cache.capabilities[c] = UNKNOWN;
+
+    issue(1);
+    real_glDisablei(target, index);
+}
+
+static int set_blend_func(GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha)
+{
+    if (cache.blend_src_rgb == src_rgb && cache.blend_dst_rgb == dst_rgb && cache.blend_src_alpha == src_alpha && cache.blend_dst_alpha == dst_alpha)
+        return issue(0);
+
+    cache.blend_src_rgb = src_rgb;
+    cache.blend_dst_rgb = dst_rgb;
+    cache.blend_src_alpha = src_alpha;
+    cache.blend_dst_alpha = dst_alpha;
+    return issue(1);
+}
+
+static int set_blend_equation(GLenum rgb, GLenum alpha)
+{
+    if (cache.blend_equation_rgb == rgb && cache.blend_equation_alpha == alpha)
+        return issue(0);
+
+    cache.blend_equation_rgb = rgb;
+    cache.blend_equation_alpha = alpha;
+    return issue(1);
+}
+
+static void LX_GL_API cached_glBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    if (set_blend_func(sfactor, dfactor, sfactor, dfactor))
+        real_glBlendFunc(sfactor, dfactor);
+}
+
+static void LX_GL_API cached_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+    if (set_blend_func(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha))
+        real_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void LX_GL_API cached_glBlendFunci(GLuint buf, GLenum src, GLenum dst)
+{
+    cache.blend_src_rgb = UNKNOWN;
+    issue(1);
+    real_glBlendFunci(buf, src, dst);
+}
+
+static void LX_GL_API cached_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    cache.blend_src_rgb = UNKNOWN;
+    issue(1);
+    real_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void LX_GL_API cached_glBlendEquation(GLenum mode)
+{
+    if (set_blend_equation(mode, mode))
+        real_glBlendEquation(mode);
+}
+
+static void LX_GL_API cached_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
+{
+    if (set_blend_equation(modeRGB, modeAlpha))
+        real_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void LX_GL_API cached_glBlendEquationi(GLuint buf, GLenum mode)
+{
+    cache.blend_equation_rgb = UNKNOWN;
+    issue(1);
+    real_glBlendEquationi(buf, mode);
+}
+
+static void LX_GL_API cached_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+    cache.blend_equation_rgb = UNKNOWN;
+    issue(1);
+    real_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static void LX_GL_API cached_glDepthFunc(GLenum func)
+{
+    if (issue(cache.depth_func != func))
+    {
+        cache.depth_func = func;
+        real_glDepthFunc(func);
+    }
+}
+
+static void LX_GL_API cached_glDepthMask(GLboolean flag)
+{
+    GLuint mask = flag != GL_FALSE;
+    if (issue(cache.depth_mask != mask))
+    {
+        cache.depth_mask = mask;
+        real_glDepthMask(flag);
+    }
+}
+
+static void LX_GL_API cached_glViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    int same = cache.viewport_known && cache.viewport[0] == x && cache.viewport[1] == y && cache.viewport[2] == width && cache.viewport[3] == height;
+    if (issue(!same))
+    {
+        cache.viewport_known = 1;
+        cache.viewport[0] = x;
+        cache.viewport[1] = y;
+        cache.viewport[2] = width;
+        cache.viewport[3] = height;
+        real_glViewport(x, y, width, height);
+    }
+}
+
+// the indexed versions may set the first viewport with float bounds
+static void LX_GL_API cached_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+    if (index == 0)
+        cache.viewport_known = 0;
+
+    issue(1);
+    real_glViewportIndexedf(index, x, y, w, h);
+}
+
+static void LX_GL_API cached_glViewportIndexedfv(GLuint index, const GLfloat* v)
+{
+    if (index == 0)
+        cache.viewport_known = 0;
+
+    issue(1);
+    real_glViewportIndexedfv(index, v);
+}
+
+static void LX_GL_API cached_glViewportArrayv(GLuint first, GLsizei count, const GLfloat* v)
+{
+    if (first == 0 && count > 0)
+        cache.viewport_known = 0;
+
+    issue(1);
+    real_glViewportArrayv(first, count, v);
+}
+
+// functions the context version lacks stay NULL
+#define WRAP(type, name)                                                    \
+    if (lx_##name != NULL)                                                  \
+    {                                                                       \
+        real_##name = (type) gl_resolve(#name, (gl_proc) lx_##name);        \
+        lx_##name = cached_##name;                                          \
+    }
+
+// private header
+// ----------------------------------------------------------------
+
+void gl_state_install()
+{
+    WRAP(PFNGLUSEPROGRAMPROC, glUseProgram);
+    WRAP(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray);
+    WRAP(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays);
+    WRAP(PFNGLBINDBUFFERPROC, glBindBuffer);
+    WRAP(PFNGLBINDBUFFERBASEPROC, glBindBufferBase);
+    WRAP(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);
+    WRAP(PFNGLDELETEBUFFERSPROC, glDeleteBuffers);
+    WRAP(PFNGLACTIVETEXTUREPROC, glActiveTexture);
+    WRAP(PFNGLBINDTEXTUREPROC, glBindTexture);
+    WRAP(PFNGLBINDTEXTUREUNITPROC, glBindTextureUnit);
+    WRAP(PFNGLBINDTEXTURESPROC, glBindTextures);
+    WRAP(PFNGLDELETETEXTURESPROC, glDeleteTextures);
+    WRAP(PFNGLENABLEPROC, glEnable);
+    WRAP(PFNGLDISABLEPROC, glDisable);
+    WRAP(PFNGLENABLEIPROC, glEnablei);
+    WRAP(PFNGLDISABLEIPROC, glDisablei);
+    WRAP(PFNGLBLENDFUNCPROC, glBlendFunc);
+    WRAP(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate);
+    WRAP(PFNGLBLENDFUNCIPROC, glBlendFunci);
+    WRAP(PFNGLBLENDFUNCSEPARATEIPROC, glBlendFuncSeparatei);
+    WRAP(PFNGLBLENDEQUATIONPROC, glBlendEquation);
+    WRAP(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate);
+    WRAP(PFNGLBLENDEQUATIONIPROC, glBlendEquationi);
+    WRAP(PFNGLBLENDEQUATIONSEPARATEIPROC, glBlendEquationSeparatei);
+    WRAP(PFNGLDEPTHFUNCPROC, glDepthFunc);
+    WRAP(PFNGLDEPTHMASKPROC, glDepthMask);
+    WRAP(PFNGLVIEWPORTPROC, glViewport);
+    WRAP(PFNGLVIEWPORTINDEXEDFPROC, glViewportIndexedf);
+    WRAP(PFNGLVIEWPORTINDEXEDFVPROC, glViewportIndexedfv);
+    WRAP(PFNGLVIEWPORTARRAYVPROC, glViewportArrayv);
+
+    invalidate();
+    counters = (lx_gl_state_counters){ 0, 0 };
+    installed = 1;
+}
+
+void gl_state_uninstall()
+{
+    installed = 0;
+    counters = (lx_gl_state_counters){ 0, 0 };
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_gl_state_counters lx_gl_get_state_counters()
+{
+    return counters;
+}
+
+void lx_gl_reset_state_counters()
+{
+    counters = (lx_gl_state_counters){ 0, 0 };
+}
+
+void lx_gl_invalidate_state_cache()
+{
+    if (installed)
+        invalidate();
+}
@@ -0,0 +1,36 @@
+#include "lux/math.h"
+#include "math.h"
+#include "../debug/debug.h"
+
+// public header
+// ----------------------------------------------------------------
+
+void lx_mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count)
+{
+    GUARD(m == NULL || in == NULL || out == NULL, ("failed to transform vec4 array, null array or matrix"));
+    mt_kernels.mat4_mul_vec4_array(m, in, out, count);
+}
+
+void lx_mat4_mul_vec3_array(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w)
+{
+    GUARD(m == NULL || in == NULL || out == NULL, ("failed to transform vec3 array, null array or matrix"));
+    mt_kernels.mat4_mul_vec3_array(m, in, out, count, w);
+}
+
+void lx_mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count)
+{
+    GUARD(a == NULL || in == NULL || out == NULL, ("failed to multiply mat4 array, null array or matrix"));
+    mt_kernels.mat4_mul_array(a, in, out, count);
+}
+
+void lx_mat4_from_trs_array(const lx_vec3* translations, const lx_quat* rotations, const lx_vec3* scales, lx_mat4* out, size_t count)
+{
+    GUARD(translations == NULL || rotations == NULL || scales == NULL || out == NULL, ("failed to build trs matrices, null array"));
+    mt_kernels.mat4_from_trs_array(translations, rotations, scales, out, count);
+}
+
+void lx_mat4_normal_matrix_array(const lx_mat4* in, lx_mat3* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to compute normal matrices, null array"));
+    mt_kernels.mat4_normal_matrix_array(in, out, count);
+}
@@ -0,0 +1,202 @@
+#include "lux/math.h"
+#include "lux/debug.h"
+#include "math.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define CPU_X86
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+    #define CPU_X86
+#endif
+
+// private source
+// ----------------------------------------------------------------
+
+static int forced = 0;
+
+#ifdef CPU_X86
+
+static void cpuid(unsigned int leaf, unsigned int sub, unsigned int regs[4])
+{
+#ifdef _MSC_VER
+    __cpuidex((int*)regs, (int)leaf, (int)sub);
+#else
+    __cpuid_count(leaf, sub, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static unsigned long long xgetbv()
+{
+#ifdef _MSC_VER
+    return _xgetbv(0);
+#else
+    unsigned int lo, hi;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((unsigned long long)hi << 32) | lo;
+#endif
+}
+
+#endif
+
+static int is_supported(lx_simd_level level)
+{
+    switch (level)
+    {
+    case LX_SIMD_SCALAR:
+        return 1;
+
+#ifdef CPU_X86
+    case LX_SIMD_SSE2:
+    case LX_SIMD_SSE41:
+    case LX_SIMD_AVX2:
+    {
+        unsigned int regs[4];
+        cpuid(0, 0, regs);
+        unsigned int max_leaf = regs[0];
+
+        cpuid(1, 0, regs);
+        int sse2 = (regs[3] >> 26) & 1;
+        int sse41 = (regs[2] >> 19) & 1;
+        int fma = (regs[2] >> 12) & 1;
+        int osxsave = (regs[2] >> 27) & 1;
+        int avx = (regs[2] >> 28) & 1;
+
+        if (level == LX_SIMD_SSE2)
+            return sse2;
+
+        if (level == LX_SIMD_SSE41)
+            return sse2 && sse41;
+
+        // the os must also save the ymm registers across context switches
+        if (max_leaf < 7 || !osxsave || !avx || !fma || (xgetbv() & 0x6) != 0x6)
+            return 0;
+
+        cpuid(7, 0, regs);
+        return sse41 && ((regs[1] >> 5) & 1);
+    }
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    case LX_SIMD_NEON:
+        return 1;
+#endif
+
+    default:
+        return 0;
+    }
+}
+
+static int load_kernels(lx_simd_level level, math_kernels* k)
+{
+    load_scalar_kernels(k);
+
+    switch (level)
+    {
+    case LX_SIMD_SCALAR: return 1;
+    case LX_SIMD_SSE2: return load_sse2_kernels(k);
+    case LX_SIMD_SSE41: return load_sse41_kernels(k);
+    case LX_SIMD_AVX2: return load_avx2_kernels(k);
+    case LX_SIMD_NEON: return load_neon_kernels(k);
+    default: return 0;
+    }
+}
+
+static int select_kernels(lx_simd_level level)
+{
+    if (!is_supported(level))
+        return 0;
+
+    math_kernels k;
+    if (!load_kernels(level, &k))
+        return 0;
+
+    mt_kernels = k;
+    return 1;
+}
+
+// private header
+// ----------------------------------------------------------------
+
+math_kernels mt_kernels = {
+    .level = LX_SIMD_SCALAR,
+    .mat4_mul = scalar_mat4_mul,
+    .mat4_mul_vec4 = scalar_mat4_mul_vec4,
+    .mat4_inverse = scalar_mat4_inverse,
+    .mat4_inverse_affine = scalar_mat4_inverse_affine,
+    .mat4_inverse_rigid = scalar_mat4_inverse_rigid,
+    .mat4_mul_vec4_array = scalar_mat4_mul_vec4_array,
+    .mat4_mul_vec3_array = scalar_mat4_mul_vec3_array,
+    .mat4_mul_array = scalar_mat4_mul_array,
+    .mat4_normal_matrix_array = scalar_mat4_normal_matrix_array,
+    .mat4_from_trs_array = scalar_mat4_from_trs_array,
+    .float_array_add = scalar_float_array_add,
+    .float_array_sub = scalar_float_array_sub,
+    .float_array_scale = scalar_float_array_scale,
+    .float_array_lerp = scalar_float_array_lerp,
+    .float_array_clamp = scalar_float_array_clamp,
+    .float_array_min = scalar_float_array_min,
+    .float_array_max = scalar_float_array_max,
+    .vec2_stream_dot = scalar_vec2_stream_dot,
+    .vec3_stream_dot = scalar_vec3_stream_dot,
+    .vec3_stream_cross = scalar_vec3_stream_cross,
+    .vec2_stream_normalize = scalar_vec2_stream_normalize,
+    .vec3_stream_normalize = scalar_vec3_stream_normalize,
+    .vec2_stream_distance = scalar_vec2_stream_distance,
+    .vec3_stream_distance = scalar_vec3_stream_distance,
+    .frustum_cull_spheres = scalar_frustum_cull_spheres,
+    .frustum_cull_aabbs = scalar_frustum_cull_aabbs,
+    .bvh_raycast = scalar_bvh_raycast,
+    .sweep_pairs = scalar_sweep_pairs,
+    .skin_vertices = scalar_skin_vertices,
+    .anim_blend = scalar_anim_blend,
+    .pack_half = scalar_pack_half,
+    .pack_positions = scalar_pack_positions,
+    .pack_normals = scalar_pack_normals,
+    .pack_tangents = scalar_pack_tangents,
+    .pack_colors = scalar_pack_colors,
+    .rng_floats = scalar_rng_floats,
+    .rng_vec3 = scalar_rng_vec3,
+    .noise_simplex2 = scalar_noise_simplex2,
+    .noise_simplex3 = scalar_noise_simplex3
+};
+
+void math_init()
+{
+    if (forced)
+        return;
+
+    static const lx_simd_level preferred[] = { LX_SIMD_AVX2, LX_SIMD_SSE41, LX_SIMD_SSE2, LX_SIMD_NEON, LX_SIMD_SCALAR };
+
+    for (int i = 0; i < (int)(sizeof(preferred) / sizeof(preferred[0])); i++)
+    {
+        if (select_kernels(preferred[i]))
+            return;
+    }
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_simd_level lx_get_simd_level()
+{
+    return mt_kernels.level;
+}
+
+int lx_is_simd_level_supported(lx_simd_level level)
+{
+    math_kernels k;
+    return is_supported(level) && load_kernels(level, &k);
+}
+
+int lx_set_simd_level(lx_simd_level level)
+{
+    if (!select_kernels(level))
+    {
+        lx_error("failed to select simd level %d, it is not supported by this cpu or build", (int)level);
+        return 0;
+    }
+
+    forced = 1;
+    return 1;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+// animation kernels written against simd.h, included once by each kernel file
+// alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+// private source
+// ----------------------------------------------------------------
+
+static inline void rebuild_rotation(const float* const* q, size_t i, f32v* x, f32v* y, f32v* z, f32v* w)
+{
+    f32v one = f32v_set(1.0f);
+    f32v a = f32v_load(&q[0][i]);
+    f32v b = f32v_load(&q[1][i]);
+    f32v c = f32v_load(&q[2][i]);
+    f32v largest = f32v_load(&q[3][i]);
+
+    f32v rest = f32v_sub(one, f32v_madd(a, a, f32v_madd(b, b, f32v_mul(c, c))));
+    f32v d = f32v_sqrt(f32v_max(rest, f32v_set(0.0f)));
+
+    // the stored components fill the slots around the largest in order
+    f32v past_x = f32v_cmpge(largest, one);
+    f32v past_y = f32v_cmpge(largest, f32v_set(2.0f));
+    f32v past_z = f32v_cmpge(largest, f32v_set(3.0f));
+
+    *x = f32v_select(past_x, d, a);
+    *y = f32v_select(past_y, f32v_select(past_x, a, d), b);
+    *z = f32v_select(past_z, f32v_select(past_y, b, d), c);
+    *w = f32v_select(past_z, c, d);
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(anim_blend)(anim_batch* b, size_t count)
+{
+    f32v one = f32v_set(1.0f);
+    f32v minus_one = f32v_set(-1.0f);
+    f32v zero = f32v_set(0.0f);
+
+    for (size_t i = 0; i < count; i += F32V_WIDTH)
+    {
+        for (int c = 0; c < 6; c++)
+        {
+            f32v t = f32v_load(&b->vec_t[c / 3][i]);
+            f32v a = f32v_load(&b->vec_a[c][i]);
+            f32v_store(&b->vec_a[c][i], f32v_madd(f32v_sub(f32v_load(&b->vec_b[c][i]), a), t, a));
+        }
+
+        const float* qa[4] = { b->quat_a[0], b->quat_a[1], b->quat_a[2], b->quat_a[3] };
+        const float* qb[4] = { b->quat_b[0], b->quat_b[1], b->quat_b[2], b->quat_b[3] };
+
+        f32v ax, ay, az, aw, bx, by, bz, bw;
+        rebuild_rotation(qa, i, &ax, &ay, &az, &aw);
+        rebuild_rotation(qb, i, &bx, &by, &bz, &bw);
+
+        // the second key is flipped onto the same hemisphere for the short way round
+        f32v dot = f32v_madd(ax, bx, f32v_madd(ay, by, f32v_madd(az, bz, f32v_mul(aw, bw))));
+        f32v t = f32v_load(&b->quat_t[i]);
+        t = f32v_mul(t, f32v_select(f32v_cmpge(dot, zero), minus_one, one));
+
+        f32v s = f32v_sub(one, f32v_load(&b->quat_t[i]));
+        f32v x = f32v_madd(bx, t, f32v_mul(ax, s));
+        f32v y = f32v_madd(by, t, f32v_mul(ay, s));
+        f32v z = f32v_madd(bz, t, f32v_mul(az, s));
+        f32v w = f32v_madd(bw, t, f32v_mul(aw, s));
+
+        f32v length = f32v_sqrt(f32v_madd(x, x, f32v_madd(y, y, f32v_madd(z, z, f32v_mul(w, w)))));
+        f32v inv = f32v_div(one, length);
+
+        f32v_store(&b->quat_a[0][i], f32v_mul(x, inv));
+        f32v_store(&b->quat_a[1][i], f32v_mul(y, inv));
+        f32v_store(&b->quat_a[2][i], f32v_mul(z, inv));
+        f32v_store(&b->quat_a[3][i], f32v_mul(w, inv));
+    }
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_anim_kernels(math_kernels* k)
+{
+    k->anim_blend = KERNEL(anim_blend);
+}
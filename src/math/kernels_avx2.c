@@ -0,0 +1,139 @@
+#include "math.h"
+
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+
+#include "sse.h"
+#include <immintrin.h>
+
+#define KERNEL(name) avx2_##name
+#include "kernels_stream.h"
+#include "kernels_cull.h"
+#include "kernels_ray.h"
+#include "kernels_sweep.h"
+#include "kernels_skin.h"
+#include "kernels_anim.h"
+#include "kernels_pack.h"
+#include "kernels_random.h"
+#include "kernels_noise.h"
+
+// private source
+// ----------------------------------------------------------------
+
+static inline __m128 mat4_column_fma(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v)
+{
+    __m128 r = _mm_mul_ps(c0, SPLAT(v, 0));
+    r = _mm_fmadd_ps(c1, SPLAT(v, 1), r);
+    r = _mm_fmadd_ps(c2, SPLAT(v, 2), r);
+    return _mm_fmadd_ps(c3, SPLAT(v, 3), r);
+}
+
+// the single matrix kernels stay 128 bits wide, their operands usually come
+// straight from by-value copies on the stack where a 256 bit load would stall
+// on store forwarding
+
+static void mat4_mul(const lx_mat4* a, const lx_mat4* b, lx_mat4* out)
+{
+    __m128 a0 = _mm_loadu_ps(&a->m[0]);
+    __m128 a1 = _mm_loadu_ps(&a->m[4]);
+    __m128 a2 = _mm_loadu_ps(&a->m[8]);
+    __m128 a3 = _mm_loadu_ps(&a->m[12]);
+
+    __m128 b0 = _mm_loadu_ps(&b->m[0]);
+    __m128 b1 = _mm_loadu_ps(&b->m[4]);
+    __m128 b2 = _mm_loadu_ps(&b->m[8]);
+    __m128 b3 = _mm_loadu_ps(&b->m[12]);
+
+    _mm_storeu_ps(&out->m[0], mat4_column_fma(a0, a1, a2, a3, b0));
+    _mm_storeu_ps(&out->m[4], mat4_column_fma(a0, a1, a2, a3, b1));
+    _mm_storeu_ps(&out->m[8], mat4_column_fma(a0, a1, a2, a3, b2));
+    _mm_storeu_ps(&out->m[12], mat4_column_fma(a0, a1, a2, a3, b3));
+}
+
+static void mat4_mul_vec4(const lx_mat4* m, const lx_vec4* v, lx_vec4* out)
+{
+    __m128 r = mat4_column_fma(
+        _mm_loadu_ps(&m->m[0]),
+        _mm_loadu_ps(&m->m[4]),
+        _mm_loadu_ps(&m->m[8]),
+        _mm_loadu_ps(&m->m[12]),
+        _mm_loadu_ps(&v->x)
+    );
+
+    _mm_storeu_ps(&out->x, r);
+}
+
+// the array kernels read from caller memory, so they go 256 bits wide with
+// the low lane holding one column or vector and the high lane the next
+static inline __m256 mat4_column_pair(__m256 c0, __m256 c1, __m256 c2, __m256 c3, __m256 v)
+{
+    __m256 r = _mm256_mul_ps(c0, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+    r = _mm256_fmadd_ps(c1, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)), r);
+    r = _mm256_fmadd_ps(c2, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)), r);
+    return _mm256_fmadd_ps(c3, _mm256_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)), r);
+}
+
+static void mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count)
+{
+    __m256 c0 = _mm256_broadcast_ps((const __m128*)&m->m[0]);
+    __m256 c1 = _mm256_broadcast_ps((const __m128*)&m->m[4]);
+    __m256 c2 = _mm256_broadcast_ps((const __m128*)&m->m[8]);
+    __m256 c3 = _mm256_broadcast_ps((const __m128*)&m->m[12]);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2)
+        _mm256_storeu_ps(&out[i].x, mat4_column_pair(c0, c1, c2, c3, _mm256_loadu_ps(&in[i].x)));
+
+    if (i < count)
+        mat4_mul_vec4(m, &in[i], &out[i]);
+}
+
+static void mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count)
+{
+    __m256 a0 = _mm256_broadcast_ps((const __m128*)&a->m[0]);
+    __m256 a1 = _mm256_broadcast_ps((const __m128*)&a->m[4]);
+    __m256 a2 = _mm256_broadcast_ps((const __m128*)&a->m[8]);
+    __m256 a3 = _mm256_broadcast_ps((const __m128*)&a->m[12]);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        __m256 b01 = _mm256_loadu_ps(&in[i].m[0]);
+        __m256 b23 = _mm256_loadu_ps(&in[i].m[8]);
+
+        _mm256_storeu_ps(&out[i].m[0], mat4_column_pair(a0, a1, a2, a3, b01));
+        _mm256_storeu_ps(&out[i].m[8], mat4_column_pair(a0, a1, a2, a3, b23));
+    }
+}
+
+// private header
+// ----------------------------------------------------------------
+
+int load_avx2_kernels(math_kernels* k)
+{
+    if (!load_sse41_kernels(k))
+        return 0;
+
+    k->level = LX_SIMD_AVX2;
+    k->mat4_mul = mat4_mul;
+    k->mat4_mul_vec4 = mat4_mul_vec4;
+    k->mat4_mul_vec4_array = mat4_mul_vec4_array;
+    k->mat4_mul_array = mat4_mul_array;
+    load_stream_kernels(k);
+    load_cull_kernels(k);
+    load_ray_kernels(k);
+    load_sweep_kernels(k);
+    load_skin_kernels(k);
+    load_anim_kernels(k);
+    load_pack_kernels(k);
+    load_random_kernels(k);
+    load_noise_kernels(k);
+    return 1;
+}
+
+#else
+
+int load_avx2_kernels(math_kernels* k)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,153 @@
+#pragma once
+
+// frustum culling kernels written against simd.h, included once by each kernel
+// file alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+#include <math.h>
+
+// private source
+// ----------------------------------------------------------------
+
+static inline int sphere_visible(const lx_frustum* f, const lx_sphere* s)
+{
+    for (int p = 0; p < 6; p++)
+    {
+        const lx_vec4* n = &f->planes[p];
+        if (n->x * s->center.x + n->y * s->center.y + n->z * s->center.z + n->w < -s->radius)
+            return 0;
+    }
+
+    return 1;
+}
+
+static inline int aabb_visible(const lx_frustum* f, const lx_aabb* b)
+{
+    for (int p = 0; p < 6; p++)
+    {
+        const lx_vec4* n = &f->planes[p];
+
+        // the corner furthest along the normal decides the whole box
+        float x = n->x > 0.0f ? b->max.x : b->min.x;
+        float y = n->y > 0.0f ? b->max.y : b->min.y;
+        float z = n->z > 0.0f ? b->max.z : b->min.z;
+
+        if (n->x * x + n->y * y + n->z * z + n->w < 0.0f)
+            return 0;
+    }
+
+    return 1;
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(frustum_cull_spheres)(const lx_frustum* f, const lx_sphere* s, size_t count, uint32_t* mask)
+{
+    f32v nx[6], ny[6], nz[6], nw[6];
+    for (int p = 0; p < 6; p++)
+    {
+        nx[p] = f32v_set(f->planes[p].x);
+        ny[p] = f32v_set(f->planes[p].y);
+        nz[p] = f32v_set(f->planes[p].z);
+        nw[p] = f32v_set(f->planes[p].w);
+    }
+
+    f32v zero = f32v_set(0.0f);
+
+    for (size_t begin = 0; begin < count; begin += 32)
+    {
+        size_t end = begin + 32 < count ? begin + 32 : count;
+        uint32_t bits = 0;
+        size_t i = begin;
+
+        // a single lane does better with the early out of the scalar test
+        for (; F32V_WIDTH > 1 && i + F32V_WIDTH <= end; i += F32V_WIDTH)
+        {
+            f32v x, y, z, r;
+            f32v_load_aos4(&s[i].center.x, 4, &x, &y, &z, &r);
+            f32v neg_r = f32v_sub(zero, r);
+
+            f32v in = f32v_cmpge(f32v_madd(nx[0], x, f32v_madd(ny[0], y, f32v_madd(nz[0], z, nw[0]))), neg_r);
+            for (int p = 1; p < 6; p++)
+                in = f32v_and(in, f32v_cmpge(f32v_madd(nx[p], x, f32v_madd(ny[p], y, f32v_madd(nz[p], z, nw[p]))), neg_r));
+
+            bits |= (uint32_t)f32v_movemask(in) << (i - begin);
+        }
+
+        for (; i < end; i++)
+            bits |= (uint32_t)sphere_visible(f, &s[i]) << (i - begin);
+
+        mask[begin / 32] = bits;
+    }
+}
+
+void KERNEL(frustum_cull_aabbs)(const lx_frustum* f, const lx_aabb* b, size_t count, uint32_t* mask)
+{
+    // boxes are tested as a center and extents, the extents projected onto
+    // the absolute normal give the box's radius along it
+    f32v nx[6], ny[6], nz[6], nw[6], ax[6], ay[6], az[6];
+    for (int p = 0; p < 6; p++)
+    {
+        nx[p] = f32v_set(f->planes[p].x);
+        ny[p] = f32v_set(f->planes[p].y);
+        nz[p] = f32v_set(f->planes[p].z);
+        nw[p] = f32v_set(f->planes[p].w);
+        ax[p] = f32v_set(fabsf(f->planes[p].x));
+        ay[p] = f32v_set(fabsf(f->planes[p].y));
+        az[p] = f32v_set(fabsf(f->planes[p].z));
+    }
+
+    f32v half = f32v_set(0.5f);
+    f32v zero = f32v_set(0.0f);
+
+    for (size_t begin = 0; begin < count; begin += 32)
+    {
+        size_t end = begin + 32 < count ? begin + 32 : count;
+        uint32_t bits = 0;
+        size_t i = begin;
+
+        for (; F32V_WIDTH > 1 && i + F32V_WIDTH <= end; i += F32V_WIDTH)
+        {
+            // a box is six floats, read as two overlapping groups of four
+            f32v min_x, min_y, min_z, max_x, max_y, max_z, unused;
+            f32v_load_aos4(&b[i].min.x, 6, &min_x, &min_y, &min_z, &unused);
+            f32v_load_aos4(&b[i].min.z, 6, &unused, &max_x, &max_y, &max_z);
+
+            f32v cx = f32v_mul(f32v_add(min_x, max_x), half);
+            f32v cy = f32v_mul(f32v_add(min_y, max_y), half);
+            f32v cz = f32v_mul(f32v_add(min_z, max_z), half);
+            f32v ex = f32v_mul(f32v_sub(max_x, min_x), half);
+            f32v ey = f32v_mul(f32v_sub(max_y, min_y), half);
+            f32v ez = f32v_mul(f32v_sub(max_z, min_z), half);
+
+            f32v in = zero;
+            for (int p = 0; p < 6; p++)
+            {
+                f32v d = f32v_madd(nx[p], cx, f32v_madd(ny[p], cy, f32v_madd(nz[p], cz, nw[p])));
+                f32v r = f32v_madd(ax[p], ex, f32v_madd(ay[p], ey, f32v_mul(az[p], ez)));
+                f32v plane_in = f32v_cmpge(f32v_add(d, r), zero);
+
+                in = p == 0 ? plane_in : f32v_and(in, plane_in);
+            }
+
+            bits |= (uint32_t)f32v_movemask(in) << (i - begin);
+        }
+
+        for (; i < end; i++)
+            bits |= (uint32_t)aabb_visible(f, &b[i]) << (i - begin);
+
+        mask[begin / 32] = bits;
+    }
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_cull_kernels(math_kernels* k)
+{
+    k->frustum_cull_spheres = KERNEL(frustum_cull_spheres);
+    k->frustum_cull_aabbs = KERNEL(frustum_cull_aabbs);
+}
@@ -0,0 +1,136 @@
+#include "math.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+
+#include <arm_neon.h>
+
+#define KERNEL(name) neon_##name
+#include "kernels_stream.h"
+#include "kernels_cull.h"
+#include "kernels_ray.h"
+#include "kernels_sweep.h"
+#include "kernels_skin.h"
+#include "kernels_anim.h"
+#include "kernels_pack.h"
+#include "kernels_random.h"
+#include "kernels_noise.h"
+
+// private source
+// ----------------------------------------------------------------
+
+static inline float32x4_t mat4_column(float32x4_t c0, float32x4_t c1, float32x4_t c2, float32x4_t c3, float32x4_t v)
+{
+    float32x4_t r = vmulq_laneq_f32(c0, v, 0);
+    r = vfmaq_laneq_f32(r, c1, v, 1);
+    r = vfmaq_laneq_f32(r, c2, v, 2);
+    return vfmaq_laneq_f32(r, c3, v, 3);
+}
+
+static void mat4_mul(const lx_mat4* a, const lx_mat4* b, lx_mat4* out)
+{
+    float32x4_t a0 = vld1q_f32(&a->m[0]);
+    float32x4_t a1 = vld1q_f32(&a->m[4]);
+    float32x4_t a2 = vld1q_f32(&a->m[8]);
+    float32x4_t a3 = vld1q_f32(&a->m[12]);
+
+    float32x4_t b0 = vld1q_f32(&b->m[0]);
+    float32x4_t b1 = vld1q_f32(&b->m[4]);
+    float32x4_t b2 = vld1q_f32(&b->m[8]);
+    float32x4_t b3 = vld1q_f32(&b->m[12]);
+
+    vst1q_f32(&out->m[0], mat4_column(a0, a1, a2, a3, b0));
+    vst1q_f32(&out->m[4], mat4_column(a0, a1, a2, a3, b1));
+    vst1q_f32(&out->m[8], mat4_column(a0, a1, a2, a3, b2));
+    vst1q_f32(&out->m[12], mat4_column(a0, a1, a2, a3, b3));
+}
+
+static void mat4_mul_vec4(const lx_mat4* m, const lx_vec4* v, lx_vec4* out)
+{
+    float32x4_t r = mat4_column(
+        vld1q_f32(&m->m[0]),
+        vld1q_f32(&m->m[4]),
+        vld1q_f32(&m->m[8]),
+        vld1q_f32(&m->m[12]),
+        vld1q_f32(&v->x)
+    );
+
+    vst1q_f32(&out->x, r);
+}
+
+static void mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count)
+{
+    float32x4_t c0 = vld1q_f32(&m->m[0]);
+    float32x4_t c1 = vld1q_f32(&m->m[4]);
+    float32x4_t c2 = vld1q_f32(&m->m[8]);
+    float32x4_t c3 = vld1q_f32(&m->m[12]);
+
+    for (size_t i = 0; i < count; i++)
+        vst1q_f32(&out[i].x, mat4_column(c0, c1, c2, c3, vld1q_f32(&in[i].x)));
+}
+
+static void mat4_mul_vec3_array(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w)
+{
+    float32x4_t c0 = vld1q_f32(&m->m[0]);
+    float32x4_t c1 = vld1q_f32(&m->m[4]);
+    float32x4_t c2 = vld1q_f32(&m->m[8]);
+
+    float32x4_t tx = vdupq_n_f32(m->m[12] * w);
+    float32x4_t ty = vdupq_n_f32(m->m[13] * w);
+    float32x4_t tz = vdupq_n_f32(m->m[14] * w);
+
+    // the interleaved loads split four vectors into one register per component
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4x3_t v = vld3q_f32(&in[i].x);
+        float32x4x3_t r;
+
+        r.val[0] = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(tx, v.val[0], c0, 0), v.val[1], c1, 0), v.val[2], c2, 0);
+        r.val[1] = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(ty, v.val[0], c0, 1), v.val[1], c1, 1), v.val[2], c2, 1);
+        r.val[2] = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(tz, v.val[0], c0, 2), v.val[1], c1, 2), v.val[2], c2, 2);
+
+        vst3q_f32(&out[i].x, r);
+    }
+
+    scalar_mat4_mul_vec3_array(m, in + i, out + i, count - i, w);
+}
+
+static void mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        mat4_mul(a, &in[i], &out[i]);
+}
+
+// private header
+// ----------------------------------------------------------------
+
+// the inverse stays on the scalar kernel, neon has no cheap cross-lane
+// shuffles to match the blockwise sse version
+int load_neon_kernels(math_kernels* k)
+{
+    k->level = LX_SIMD_NEON;
+    k->mat4_mul = mat4_mul;
+    k->mat4_mul_vec4 = mat4_mul_vec4;
+    k->mat4_mul_vec4_array = mat4_mul_vec4_array;
+    k->mat4_mul_vec3_array = mat4_mul_vec3_array;
+    k->mat4_mul_array = mat4_mul_array;
+    load_stream_kernels(k);
+    load_cull_kernels(k);
+    load_ray_kernels(k);
+    load_sweep_kernels(k);
+    load_skin_kernels(k);
+    load_anim_kernels(k);
+    load_pack_kernels(k);
+    load_random_kernels(k);
+    load_noise_kernels(k);
+    return 1;
+}
+
+#else
+
+int load_neon_kernels(math_kernels* k)
+{
+    return 0;
+}
+
+#endif
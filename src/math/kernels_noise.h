@@ -0,0 +1,241 @@
+#pragma once
+
+// noise kernels written against simd.h, included once by each kernel file
+// alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// simplex noise after the webgl-noise formulation by McEwan and Gustavson,
+// which hashes lattice points with float polynomials modulo 289 rather than
+// a permutation table, so every lane computes its own corners without gathers.
+// the products stay below 2^24 and are exact at every simd level
+
+static inline f32v mod289(f32v x)
+{
+    return f32v_sub(x, f32v_mul(f32v_floor(f32v_mul(x, f32v_set(1.0f / 289.0f))), f32v_set(289.0f)));
+}
+
+static inline f32v permute(f32v x)
+{
+    return mod289(f32v_mul(f32v_add(f32v_mul(x, f32v_set(34.0f)), f32v_set(10.0f)), x));
+}
+
+static inline f32v abs_f32v(f32v a)
+{
+    return f32v_max(a, f32v_sub(f32v_set(0.0f), a));
+}
+
+// 1 where a is 0 or more, 0 elsewhere
+static inline f32v step_f32v(f32v a)
+{
+    return f32v_select(f32v_cmpge(a, f32v_set(0.0f)), f32v_set(0.0f), f32v_set(1.0f));
+}
+
+// a corner's hash picks one of 41 gradients spread around a diamond, which
+// are normalized on the fly, and the falloff weights its dot with x y
+static inline f32v corner2(f32v hash, f32v x, f32v y)
+{
+    f32v m = f32v_max(f32v_sub(f32v_set(0.5f), f32v_madd(x, x, f32v_mul(y, y))), f32v_set(0.0f));
+    m = f32v_mul(m, m);
+    m = f32v_mul(m, m);
+
+    f32v g = f32v_mul(hash, f32v_set(1.0f / 41.0f));
+    g = f32v_sub(f32v_mul(f32v_sub(g, f32v_floor(g)), f32v_set(2.0f)), f32v_set(1.0f));
+
+    f32v gy = f32v_sub(abs_f32v(g), f32v_set(0.5f));
+    f32v gx = f32v_sub(g, f32v_floor(f32v_add(g, f32v_set(0.5f))));
+
+    f32v length = f32v_madd(gx, gx, f32v_mul(gy, gy));
+    m = f32v_mul(m, f32v_sub(f32v_set(1.79284291400159f), f32v_mul(length, f32v_set(0.85373472095314f))));
+    return f32v_mul(m, f32v_madd(gx, x, f32v_mul(gy, y)));
+}
+
+// a corner's hash picks one of 49 gradients on the faces of an octahedron
+static inline f32v corner3(f32v hash, f32v x, f32v y, f32v z)
+{
+    f32v m = f32v_max(f32v_sub(f32v_set(0.5f), f32v_madd(x, x, f32v_madd(y, y, f32v_mul(z, z)))), f32v_set(0.0f));
+    m = f32v_mul(m, m);
+    m = f32v_mul(m, m);
+
+    f32v j = f32v_sub(hash, f32v_mul(f32v_floor(f32v_mul(hash, f32v_set(1.0f / 49.0f))), f32v_set(49.0f)));
+    f32v jx = f32v_floor(f32v_mul(j, f32v_set(1.0f / 7.0f)));
+    f32v jy = f32v_floor(f32v_sub(j, f32v_mul(jx, f32v_set(7.0f))));
+
+    f32v gx = f32v_madd(jx, f32v_set(2.0f / 7.0f), f32v_set(0.5f / 7.0f - 1.0f));
+    f32v gy = f32v_madd(jy, f32v_set(2.0f / 7.0f), f32v_set(0.5f / 7.0f - 1.0f));
+    f32v gz = f32v_sub(f32v_sub(f32v_set(1.0f), abs_f32v(gx)), abs_f32v(gy));
+
+    // the lower half folds out onto the lower faces
+    f32v lower = f32v_cmpge(f32v_set(0.0f), gz);
+    gx = f32v_select(lower, gx, f32v_sub(gx, f32v_sub(f32v_mul(step_f32v(gx), f32v_set(2.0f)), f32v_set(1.0f))));
+    gy = f32v_select(lower, gy, f32v_sub(gy, f32v_sub(f32v_mul(step_f32v(gy), f32v_set(2.0f)), f32v_set(1.0f))));
+
+    f32v inv = f32v_div(f32v_set(1.0f), f32v_sqrt(f32v_madd(gx, gx, f32v_madd(gy, gy, f32v_mul(gz, gz)))));
+    f32v d = f32v_madd(gx, x, f32v_madd(gy, y, f32v_mul(gz, z)));
+    return f32v_mul(f32v_mul(m, inv), d);
+}
+
+static inline f32v simplex2(f32v x, f32v y)
+{
+    const float skew = 0.366025403784439f;
+    const float unskew = 0.211324865405187f;
+
+    f32v s = f32v_mul(f32v_add(x, y), f32v_set(skew));
+    f32v ix = f32v_floor(f32v_add(x, s));
+    f32v iy = f32v_floor(f32v_add(y, s));
+
+    f32v t = f32v_mul(f32v_add(ix, iy), f32v_set(unskew));
+    f32v x0 = f32v_add(f32v_sub(x, ix), t);
+    f32v y0 = f32v_add(f32v_sub(y, iy), t);
+
+    // the middle corner steps along the axis x0 y0 is further along
+    f32v along_y = f32v_cmpge(y0, x0);
+    f32v i1x = f32v_select(along_y, f32v_set(1.0f), f32v_set(0.0f));
+    f32v i1y = f32v_select(along_y, f32v_set(0.0f), f32v_set(1.0f));
+
+    f32v x1 = f32v_add(f32v_sub(x0, i1x), f32v_set(unskew));
+    f32v y1 = f32v_add(f32v_sub(y0, i1y), f32v_set(unskew));
+    f32v x2 = f32v_add(x0, f32v_set(2.0f * unskew - 1.0f));
+    f32v y2 = f32v_add(y0, f32v_set(2.0f * unskew - 1.0f));
+
+    ix = mod289(ix);
+    iy = mod289(iy);
+
+    f32v one = f32v_set(1.0f);
+    f32v h0 = permute(f32v_add(permute(iy), ix));
+    f32v h1 = permute(f32v_add(permute(f32v_add(iy, i1y)), f32v_add(ix, i1x)));
+    f32v h2 = permute(f32v_add(permute(f32v_add(iy, one)), f32v_add(ix, one)));
+
+    f32v n = f32v_add(corner2(h0, x0, y0), f32v_add(corner2(h1, x1, y1), corner2(h2, x2, y2)));
+    return f32v_mul(n, f32v_set(130.0f));
+}
+
+static inline f32v simplex3(f32v x, f32v y, f32v z)
+{
+    const float skew = 1.0f / 3.0f;
+    const float unskew = 1.0f / 6.0f;
+
+    f32v s = f32v_mul(f32v_add(x, f32v_add(y, z)), f32v_set(skew));
+    f32v ix = f32v_floor(f32v_add(x, s));
+    f32v iy = f32v_floor(f32v_add(y, s));
+    f32v iz = f32v_floor(f32v_add(z, s));
+
+    f32v t = f32v_mul(f32v_add(ix, f32v_add(iy, iz)), f32v_set(unskew));
+    f32v x0 = f32v_add(f32v_sub(x, ix), t);
+    f32v y0 = f32v_add(f32v_sub(y, iy), t);
+    f32v z0 = f32v_add(f32v_sub(z, iz), t);
+
+    // the two middle corners step along the largest axis of x0 y0 z0 and
+    // then the largest two, found by ranking each pair. the last comparison
+    // is strict so ties still rank in a consistent order, where three of >=
+    // would cycle and pick the wrong simplex
+    f32v one = f32v_set(1.0f);
+    f32v gx = step_f32v(f32v_sub(x0, y0));
+    f32v gy = step_f32v(f32v_sub(y0, z0));
+    f32v gz = f32v_sub(one, step_f32v(f32v_sub(x0, z0)));
+    f32v lx = f32v_sub(one, gx);
+    f32v ly = f32v_sub(one, gy);
+    f32v lz = f32v_sub(one, gz);
+
+    f32v i1x = f32v_min(gx, lz);
+    f32v i1y = f32v_min(gy, lx);
+    f32v i1z = f32v_min(gz, ly);
+    f32v i2x = f32v_max(gx, lz);
+    f32v i2y = f32v_max(gy, lx);
+    f32v i2z = f32v_max(gz, ly);
+
+    f32v c1 = f32v_set(unskew);
+    f32v c2 = f32v_set(2.0f * unskew);
+    f32v c3 = f32v_set(3.0f * unskew - 1.0f);
+
+    f32v x1 = f32v_add(f32v_sub(x0, i1x), c1);
+    f32v y1 = f32v_add(f32v_sub(y0, i1y), c1);
+    f32v z1 = f32v_add(f32v_sub(z0, i1z), c1);
+    f32v x2 = f32v_add(f32v_sub(x0, i2x), c2);
+    f32v y2 = f32v_add(f32v_sub(y0, i2y), c2);
+    f32v z2 = f32v_add(f32v_sub(z0, i2z), c2);
+    f32v x3 = f32v_add(x0, c3);
+    f32v y3 = f32v_add(y0, c3);
+    f32v z3 = f32v_add(z0, c3);
+
+    ix = mod289(ix);
+    iy = mod289(iy);
+    iz = mod289(iz);
+
+    f32v h0 = permute(f32v_add(permute(f32v_add(permute(iz), iy)), ix));
+    f32v h1 = permute(f32v_add(permute(f32v_add(permute(f32v_add(iz, i1z)), f32v_add(iy, i1y))), f32v_add(ix, i1x)));
+    f32v h2 = permute(f32v_add(permute(f32v_add(permute(f32v_add(iz, i2z)), f32v_add(iy, i2y))), f32v_add(ix, i2x)));
+    f32v h3 = permute(f32v_add(permute(f32v_add(permute(f32v_add(iz, one)), f32v_add(iy, one))), f32v_add(ix, one)));
+
+    f32v n = f32v_add(f32v_add(corner3(h0, x0, y0, z0), corner3(h1, x1, y1, z1)), f32v_add(corner3(h2, x2, y2, z2), corner3(h3, x3, y3, z3)));
+    return f32v_mul(n, f32v_set(105.0f));
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(noise_simplex2)(const lx_vec2* in, float* out, size_t count)
+{
+    size_t i = 0;
+
+    // each load reads two floats past its last lane, so the last vector's
+    // worth goes through a padded copy
+    for (; i + F32V_WIDTH < count; i += F32V_WIDTH)
+    {
+        f32v x, y, z, w;
+        f32v_load_aos4(&in[i].x, 2, &x, &y, &z, &w);
+        f32v_store(out + i, simplex2(x, y));
+    }
+
+    if (i == count)
+        return;
+
+    lx_vec2 pad[F32V_WIDTH + 1] = { { 0.0f, 0.0f } };
+    float o[F32V_WIDTH];
+    memcpy(pad, in + i, (count - i) * sizeof(lx_vec2));
+
+    f32v x, y, z, w;
+    f32v_load_aos4(&pad[0].x, 2, &x, &y, &z, &w);
+    f32v_store(o, simplex2(x, y));
+    memcpy(out + i, o, (count - i) * sizeof(float));
+}
+
+void KERNEL(noise_simplex3)(const lx_vec3* in, float* out, size_t count)
+{
+    size_t i = 0;
+
+    // as for 2D, with a float read past the last lane
+    for (; i + F32V_WIDTH < count; i += F32V_WIDTH)
+    {
+        f32v x, y, z, w;
+        f32v_load_aos4(&in[i].x, 3, &x, &y, &z, &w);
+        f32v_store(out + i, simplex3(x, y, z));
+    }
+
+    if (i == count)
+        return;
+
+    lx_vec3 pad[F32V_WIDTH + 1] = { { 0.0f, 0.0f, 0.0f } };
+    float o[F32V_WIDTH];
+    memcpy(pad, in + i, (count - i) * sizeof(lx_vec3));
+
+    f32v x, y, z, w;
+    f32v_load_aos4(&pad[0].x, 3, &x, &y, &z, &w);
+    f32v_store(o, simplex3(x, y, z));
+    memcpy(out + i, o, (count - i) * sizeof(float));
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_noise_kernels(math_kernels* k)
+{
+    k->noise_simplex2 = KERNEL(noise_simplex2);
+    k->noise_simplex3 = KERNEL(noise_simplex3);
+}
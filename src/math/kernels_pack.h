@@ -0,0 +1,245 @@
+#pragma once
+
+// vertex packing kernels written against simd.h, included once by each kernel
+// file alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+#include <math.h>
+
+// private source
+// ----------------------------------------------------------------
+
+#define SNORM16_MAX 32767.0f
+#define SNORM10_MAX 511.0f
+#define UNORM8_MAX 255.0f
+
+// the scalar versions handle the elements left over by the vector loops
+
+static inline int32_t pack_snorm(float v, float max)
+{
+    v = v < -1.0f ? -1.0f : v > 1.0f ? 1.0f : v;
+    return (int32_t)lrintf(v * max);
+}
+
+static inline int32_t pack_unorm(float v, float max)
+{
+    v = v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v;
+    return (int32_t)lrintf(v * max);
+}
+
+static inline uint32_t pack_2_10_10_10(int32_t x, int32_t y, int32_t z, int32_t w)
+{
+    return (uint32_t)(x & 0x3ff) | (uint32_t)(y & 0x3ff) << 10 | (uint32_t)(z & 0x3ff) << 20 | (uint32_t)(w & 0x3) << 30;
+}
+
+// projects a unit vector onto the octahedron |x| + |y| + |z| = 1 and folds
+// its lower half over the upper, flattening it into the square -1 to 1
+static inline void octahedral(lx_vec3 n, float* u, float* v)
+{
+    float l1 = fabsf(n.x) + fabsf(n.y) + fabsf(n.z);
+    float inv = 1.0f / (l1 > 1e-30f ? l1 : 1e-30f);
+    float x = n.x * inv;
+    float y = n.y * inv;
+
+    if (n.z < 0.0f)
+    {
+        float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+
+    *u = x;
+    *v = y;
+}
+
+static inline f32v abs_v(f32v a)
+{
+    return f32v_max(a, f32v_sub(f32v_set(0.0f), a));
+}
+
+// 1 where a is 0 or more, -1 elsewhere
+static inline f32v sign_v(f32v a)
+{
+    return f32v_select(f32v_cmpge(a, f32v_set(0.0f)), f32v_set(-1.0f), f32v_set(1.0f));
+}
+
+static inline f32v clamp_v(f32v a, float min, float max)
+{
+    return f32v_min(f32v_max(a, f32v_set(min)), f32v_set(max));
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(pack_half)(const float* in, uint16_t* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        f32v_store_half(out + i, f32v_load(in + i));
+
+    for (; i < count; i++)
+        out[i] = f32_to_half(in[i]);
+}
+
+void KERNEL(pack_positions)(const lx_vec3* in, int16_t* out, size_t count, lx_vec3 offset, lx_vec3 inv_scale)
+{
+    f32v ox = f32v_set(offset.x);
+    f32v oy = f32v_set(offset.y);
+    f32v oz = f32v_set(offset.z);
+    f32v sx = f32v_set(inv_scale.x);
+    f32v sy = f32v_set(inv_scale.y);
+    f32v sz = f32v_set(inv_scale.z);
+    f32v max = f32v_set(SNORM16_MAX);
+    size_t i = 0;
+
+    // each load of three floats per lane reads a fourth past the last lane,
+    // so the last vector's worth is left to the scalar loop
+    for (; i + F32V_WIDTH < count; i += F32V_WIDTH)
+    {
+        f32v x, y, z, w;
+        f32v_load_aos4(&in[i].x, 3, &x, &y, &z, &w);
+
+        int32_t q[3][F32V_WIDTH];
+        f32v_store_i32(q[0], f32v_mul(clamp_v(f32v_mul(f32v_sub(x, ox), sx), -1.0f, 1.0f), max));
+        f32v_store_i32(q[1], f32v_mul(clamp_v(f32v_mul(f32v_sub(y, oy), sy), -1.0f, 1.0f), max));
+        f32v_store_i32(q[2], f32v_mul(clamp_v(f32v_mul(f32v_sub(z, oz), sz), -1.0f, 1.0f), max));
+
+        for (int l = 0; l < F32V_WIDTH; l++)
+        {
+            int16_t* o = out + (i + l) * 4;
+            o[0] = (int16_t)q[0][l];
+            o[1] = (int16_t)q[1][l];
+            o[2] = (int16_t)q[2][l];
+            o[3] = (int16_t)SNORM16_MAX;
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        int16_t* o = out + i * 4;
+        o[0] = (int16_t)pack_snorm((in[i].x - offset.x) * inv_scale.x, SNORM16_MAX);
+        o[1] = (int16_t)pack_snorm((in[i].y - offset.y) * inv_scale.y, SNORM16_MAX);
+        o[2] = (int16_t)pack_snorm((in[i].z - offset.z) * inv_scale.z, SNORM16_MAX);
+        o[3] = (int16_t)SNORM16_MAX;
+    }
+}
+
+void KERNEL(pack_normals)(const lx_vec3* in, int16_t* out, size_t count)
+{
+    f32v one = f32v_set(1.0f);
+    f32v zero = f32v_set(0.0f);
+    f32v max = f32v_set(SNORM16_MAX);
+    size_t i = 0;
+
+    // as for positions, the last vector's worth is left to the scalar loop
+    for (; i + F32V_WIDTH < count; i += F32V_WIDTH)
+    {
+        f32v x, y, z, w;
+        f32v_load_aos4(&in[i].x, 3, &x, &y, &z, &w);
+
+        f32v l1 = f32v_add(abs_v(x), f32v_add(abs_v(y), abs_v(z)));
+        f32v inv = f32v_div(one, f32v_max(l1, f32v_set(1e-30f)));
+        x = f32v_mul(x, inv);
+        y = f32v_mul(y, inv);
+
+        f32v fx = f32v_mul(f32v_sub(one, abs_v(y)), sign_v(x));
+        f32v fy = f32v_mul(f32v_sub(one, abs_v(x)), sign_v(y));
+        f32v upper = f32v_cmpge(z, zero);
+        x = f32v_select(upper, fx, x);
+        y = f32v_select(upper, fy, y);
+
+        int32_t q[2][F32V_WIDTH];
+        f32v_store_i32(q[0], f32v_mul(clamp_v(x, -1.0f, 1.0f), max));
+        f32v_store_i32(q[1], f32v_mul(clamp_v(y, -1.0f, 1.0f), max));
+
+        for (int l = 0; l < F32V_WIDTH; l++)
+        {
+            out[(i + l) * 2] = (int16_t)q[0][l];
+            out[(i + l) * 2 + 1] = (int16_t)q[1][l];
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        float u, v;
+        octahedral(in[i], &u, &v);
+        out[i * 2] = (int16_t)pack_snorm(u, SNORM16_MAX);
+        out[i * 2 + 1] = (int16_t)pack_snorm(v, SNORM16_MAX);
+    }
+}
+
+void KERNEL(pack_tangents)(const lx_vec4* in, uint32_t* out, size_t count)
+{
+    f32v max = f32v_set(SNORM10_MAX);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+    {
+        f32v x, y, z, w;
+        f32v_load_aos4(&in[i].x, 4, &x, &y, &z, &w);
+
+        int32_t q[4][F32V_WIDTH];
+        f32v_store_i32(q[0], f32v_mul(clamp_v(x, -1.0f, 1.0f), max));
+        f32v_store_i32(q[1], f32v_mul(clamp_v(y, -1.0f, 1.0f), max));
+        f32v_store_i32(q[2], f32v_mul(clamp_v(z, -1.0f, 1.0f), max));
+        f32v_store_i32(q[3], sign_v(w));
+
+        for (int l = 0; l < F32V_WIDTH; l++)
+            out[i + l] = pack_2_10_10_10(q[0][l], q[1][l], q[2][l], q[3][l]);
+    }
+
+    for (; i < count; i++)
+    {
+        out[i] = pack_2_10_10_10(
+            pack_snorm(in[i].x, SNORM10_MAX),
+            pack_snorm(in[i].y, SNORM10_MAX),
+            pack_snorm(in[i].z, SNORM10_MAX),
+            in[i].w >= 0.0f ? 1 : -1
+        );
+    }
+}
+
+void KERNEL(pack_colors)(const lx_vec4* in, uint8_t* out, size_t count)
+{
+    f32v max = f32v_set(UNORM8_MAX);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+    {
+        f32v c[4];
+        f32v_load_aos4(&in[i].x, 4, &c[0], &c[1], &c[2], &c[3]);
+
+        int32_t q[4][F32V_WIDTH];
+        for (int k = 0; k < 4; k++)
+            f32v_store_i32(q[k], f32v_mul(clamp_v(c[k], 0.0f, 1.0f), max));
+
+        for (int l = 0; l < F32V_WIDTH; l++)
+        {
+            for (int k = 0; k < 4; k++)
+                out[(i + l) * 4 + k] = (uint8_t)q[k][l];
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        const float* c = &in[i].x;
+        for (int k = 0; k < 4; k++)
+            out[i * 4 + k] = (uint8_t)pack_unorm(c[k], UNORM8_MAX);
+    }
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_pack_kernels(math_kernels* k)
+{
+    k->pack_half = KERNEL(pack_half);
+    k->pack_positions = KERNEL(pack_positions);
+    k->pack_normals = KERNEL(pack_normals);
+    k->pack_tangents = KERNEL(pack_tangents);
+    k->pack_colors = KERNEL(pack_colors);
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+// random number kernels written against simd.h, included once by each kernel
+// file alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+#define RNG_VECTORS (RNG_LANES / F32V_WIDTH)
+
+// the generator state held in registers for the length of a fill
+typedef struct _rng_lanes { u32v s[4][RNG_VECTORS]; } rng_lanes;
+
+static inline void rng_load(rng_lanes* r, const lx_rng* rng)
+{
+    for (int k = 0; k < 4; k++)
+    {
+        for (int v = 0; v < RNG_VECTORS; v++)
+            r->s[k][v] = u32v_load(&rng->state[k][v * F32V_WIDTH]);
+    }
+}
+
+static inline void rng_save(const rng_lanes* r, lx_rng* rng)
+{
+    for (int k = 0; k < 4; k++)
+    {
+        for (int v = 0; v < RNG_VECTORS; v++)
+            u32v_store(&rng->state[k][v * F32V_WIDTH], r->s[k][v]);
+    }
+}
+
+// one xoshiro128+ step of a vector of the generators
+static inline u32v rng_next(rng_lanes* r, int v)
+{
+    u32v s0 = r->s[0][v];
+    u32v s1 = r->s[1][v];
+    u32v s2 = r->s[2][v];
+    u32v s3 = r->s[3][v];
+
+    u32v result = u32v_add(s0, s3);
+    u32v t = u32v_shl(s1, 9);
+
+    s2 = u32v_xor(s2, s0);
+    s3 = u32v_xor(s3, s1);
+    s1 = u32v_xor(s1, s2);
+    s0 = u32v_xor(s0, s3);
+    s2 = u32v_xor(s2, t);
+    s3 = u32v_or(u32v_shl(s3, 11), u32v_shr(s3, 21));
+
+    r->s[0][v] = s0;
+    r->s[1][v] = s1;
+    r->s[2][v] = s2;
+    r->s[3][v] = s3;
+    return result;
+}
+
+// the top 23 bits as the mantissa of a float from 1 to 2, less 1. the low
+// bits of xoshiro128+ are its weakest and are dropped
+static inline f32v rng_unit(u32v u)
+{
+    return f32v_sub(u32v_as_f32v(u32v_or(u32v_shr(u, 9), u32v_set(0x3f800000))), f32v_set(1.0f));
+}
+
+// sin(2 pi t) for t from -0.5 to 0.5, folded onto the quarter turns either
+// side of 0 where the series converges quickly
+static inline f32v sin_turns(f32v t)
+{
+    t = f32v_select(f32v_cmpge(t, f32v_set(0.25f)), t, f32v_sub(f32v_set(0.5f), t));
+    t = f32v_select(f32v_cmpge(f32v_set(-0.25f), t), t, f32v_sub(f32v_set(-0.5f), t));
+
+    f32v x = f32v_mul(t, f32v_set(2.0f * LX_PI));
+    f32v x2 = f32v_mul(x, x);
+    f32v p = f32v_set(-1.0f / 39916800.0f);
+    p = f32v_madd(p, x2, f32v_set(1.0f / 362880.0f));
+    p = f32v_madd(p, x2, f32v_set(-1.0f / 5040.0f));
+    p = f32v_madd(p, x2, f32v_set(1.0f / 120.0f));
+    p = f32v_madd(p, x2, f32v_set(-1.0f / 6.0f));
+    p = f32v_madd(p, x2, f32v_set(1.0f));
+    return f32v_mul(p, x);
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(rng_floats)(lx_rng* rng, float* out, size_t count, float min, float range)
+{
+    rng_lanes r;
+    rng_load(&r, rng);
+
+    f32v lo = f32v_set(min);
+    f32v scale = f32v_set(range);
+    float block[RNG_LANES];
+
+    for (size_t i = 0; i < count; i += RNG_LANES)
+    {
+        float* o = i + RNG_LANES <= count ? out + i : block;
+
+        for (int v = 0; v < RNG_VECTORS; v++)
+            f32v_store(o + v * F32V_WIDTH, f32v_madd(rng_unit(rng_next(&r, v)), scale, lo));
+
+        if (o == block)
+            memcpy(out + i, block, (count - i) * sizeof(float));
+    }
+
+    rng_save(&r, rng);
+}
+
+void KERNEL(rng_vec3)(lx_rng* rng, lx_vec3* out, size_t count, int inside)
+{
+    rng_lanes r;
+    rng_load(&r, rng);
+
+    f32v one = f32v_set(1.0f);
+    f32v half = f32v_set(0.5f);
+
+    for (size_t i = 0; i < count; i += RNG_LANES)
+    {
+        float x[RNG_LANES];
+        float y[RNG_LANES];
+        float z[RNG_LANES];
+
+        for (int v = 0; v < RNG_VECTORS; v++)
+        {
+            // a uniform height and angle are uniform over the sphere
+            f32v u = rng_unit(rng_next(&r, v));
+            f32v h = f32v_sub(f32v_add(u, u), one);
+            f32v t = f32v_sub(rng_unit(rng_next(&r, v)), half);
+
+            f32v c = f32v_add(t, f32v_set(0.25f));
+            c = f32v_select(f32v_cmpge(c, half), c, f32v_sub(c, one));
+
+            f32v ring = f32v_sqrt(f32v_max(f32v_sub(one, f32v_mul(h, h)), f32v_set(0.0f)));
+            f32v px = f32v_mul(ring, sin_turns(c));
+            f32v py = f32v_mul(ring, sin_turns(t));
+
+            // the largest of three uniforms has the cube law of the radius
+            // of points spread through a ball
+            if (inside)
+            {
+                f32v radius = f32v_max(rng_unit(rng_next(&r, v)), f32v_max(rng_unit(rng_next(&r, v)), rng_unit(rng_next(&r, v))));
+                px = f32v_mul(px, radius);
+                py = f32v_mul(py, radius);
+                h = f32v_mul(h, radius);
+            }
+
+            f32v_store(x + v * F32V_WIDTH, px);
+            f32v_store(y + v * F32V_WIDTH, py);
+            f32v_store(z + v * F32V_WIDTH, h);
+        }
+
+        size_t n = count - i < RNG_LANES ? count - i : RNG_LANES;
+        for (size_t l = 0; l < n; l++)
+            out[i + l] = (lx_vec3){ x[l], y[l], z[l] };
+    }
+
+    rng_save(&r, rng);
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_random_kernels(math_kernels* k)
+{
+    k->rng_floats = KERNEL(rng_floats);
+    k->rng_vec3 = KERNEL(rng_vec3);
+}
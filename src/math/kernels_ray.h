@@ -0,0 +1,204 @@
+#pragma once
+
+// bvh ray casting kernels written against simd.h, included once by each
+// kernel file alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+// private source
+// ----------------------------------------------------------------
+
+// one ray per lane, the inverse direction is used by the slab tests
+typedef struct _ray_packet
+{
+    f32v ox, oy, oz;
+    f32v dx, dy, dz;
+    f32v ix, iy, iz;
+}
+ray_packet;
+
+// keeps axis aligned directions away from infinite inverses, which give nan
+// slab distances for origins lying on a box face
+static inline float safe_direction(float d)
+{
+    if (d > -1e-20f && d < 1e-20f)
+        return d < 0.0f ? -1e-20f : 1e-20f;
+
+    return d;
+}
+
+// returns a mask of the lanes entering the box before t_max, with the
+// distance at which they do so
+static inline f32v ray_box(const ray_packet* p, const float* min, const float* max, f32v t_max, f32v* t_enter)
+{
+    f32v x0 = f32v_mul(f32v_sub(f32v_set(min[0]), p->ox), p->ix);
+    f32v x1 = f32v_mul(f32v_sub(f32v_set(max[0]), p->ox), p->ix);
+    f32v y0 = f32v_mul(f32v_sub(f32v_set(min[1]), p->oy), p->iy);
+    f32v y1 = f32v_mul(f32v_sub(f32v_set(max[1]), p->oy), p->iy);
+    f32v z0 = f32v_mul(f32v_sub(f32v_set(min[2]), p->oz), p->iz);
+    f32v z1 = f32v_mul(f32v_sub(f32v_set(max[2]), p->oz), p->iz);
+
+    f32v enter = f32v_max(f32v_max(f32v_min(x0, x1), f32v_min(y0, y1)), f32v_max(f32v_min(z0, z1), f32v_set(0.0f)));
+    f32v leave = f32v_min(f32v_min(f32v_max(x0, x1), f32v_max(y0, y1)), f32v_min(f32v_max(z0, z1), t_max));
+
+    *t_enter = enter;
+    return f32v_cmpge(leave, enter);
+}
+
+// moller trumbore with the determinant left unchecked, a parallel ray gives
+// infinite or nan barycentrics which fail the comparisons
+static inline f32v ray_triangle(const ray_packet* p, const bvh_triangle* tri, f32v t_max, f32v* t, f32v* u, f32v* v)
+{
+    f32v e1x = f32v_set(tri->e1.x), e1y = f32v_set(tri->e1.y), e1z = f32v_set(tri->e1.z);
+    f32v e2x = f32v_set(tri->e2.x), e2y = f32v_set(tri->e2.y), e2z = f32v_set(tri->e2.z);
+
+    f32v px = f32v_sub(f32v_mul(p->dy, e2z), f32v_mul(p->dz, e2y));
+    f32v py = f32v_sub(f32v_mul(p->dz, e2x), f32v_mul(p->dx, e2z));
+    f32v pz = f32v_sub(f32v_mul(p->dx, e2y), f32v_mul(p->dy, e2x));
+    f32v inv_det = f32v_div(f32v_set(1.0f), f32v_madd(e1x, px, f32v_madd(e1y, py, f32v_mul(e1z, pz))));
+
+    f32v sx = f32v_sub(p->ox, f32v_set(tri->v0.x));
+    f32v sy = f32v_sub(p->oy, f32v_set(tri->v0.y));
+    f32v sz = f32v_sub(p->oz, f32v_set(tri->v0.z));
+    *u = f32v_mul(f32v_madd(sx, px, f32v_madd(sy, py, f32v_mul(sz, pz))), inv_det);
+
+    f32v qx = f32v_sub(f32v_mul(sy, e1z), f32v_mul(sz, e1y));
+    f32v qy = f32v_sub(f32v_mul(sz, e1x), f32v_mul(sx, e1z));
+    f32v qz = f32v_sub(f32v_mul(sx, e1y), f32v_mul(sy, e1x));
+    *v = f32v_mul(f32v_madd(p->dx, qx, f32v_madd(p->dy, qy, f32v_mul(p->dz, qz))), inv_det);
+    *t = f32v_mul(f32v_madd(e2x, qx, f32v_madd(e2y, qy, f32v_mul(e2z, qz))), inv_det);
+
+    f32v zero = f32v_set(0.0f);
+    f32v hit = f32v_and(f32v_cmpge(*u, zero), f32v_cmpge(*v, zero));
+    hit = f32v_and(hit, f32v_cmpge(f32v_set(1.0f), f32v_add(*u, *v)));
+    hit = f32v_and(hit, f32v_cmpge(*t, f32v_set(1e-6f)));
+    return f32v_and(hit, f32v_cmpge(t_max, *t));
+}
+
+// private header
+// ----------------------------------------------------------------
+
+size_t KERNEL(bvh_raycast)(const bvh_tree* tree, const lx_ray* rays, size_t count, float max_t, lx_ray_hit* hits)
+{
+    size_t hit_count = 0;
+
+    for (size_t begin = 0; begin < count; begin += F32V_WIDTH)
+    {
+        size_t n = count - begin < F32V_WIDTH ? count - begin : F32V_WIDTH;
+
+        // a partial packet repeats its last ray in the unused lanes
+        float lanes[9][F32V_WIDTH];
+        for (size_t l = 0; l < F32V_WIDTH; l++)
+        {
+            const lx_ray* r = &rays[begin + (l < n ? l : n - 1)];
+
+            lanes[0][l] = r->origin.x;
+            lanes[1][l] = r->origin.y;
+            lanes[2][l] = r->origin.z;
+            lanes[3][l] = r->direction.x;
+            lanes[4][l] = r->direction.y;
+            lanes[5][l] = r->direction.z;
+            lanes[6][l] = 1.0f / safe_direction(r->direction.x);
+            lanes[7][l] = 1.0f / safe_direction(r->direction.y);
+            lanes[8][l] = 1.0f / safe_direction(r->direction.z);
+        }
+
+        ray_packet p = {
+            f32v_load(lanes[0]), f32v_load(lanes[1]), f32v_load(lanes[2]),
+            f32v_load(lanes[3]), f32v_load(lanes[4]), f32v_load(lanes[5]),
+            f32v_load(lanes[6]), f32v_load(lanes[7]), f32v_load(lanes[8])
+        };
+
+        f32v best_t = f32v_set(max_t);
+        f32v best_u = f32v_set(0.0f);
+        f32v best_v = f32v_set(0.0f);
+
+        uint32_t best[F32V_WIDTH];
+        for (size_t l = 0; l < F32V_WIDTH; l++)
+            best[l] = LX_BVH_NO_HIT;
+
+        uint32_t stack[BVH_MAX_DEPTH + 2];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const bvh_node* node = &tree->nodes[stack[--top]];
+
+            // tested when popped rather than pushed, so hits found since
+            // then can cull it
+            f32v t_enter;
+            if (!f32v_movemask(ray_box(&p, node->min, node->max, best_t, &t_enter)))
+                continue;
+
+            if (node->count == 0)
+            {
+                // visit the child nearer along the first ray first, it is
+                // pushed last
+                const bvh_node* a = &tree->nodes[node->index];
+                const bvh_node* b = a + 1;
+
+                float d = (a->min[0] + a->max[0] - b->min[0] - b->max[0]) * lanes[3][0] +
+                    (a->min[1] + a->max[1] - b->min[1] - b->max[1]) * lanes[4][0] +
+                    (a->min[2] + a->max[2] - b->min[2] - b->max[2]) * lanes[5][0];
+
+                stack[top++] = d > 0.0f ? node->index : node->index + 1;
+                stack[top++] = d > 0.0f ? node->index + 1 : node->index;
+                continue;
+            }
+
+            for (uint32_t i = node->index; i < node->index + node->count; i++)
+            {
+                f32v t, u, v, hit;
+
+                if (tree->triangles != NULL)
+                {
+                    hit = ray_triangle(&p, &tree->triangles[i], best_t, &t, &u, &v);
+                }
+                else
+                {
+                    hit = ray_box(&p, &tree->boxes[i].min.x, &tree->boxes[i].max.x, best_t, &t);
+                    u = v = f32v_set(0.0f);
+                }
+
+                int bits = f32v_movemask(hit);
+                if (bits == 0)
+                    continue;
+
+                best_t = f32v_select(hit, best_t, t);
+                best_u = f32v_select(hit, best_u, u);
+                best_v = f32v_select(hit, best_v, v);
+
+                for (size_t l = 0; l < F32V_WIDTH; l++)
+                {
+                    if (bits & (1 << l))
+                        best[l] = i;
+                }
+            }
+        }
+
+        float t[F32V_WIDTH], u[F32V_WIDTH], v[F32V_WIDTH];
+        f32v_store(t, best_t);
+        f32v_store(u, best_u);
+        f32v_store(v, best_v);
+
+        for (size_t l = 0; l < n; l++)
+        {
+            int hit = best[l] != LX_BVH_NO_HIT;
+
+            hits[begin + l] = (lx_ray_hit){ t[l], u[l], v[l], hit ? tree->ids[best[l]] : LX_BVH_NO_HIT };
+            hit_count += hit;
+        }
+    }
+
+    return hit_count;
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_ray_kernels(math_kernels* k)
+{
+    k->bvh_raycast = KERNEL(bvh_raycast);
+}
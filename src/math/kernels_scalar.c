@@ -0,0 +1,249 @@
+#include "math.h"
+
+#define SIMD_SCALAR
+#define KERNEL(name) scalar_##name
+#include "kernels_stream.h"
+#include "kernels_cull.h"
+#include "kernels_ray.h"
+#include "kernels_sweep.h"
+#include "kernels_skin.h"
+#include "kernels_anim.h"
+#include "kernels_pack.h"
+#include "kernels_random.h"
+#include "kernels_noise.h"
+
+// private header
+// ----------------------------------------------------------------
+
+void scalar_mat4_mul(const lx_mat4* a, const lx_mat4* b, lx_mat4* out)
+{
+    lx_mat4 n;
+
+    for (int c = 0; c < 4; c++)
+    {
+        const float* col = &b->m[c * 4];
+
+        for (int r = 0; r < 4; r++)
+            n.m[c * 4 + r] = a->m[r] * col[0] + a->m[4 + r] * col[1] + a->m[8 + r] * col[2] + a->m[12 + r] * col[3];
+    }
+
+    *out = n;
+}
+
+void scalar_mat4_mul_vec4(const lx_mat4* m, const lx_vec4* v, lx_vec4* out)
+{
+    const float* e = m->m;
+
+    *out = (lx_vec4){
+        e[0] * v->x + e[4] * v->y + e[8] * v->z + e[12] * v->w,
+        e[1] * v->x + e[5] * v->y + e[9] * v->z + e[13] * v->w,
+        e[2] * v->x + e[6] * v->y + e[10] * v->z + e[14] * v->w,
+        e[3] * v->x + e[7] * v->y + e[11] * v->z + e[15] * v->w
+    };
+}
+
+int scalar_mat4_inverse(const lx_mat4* in, lx_mat4* out)
+{
+    const float* m = in->m;
+    float inv[16];
+
+    inv[0] = m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15] + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+    inv[4] = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15] - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+    inv[8] = m[4] * m[9] * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15] + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+    inv[12] = -m[4] * m[9] * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14] - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+    inv[1] = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15] - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+    inv[5] = m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15] + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+    inv[9] = -m[0] * m[9] * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15] - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+    inv[13] = m[0] * m[9] * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14] + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+    inv[2] = m[1] * m[6] * m[15] - m[1] * m[7] * m[14] - m[5] * m[2] * m[15] + m[5] * m[3] * m[14] + m[13] * m[2] * m[7] - m[13] * m[3] * m[6];
+    inv[6] = -m[0] * m[6] * m[15] + m[0] * m[7] * m[14] + m[4] * m[2] * m[15] - m[4] * m[3] * m[14] - m[12] * m[2] * m[7] + m[12] * m[3] * m[6];
+    inv[10] = m[0] * m[5] * m[15] - m[0] * m[7] * m[13] - m[4] * m[1] * m[15] + m[4] * m[3] * m[13] + m[12] * m[1] * m[7] - m[12] * m[3] * m[5];
+    inv[14] = -m[0] * m[5] * m[14] + m[0] * m[6] * m[13] + m[4] * m[1] * m[14] - m[4] * m[2] * m[13] - m[12] * m[1] * m[6] + m[12] * m[2] * m[5];
+    inv[3] = -m[1] * m[6] * m[11] + m[1] * m[7] * m[10] + m[5] * m[2] * m[11] - m[5] * m[3] * m[10] - m[9] * m[2] * m[7] + m[9] * m[3] * m[6];
+    inv[7] = m[0] * m[6] * m[11] - m[0] * m[7] * m[10] - m[4] * m[2] * m[11] + m[4] * m[3] * m[10] + m[8] * m[2] * m[7] - m[8] * m[3] * m[6];
+    inv[11] = -m[0] * m[5] * m[11] + m[0] * m[7] * m[9] + m[4] * m[1] * m[11] - m[4] * m[3] * m[9] - m[8] * m[1] * m[7] + m[8] * m[3] * m[5];
+    inv[15] = m[0] * m[5] * m[10] - m[0] * m[6] * m[9] - m[4] * m[1] * m[10] + m[4] * m[2] * m[9] + m[8] * m[1] * m[6] - m[8] * m[2] * m[5];
+
+    float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+
+    if (det == 0.0f)
+    {
+        *out = (lx_mat4){ .m = { 0.0f } };
+        return 0;
+    }
+
+    det = 1.0f / det;
+
+    for (int i = 0; i < 16; i++)
+        out->m[i] = inv[i] * det;
+
+    return 1;
+}
+
+int scalar_mat4_inverse_affine(const lx_mat4* in, lx_mat4* out)
+{
+    const float* m = in->m;
+
+    // rows of the inverse 3x3, the cross products of pairs of columns
+    float x[3] = { m[5] * m[10] - m[6] * m[9], m[6] * m[8] - m[4] * m[10], m[4] * m[9] - m[5] * m[8] };
+    float y[3] = { m[9] * m[2] - m[10] * m[1], m[10] * m[0] - m[8] * m[2], m[8] * m[1] - m[9] * m[0] };
+    float z[3] = { m[1] * m[6] - m[2] * m[5], m[2] * m[4] - m[0] * m[6], m[0] * m[5] - m[1] * m[4] };
+
+    float det = m[0] * x[0] + m[1] * x[1] + m[2] * x[2];
+
+    if (det == 0.0f)
+    {
+        *out = (lx_mat4){ .m = { 0.0f } };
+        return 0;
+    }
+
+    det = 1.0f / det;
+
+    for (int i = 0; i < 3; i++)
+    {
+        x[i] *= det;
+        y[i] *= det;
+        z[i] *= det;
+    }
+
+    *out = (lx_mat4){
+        .m = {
+            x[0], y[0], z[0], 0.0f,
+            x[1], y[1], z[1], 0.0f,
+            x[2], y[2], z[2], 0.0f,
+            -(x[0] * m[12] + x[1] * m[13] + x[2] * m[14]),
+            -(y[0] * m[12] + y[1] * m[13] + y[2] * m[14]),
+            -(z[0] * m[12] + z[1] * m[13] + z[2] * m[14]),
+            1.0f
+        }
+    };
+
+    return 1;
+}
+
+void scalar_mat4_inverse_rigid(const lx_mat4* in, lx_mat4* out)
+{
+    const float* m = in->m;
+
+    *out = (lx_mat4){
+        .m = {
+            m[0], m[4], m[8], 0.0f,
+            m[1], m[5], m[9], 0.0f,
+            m[2], m[6], m[10], 0.0f,
+            -(m[0] * m[12] + m[1] * m[13] + m[2] * m[14]),
+            -(m[4] * m[12] + m[5] * m[13] + m[6] * m[14]),
+            -(m[8] * m[12] + m[9] * m[13] + m[10] * m[14]),
+            1.0f
+        }
+    };
+}
+
+void scalar_mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        scalar_mat4_mul_vec4(m, &in[i], &out[i]);
+}
+
+void scalar_mat4_mul_vec3_array(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w)
+{
+    const float* e = m->m;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        lx_vec3 v = in[i];
+
+        out[i] = (lx_vec3){
+            e[0] * v.x + e[4] * v.y + e[8] * v.z + e[12] * w,
+            e[1] * v.x + e[5] * v.y + e[9] * v.z + e[13] * w,
+            e[2] * v.x + e[6] * v.y + e[10] * v.z + e[14] * w
+        };
+    }
+}
+
+void scalar_mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        scalar_mat4_mul(a, &in[i], &out[i]);
+}
+
+void scalar_mat4_normal_matrix_array(const lx_mat4* in, lx_mat3* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const float* m = in[i].m;
+
+        float x0 = m[5] * m[10] - m[6] * m[9];
+        float x1 = m[6] * m[8] - m[4] * m[10];
+        float x2 = m[4] * m[9] - m[5] * m[8];
+
+        float det = m[0] * x0 + m[1] * x1 + m[2] * x2;
+
+        if (det == 0.0f)
+        {
+            out[i] = (lx_mat3){ .m = { 0.0f } };
+            continue;
+        }
+
+        float inv_det = 1.0f / det;
+
+        out[i] = (lx_mat3){
+            .m = {
+                x0 * inv_det,
+                x1 * inv_det,
+                x2 * inv_det,
+                (m[9] * m[2] - m[10] * m[1]) * inv_det,
+                (m[10] * m[0] - m[8] * m[2]) * inv_det,
+                (m[8] * m[1] - m[9] * m[0]) * inv_det,
+                (m[1] * m[6] - m[2] * m[5]) * inv_det,
+                (m[2] * m[4] - m[0] * m[6]) * inv_det,
+                (m[0] * m[5] - m[1] * m[4]) * inv_det
+            }
+        };
+    }
+}
+
+void scalar_mat4_from_trs_array(const lx_vec3* t, const lx_quat* r, const lx_vec3* s, lx_mat4* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        lx_quat q = r[i];
+
+        float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+        float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+        float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+        out[i] = (lx_mat4){
+            .m = {
+                (1.0f - 2.0f * (yy + zz)) * s[i].x, 2.0f * (xy + wz) * s[i].x, 2.0f * (xz - wy) * s[i].x, 0.0f,
+                2.0f * (xy - wz) * s[i].y, (1.0f - 2.0f * (xx + zz)) * s[i].y, 2.0f * (yz + wx) * s[i].y, 0.0f,
+                2.0f * (xz + wy) * s[i].z, 2.0f * (yz - wx) * s[i].z, (1.0f - 2.0f * (xx + yy)) * s[i].z, 0.0f,
+                t[i].x, t[i].y, t[i].z, 1.0f
+            }
+        };
+    }
+}
+
+int load_scalar_kernels(math_kernels* k)
+{
+    k->level = LX_SIMD_SCALAR;
+    k->mat4_mul = scalar_mat4_mul;
+    k->mat4_mul_vec4 = scalar_mat4_mul_vec4;
+    k->mat4_inverse = scalar_mat4_inverse;
+    k->mat4_inverse_affine = scalar_mat4_inverse_affine;
+    k->mat4_inverse_rigid = scalar_mat4_inverse_rigid;
+    k->mat4_mul_vec4_array = scalar_mat4_mul_vec4_array;
+    k->mat4_mul_vec3_array = scalar_mat4_mul_vec3_array;
+    k->mat4_mul_array = scalar_mat4_mul_array;
+    k->mat4_normal_matrix_array = scalar_mat4_normal_matrix_array;
+    k->mat4_from_trs_array = scalar_mat4_from_trs_array;
+    load_stream_kernels(k);
+    load_cull_kernels(k);
+    load_ray_kernels(k);
+    load_sweep_kernels(k);
+    load_skin_kernels(k);
+    load_anim_kernels(k);
+    load_pack_kernels(k);
+    load_random_kernels(k);
+    load_noise_kernels(k);
+    return 1;
+}
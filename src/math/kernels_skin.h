@@ -0,0 +1,91 @@
+#pragma once
+
+// skinning kernels written against simd.h, included once by each kernel file
+// alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+#include <math.h>
+
+// private source
+// ----------------------------------------------------------------
+
+#define SKIN_CHUNKS (16 / F32V_WIDTH)
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(skin_vertices)(const lx_mat4* palette, size_t bone_count, const lx_skin_vertex* in, lx_vec3* positions, lx_vec3* normals, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        const lx_skin_vertex* v = &in[i];
+
+        // the palette matrices are blended a vector at a time, most vertices
+        // have fewer than four influences so empty ones are skipped
+        f32v blend[SKIN_CHUNKS];
+        for (int c = 0; c < SKIN_CHUNKS; c++)
+            blend[c] = f32v_set(0.0f);
+
+        for (int s = 0; s < 4; s++)
+        {
+            if (v->weights[s] == 0.0f || v->bones[s] >= bone_count)
+                continue;
+
+            const float* m = palette[v->bones[s]].m;
+            f32v w = f32v_set(v->weights[s]);
+
+            for (int c = 0; c < SKIN_CHUNKS; c++)
+                blend[c] = f32v_madd(f32v_load(m + c * F32V_WIDTH), w, blend[c]);
+        }
+
+        lx_vec3 p = v->position;
+        lx_vec3 n = v->normal;
+        lx_vec3 r;
+
+#if F32V_WIDTH == 4
+        // one column of the blend per vector
+        float t[4];
+        f32v_store(t, f32v_madd(blend[0], f32v_set(p.x), f32v_madd(blend[1], f32v_set(p.y), f32v_madd(blend[2], f32v_set(p.z), blend[3]))));
+        positions[i] = (lx_vec3){ t[0], t[1], t[2] };
+
+        if (normals == NULL)
+            continue;
+
+        f32v_store(t, f32v_madd(blend[0], f32v_set(n.x), f32v_madd(blend[1], f32v_set(n.y), f32v_mul(blend[2], f32v_set(n.z)))));
+        r = (lx_vec3){ t[0], t[1], t[2] };
+#else
+        float e[16];
+        for (int c = 0; c < SKIN_CHUNKS; c++)
+            f32v_store(e + c * F32V_WIDTH, blend[c]);
+
+        positions[i] = (lx_vec3){
+            e[0] * p.x + e[4] * p.y + e[8] * p.z + e[12],
+            e[1] * p.x + e[5] * p.y + e[9] * p.z + e[13],
+            e[2] * p.x + e[6] * p.y + e[10] * p.z + e[14]
+        };
+
+        if (normals == NULL)
+            continue;
+
+        r = (lx_vec3){
+            e[0] * n.x + e[4] * n.y + e[8] * n.z,
+            e[1] * n.x + e[5] * n.y + e[9] * n.z,
+            e[2] * n.x + e[6] * n.y + e[10] * n.z
+        };
+#endif
+
+        float length_sq = r.x * r.x + r.y * r.y + r.z * r.z;
+        float scale = length_sq > 0.0f ? 1.0f / sqrtf(length_sq) : 0.0f;
+        normals[i] = (lx_vec3){ r.x * scale, r.y * scale, r.z * scale };
+    }
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_skin_kernels(math_kernels* k)
+{
+    k->skin_vertices = KERNEL(skin_vertices);
+}
@@ -0,0 +1,335 @@
+#include "math.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include "sse.h"
+
+#define KERNEL(name) sse2_##name
+#include "kernels_stream.h"
+#include "kernels_cull.h"
+#include "kernels_ray.h"
+#include "kernels_sweep.h"
+#include "kernels_skin.h"
+#include "kernels_anim.h"
+#include "kernels_pack.h"
+#include "kernels_random.h"
+#include "kernels_noise.h"
+
+// private source
+// ----------------------------------------------------------------
+
+static void mat4_mul(const lx_mat4* a, const lx_mat4* b, lx_mat4* out)
+{
+    __m128 a0 = _mm_loadu_ps(&a->m[0]);
+    __m128 a1 = _mm_loadu_ps(&a->m[4]);
+    __m128 a2 = _mm_loadu_ps(&a->m[8]);
+    __m128 a3 = _mm_loadu_ps(&a->m[12]);
+
+    __m128 b0 = _mm_loadu_ps(&b->m[0]);
+    __m128 b1 = _mm_loadu_ps(&b->m[4]);
+    __m128 b2 = _mm_loadu_ps(&b->m[8]);
+    __m128 b3 = _mm_loadu_ps(&b->m[12]);
+
+    _mm_storeu_ps(&out->m[0], mat4_column(a0, a1, a2, a3, b0));
+    _mm_storeu_ps(&out->m[4], mat4_column(a0, a1, a2, a3, b1));
+    _mm_storeu_ps(&out->m[8], mat4_column(a0, a1, a2, a3, b2));
+    _mm_storeu_ps(&out->m[12], mat4_column(a0, a1, a2, a3, b3));
+}
+
+static void mat4_mul_vec4(const lx_mat4* m, const lx_vec4* v, lx_vec4* out)
+{
+    __m128 r = mat4_column(
+        _mm_loadu_ps(&m->m[0]),
+        _mm_loadu_ps(&m->m[4]),
+        _mm_loadu_ps(&m->m[8]),
+        _mm_loadu_ps(&m->m[12]),
+        _mm_loadu_ps(&v->x)
+    );
+
+    _mm_storeu_ps(&out->x, r);
+}
+
+// horizontal sum of a * b broadcast to every lane
+static inline __m128 trace_sse2(__m128 a, __m128 b)
+{
+    __m128 t = _mm_mul_ps(a, b);
+    t = _mm_add_ps(t, SWIZZLE(t, 1, 0, 3, 2));
+    return _mm_add_ps(t, SWIZZLE(t, 2, 3, 0, 1));
+}
+
+static int mat4_inverse(const lx_mat4* in, lx_mat4* out)
+{
+    MAT4_INVERSE_BODY(trace_sse2)
+}
+
+static void mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count)
+{
+    __m128 c0 = _mm_loadu_ps(&m->m[0]);
+    __m128 c1 = _mm_loadu_ps(&m->m[4]);
+    __m128 c2 = _mm_loadu_ps(&m->m[8]);
+    __m128 c3 = _mm_loadu_ps(&m->m[12]);
+
+    for (size_t i = 0; i < count; i++)
+        _mm_storeu_ps(&out[i].x, mat4_column(c0, c1, c2, c3, _mm_loadu_ps(&in[i].x)));
+}
+
+static void mat4_mul_vec3_array(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w)
+{
+    const float* e = m->m;
+
+    __m128 m0 = _mm_set1_ps(e[0]), m4 = _mm_set1_ps(e[4]), m8 = _mm_set1_ps(e[8]);
+    __m128 m1 = _mm_set1_ps(e[1]), m5 = _mm_set1_ps(e[5]), m9 = _mm_set1_ps(e[9]);
+    __m128 m2 = _mm_set1_ps(e[2]), m6 = _mm_set1_ps(e[6]), m10 = _mm_set1_ps(e[10]);
+
+    __m128 tx = _mm_set1_ps(e[12] * w);
+    __m128 ty = _mm_set1_ps(e[13] * w);
+    __m128 tz = _mm_set1_ps(e[14] * w);
+
+    // four vectors at a time as one register per component
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        load_vec3x4(&in[i].x, &x, &y, &z);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_add_ps(_mm_mul_ps(m8, z), tx));
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_add_ps(_mm_mul_ps(m9, z), ty));
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_add_ps(_mm_mul_ps(m10, z), tz));
+
+        store_vec3x4(&out[i].x, rx, ry, rz);
+    }
+
+    scalar_mat4_mul_vec3_array(m, in + i, out + i, count - i, w);
+}
+
+static int mat4_inverse_affine(const lx_mat4* m, lx_mat4* out)
+{
+    __m128 c0 = _mm_loadu_ps(&m->m[0]);
+    __m128 c1 = _mm_loadu_ps(&m->m[4]);
+    __m128 c2 = _mm_loadu_ps(&m->m[8]);
+    __m128 t = _mm_loadu_ps(&m->m[12]);
+
+    // rows of the inverse 3x3, each with a zero w lane
+    __m128 x = cross3(c1, c2);
+    __m128 y = cross3(c2, c0);
+    __m128 z = cross3(c0, c1);
+
+    __m128 det = _mm_mul_ps(c0, x);
+    det = _mm_add_ps(det, SWIZZLE(det, 1, 0, 3, 2));
+    det = _mm_add_ps(det, SWIZZLE(det, 2, 3, 0, 1));
+
+    if (_mm_cvtss_f32(det) == 0.0f)
+    {
+        *out = (lx_mat4){ .m = { 0.0f } };
+        return 0;
+    }
+
+    __m128 inv_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+    x = _mm_mul_ps(x, inv_det);
+    y = _mm_mul_ps(y, inv_det);
+    z = _mm_mul_ps(z, inv_det);
+
+    __m128 w = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    __m128 n3 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, SPLAT(t, 0)), _mm_mul_ps(y, SPLAT(t, 1))), _mm_mul_ps(z, SPLAT(t, 2)));
+
+    _mm_storeu_ps(&out->m[0], x);
+    _mm_storeu_ps(&out->m[4], y);
+    _mm_storeu_ps(&out->m[8], z);
+    _mm_storeu_ps(&out->m[12], _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), n3));
+    return 1;
+}
+
+static void mat4_inverse_rigid(const lx_mat4* m, lx_mat4* out)
+{
+    __m128 c0 = _mm_loadu_ps(&m->m[0]);
+    __m128 c1 = _mm_loadu_ps(&m->m[4]);
+    __m128 c2 = _mm_loadu_ps(&m->m[8]);
+    __m128 t = _mm_loadu_ps(&m->m[12]);
+
+    // transposing against a zero row also clears the w lanes of the rotation
+    __m128 w = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(c0, c1, c2, w);
+
+    __m128 n3 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, SPLAT(t, 0)), _mm_mul_ps(c1, SPLAT(t, 1))), _mm_mul_ps(c2, SPLAT(t, 2)));
+
+    _mm_storeu_ps(&out->m[0], c0);
+    _mm_storeu_ps(&out->m[4], c1);
+    _mm_storeu_ps(&out->m[8], c2);
+    _mm_storeu_ps(&out->m[12], _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), n3));
+}
+
+static void mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count)
+{
+    __m128 a0 = _mm_loadu_ps(&a->m[0]);
+    __m128 a1 = _mm_loadu_ps(&a->m[4]);
+    __m128 a2 = _mm_loadu_ps(&a->m[8]);
+    __m128 a3 = _mm_loadu_ps(&a->m[12]);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128 b0 = _mm_loadu_ps(&in[i].m[0]);
+        __m128 b1 = _mm_loadu_ps(&in[i].m[4]);
+        __m128 b2 = _mm_loadu_ps(&in[i].m[8]);
+        __m128 b3 = _mm_loadu_ps(&in[i].m[12]);
+
+        _mm_storeu_ps(&out[i].m[0], mat4_column(a0, a1, a2, a3, b0));
+        _mm_storeu_ps(&out[i].m[4], mat4_column(a0, a1, a2, a3, b1));
+        _mm_storeu_ps(&out[i].m[8], mat4_column(a0, a1, a2, a3, b2));
+        _mm_storeu_ps(&out[i].m[12], mat4_column(a0, a1, a2, a3, b3));
+    }
+}
+
+static void mat4_normal_matrix_array(const lx_mat4* in, lx_mat3* out, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        __m128 c0 = _mm_loadu_ps(&in[i].m[0]);
+        __m128 c1 = _mm_loadu_ps(&in[i].m[4]);
+        __m128 c2 = _mm_loadu_ps(&in[i].m[8]);
+
+        __m128 x = cross3(c1, c2);
+        __m128 y = cross3(c2, c0);
+        __m128 z = cross3(c0, c1);
+
+        // x has a zero w lane, so a four lane sum is the 3D dot product
+        __m128 det = _mm_mul_ps(c0, x);
+        det = _mm_add_ps(det, SWIZZLE(det, 1, 0, 3, 2));
+        det = _mm_add_ps(det, SWIZZLE(det, 2, 3, 0, 1));
+
+        if (_mm_cvtss_f32(det) == 0.0f)
+        {
+            out[i] = (lx_mat3){ .m = { 0.0f } };
+            continue;
+        }
+
+        __m128 inv_det = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+        // each column is written four lanes wide, the spare lane being
+        // overwritten by the next column, or by the next matrix for the last.
+        // storing straight to out avoids reloading a temporary, which stalls
+        // on store forwarding
+        if (i + 1 < count)
+        {
+            _mm_storeu_ps(&out[i].m[0], _mm_mul_ps(x, inv_det));
+            _mm_storeu_ps(&out[i].m[3], _mm_mul_ps(y, inv_det));
+            _mm_storeu_ps(&out[i].m[6], _mm_mul_ps(z, inv_det));
+            continue;
+        }
+
+        float n[12];
+        _mm_storeu_ps(&n[0], _mm_mul_ps(x, inv_det));
+        _mm_storeu_ps(&n[3], _mm_mul_ps(y, inv_det));
+        _mm_storeu_ps(&n[6], _mm_mul_ps(z, inv_det));
+
+        for (int j = 0; j < 9; j++)
+            out[i].m[j] = n[j];
+    }
+}
+
+static void mat4_from_trs_array(const lx_vec3* t, const lx_quat* r, const lx_vec3* s, lx_mat4* out, size_t count)
+{
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 two = _mm_set1_ps(2.0f);
+    __m128 zero = _mm_setzero_ps();
+    size_t i = 0;
+
+    // four transforms at a time, with one register per component
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 qx = _mm_loadu_ps(&r[i].x);
+        __m128 qy = _mm_loadu_ps(&r[i + 1].x);
+        __m128 qz = _mm_loadu_ps(&r[i + 2].x);
+        __m128 qw = _mm_loadu_ps(&r[i + 3].x);
+        _MM_TRANSPOSE4_PS(qx, qy, qz, qw);
+
+        __m128 tx, ty, tz, sx, sy, sz;
+        load_vec3x4(&t[i].x, &tx, &ty, &tz);
+        load_vec3x4(&s[i].x, &sx, &sy, &sz);
+
+        __m128 x2 = _mm_mul_ps(qx, two), y2 = _mm_mul_ps(qy, two), z2 = _mm_mul_ps(qz, two);
+        __m128 xx = _mm_mul_ps(qx, x2), yy = _mm_mul_ps(qy, y2), zz = _mm_mul_ps(qz, z2);
+        __m128 xy = _mm_mul_ps(qx, y2), xz = _mm_mul_ps(qx, z2), yz = _mm_mul_ps(qy, z2);
+        __m128 wx = _mm_mul_ps(qw, x2), wy = _mm_mul_ps(qw, y2), wz = _mm_mul_ps(qw, z2);
+
+        // each group of four is one column of the four matrices, transposed
+        // back so each register holds one column of one matrix
+        __m128 a0 = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(yy, zz)), sx);
+        __m128 a1 = _mm_mul_ps(_mm_add_ps(xy, wz), sx);
+        __m128 a2 = _mm_mul_ps(_mm_sub_ps(xz, wy), sx);
+        __m128 a3 = zero;
+        _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+
+        __m128 b0 = _mm_mul_ps(_mm_sub_ps(xy, wz), sy);
+        __m128 b1 = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, zz)), sy);
+        __m128 b2 = _mm_mul_ps(_mm_add_ps(yz, wx), sy);
+        __m128 b3 = zero;
+        _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+
+        __m128 c0 = _mm_mul_ps(_mm_add_ps(xz, wy), sz);
+        __m128 c1 = _mm_mul_ps(_mm_sub_ps(yz, wx), sz);
+        __m128 c2 = _mm_mul_ps(_mm_sub_ps(one, _mm_add_ps(xx, yy)), sz);
+        __m128 c3 = zero;
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        __m128 d3 = one;
+        _MM_TRANSPOSE4_PS(tx, ty, tz, d3);
+
+        _mm_storeu_ps(&out[i].m[0], a0);
+        _mm_storeu_ps(&out[i].m[4], b0);
+        _mm_storeu_ps(&out[i].m[8], c0);
+        _mm_storeu_ps(&out[i].m[12], tx);
+        _mm_storeu_ps(&out[i + 1].m[0], a1);
+        _mm_storeu_ps(&out[i + 1].m[4], b1);
+        _mm_storeu_ps(&out[i + 1].m[8], c1);
+        _mm_storeu_ps(&out[i + 1].m[12], ty);
+        _mm_storeu_ps(&out[i + 2].m[0], a2);
+        _mm_storeu_ps(&out[i + 2].m[4], b2);
+        _mm_storeu_ps(&out[i + 2].m[8], c2);
+        _mm_storeu_ps(&out[i + 2].m[12], tz);
+        _mm_storeu_ps(&out[i + 3].m[0], a3);
+        _mm_storeu_ps(&out[i + 3].m[4], b3);
+        _mm_storeu_ps(&out[i + 3].m[8], c3);
+        _mm_storeu_ps(&out[i + 3].m[12], d3);
+    }
+
+    scalar_mat4_from_trs_array(t + i, r + i, s + i, out + i, count - i);
+}
+
+// private header
+// ----------------------------------------------------------------
+
+int load_sse2_kernels(math_kernels* k)
+{
+    k->level = LX_SIMD_SSE2;
+    k->mat4_mul = mat4_mul;
+    k->mat4_mul_vec4 = mat4_mul_vec4;
+    k->mat4_inverse = mat4_inverse;
+    k->mat4_inverse_affine = mat4_inverse_affine;
+    k->mat4_inverse_rigid = mat4_inverse_rigid;
+    k->mat4_mul_vec4_array = mat4_mul_vec4_array;
+    k->mat4_mul_vec3_array = mat4_mul_vec3_array;
+    k->mat4_mul_array = mat4_mul_array;
+    k->mat4_normal_matrix_array = mat4_normal_matrix_array;
+    k->mat4_from_trs_array = mat4_from_trs_array;
+    load_stream_kernels(k);
+    load_cull_kernels(k);
+    load_ray_kernels(k);
+    load_sweep_kernels(k);
+    load_skin_kernels(k);
+    load_anim_kernels(k);
+    load_pack_kernels(k);
+    load_random_kernels(k);
+    load_noise_kernels(k);
+    return 1;
+}
+
+#else
+
+int load_sse2_kernels(math_kernels* k)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,44 @@
+#include "math.h"
+
+#if defined(__SSE4_1__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+
+#include "sse.h"
+#include <smmintrin.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// sse4.1 has no wider registers, the only kernel it improves is the inverse
+// where the trace term becomes a single dot product
+
+static inline __m128 trace_sse41(__m128 a, __m128 b)
+{
+    return _mm_dp_ps(a, b, 0xFF);
+}
+
+static int mat4_inverse(const lx_mat4* in, lx_mat4* out)
+{
+    MAT4_INVERSE_BODY(trace_sse41)
+}
+
+// private header
+// ----------------------------------------------------------------
+
+int load_sse41_kernels(math_kernels* k)
+{
+    if (!load_sse2_kernels(k))
+        return 0;
+
+    k->level = LX_SIMD_SSE41;
+    k->mat4_inverse = mat4_inverse;
+    return 1;
+}
+
+#else
+
+int load_sse41_kernels(math_kernels* k)
+{
+    return 0;
+}
+
+#endif
@@ -0,0 +1,277 @@
+#pragma once
+
+// stream kernels written against simd.h, included once by each kernel file.
+// the including file defines KERNEL(name) to give the functions a unique name
+// for its instruction set, and calls load_stream_kernels from its loader.
+
+#include "math.h"
+#include "simd.h"
+
+#include <math.h>
+
+// private header
+// ----------------------------------------------------------------
+
+void KERNEL(float_array_add)(const float* a, const float* b, float* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        f32v_store(out + i, f32v_add(f32v_load(a + i), f32v_load(b + i)));
+
+    for (; i < count; i++)
+        out[i] = a[i] + b[i];
+}
+
+void KERNEL(float_array_sub)(const float* a, const float* b, float* out, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        f32v_store(out + i, f32v_sub(f32v_load(a + i), f32v_load(b + i)));
+
+    for (; i < count; i++)
+        out[i] = a[i] - b[i];
+}
+
+void KERNEL(float_array_scale)(const float* a, float s, float* out, size_t count)
+{
+    f32v vs = f32v_set(s);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        f32v_store(out + i, f32v_mul(f32v_load(a + i), vs));
+
+    for (; i < count; i++)
+        out[i] = a[i] * s;
+}
+
+void KERNEL(float_array_lerp)(const float* a, const float* b, float t, float* out, size_t count)
+{
+    f32v vt = f32v_set(t);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+    {
+        f32v va = f32v_load(a + i);
+        f32v_store(out + i, f32v_madd(f32v_sub(f32v_load(b + i), va), vt, va));
+    }
+
+    for (; i < count; i++)
+        out[i] = a[i] + (b[i] - a[i]) * t;
+}
+
+void KERNEL(float_array_clamp)(const float* a, float min, float max, float* out, size_t count)
+{
+    f32v vmin = f32v_set(min);
+    f32v vmax = f32v_set(max);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        f32v_store(out + i, f32v_min(f32v_max(f32v_load(a + i), vmin), vmax));
+
+    for (; i < count; i++)
+        out[i] = a[i] < min ? min : (a[i] > max ? max : a[i]);
+}
+
+float KERNEL(float_array_min)(const float* a, size_t count)
+{
+    f32v vm = f32v_set(INFINITY);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        vm = f32v_min(vm, f32v_load(a + i));
+
+    float m = f32v_hmin(vm);
+    for (; i < count; i++)
+        m = a[i] < m ? a[i] : m;
+
+    return m;
+}
+
+float KERNEL(float_array_max)(const float* a, size_t count)
+{
+    f32v vm = f32v_set(-INFINITY);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= count; i += F32V_WIDTH)
+        vm = f32v_max(vm, f32v_load(a + i));
+
+    float m = f32v_hmax(vm);
+    for (; i < count; i++)
+        m = a[i] > m ? a[i] : m;
+
+    return m;
+}
+
+void KERNEL(vec2_stream_dot)(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= a->count; i += F32V_WIDTH)
+    {
+        f32v d = f32v_mul(f32v_load(a->x + i), f32v_load(b->x + i));
+        d = f32v_madd(f32v_load(a->y + i), f32v_load(b->y + i), d);
+        f32v_store(out + i, d);
+    }
+
+    for (; i < a->count; i++)
+        out[i] = a->x[i] * b->x[i] + a->y[i] * b->y[i];
+}
+
+void KERNEL(vec3_stream_dot)(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= a->count; i += F32V_WIDTH)
+    {
+        f32v d = f32v_mul(f32v_load(a->x + i), f32v_load(b->x + i));
+        d = f32v_madd(f32v_load(a->y + i), f32v_load(b->y + i), d);
+        d = f32v_madd(f32v_load(a->z + i), f32v_load(b->z + i), d);
+        f32v_store(out + i, d);
+    }
+
+    for (; i < a->count; i++)
+        out[i] = a->x[i] * b->x[i] + a->y[i] * b->y[i] + a->z[i] * b->z[i];
+}
+
+void KERNEL(vec3_stream_cross)(const lx_vec3_stream* a, const lx_vec3_stream* b, const lx_vec3_stream* out)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= a->count; i += F32V_WIDTH)
+    {
+        f32v ax = f32v_load(a->x + i), ay = f32v_load(a->y + i), az = f32v_load(a->z + i);
+        f32v bx = f32v_load(b->x + i), by = f32v_load(b->y + i), bz = f32v_load(b->z + i);
+
+        f32v_store(out->x + i, f32v_sub(f32v_mul(ay, bz), f32v_mul(az, by)));
+        f32v_store(out->y + i, f32v_sub(f32v_mul(az, bx), f32v_mul(ax, bz)));
+        f32v_store(out->z + i, f32v_sub(f32v_mul(ax, by), f32v_mul(ay, bx)));
+    }
+
+    for (; i < a->count; i++)
+    {
+        float ax = a->x[i], ay = a->y[i], az = a->z[i];
+        float bx = b->x[i], by = b->y[i], bz = b->z[i];
+
+        out->x[i] = ay * bz - az * by;
+        out->y[i] = az * bx - ax * bz;
+        out->z[i] = ax * by - ay * bx;
+    }
+}
+
+void KERNEL(vec2_stream_normalize)(const lx_vec2_stream* v, const lx_vec2_stream* out)
+{
+    f32v zero = f32v_set(0.0f);
+    f32v one = f32v_set(1.0f);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= v->count; i += F32V_WIDTH)
+    {
+        f32v x = f32v_load(v->x + i), y = f32v_load(v->y + i);
+        f32v len2 = f32v_madd(y, y, f32v_mul(x, x));
+
+        // zero length vectors scale by zero rather than by infinity
+        f32v inv = f32v_select_gt(len2, zero, f32v_div(one, f32v_sqrt(len2)));
+
+        f32v_store(out->x + i, f32v_mul(x, inv));
+        f32v_store(out->y + i, f32v_mul(y, inv));
+    }
+
+    for (; i < v->count; i++)
+    {
+        float x = v->x[i], y = v->y[i];
+        float len2 = x * x + y * y;
+        float inv = len2 > 0.0f ? 1.0f / sqrtf(len2) : 0.0f;
+
+        out->x[i] = x * inv;
+        out->y[i] = y * inv;
+    }
+}
+
+void KERNEL(vec3_stream_normalize)(const lx_vec3_stream* v, const lx_vec3_stream* out)
+{
+    f32v zero = f32v_set(0.0f);
+    f32v one = f32v_set(1.0f);
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= v->count; i += F32V_WIDTH)
+    {
+        f32v x = f32v_load(v->x + i), y = f32v_load(v->y + i), z = f32v_load(v->z + i);
+        f32v len2 = f32v_madd(z, z, f32v_madd(y, y, f32v_mul(x, x)));
+        f32v inv = f32v_select_gt(len2, zero, f32v_div(one, f32v_sqrt(len2)));
+
+        f32v_store(out->x + i, f32v_mul(x, inv));
+        f32v_store(out->y + i, f32v_mul(y, inv));
+        f32v_store(out->z + i, f32v_mul(z, inv));
+    }
+
+    for (; i < v->count; i++)
+    {
+        float x = v->x[i], y = v->y[i], z = v->z[i];
+        float len2 = x * x + y * y + z * z;
+        float inv = len2 > 0.0f ? 1.0f / sqrtf(len2) : 0.0f;
+
+        out->x[i] = x * inv;
+        out->y[i] = y * inv;
+        out->z[i] = z * inv;
+    }
+}
+
+void KERNEL(vec2_stream_distance)(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= a->count; i += F32V_WIDTH)
+    {
+        f32v dx = f32v_sub(f32v_load(b->x + i), f32v_load(a->x + i));
+        f32v dy = f32v_sub(f32v_load(b->y + i), f32v_load(a->y + i));
+        f32v_store(out + i, f32v_sqrt(f32v_madd(dy, dy, f32v_mul(dx, dx))));
+    }
+
+    for (; i < a->count; i++)
+    {
+        float dx = b->x[i] - a->x[i], dy = b->y[i] - a->y[i];
+        out[i] = sqrtf(dx * dx + dy * dy);
+    }
+}
+
+void KERNEL(vec3_stream_distance)(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out)
+{
+    size_t i = 0;
+
+    for (; i + F32V_WIDTH <= a->count; i += F32V_WIDTH)
+    {
+        f32v dx = f32v_sub(f32v_load(b->x + i), f32v_load(a->x + i));
+        f32v dy = f32v_sub(f32v_load(b->y + i), f32v_load(a->y + i));
+        f32v dz = f32v_sub(f32v_load(b->z + i), f32v_load(a->z + i));
+        f32v_store(out + i, f32v_sqrt(f32v_madd(dz, dz, f32v_madd(dy, dy, f32v_mul(dx, dx)))));
+    }
+
+    for (; i < a->count; i++)
+    {
+        float dx = b->x[i] - a->x[i], dy = b->y[i] - a->y[i], dz = b->z[i] - a->z[i];
+        out[i] = sqrtf(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_stream_kernels(math_kernels* k)
+{
+    k->float_array_add = KERNEL(float_array_add);
+    k->float_array_sub = KERNEL(float_array_sub);
+    k->float_array_scale = KERNEL(float_array_scale);
+    k->float_array_lerp = KERNEL(float_array_lerp);
+    k->float_array_clamp = KERNEL(float_array_clamp);
+    k->float_array_min = KERNEL(float_array_min);
+    k->float_array_max = KERNEL(float_array_max);
+    k->vec2_stream_dot = KERNEL(vec2_stream_dot);
+    k->vec3_stream_dot = KERNEL(vec3_stream_dot);
+    k->vec3_stream_cross = KERNEL(vec3_stream_cross);
+    k->vec2_stream_normalize = KERNEL(vec2_stream_normalize);
+    k->vec3_stream_normalize = KERNEL(vec3_stream_normalize);
+    k->vec2_stream_distance = KERNEL(vec2_stream_distance);
+    k->vec3_stream_distance = KERNEL(vec3_stream_distance);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+// sweep and prune kernels written against simd.h, included once by each
+// kernel file alongside kernels_stream.h, see there for how they are named
+
+#include "math.h"
+#include "simd.h"
+
+// private source
+// ----------------------------------------------------------------
+
+static inline size_t sweep_pairs_single(const sweep_bounds* b, size_t count, lx_pair* pairs, size_t capacity)
+{
+    size_t n = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        float end = b->max[0][i];
+
+        for (size_t j = i + 1; j < count && b->min[0][j] <= end; j++)
+        {
+            if (b->max[1][j] < b->min[1][i] || b->min[1][j] > b->max[1][i] ||
+                b->max[2][j] < b->min[2][i] || b->min[2][j] > b->max[2][i])
+                continue;
+
+            uint32_t id = b->ids[i];
+            uint32_t other = b->ids[j];
+
+            if (n < capacity)
+                pairs[n] = id < other ? (lx_pair){ id, other } : (lx_pair){ other, id };
+
+            n++;
+        }
+    }
+
+    return n;
+}
+
+// private header
+// ----------------------------------------------------------------
+
+size_t KERNEL(sweep_pairs)(const sweep_bounds* b, size_t count, lx_pair* pairs, size_t capacity)
+{
+    // a single lane does better with the early outs of the scalar test
+    if (F32V_WIDTH == 1)
+        return sweep_pairs_single(b, count, pairs, capacity);
+
+    const int all = (1 << F32V_WIDTH) - 1;
+    size_t n = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        f32v end = f32v_set(b->max[0][i]);
+        f32v min_y = f32v_set(b->min[1][i]);
+        f32v max_y = f32v_set(b->max[1][i]);
+        f32v min_z = f32v_set(b->min[2][i]);
+        f32v max_z = f32v_set(b->max[2][i]);
+        uint32_t id = b->ids[i];
+
+        // the boxes after i start in order along the sweep axis, so the first
+        // one starting past its end closes the run, the padding closes it at
+        // the end of the arrays
+        for (size_t j = i + 1; j < count; j += F32V_WIDTH)
+        {
+            f32v in_run = f32v_cmpge(end, f32v_load(&b->min[0][j]));
+            int run = f32v_movemask(in_run);
+            if (run == 0)
+                break;
+
+            f32v overlap = f32v_and(in_run, f32v_cmpge(f32v_load(&b->max[1][j]), min_y));
+            overlap = f32v_and(overlap, f32v_cmpge(max_y, f32v_load(&b->min[1][j])));
+            overlap = f32v_and(overlap, f32v_cmpge(f32v_load(&b->max[2][j]), min_z));
+            overlap = f32v_and(overlap, f32v_cmpge(max_z, f32v_load(&b->min[2][j])));
+
+            int bits = f32v_movemask(overlap);
+            for (int l = 0; bits != 0 && l < F32V_WIDTH; l++)
+            {
+                if (!(bits & (1 << l)))
+                    continue;
+
+                uint32_t other = b->ids[j + l];
+                if (n < capacity)
+                    pairs[n] = id < other ? (lx_pair){ id, other } : (lx_pair){ other, id };
+
+                n++;
+            }
+
+            if (run != all)
+                break;
+        }
+    }
+
+    return n;
+}
+
+// private source
+// ----------------------------------------------------------------
+
+static void load_sweep_kernels(math_kernels* k)
+{
+    k->sweep_pairs = KERNEL(sweep_pairs);
+}
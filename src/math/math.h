@@ -0,0 +1,205 @@
+#pragma once
+
+#include "lux/math.h"
+#include "lux/spatial.h"
+#include "lux/scene.h"
+
+// types
+// ----------------------------------------------------------------
+
+// leaves have a non zero count of primitives starting at index, interior
+// nodes have their two children at index and index + 1
+typedef struct _bvh_node
+{
+    float min[3];
+    uint32_t index;
+    float max[3];
+    uint32_t count;
+}
+bvh_node;
+
+// builds stop splitting at this depth, which bounds the traversal stack
+#define BVH_MAX_DEPTH 48
+
+// triangles are stored as a vertex and the two edges leaving it
+typedef struct _bvh_triangle { lx_vec3 v0; lx_vec3 e1; lx_vec3 e2; } bvh_triangle;
+
+// one of triangles or boxes is set, stored in leaf order, with ids mapping
+// them back to the indices they were built from
+typedef struct _bvh_tree
+{
+    const bvh_node* nodes;
+    const bvh_triangle* triangles;
+    const lx_aabb* boxes;
+    const uint32_t* ids;
+}
+bvh_tree;
+
+// boxes sorted by their minimum along the first axis, each array is followed
+// by SWEEP_PADDING entries with a minimum of infinity, so a kernel may read
+// a whole vector past the end
+typedef struct _sweep_bounds
+{
+    const float* min[3];
+    const float* max[3];
+    const uint32_t* ids;
+}
+sweep_bounds;
+
+// the widest simd width any kernel uses
+#define SWEEP_PADDING 8
+
+// animation samples are interpolated this many at a time
+#define ANIM_BATCH 64
+
+// the two keys around each sample dequantized into component arrays, with
+// the fraction between them. translations are vec 0 to 2 and scales 3 to 5.
+// rotations arrive as their three smallest components followed by the index
+// of the largest, which is rebuilt as positive, and leave as quaternions
+typedef struct _anim_batch
+{
+    float vec_a[6][ANIM_BATCH];
+    float vec_b[6][ANIM_BATCH];
+    float vec_t[2][ANIM_BATCH];
+    float quat_a[4][ANIM_BATCH];
+    float quat_b[4][ANIM_BATCH];
+    float quat_t[ANIM_BATCH];
+}
+anim_batch;
+
+// the generators in an lx_rng, a multiple of every simd width
+#define RNG_LANES 8
+
+typedef struct _math_kernels
+{
+    lx_simd_level level;
+
+    // out may alias any input
+    void (*mat4_mul)(const lx_mat4* a, const lx_mat4* b, lx_mat4* out);
+    void (*mat4_mul_vec4)(const lx_mat4* m, const lx_vec4* v, lx_vec4* out);
+
+    // returns 0 and writes a zero matrix if m is singular
+    int (*mat4_inverse)(const lx_mat4* m, lx_mat4* out);
+    int (*mat4_inverse_affine)(const lx_mat4* m, lx_mat4* out);
+
+    // assumes the upper 3x3 is orthonormal
+    void (*mat4_inverse_rigid)(const lx_mat4* m, lx_mat4* out);
+
+    // out may be the same array as in
+    void (*mat4_mul_vec4_array)(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count);
+    void (*mat4_mul_vec3_array)(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w);
+    void (*mat4_mul_array)(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count);
+    void (*mat4_normal_matrix_array)(const lx_mat4* in, lx_mat3* out, size_t count);
+    void (*mat4_from_trs_array)(const lx_vec3* t, const lx_quat* r, const lx_vec3* s, lx_mat4* out, size_t count);
+
+    // streams are processed one component array at a time where possible, out
+    // may be the same array or stream as any input
+    void (*float_array_add)(const float* a, const float* b, float* out, size_t count);
+    void (*float_array_sub)(const float* a, const float* b, float* out, size_t count);
+    void (*float_array_scale)(const float* a, float s, float* out, size_t count);
+    void (*float_array_lerp)(const float* a, const float* b, float t, float* out, size_t count);
+    void (*float_array_clamp)(const float* a, float min, float max, float* out, size_t count);
+    float (*float_array_min)(const float* a, size_t count);
+    float (*float_array_max)(const float* a, size_t count);
+    void (*vec2_stream_dot)(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out);
+    void (*vec3_stream_dot)(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out);
+    void (*vec3_stream_cross)(const lx_vec3_stream* a, const lx_vec3_stream* b, const lx_vec3_stream* out);
+    void (*vec2_stream_normalize)(const lx_vec2_stream* v, const lx_vec2_stream* out);
+    void (*vec3_stream_normalize)(const lx_vec3_stream* v, const lx_vec3_stream* out);
+    void (*vec2_stream_distance)(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out);
+    void (*vec3_stream_distance)(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out);
+
+    // writes (count + 31) / 32 mask words
+    void (*frustum_cull_spheres)(const lx_frustum* f, const lx_sphere* s, size_t count, uint32_t* mask);
+    void (*frustum_cull_aabbs)(const lx_frustum* f, const lx_aabb* b, size_t count, uint32_t* mask);
+
+    // rays are traversed in packets of the simd width, returns the hit count
+    size_t (*bvh_raycast)(const bvh_tree* tree, const lx_ray* rays, size_t count, float max_t, lx_ray_hit* hits);
+
+    // writes the first capacity overlapping pairs, returns the total count
+    size_t (*sweep_pairs)(const sweep_bounds* b, size_t count, lx_pair* pairs, size_t capacity);
+
+    // normals may be NULL, influences with a bone of bone_count or more are skipped
+    void (*skin_vertices)(const lx_mat4* palette, size_t bone_count, const lx_skin_vertex* in, lx_vec3* positions, lx_vec3* normals, size_t count);
+
+    // writes the interpolated samples over the a arrays, lanes up to the next
+    // multiple of the simd width are read and written
+    void (*anim_blend)(anim_batch* b, size_t count);
+
+    // out may not alias in, positions are mapped through (p - offset) * inv_scale
+    void (*pack_half)(const float* in, uint16_t* out, size_t count);
+    void (*pack_positions)(const lx_vec3* in, int16_t* out, size_t count, lx_vec3 offset, lx_vec3 inv_scale);
+    void (*pack_normals)(const lx_vec3* in, int16_t* out, size_t count);
+    void (*pack_tangents)(const lx_vec4* in, uint32_t* out, size_t count);
+    void (*pack_colors)(const lx_vec4* in, uint8_t* out, size_t count);
+
+    // every generator steps once per RNG_LANES values, a partial block is
+    // drawn whole and the rest of it dropped
+    void (*rng_floats)(lx_rng* rng, float* out, size_t count, float min, float range);
+    void (*rng_vec3)(lx_rng* rng, lx_vec3* out, size_t count, int inside);
+
+    void (*noise_simplex2)(const lx_vec2* in, float* out, size_t count);
+    void (*noise_simplex3)(const lx_vec3* in, float* out, size_t count);
+}
+math_kernels;
+
+// dispatch
+// ----------------------------------------------------------------
+
+extern math_kernels mt_kernels;
+
+// selects the best kernels for the running cpu, unless a level was forced
+void math_init();
+
+// kernels
+// ----------------------------------------------------------------
+
+// the scalar kernels are also the initial contents of the dispatch table, so
+// the math api works before lux has been initialised
+void scalar_mat4_mul(const lx_mat4* a, const lx_mat4* b, lx_mat4* out);
+void scalar_mat4_mul_vec4(const lx_mat4* m, const lx_vec4* v, lx_vec4* out);
+int scalar_mat4_inverse(const lx_mat4* m, lx_mat4* out);
+int scalar_mat4_inverse_affine(const lx_mat4* m, lx_mat4* out);
+void scalar_mat4_inverse_rigid(const lx_mat4* m, lx_mat4* out);
+void scalar_mat4_mul_vec4_array(const lx_mat4* m, const lx_vec4* in, lx_vec4* out, size_t count);
+void scalar_mat4_mul_vec3_array(const lx_mat4* m, const lx_vec3* in, lx_vec3* out, size_t count, float w);
+void scalar_mat4_mul_array(const lx_mat4* a, const lx_mat4* in, lx_mat4* out, size_t count);
+void scalar_mat4_normal_matrix_array(const lx_mat4* in, lx_mat3* out, size_t count);
+void scalar_mat4_from_trs_array(const lx_vec3* t, const lx_quat* r, const lx_vec3* s, lx_mat4* out, size_t count);
+void scalar_float_array_add(const float* a, const float* b, float* out, size_t count);
+void scalar_float_array_sub(const float* a, const float* b, float* out, size_t count);
+void scalar_float_array_scale(const float* a, float s, float* out, size_t count);
+void scalar_float_array_lerp(const float* a, const float* b, float t, float* out, size_t count);
+void scalar_float_array_clamp(const float* a, float min, float max, float* out, size_t count);
+float scalar_float_array_min(const float* a, size_t count);
+float scalar_float_array_max(const float* a, size_t count);
+void scalar_vec2_stream_dot(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out);
+void scalar_vec3_stream_dot(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out);
+void scalar_vec3_stream_cross(const lx_vec3_stream* a, const lx_vec3_stream* b, const lx_vec3_stream* out);
+void scalar_vec2_stream_normalize(const lx_vec2_stream* v, const lx_vec2_stream* out);
+void scalar_vec3_stream_normalize(const lx_vec3_stream* v, const lx_vec3_stream* out);
+void scalar_vec2_stream_distance(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out);
+void scalar_vec3_stream_distance(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out);
+void scalar_frustum_cull_spheres(const lx_frustum* f, const lx_sphere* s, size_t count, uint32_t* mask);
+void scalar_frustum_cull_aabbs(const lx_frustum* f, const lx_aabb* b, size_t count, uint32_t* mask);
+size_t scalar_bvh_raycast(const bvh_tree* tree, const lx_ray* rays, size_t count, float max_t, lx_ray_hit* hits);
+size_t scalar_sweep_pairs(const sweep_bounds* b, size_t count, lx_pair* pairs, size_t capacity);
+void scalar_skin_vertices(const lx_mat4* palette, size_t bone_count, const lx_skin_vertex* in, lx_vec3* positions, lx_vec3* normals, size_t count);
+void scalar_anim_blend(anim_batch* b, size_t count);
+void scalar_pack_half(const float* in, uint16_t* out, size_t count);
+void scalar_pack_positions(const lx_vec3* in, int16_t* out, size_t count, lx_vec3 offset, lx_vec3 inv_scale);
+void scalar_pack_normals(const lx_vec3* in, int16_t* out, size_t count);
+void scalar_pack_tangents(const lx_vec4* in, uint32_t* out, size_t count);
+void scalar_pack_colors(const lx_vec4* in, uint8_t* out, size_t count);
+void scalar_rng_floats(lx_rng* rng, float* out, size_t count, float min, float range);
+void scalar_rng_vec3(lx_rng* rng, lx_vec3* out, size_t count, int inside);
+void scalar_noise_simplex2(const lx_vec2* in, float* out, size_t count);
+void scalar_noise_simplex3(const lx_vec3* in, float* out, size_t count);
+
+// each loader layers its kernels over those already in the table, returning
+// 0 if the instruction set was not compiled into this build
+int load_scalar_kernels(math_kernels* k);
+int load_sse2_kernels(math_kernels* k);
+int load_sse41_kernels(math_kernels* k);
+int load_avx2_kernels(math_kernels* k);
+int load_neon_kernels(math_kernels* k);
@@ -0,0 +1,18 @@
+#include "lux/math.h"
+#include "math.h"
+#include "../debug/debug.h"
+
+// public header
+// ----------------------------------------------------------------
+
+void lx_noise_simplex2(const lx_vec2* in, float* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to evaluate noise, null array"));
+    mt_kernels.noise_simplex2(in, out, count);
+}
+
+void lx_noise_simplex3(const lx_vec3* in, float* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to evaluate noise, null array"));
+    mt_kernels.noise_simplex3(in, out, count);
+}
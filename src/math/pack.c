@@ -0,0 +1,181 @@
+#include "lux/math.h"
+#include "math.h"
+#include "../debug/debug.h"
+
+#include <math.h>
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+static float half_to_f32(uint16_t h)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+    uint32_t exponent = (h >> 10) & 0x1f;
+    uint32_t mantissa = h & 0x3ff;
+    uint32_t bits;
+
+    if (exponent == 0x1f)
+    {
+        // inf and nan keep their mantissa
+        bits = sign | 0x7f800000 | mantissa << 13;
+    }
+    else if (exponent == 0)
+    {
+        // denormals are exact as floats, a mantissa step is 2^-24
+        float f = (float)mantissa * 5.9604644775390625e-8f;
+        memcpy(&bits, &f, sizeof(bits));
+        bits |= sign;
+    }
+    else
+    {
+        bits = sign | (exponent + 112) << 23 | mantissa << 13;
+    }
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+static float unpack_snorm(int32_t v, float max)
+{
+    float f = (float)v / max;
+    return f < -1.0f ? -1.0f : f;
+}
+
+// sign extends the field of the given width at the given shift
+static int32_t field(uint32_t v, int shift, int width)
+{
+    return (int32_t)(v << (32 - shift - width)) >> (32 - width);
+}
+
+// public header
+// ----------------------------------------------------------------
+
+void lx_pack_half(const float* in, uint16_t* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to pack half floats, null array"));
+    mt_kernels.pack_half(in, out, count);
+}
+
+void lx_unpack_half(const uint16_t* in, float* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to unpack half floats, null array"));
+
+    for (size_t i = 0; i < count; i++)
+        out[i] = half_to_f32(in[i]);
+}
+
+void lx_pack_positions(const lx_vec3* in, int16_t* out, size_t count, lx_vec3* scale, lx_vec3* offset)
+{
+    GUARD(in == NULL || out == NULL || scale == NULL || offset == NULL, ("failed to pack positions, null array"));
+
+    lx_vec3 min = count > 0 ? in[0] : lx_vec3_zero();
+    lx_vec3 max = min;
+
+    for (size_t i = 1; i < count; i++)
+    {
+        min.x = in[i].x < min.x ? in[i].x : min.x;
+        min.y = in[i].y < min.y ? in[i].y : min.y;
+        min.z = in[i].z < min.z ? in[i].z : min.z;
+        max.x = in[i].x > max.x ? in[i].x : max.x;
+        max.y = in[i].y > max.y ? in[i].y : max.y;
+        max.z = in[i].z > max.z ? in[i].z : max.z;
+    }
+
+    // the bounds are mapped onto -1 to 1, flat axes keep a scale of 1 so the
+    // unpack never multiplies by 0
+    lx_vec3 s = { (max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f };
+    s.x = s.x > 0.0f ? s.x : 1.0f;
+    s.y = s.y > 0.0f ? s.y : 1.0f;
+    s.z = s.z > 0.0f ? s.z : 1.0f;
+
+    *scale = s;
+    *offset = (lx_vec3){ (min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f };
+
+    mt_kernels.pack_positions(in, out, count, *offset, (lx_vec3){ 1.0f / s.x, 1.0f / s.y, 1.0f / s.z });
+}
+
+void lx_unpack_positions(const int16_t* in, lx_vec3* out, size_t count, lx_vec3 scale, lx_vec3 offset)
+{
+    GUARD(in == NULL || out == NULL, ("failed to unpack positions, null array"));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int16_t* p = in + i * 4;
+        out[i] = (lx_vec3){
+            offset.x + scale.x * unpack_snorm(p[0], 32767.0f),
+            offset.y + scale.y * unpack_snorm(p[1], 32767.0f),
+            offset.z + scale.z * unpack_snorm(p[2], 32767.0f)
+        };
+    }
+}
+
+void lx_pack_normals(const lx_vec3* in, int16_t* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to pack normals, null array"));
+    mt_kernels.pack_normals(in, out, count);
+}
+
+void lx_unpack_normals(const int16_t* in, lx_vec3* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to unpack normals, null array"));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        float x = unpack_snorm(in[i * 2], 32767.0f);
+        float y = unpack_snorm(in[i * 2 + 1], 32767.0f);
+        float z = 1.0f - fabsf(x) - fabsf(y);
+
+        // the corners of the square fold back under the octahedron
+        if (z < 0.0f)
+        {
+            float fx = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            float fy = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = fx;
+            y = fy;
+        }
+
+        float length_sq = x * x + y * y + z * z;
+        float inv = length_sq > 0.0f ? 1.0f / sqrtf(length_sq) : 0.0f;
+        out[i] = (lx_vec3){ x * inv, y * inv, z * inv };
+    }
+}
+
+void lx_pack_tangents(const lx_vec4* in, uint32_t* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to pack tangents, null array"));
+    mt_kernels.pack_tangents(in, out, count);
+}
+
+void lx_unpack_tangents(const uint32_t* in, lx_vec4* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to unpack tangents, null array"));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = (lx_vec4){
+            unpack_snorm(field(in[i], 0, 10), 511.0f),
+            unpack_snorm(field(in[i], 10, 10), 511.0f),
+            unpack_snorm(field(in[i], 20, 10), 511.0f),
+            field(in[i], 30, 2) >= 0 ? 1.0f : -1.0f
+        };
+    }
+}
+
+void lx_pack_colors(const lx_vec4* in, uint8_t* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to pack colors, null array"));
+    mt_kernels.pack_colors(in, out, count);
+}
+
+void lx_unpack_colors(const uint8_t* in, lx_vec4* out, size_t count)
+{
+    GUARD(in == NULL || out == NULL, ("failed to unpack colors, null array"));
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const uint8_t* c = in + i * 4;
+        out[i] = (lx_vec4){ c[0] / 255.0f, c[1] / 255.0f, c[2] / 255.0f, c[3] / 255.0f };
+    }
+}
@@ -0,0 +1,8 @@
+#include "lux/math.h"
+
+// public header
+// ----------------------------------------------------------------
+
+// the definitions are shared with LX_MATH_INLINE mode, when built as part of
+// the library they are emitted once here as exported symbols
+#include "lux/inline/math_quat.h"
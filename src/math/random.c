@@ -0,0 +1,110 @@
+#include "lux/math.h"
+#include "math.h"
+#include "../debug/debug.h"
+
+// private source
+// ----------------------------------------------------------------
+
+static uint64_t splitmix64(uint64_t* x)
+{
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// one xoshiro128+ step of a single generator, as the kernels step them all
+static uint32_t rng_next_lane(lx_rng* rng, uint32_t lane)
+{
+    uint32_t s0 = rng->state[0][lane];
+    uint32_t s1 = rng->state[1][lane];
+    uint32_t s2 = rng->state[2][lane];
+    uint32_t s3 = rng->state[3][lane];
+
+    uint32_t result = s0 + s3;
+    uint32_t t = s1 << 9;
+
+    s2 ^= s0;
+    s3 ^= s1;
+    s1 ^= s2;
+    s0 ^= s3;
+    s2 ^= t;
+    s3 = (s3 << 11) | (s3 >> 21);
+
+    rng->state[0][lane] = s0;
+    rng->state[1][lane] = s1;
+    rng->state[2][lane] = s2;
+    rng->state[3][lane] = s3;
+    return result;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+void lx_rng_seed(lx_rng* rng, uint64_t seed, uint64_t stream)
+{
+    GUARD(rng == NULL, ("failed to seed rng, null rng"));
+
+    // the stream is mixed before it meets the seed, so neighbouring ids and
+    // seeds start far apart
+    uint64_t x = seed ^ splitmix64(&stream);
+
+    for (int l = 0; l < RNG_LANES; l++)
+    {
+        uint64_t a = splitmix64(&x);
+        uint64_t b = splitmix64(&x);
+
+        rng->state[0][l] = (uint32_t)a;
+        rng->state[1][l] = (uint32_t)(a >> 32);
+        rng->state[2][l] = (uint32_t)b;
+        // the set bit keeps a generator from ever being all zero
+        rng->state[3][l] = (uint32_t)(b >> 32) | 1;
+    }
+
+    rng->lane = 0;
+}
+
+uint32_t lx_rng_next_u32(lx_rng* rng)
+{
+    GUARD(rng == NULL, ("failed to draw random number, null rng"), 0);
+
+    uint32_t lane = rng->lane;
+    rng->lane = (lane + 1) % RNG_LANES;
+    return rng_next_lane(rng, lane);
+}
+
+float lx_rng_next_float(lx_rng* rng)
+{
+    GUARD(rng == NULL, ("failed to draw random number, null rng"), 0.0f);
+    return (float)(lx_rng_next_u32(rng) >> 9) * (1.0f / 8388608.0f);
+}
+
+float lx_rng_next_range(lx_rng* rng, float min, float max)
+{
+    GUARD(rng == NULL, ("failed to draw random number, null rng"), min);
+    return min + (max - min) * lx_rng_next_float(rng);
+}
+
+void lx_rng_fill_floats(lx_rng* rng, float* out, size_t count)
+{
+    GUARD(rng == NULL || out == NULL, ("failed to fill random floats, null rng or array"));
+    mt_kernels.rng_floats(rng, out, count, 0.0f, 1.0f);
+}
+
+void lx_rng_fill_range(lx_rng* rng, float* out, size_t count, float min, float max)
+{
+    GUARD(rng == NULL || out == NULL, ("failed to fill random floats, null rng or array"));
+    mt_kernels.rng_floats(rng, out, count, min, max - min);
+}
+
+void lx_rng_fill_unit_vec3(lx_rng* rng, lx_vec3* out, size_t count)
+{
+    GUARD(rng == NULL || out == NULL, ("failed to fill random vectors, null rng or array"));
+    mt_kernels.rng_vec3(rng, out, count, 0);
+}
+
+void lx_rng_fill_in_sphere(lx_rng* rng, lx_vec3* out, size_t count)
+{
+    GUARD(rng == NULL || out == NULL, ("failed to fill random points, null rng or array"));
+    mt_kernels.rng_vec3(rng, out, count, 1);
+}
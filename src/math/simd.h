@@ -0,0 +1,366 @@
+#pragma once
+
+// width generic float vectors for kernels which are written once and compiled
+// for every instruction set, see kernels_stream.h. the width follows the flags
+// of the including file, defining SIMD_SCALAR first forces a single lane.
+// conversions to integers round to nearest even. u32v holds the same number
+// of unsigned lanes for integer work such as random number generation.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// rounds a float to the nearest half float, overflowing to infinity and
+// keeping nans quiet, as the vector versions below do lane by lane
+static inline uint16_t f32_to_half(float f)
+{
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+
+    uint32_t sign = u & 0x80000000u;
+    uint32_t o;
+    u ^= sign;
+
+    if (u >= 0x47800000u)
+    {
+        o = u > 0x7f800000u ? 0x7e00 : 0x7c00;
+    }
+    else if (u < 0x38800000u)
+    {
+        // adding 0.5 lines the half denormal up with the bottom of the mantissa
+        float d;
+        memcpy(&d, &u, sizeof(d));
+        d += 0.5f;
+        memcpy(&o, &d, sizeof(o));
+        o -= 0x3f000000u;
+    }
+    else
+    {
+        // rebias the exponent and round the mantissa to nearest even
+        uint32_t odd = (u >> 13) & 1;
+        o = (u + 0xc8000fffu + odd) >> 13;
+    }
+
+    return (uint16_t)(o | (sign >> 16));
+}
+
+#if defined(SIMD_SCALAR)
+
+#include <math.h>
+
+#define F32V_WIDTH 1
+
+typedef float f32v;
+
+static inline f32v f32v_load(const float* p) { return *p; }
+static inline void f32v_store(float* p, f32v a) { *p = a; }
+static inline f32v f32v_set(float f) { return f; }
+static inline f32v f32v_add(f32v a, f32v b) { return a + b; }
+static inline f32v f32v_sub(f32v a, f32v b) { return a - b; }
+static inline f32v f32v_mul(f32v a, f32v b) { return a * b; }
+static inline f32v f32v_div(f32v a, f32v b) { return a / b; }
+static inline f32v f32v_madd(f32v a, f32v b, f32v c) { return a * b + c; }
+static inline f32v f32v_sqrt(f32v a) { return sqrtf(a); }
+static inline f32v f32v_min(f32v a, f32v b) { return a < b ? a : b; }
+static inline f32v f32v_max(f32v a, f32v b) { return a > b ? a : b; }
+static inline f32v f32v_select_gt(f32v a, f32v b, f32v v) { return a > b ? v : 0.0f; }
+static inline float f32v_hmin(f32v a) { return a; }
+static inline float f32v_hmax(f32v a) { return a; }
+
+// masks hold 1 or 0 in the single lane, select picks b where the mask is set
+static inline f32v f32v_cmpge(f32v a, f32v b) { return a >= b ? 1.0f : 0.0f; }
+static inline f32v f32v_and(f32v a, f32v b) { return a * b; }
+static inline int f32v_movemask(f32v a) { return a != 0.0f; }
+static inline f32v f32v_select(f32v mask, f32v a, f32v b) { return mask != 0.0f ? b : a; }
+static inline void f32v_store_i32(int32_t* p, f32v a) { *p = (int32_t)lrintf(a); }
+static inline void f32v_store_half(uint16_t* p, f32v a) { *p = f32_to_half(a); }
+static inline f32v f32v_floor(f32v a) { return floorf(a); }
+
+typedef uint32_t u32v;
+
+static inline u32v u32v_load(const uint32_t* p) { return *p; }
+static inline void u32v_store(uint32_t* p, u32v a) { *p = a; }
+static inline u32v u32v_set(uint32_t u) { return u; }
+static inline u32v u32v_add(u32v a, u32v b) { return a + b; }
+static inline u32v u32v_xor(u32v a, u32v b) { return a ^ b; }
+static inline u32v u32v_or(u32v a, u32v b) { return a | b; }
+static inline u32v u32v_shl(u32v a, int n) { return a << n; }
+static inline u32v u32v_shr(u32v a, int n) { return a >> n; }
+
+static inline f32v u32v_as_f32v(u32v a)
+{
+    f32v f;
+    memcpy(&f, &a, sizeof(f));
+    return f;
+}
+
+static inline void f32v_load_aos4(const float* p, size_t stride, f32v* a, f32v* b, f32v* c, f32v* d)
+{
+    (void)stride;
+    *a = p[0];
+    *b = p[1];
+    *c = p[2];
+    *d = p[3];
+}
+
+#elif defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+
+#include <immintrin.h>
+
+#define F32V_WIDTH 8
+
+typedef __m256 f32v;
+
+static inline f32v f32v_load(const float* p) { return _mm256_loadu_ps(p); }
+static inline void f32v_store(float* p, f32v a) { _mm256_storeu_ps(p, a); }
+static inline f32v f32v_set(float f) { return _mm256_set1_ps(f); }
+static inline f32v f32v_add(f32v a, f32v b) { return _mm256_add_ps(a, b); }
+static inline f32v f32v_sub(f32v a, f32v b) { return _mm256_sub_ps(a, b); }
+static inline f32v f32v_mul(f32v a, f32v b) { return _mm256_mul_ps(a, b); }
+static inline f32v f32v_div(f32v a, f32v b) { return _mm256_div_ps(a, b); }
+static inline f32v f32v_madd(f32v a, f32v b, f32v c) { return _mm256_fmadd_ps(a, b, c); }
+static inline f32v f32v_sqrt(f32v a) { return _mm256_sqrt_ps(a); }
+static inline f32v f32v_min(f32v a, f32v b) { return _mm256_min_ps(a, b); }
+static inline f32v f32v_max(f32v a, f32v b) { return _mm256_max_ps(a, b); }
+static inline f32v f32v_select_gt(f32v a, f32v b, f32v v) { return _mm256_and_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ), v); }
+
+static inline float f32v_hmin(f32v a)
+{
+    __m128 m = _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+static inline float f32v_hmax(f32v a)
+{
+    __m128 m = _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    m = _mm_max_ps(m, _mm_movehl_ps(m, m));
+    m = _mm_max_ss(m, _mm_shuffle_ps(m, m, 1));
+    return _mm_cvtss_f32(m);
+}
+
+static inline f32v f32v_cmpge(f32v a, f32v b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+static inline f32v f32v_and(f32v a, f32v b) { return _mm256_and_ps(a, b); }
+static inline int f32v_movemask(f32v a) { return _mm256_movemask_ps(a); }
+static inline f32v f32v_select(f32v mask, f32v a, f32v b) { return _mm256_blendv_ps(a, b, mask); }
+static inline void f32v_store_i32(int32_t* p, f32v a) { _mm256_storeu_si256((__m256i*)p, _mm256_cvtps_epi32(a)); }
+static inline f32v f32v_floor(f32v a) { return _mm256_floor_ps(a); }
+
+typedef __m256i u32v;
+
+static inline u32v u32v_load(const uint32_t* p) { return _mm256_loadu_si256((const __m256i*)p); }
+static inline void u32v_store(uint32_t* p, u32v a) { _mm256_storeu_si256((__m256i*)p, a); }
+static inline u32v u32v_set(uint32_t u) { return _mm256_set1_epi32((int)u); }
+static inline u32v u32v_add(u32v a, u32v b) { return _mm256_add_epi32(a, b); }
+static inline u32v u32v_xor(u32v a, u32v b) { return _mm256_xor_si256(a, b); }
+static inline u32v u32v_or(u32v a, u32v b) { return _mm256_or_si256(a, b); }
+static inline u32v u32v_shl(u32v a, int n) { return _mm256_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+static inline u32v u32v_shr(u32v a, int n) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+static inline f32v u32v_as_f32v(u32v a) { return _mm256_castsi256_ps(a); }
+
+static inline void f32v_store_half(uint16_t* p, f32v a)
+{
+    __m256i u = _mm256_castps_si256(a);
+    __m256i sign = _mm256_and_si256(u, _mm256_set1_epi32((int)0x80000000u));
+    u = _mm256_xor_si256(u, sign);
+
+    __m256i odd = _mm256_and_si256(_mm256_srli_epi32(u, 13), _mm256_set1_epi32(1));
+    __m256i normal = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(u, _mm256_set1_epi32((int)0xc8000fffu)), odd), 13);
+    __m256i denormal = _mm256_sub_epi32(_mm256_castps_si256(_mm256_add_ps(_mm256_castsi256_ps(u), _mm256_set1_ps(0.5f))), _mm256_set1_epi32(0x3f000000));
+    __m256i special = _mm256_or_si256(_mm256_set1_epi32(0x7c00), _mm256_and_si256(_mm256_cmpgt_epi32(u, _mm256_set1_epi32(0x7f800000)), _mm256_set1_epi32(0x0200)));
+
+    __m256i o = _mm256_blendv_epi8(normal, denormal, _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38800000), u));
+    o = _mm256_blendv_epi8(o, special, _mm256_cmpgt_epi32(u, _mm256_set1_epi32(0x477fffff)));
+    o = _mm256_or_si256(o, _mm256_srli_epi32(sign, 16));
+
+    _mm_storeu_si128((__m128i*)p, _mm_packus_epi32(_mm256_castsi256_si128(o), _mm256_extracti128_si256(o, 1)));
+}
+
+static inline void f32v_load_aos4(const float* p, size_t stride, f32v* a, f32v* b, f32v* c, f32v* d)
+{
+    // rows i and i + 4 share a register, so the in-lane transpose below
+    // leaves lanes 0 to 3 and 4 to 7 in order
+    __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + stride * 4), 1);
+    __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + stride)), _mm_loadu_ps(p + stride * 5), 1);
+    __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + stride * 2)), _mm_loadu_ps(p + stride * 6), 1);
+    __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + stride * 3)), _mm_loadu_ps(p + stride * 7), 1);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t2 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+    *a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1, 0, 1, 0));
+    *b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 2, 3, 2));
+    *c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    *d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+#include <emmintrin.h>
+
+#define F32V_WIDTH 4
+
+typedef __m128 f32v;
+
+static inline f32v f32v_load(const float* p) { return _mm_loadu_ps(p); }
+static inline void f32v_store(float* p, f32v a) { _mm_storeu_ps(p, a); }
+static inline f32v f32v_set(float f) { return _mm_set1_ps(f); }
+static inline f32v f32v_add(f32v a, f32v b) { return _mm_add_ps(a, b); }
+static inline f32v f32v_sub(f32v a, f32v b) { return _mm_sub_ps(a, b); }
+static inline f32v f32v_mul(f32v a, f32v b) { return _mm_mul_ps(a, b); }
+static inline f32v f32v_div(f32v a, f32v b) { return _mm_div_ps(a, b); }
+static inline f32v f32v_madd(f32v a, f32v b, f32v c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static inline f32v f32v_sqrt(f32v a) { return _mm_sqrt_ps(a); }
+static inline f32v f32v_min(f32v a, f32v b) { return _mm_min_ps(a, b); }
+static inline f32v f32v_max(f32v a, f32v b) { return _mm_max_ps(a, b); }
+static inline f32v f32v_select_gt(f32v a, f32v b, f32v v) { return _mm_and_ps(_mm_cmpgt_ps(a, b), v); }
+
+static inline float f32v_hmin(f32v a)
+{
+    a = _mm_min_ps(a, _mm_movehl_ps(a, a));
+    a = _mm_min_ss(a, _mm_shuffle_ps(a, a, 1));
+    return _mm_cvtss_f32(a);
+}
+
+static inline float f32v_hmax(f32v a)
+{
+    a = _mm_max_ps(a, _mm_movehl_ps(a, a));
+    a = _mm_max_ss(a, _mm_shuffle_ps(a, a, 1));
+    return _mm_cvtss_f32(a);
+}
+
+static inline f32v f32v_cmpge(f32v a, f32v b) { return _mm_cmpge_ps(a, b); }
+static inline f32v f32v_and(f32v a, f32v b) { return _mm_and_ps(a, b); }
+static inline int f32v_movemask(f32v a) { return _mm_movemask_ps(a); }
+static inline f32v f32v_select(f32v mask, f32v a, f32v b) { return _mm_or_ps(_mm_and_ps(mask, b), _mm_andnot_ps(mask, a)); }
+static inline void f32v_store_i32(int32_t* p, f32v a) { _mm_storeu_si128((__m128i*)p, _mm_cvtps_epi32(a)); }
+
+// truncation rounds negative fractions up, the compare takes them back down.
+// only exact for magnitudes within the int32 range
+static inline f32v f32v_floor(f32v a)
+{
+    __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+    return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+}
+
+typedef __m128i u32v;
+
+static inline u32v u32v_load(const uint32_t* p) { return _mm_loadu_si128((const __m128i*)p); }
+static inline void u32v_store(uint32_t* p, u32v a) { _mm_storeu_si128((__m128i*)p, a); }
+static inline u32v u32v_set(uint32_t u) { return _mm_set1_epi32((int)u); }
+static inline u32v u32v_add(u32v a, u32v b) { return _mm_add_epi32(a, b); }
+static inline u32v u32v_xor(u32v a, u32v b) { return _mm_xor_si128(a, b); }
+static inline u32v u32v_or(u32v a, u32v b) { return _mm_or_si128(a, b); }
+static inline u32v u32v_shl(u32v a, int n) { return _mm_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+static inline u32v u32v_shr(u32v a, int n) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+static inline f32v u32v_as_f32v(u32v a) { return _mm_castsi128_ps(a); }
+
+static inline __m128i si128_select(__m128i mask, __m128i a, __m128i b) { return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a)); }
+
+static inline void f32v_store_half(uint16_t* p, f32v a)
+{
+    __m128i u = _mm_castps_si128(a);
+    __m128i sign = _mm_and_si128(u, _mm_set1_epi32((int)0x80000000u));
+    u = _mm_xor_si128(u, sign);
+
+    __m128i odd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+    __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, _mm_set1_epi32((int)0xc8000fffu)), odd), 13);
+    __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(u), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3f000000));
+    __m128i special = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(_mm_cmpgt_epi32(u, _mm_set1_epi32(0x7f800000)), _mm_set1_epi32(0x0200)));
+
+    __m128i o = si128_select(_mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), u), normal, denormal);
+    o = si128_select(_mm_cmpgt_epi32(u, _mm_set1_epi32(0x477fffff)), o, special);
+    o = _mm_or_si128(o, _mm_srli_epi32(sign, 16));
+
+    // sse2 only packs with signed saturation, so the halves are biased into range
+    o = _mm_packs_epi32(_mm_sub_epi32(o, _mm_set1_epi32(0x8000)), _mm_setzero_si128());
+    _mm_storel_epi64((__m128i*)p, _mm_xor_si128(o, _mm_set1_epi16((short)0x8000)));
+}
+
+static inline void f32v_load_aos4(const float* p, size_t stride, f32v* a, f32v* b, f32v* c, f32v* d)
+{
+    __m128 r0 = _mm_loadu_ps(p);
+    __m128 r1 = _mm_loadu_ps(p + stride);
+    __m128 r2 = _mm_loadu_ps(p + stride * 2);
+    __m128 r3 = _mm_loadu_ps(p + stride * 3);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+    *a = r0;
+    *b = r1;
+    *c = r2;
+    *d = r3;
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+#include <arm_neon.h>
+
+#define F32V_WIDTH 4
+
+typedef float32x4_t f32v;
+
+static inline f32v f32v_load(const float* p) { return vld1q_f32(p); }
+static inline void f32v_store(float* p, f32v a) { vst1q_f32(p, a); }
+static inline f32v f32v_set(float f) { return vdupq_n_f32(f); }
+static inline f32v f32v_add(f32v a, f32v b) { return vaddq_f32(a, b); }
+static inline f32v f32v_sub(f32v a, f32v b) { return vsubq_f32(a, b); }
+static inline f32v f32v_mul(f32v a, f32v b) { return vmulq_f32(a, b); }
+static inline f32v f32v_div(f32v a, f32v b) { return vdivq_f32(a, b); }
+static inline f32v f32v_madd(f32v a, f32v b, f32v c) { return vfmaq_f32(c, a, b); }
+static inline f32v f32v_sqrt(f32v a) { return vsqrtq_f32(a); }
+static inline f32v f32v_min(f32v a, f32v b) { return vminq_f32(a, b); }
+static inline f32v f32v_max(f32v a, f32v b) { return vmaxq_f32(a, b); }
+static inline f32v f32v_select_gt(f32v a, f32v b, f32v v) { return vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(a, b), vreinterpretq_u32_f32(v))); }
+static inline float f32v_hmin(f32v a) { return vminvq_f32(a); }
+static inline float f32v_hmax(f32v a) { return vmaxvq_f32(a); }
+static inline f32v f32v_cmpge(f32v a, f32v b) { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+static inline f32v f32v_and(f32v a, f32v b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+static inline f32v f32v_select(f32v mask, f32v a, f32v b) { return vbslq_f32(vreinterpretq_u32_f32(mask), b, a); }
+static inline void f32v_store_i32(int32_t* p, f32v a) { vst1q_s32(p, vcvtnq_s32_f32(a)); }
+static inline void f32v_store_half(uint16_t* p, f32v a) { vst1_u16(p, vreinterpret_u16_f16(vcvt_f16_f32(a))); }
+static inline f32v f32v_floor(f32v a) { return vrndmq_f32(a); }
+
+static inline int f32v_movemask(f32v a)
+{
+    static const uint32_t bits[4] = { 1, 2, 4, 8 };
+    return (int)vaddvq_u32(vandq_u32(vreinterpretq_u32_f32(a), vld1q_u32(bits)));
+}
+
+static inline void f32v_load_aos4(const float* p, size_t stride, f32v* a, f32v* b, f32v* c, f32v* d)
+{
+    float32x4_t r0 = vld1q_f32(p);
+    float32x4_t r1 = vld1q_f32(p + stride);
+    float32x4_t r2 = vld1q_f32(p + stride * 2);
+    float32x4_t r3 = vld1q_f32(p + stride * 3);
+
+    float32x4_t t0 = vzip1q_f32(r0, r2);
+    float32x4_t t1 = vzip1q_f32(r1, r3);
+    float32x4_t t2 = vzip2q_f32(r0, r2);
+    float32x4_t t3 = vzip2q_f32(r1, r3);
+
+    *a = vzip1q_f32(t0, t1);
+    *b = vzip2q_f32(t0, t1);
+    *c = vzip1q_f32(t2, t3);
+    *d = vzip2q_f32(t2, t3);
+}
+
+typedef uint32x4_t u32v;
+
+static inline u32v u32v_load(const uint32_t* p) { return vld1q_u32(p); }
+static inline void u32v_store(uint32_t* p, u32v a) { vst1q_u32(p, a); }
+static inline u32v u32v_set(uint32_t u) { return vdupq_n_u32(u); }
+static inline u32v u32v_add(u32v a, u32v b) { return vaddq_u32(a, b); }
+static inline u32v u32v_xor(u32v a, u32v b) { return veorq_u32(a, b); }
+static inline u32v u32v_or(u32v a, u32v b) { return vorrq_u32(a, b); }
+static inline u32v u32v_shl(u32v a, int n) { return vshlq_u32(a, vdupq_n_s32(n)); }
+static inline u32v u32v_shr(u32v a, int n) { return vshlq_u32(a, vdupq_n_s32(-n)); }
+static inline f32v u32v_as_f32v(u32v a) { return vreinterpretq_f32_u32(a); }
+
+#else
+
+#error "simd.h included without a supported instruction set, define SIMD_SCALAR"
+
+#endif
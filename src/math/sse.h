@@ -0,0 +1,134 @@
+#pragma once
+
+// helpers shared by the x86 kernels, only include this once the translation
+// unit has checked that sse2 intrinsics are available
+
+#include <emmintrin.h>
+
+// shuffles
+// ----------------------------------------------------------------
+
+#define SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#define SWIZZLE(v, x, y, z, w) SHUFFLE(v, v, x, y, z, w)
+#define SPLAT(v, i) SWIZZLE(v, i, i, i, i)
+
+// matrices
+// ----------------------------------------------------------------
+
+// 2x2 matrix helpers for the block inverse, each 2x2 matrix is packed into a
+// single register as (m00, m01, m10, m11)
+
+// a * b
+static inline __m128 mat2_mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(SWIZZLE(a, 1, 0, 3, 2), SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+// adj(a) * b
+static inline __m128 mat2_adj_mul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(SWIZZLE(a, 1, 1, 2, 2), SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+// a * adj(b)
+static inline __m128 mat2_mul_adj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(SWIZZLE(a, 1, 0, 3, 2), SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+static inline __m128 mat4_column(__m128 c0, __m128 c1, __m128 c2, __m128 c3, __m128 v)
+{
+    __m128 r = _mm_mul_ps(c0, SPLAT(v, 0));
+    r = _mm_add_ps(r, _mm_mul_ps(c1, SPLAT(v, 1)));
+    r = _mm_add_ps(r, _mm_mul_ps(c2, SPLAT(v, 2)));
+    return _mm_add_ps(r, _mm_mul_ps(c3, SPLAT(v, 3)));
+}
+
+// the inverse is computed blockwise from four 2x2 sub-matrices, treating the
+// column-major storage as a row-major matrix is fine since the inverse of the
+// transpose is the transpose of the inverse
+//
+// the trace term is the only part that differs between the sse2 and sse4.1
+// kernels, so the shared body lives in this macro
+#define MAT4_INVERSE_BODY(TRACE)                                                                        \
+    __m128 r0 = _mm_loadu_ps(&in->m[0]);                                                                \
+    __m128 r1 = _mm_loadu_ps(&in->m[4]);                                                                \
+    __m128 r2 = _mm_loadu_ps(&in->m[8]);                                                                \
+    __m128 r3 = _mm_loadu_ps(&in->m[12]);                                                               \
+                                                                                                        \
+    __m128 a = _mm_movelh_ps(r0, r1);                                                                   \
+    __m128 b = _mm_movehl_ps(r1, r0);                                                                   \
+    __m128 c = _mm_movelh_ps(r2, r3);                                                                   \
+    __m128 d = _mm_movehl_ps(r3, r2);                                                                   \
+                                                                                                        \
+    __m128 det_sub = _mm_sub_ps(                                                                        \
+        _mm_mul_ps(SHUFFLE(r0, r2, 0, 2, 0, 2), SHUFFLE(r1, r3, 1, 3, 1, 3)),                           \
+        _mm_mul_ps(SHUFFLE(r0, r2, 1, 3, 1, 3), SHUFFLE(r1, r3, 0, 2, 0, 2))                            \
+    );                                                                                                  \
+                                                                                                        \
+    __m128 det_a = SPLAT(det_sub, 0);                                                                   \
+    __m128 det_b = SPLAT(det_sub, 1);                                                                   \
+    __m128 det_c = SPLAT(det_sub, 2);                                                                   \
+    __m128 det_d = SPLAT(det_sub, 3);                                                                   \
+                                                                                                        \
+    __m128 d_c = mat2_adj_mul(d, c);                                                                    \
+    __m128 a_b = mat2_adj_mul(a, b);                                                                    \
+                                                                                                        \
+    __m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), mat2_mul(b, d_c));                                      \
+    __m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), mat2_mul(c, a_b));                                      \
+    __m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), mat2_mul_adj(d, a_b));                                  \
+    __m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), mat2_mul_adj(a, d_c));                                  \
+                                                                                                        \
+    __m128 det = _mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c));                        \
+    det = _mm_sub_ps(det, TRACE(a_b, SWIZZLE(d_c, 0, 2, 1, 3)));                                        \
+                                                                                                        \
+    if (_mm_cvtss_f32(det) == 0.0f)                                                                     \
+    {                                                                                                   \
+        *out = (lx_mat4){ .m = { 0.0f } };                                                              \
+        return 0;                                                                                       \
+    }                                                                                                   \
+                                                                                                        \
+    __m128 inv_det = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), det);                            \
+                                                                                                        \
+    x = _mm_mul_ps(x, inv_det);                                                                         \
+    y = _mm_mul_ps(y, inv_det);                                                                         \
+    z = _mm_mul_ps(z, inv_det);                                                                         \
+    w = _mm_mul_ps(w, inv_det);                                                                         \
+                                                                                                        \
+    _mm_storeu_ps(&out->m[0], SHUFFLE(x, y, 3, 1, 3, 1));                                               \
+    _mm_storeu_ps(&out->m[4], SHUFFLE(x, y, 2, 0, 2, 0));                                               \
+    _mm_storeu_ps(&out->m[8], SHUFFLE(z, w, 3, 1, 3, 1));                                               \
+    _mm_storeu_ps(&out->m[12], SHUFFLE(z, w, 2, 0, 2, 0));                                              \
+                                                                                                        \
+    return 1;
+
+
+// layout
+// ----------------------------------------------------------------
+
+// loads four packed 3D vectors, 12 floats, as one register per component
+static inline void load_vec3x4(const float* p, __m128* x, __m128* y, __m128* z)
+{
+    __m128 a = _mm_loadu_ps(p);
+    __m128 b = _mm_loadu_ps(p + 4);
+    __m128 c = _mm_loadu_ps(p + 8);
+
+    *x = SHUFFLE(a, SHUFFLE(b, c, 2, 2, 1, 1), 0, 3, 0, 2);
+    *y = SHUFFLE(SHUFFLE(a, b, 1, 1, 0, 0), SHUFFLE(b, c, 3, 3, 2, 2), 0, 2, 0, 2);
+    *z = SHUFFLE(SHUFFLE(a, b, 2, 2, 1, 1), SHUFFLE(c, c, 0, 0, 3, 3), 0, 2, 0, 2);
+}
+
+// the inverse of load_vec3x4
+static inline void store_vec3x4(float* p, __m128 x, __m128 y, __m128 z)
+{
+    _mm_storeu_ps(p, SHUFFLE(SHUFFLE(x, y, 0, 0, 0, 0), SHUFFLE(z, x, 0, 0, 1, 1), 0, 2, 0, 2));
+    _mm_storeu_ps(p + 4, SHUFFLE(SHUFFLE(y, z, 1, 1, 1, 1), SHUFFLE(x, y, 2, 2, 2, 2), 0, 2, 0, 2));
+    _mm_storeu_ps(p + 8, SHUFFLE(SHUFFLE(z, x, 2, 2, 3, 3), SHUFFLE(y, z, 3, 3, 3, 3), 0, 2, 0, 2));
+}
+
+// cross product of the xyz lanes, the w lane of the result is zero
+static inline __m128 cross3(__m128 a, __m128 b)
+{
+    __m128 r = _mm_sub_ps(_mm_mul_ps(a, SWIZZLE(b, 1, 2, 0, 3)), _mm_mul_ps(SWIZZLE(a, 1, 2, 0, 3), b));
+    return SWIZZLE(r, 1, 2, 0, 3);
+}
@@ -0,0 +1,201 @@
+#include "lux/math.h"
+#include "math.h"
+#include "../debug/debug.h"
+
+#include <stdlib.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// pads each component array to 32 bytes, so every array in a stream shares the
+// alignment of the first and full simd lanes never straddle two components
+static size_t stream_stride(size_t count)
+{
+    return (count + 7) & ~(size_t)7;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_vec2_stream lx_vec2_stream_create(size_t count)
+{
+    size_t stride = stream_stride(count);
+    float* data = malloc(stride * 2 * sizeof(float));
+
+    GUARD(data == NULL && count > 0, ("failed to allocate vec2 stream of %zu vectors", count), (lx_vec2_stream){ 0 });
+
+    return (lx_vec2_stream){ data, data + stride, count };
+}
+
+void lx_vec2_stream_destroy(lx_vec2_stream* s)
+{
+    free(s->x);
+    *s = (lx_vec2_stream){ 0 };
+}
+
+void lx_vec2_stream_add(const lx_vec2_stream* a, const lx_vec2_stream* b, lx_vec2_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to add vec2 streams, counts do not match"));
+    mt_kernels.float_array_add(a->x, b->x, out->x, a->count);
+    mt_kernels.float_array_add(a->y, b->y, out->y, a->count);
+}
+
+void lx_vec2_stream_sub(const lx_vec2_stream* a, const lx_vec2_stream* b, lx_vec2_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to subtract vec2 streams, counts do not match"));
+    mt_kernels.float_array_sub(a->x, b->x, out->x, a->count);
+    mt_kernels.float_array_sub(a->y, b->y, out->y, a->count);
+}
+
+void lx_vec2_stream_scale(const lx_vec2_stream* v, float scale, lx_vec2_stream* out)
+{
+    GUARD(v->count != out->count, ("failed to scale vec2 stream, counts do not match"));
+    mt_kernels.float_array_scale(v->x, scale, out->x, v->count);
+    mt_kernels.float_array_scale(v->y, scale, out->y, v->count);
+}
+
+void lx_vec2_stream_dot(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out)
+{
+    GUARD(a->count != b->count, ("failed to dot vec2 streams, counts do not match"));
+    mt_kernels.vec2_stream_dot(a, b, out);
+}
+
+void lx_vec2_stream_normalize(const lx_vec2_stream* v, lx_vec2_stream* out)
+{
+    GUARD(v->count != out->count, ("failed to normalize vec2 stream, counts do not match"));
+    mt_kernels.vec2_stream_normalize(v, out);
+}
+
+void lx_vec2_stream_lerp(const lx_vec2_stream* a, const lx_vec2_stream* b, float t, lx_vec2_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to lerp vec2 streams, counts do not match"));
+    mt_kernels.float_array_lerp(a->x, b->x, t, out->x, a->count);
+    mt_kernels.float_array_lerp(a->y, b->y, t, out->y, a->count);
+}
+
+void lx_vec2_stream_clamp(const lx_vec2_stream* v, lx_vec2 min, lx_vec2 max, lx_vec2_stream* out)
+{
+    GUARD(v->count != out->count, ("failed to clamp vec2 stream, counts do not match"));
+    mt_kernels.float_array_clamp(v->x, min.x, max.x, out->x, v->count);
+    mt_kernels.float_array_clamp(v->y, min.y, max.y, out->y, v->count);
+}
+
+void lx_vec2_stream_distance(const lx_vec2_stream* a, const lx_vec2_stream* b, float* out)
+{
+    GUARD(a->count != b->count, ("failed to measure vec2 stream distances, counts do not match"));
+    mt_kernels.vec2_stream_distance(a, b, out);
+}
+
+lx_vec2 lx_vec2_stream_min(const lx_vec2_stream* v)
+{
+    return (lx_vec2){
+        mt_kernels.float_array_min(v->x, v->count),
+        mt_kernels.float_array_min(v->y, v->count)
+    };
+}
+
+lx_vec2 lx_vec2_stream_max(const lx_vec2_stream* v)
+{
+    return (lx_vec2){
+        mt_kernels.float_array_max(v->x, v->count),
+        mt_kernels.float_array_max(v->y, v->count)
+    };
+}
+
+lx_vec3_stream lx_vec3_stream_create(size_t count)
+{
+    size_t stride = stream_stride(count);
+    float* data = malloc(stride * 3 * sizeof(float));
+
+    GUARD(data == NULL && count > 0, ("failed to allocate vec3 stream of %zu vectors", count), (lx_vec3_stream){ 0 });
+
+    return (lx_vec3_stream){ data, data + stride, data + stride * 2, count };
+}
+
+void lx_vec3_stream_destroy(lx_vec3_stream* s)
+{
+    free(s->x);
+    *s = (lx_vec3_stream){ 0 };
+}
+
+void lx_vec3_stream_add(const lx_vec3_stream* a, const lx_vec3_stream* b, lx_vec3_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to add vec3 streams, counts do not match"));
+    mt_kernels.float_array_add(a->x, b->x, out->x, a->count);
+    mt_kernels.float_array_add(a->y, b->y, out->y, a->count);
+    mt_kernels.float_array_add(a->z, b->z, out->z, a->count);
+}
+
+void lx_vec3_stream_sub(const lx_vec3_stream* a, const lx_vec3_stream* b, lx_vec3_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to subtract vec3 streams, counts do not match"));
+    mt_kernels.float_array_sub(a->x, b->x, out->x, a->count);
+    mt_kernels.float_array_sub(a->y, b->y, out->y, a->count);
+    mt_kernels.float_array_sub(a->z, b->z, out->z, a->count);
+}
+
+void lx_vec3_stream_scale(const lx_vec3_stream* v, float scale, lx_vec3_stream* out)
+{
+    GUARD(v->count != out->count, ("failed to scale vec3 stream, counts do not match"));
+    mt_kernels.float_array_scale(v->x, scale, out->x, v->count);
+    mt_kernels.float_array_scale(v->y, scale, out->y, v->count);
+    mt_kernels.float_array_scale(v->z, scale, out->z, v->count);
+}
+
+void lx_vec3_stream_dot(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out)
+{
+    GUARD(a->count != b->count, ("failed to dot vec3 streams, counts do not match"));
+    mt_kernels.vec3_stream_dot(a, b, out);
+}
+
+void lx_vec3_stream_cross(const lx_vec3_stream* a, const lx_vec3_stream* b, lx_vec3_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to cross vec3 streams, counts do not match"));
+    mt_kernels.vec3_stream_cross(a, b, out);
+}
+
+void lx_vec3_stream_normalize(const lx_vec3_stream* v, lx_vec3_stream* out)
+{
+    GUARD(v->count != out->count, ("failed to normalize vec3 stream, counts do not match"));
+    mt_kernels.vec3_stream_normalize(v, out);
+}
+
+void lx_vec3_stream_lerp(const lx_vec3_stream* a, const lx_vec3_stream* b, float t, lx_vec3_stream* out)
+{
+    GUARD(a->count != b->count || a->count != out->count, ("failed to lerp vec3 streams, counts do not match"));
+    mt_kernels.float_array_lerp(a->x, b->x, t, out->x, a->count);
+    mt_kernels.float_array_lerp(a->y, b->y, t, out->y, a->count);
+    mt_kernels.float_array_lerp(a->z, b->z, t, out->z, a->count);
+}
+
+void lx_vec3_stream_clamp(const lx_vec3_stream* v, lx_vec3 min, lx_vec3 max, lx_vec3_stream* out)
+{
+    GUARD(v->count != out->count, ("failed to clamp vec3 stream, counts do not match"));
+    mt_kernels.float_array_clamp(v->x, min.x, max.x, out->x, v->count);
+    mt_kernels.float_array_clamp(v->y, min.y, max.y, out->y, v->count);
+    mt_kernels.float_array_clamp(v->z, min.z, max.z, out->z, v->count);
+}
+
+void lx_vec3_stream_distance(const lx_vec3_stream* a, const lx_vec3_stream* b, float* out)
+{
+    GUARD(a->count != b->count, ("failed to measure vec3 stream distances, counts do not match"));
+    mt_kernels.vec3_stream_distance(a, b, out);
+}
+
+lx_vec3 lx_vec3_stream_min(const lx_vec3_stream* v)
+{
+    return (lx_vec3){
+        mt_kernels.float_array_min(v->x, v->count),
+        mt_kernels.float_array_min(v->y, v->count),
+        mt_kernels.float_array_min(v->z, v->count)
+    };
+}
+
+lx_vec3 lx_vec3_stream_max(const lx_vec3_stream* v)
+{
+    return (lx_vec3){
+        mt_kernels.float_array_max(v->x, v->count),
+        mt_kernels.float_array_max(v->y, v->count),
+        mt_kernels.float_array_max(v->z, v->count)
+    };
+}
@@ -0,0 +1,458 @@
+#include "lux/scene.h"
+#include "../debug/debug.h"
+#include "../math/math.h"
+#include "../utils/utils.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// a playing cursor steps over this many keys before searching instead
+#define ANIM_MAX_STEPS 4
+
+// instances handed to each worker
+#define ANIM_GRAIN 64
+
+#define ANIM_KEY_MAX 65535.0f
+#define ANIM_ROTATION_MAX 32767.0f
+#define ANIM_SQRT_HALF 0.70710678118654752f
+
+enum
+{
+    CHANNEL_TRANSLATION,
+    CHANNEL_ROTATION,
+    CHANNEL_SCALE,
+    CHANNEL_COUNT
+};
+
+// times are fractions of the clip and vec components fractions of their
+// channel's range. rotations keep their three smallest components in 15
+// bits each, the index of the largest in the top bits of the first two
+typedef struct _anim_key { uint16_t time; uint16_t v[3]; } anim_key;
+
+typedef struct _anim_channel
+{
+    uint32_t first;
+    uint32_t count;
+    float base[3];
+    float step[3];
+}
+anim_channel;
+
+struct _lx_anim_clip
+{
+    float duration;
+    size_t track_count;
+
+    // three channels per track, the keys of each track following each other
+    anim_channel* channels;
+    anim_key* keys;
+};
+
+struct _lx_anim_cursors
+{
+    size_t count;
+    size_t track_count;
+
+    // the key before the last sample, per instance, track and channel
+    uint32_t* keys;
+};
+
+typedef struct _sample_job
+{
+    const lx_anim_clip* clip;
+    lx_anim_cursors* cursors;
+    const float* times;
+    lx_vec3* translations;
+    lx_quat* rotations;
+    lx_vec3* scales;
+}
+sample_job;
+
+static inline uint16_t quantize(float v, float max)
+{
+    v = v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v;
+    return (uint16_t)(v * max + 0.5f);
+}
+
+static int check_channel(const float* times, const void* values, size_t count, size_t track)
+{
+    GUARD(count > 0 && (times == NULL || values == NULL), ("failed to create animation clip, null keys in track %zu", track), 0);
+    GUARD(count > 0 && !(times[0] >= 0.0f), ("failed to create animation clip, negative key time in track %zu", track), 0);
+
+    for (size_t i = 1; i < count; i++)
+        GUARD(!(times[i] >= times[i - 1]), ("failed to create animation clip, keys out of order in track %zu", track), 0);
+
+    return 1;
+}
+
+static void encode_vec3(anim_channel* channel, anim_key* keys, const float* times, const lx_vec3* values, float inv_duration)
+{
+    lx_vec3 min = values[0];
+    lx_vec3 max = values[0];
+
+    for (uint32_t i = 1; i < channel->count; i++)
+    {
+        min = (lx_vec3){ fminf(min.x, values[i].x), fminf(min.y, values[i].y), fminf(min.z, values[i].z) };
+        max = (lx_vec3){ fmaxf(max.x, values[i].x), fmaxf(max.y, values[i].y), fmaxf(max.z, values[i].z) };
+    }
+
+    const float* lo = &min.x;
+    const float* hi = &max.x;
+
+    for (int c = 0; c < 3; c++)
+    {
+        channel->base[c] = lo[c];
+        channel->step[c] = (hi[c] - lo[c]) / ANIM_KEY_MAX;
+    }
+
+    for (uint32_t i = 0; i < channel->count; i++)
+    {
+        const float* v = &values[i].x;
+        anim_key* key = &keys[i];
+
+        key->time = quantize(times[i] * inv_duration, ANIM_KEY_MAX);
+
+        for (int c = 0; c < 3; c++)
+            key->v[c] = channel->step[c] > 0.0f ? quantize((v[c] - lo[c]) / (hi[c] - lo[c]), ANIM_KEY_MAX) : 0;
+    }
+}
+
+static void encode_rotation(anim_key* key, lx_quat q)
+{
+    float e[4] = { q.x, q.y, q.z, q.w };
+    float length = sqrtf(e[0] * e[0] + e[1] * e[1] + e[2] * e[2] + e[3] * e[3]);
+
+    int largest = 0;
+    for (int c = 1; c < 4; c++)
+    {
+        if (fabsf(e[c]) > fabsf(e[largest]))
+            largest = c;
+    }
+
+    // q and -q are the same rotation, so the largest is kept positive and
+    // rebuilt from the others
+    float scale = (e[largest] < 0.0f ? -1.0f : 1.0f) / (length > 0.0f ? length : 1.0f);
+
+    for (int c = 0, n = 0; c < 4; c++)
+    {
+        if (c == largest)
+            continue;
+
+        key->v[n++] = quantize((e[c] * scale / ANIM_SQRT_HALF + 1.0f) * 0.5f, ANIM_ROTATION_MAX);
+    }
+
+    key->v[0] |= (uint16_t)((largest & 1) << 15);
+    key->v[1] |= (uint16_t)((largest >> 1) << 15);
+}
+
+static inline float decode_component(uint16_t v)
+{
+    return (float)(v & 0x7fff) * (2.0f * ANIM_SQRT_HALF / ANIM_ROTATION_MAX) - ANIM_SQRT_HALF;
+}
+
+// the kernel rebuilds the largest component and puts them back in order
+static inline void decode_rotation(const anim_key* key, float (*q)[ANIM_BATCH], size_t slot)
+{
+    q[0][slot] = decode_component(key->v[0]);
+    q[1][slot] = decode_component(key->v[1]);
+    q[2][slot] = decode_component(key->v[2]);
+    q[3][slot] = (float)((key->v[0] >> 15) | ((key->v[1] >> 15) << 1));
+}
+
+// returns k, at most count - 2, with time between the times of keys k and k + 1
+// where it lies within the keys
+static uint32_t locate(const anim_key* keys, uint32_t count, uint32_t cursor, float time)
+{
+    uint32_t last = count - 2;
+    uint32_t k = cursor < last ? cursor : last;
+
+    // playing forward usually stays on the same key or moves to the next
+    for (int s = 0; s <= ANIM_MAX_STEPS && time >= keys[k].time; s++, k++)
+    {
+        if (k == last || time < keys[k + 1].time)
+            return k;
+    }
+
+    uint32_t lo = 0;
+    uint32_t hi = last;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi + 1) / 2;
+
+        if (keys[mid].time <= time)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+// picks the keys either side of time, returning the fraction between them
+static inline float pick_keys(const anim_key* keys, const anim_channel* channel, uint32_t* cursor, float time, const anim_key** a, const anim_key** b)
+{
+    keys += channel->first;
+
+    if (channel->count == 1)
+    {
+        *a = *b = keys;
+        return 0.0f;
+    }
+
+    uint32_t k = locate(keys, channel->count, *cursor, time);
+    *cursor = k;
+    *a = &keys[k];
+    *b = &keys[k + 1];
+
+    float span = (float)keys[k + 1].time - (float)keys[k].time;
+    float t = span > 0.0f ? (time - (float)keys[k].time) / span : 0.0f;
+    return t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+}
+
+static void sample_vec3(const lx_anim_clip* clip, const anim_channel* channel, uint32_t* cursor, float time, float fallback, anim_batch* b, int first, size_t slot)
+{
+    if (channel->count == 0)
+    {
+        for (int c = 0; c < 3; c++)
+            b->vec_a[first + c][slot] = b->vec_b[first + c][slot] = fallback;
+
+        b->vec_t[first / 3][slot] = 0.0f;
+        return;
+    }
+
+    const anim_key* a;
+    const anim_key* k;
+    b->vec_t[first / 3][slot] = pick_keys(clip->keys, channel, cursor, time, &a, &k);
+
+    for (int c = 0; c < 3; c++)
+    {
+        b->vec_a[first + c][slot] = channel->base[c] + (float)a->v[c] * channel->step[c];
+        b->vec_b[first + c][slot] = channel->base[c] + (float)k->v[c] * channel->step[c];
+    }
+}
+
+static void sample_rotation(const lx_anim_clip* clip, const anim_channel* channel, uint32_t* cursor, float time, anim_batch* b, size_t slot)
+{
+    if (channel->count == 0)
+    {
+        // x, y and z of 0 leave w as the largest
+        for (int c = 0; c < 4; c++)
+            b->quat_a[c][slot] = b->quat_b[c][slot] = c == 3 ? 3.0f : 0.0f;
+
+        b->quat_t[slot] = 0.0f;
+        return;
+    }
+
+    const anim_key* a;
+    const anim_key* k;
+    b->quat_t[slot] = pick_keys(clip->keys, channel, cursor, time, &a, &k);
+
+    decode_rotation(a, b->quat_a, slot);
+    decode_rotation(k, b->quat_b, slot);
+}
+
+static void flush(const sample_job* job, anim_batch* b, size_t count, size_t first)
+{
+    mt_kernels.anim_blend(b, count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        job->translations[first + i] = (lx_vec3){ b->vec_a[0][i], b->vec_a[1][i], b->vec_a[2][i] };
+        job->scales[first + i] = (lx_vec3){ b->vec_a[3][i], b->vec_a[4][i], b->vec_a[5][i] };
+        job->rotations[first + i] = (lx_quat){ b->quat_a[0][i], b->quat_a[1][i], b->quat_a[2][i], b->quat_a[3][i] };
+    }
+}
+
+static void sample_range(void* ctx, int range, size_t begin, size_t end)
+{
+    (void)range;
+    const sample_job* job = ctx;
+    const lx_anim_clip* clip = job->clip;
+    size_t tracks = clip->track_count;
+
+    // lanes past the last sample of a batch are blended too, zeros rebuild
+    // to unit rotations
+    anim_batch b;
+    memset(&b, 0, sizeof(b));
+
+    float to_key = clip->duration > 0.0f ? ANIM_KEY_MAX / clip->duration : 0.0f;
+    size_t first = begin * tracks;
+    size_t slot = 0;
+
+    for (size_t i = begin; i < end; i++)
+    {
+        float time = job->times[i] * to_key;
+        time = time > 0.0f ? time < ANIM_KEY_MAX ? time : ANIM_KEY_MAX : 0.0f;
+
+        uint32_t* cursor = &job->cursors->keys[i * tracks * CHANNEL_COUNT];
+        const anim_channel* channel = clip->channels;
+
+        for (size_t t = 0; t < tracks; t++, cursor += CHANNEL_COUNT, channel += CHANNEL_COUNT)
+        {
+            sample_vec3(clip, &channel[CHANNEL_TRANSLATION], &cursor[CHANNEL_TRANSLATION], time, 0.0f, &b, 0, slot);
+            sample_rotation(clip, &channel[CHANNEL_ROTATION], &cursor[CHANNEL_ROTATION], time, &b, slot);
+            sample_vec3(clip, &channel[CHANNEL_SCALE], &cursor[CHANNEL_SCALE], time, 1.0f, &b, 3, slot);
+
+            if (++slot == ANIM_BATCH)
+            {
+                flush(job, &b, slot, first);
+                first += slot;
+                slot = 0;
+            }
+        }
+    }
+
+    if (slot > 0)
+        flush(job, &b, slot, first);
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_anim_clip* lx_anim_clip_create(const lx_anim_track* tracks, size_t track_count)
+{
+    GUARD(tracks == NULL && track_count > 0, ("failed to create animation clip, null tracks"), NULL);
+
+    size_t key_count = 0;
+    float duration = 0.0f;
+
+    for (size_t t = 0; t < track_count; t++)
+    {
+        const lx_anim_track* track = &tracks[t];
+
+        if (!check_channel(track->translation_times, track->translations, track->translation_count, t) ||
+            !check_channel(track->rotation_times, track->rotations, track->rotation_count, t) ||
+            !check_channel(track->scale_times, track->scales, track->scale_count, t))
+            return NULL;
+
+        if (track->translation_count > 0)
+            duration = fmaxf(duration, track->translation_times[track->translation_count - 1]);
+        if (track->rotation_count > 0)
+            duration = fmaxf(duration, track->rotation_times[track->rotation_count - 1]);
+        if (track->scale_count > 0)
+            duration = fmaxf(duration, track->scale_times[track->scale_count - 1]);
+
+        key_count += track->translation_count + track->rotation_count + track->scale_count;
+    }
+
+    GUARD(key_count > UINT32_MAX, ("failed to create animation clip, %zu keys is too many", key_count), NULL);
+
+    lx_anim_clip* clip = calloc(1, sizeof(lx_anim_clip));
+    GUARD(clip == NULL, ("failed to allocate animation clip"), NULL);
+
+    clip->duration = duration;
+    clip->track_count = track_count;
+    clip->channels = calloc(track_count > 0 ? track_count * CHANNEL_COUNT : 1, sizeof(anim_channel));
+    clip->keys = malloc((key_count > 0 ? key_count : 1) * sizeof(anim_key));
+
+    if (clip->channels == NULL || clip->keys == NULL)
+    {
+        lx_error("failed to allocate animation clip of %zu keys", key_count);
+        lx_anim_clip_destroy(clip);
+        return NULL;
+    }
+
+    float inv_duration = duration > 0.0f ? 1.0f / duration : 0.0f;
+    uint32_t first = 0;
+
+    for (size_t t = 0; t < track_count; t++)
+    {
+        const lx_anim_track* track = &tracks[t];
+        anim_channel* channel = &clip->channels[t * CHANNEL_COUNT];
+
+        channel[CHANNEL_TRANSLATION] = (anim_channel){ .first = first, .count = (uint32_t)track->translation_count };
+        if (track->translation_count > 0)
+            encode_vec3(&channel[CHANNEL_TRANSLATION], &clip->keys[first], track->translation_times, track->translations, inv_duration);
+
+        first += (uint32_t)track->translation_count;
+
+        channel[CHANNEL_ROTATION] = (anim_channel){ .first = first, .count = (uint32_t)track->rotation_count };
+        for (size_t i = 0; i < track->rotation_count; i++)
+        {
+            clip->keys[first + i].time = quantize(track->rotation_times[i] * inv_duration, ANIM_KEY_MAX);
+            encode_rotation(&clip->keys[first + i], track->rotations[i]);
+        }
+
+        first += (uint32_t)track->rotation_count;
+
+        channel[CHANNEL_SCALE] = (anim_channel){ .first = first, .count = (uint32_t)track->scale_count };
+        if (track->scale_count > 0)
+            encode_vec3(&channel[CHANNEL_SCALE], &clip->keys[first], track->scale_times, track->scales, inv_duration);
+
+        first += (uint32_t)track->scale_count;
+    }
+
+    return clip;
+}
+
+void lx_anim_clip_destroy(lx_anim_clip* clip)
+{
+    if (clip == NULL)
+        return;
+
+    free(clip->channels);
+    free(clip->keys);
+    free(clip);
+}
+
+float lx_anim_clip_get_duration(const lx_anim_clip* clip)
+{
+    GUARD(clip == NULL, ("failed to get animation clip duration, null clip"), 0.0f);
+    return clip->duration;
+}
+
+size_t lx_anim_clip_get_track_count(const lx_anim_clip* clip)
+{
+    GUARD(clip == NULL, ("failed to get animation clip track count, null clip"), 0);
+    return clip->track_count;
+}
+
+lx_anim_cursors* lx_anim_cursors_create(const lx_anim_clip* clip, size_t count)
+{
+    GUARD(clip == NULL, ("failed to create animation cursors, null clip"), NULL);
+
+    lx_anim_cursors* cursors = calloc(1, sizeof(lx_anim_cursors));
+    GUARD(cursors == NULL, ("failed to allocate animation cursors"), NULL);
+
+    size_t keys = count * clip->track_count * CHANNEL_COUNT;
+
+    cursors->count = count;
+    cursors->track_count = clip->track_count;
+    cursors->keys = calloc(keys > 0 ? keys : 1, sizeof(uint32_t));
+
+    if (cursors->keys == NULL)
+    {
+        lx_error("failed to allocate animation cursors for %zu instances", count);
+        free(cursors);
+        return NULL;
+    }
+
+    return cursors;
+}
+
+void lx_anim_cursors_destroy(lx_anim_cursors* cursors)
+{
+    if (cursors == NULL)
+        return;
+
+    free(cursors->keys);
+    free(cursors);
+}
+
+void lx_anim_sample(const lx_anim_clip* clip, lx_anim_cursors* cursors, const float* times, lx_vec3* translations, lx_quat* rotations, lx_vec3* scales)
+{
+    GUARD(clip == NULL || cursors == NULL, ("failed to sample animation, null clip or cursors"));
+    GUARD(times == NULL || translations == NULL || rotations == NULL || scales == NULL, ("failed to sample animation, null array"));
+    GUARD(cursors->track_count != clip->track_count, ("failed to sample animation, cursors made for %zu tracks, not %zu", cursors->track_count, clip->track_count));
+
+    if (clip->track_count == 0)
+        return;
+
+    sample_job job = { clip, cursors, times, translations, rotations, scales };
+    parallel_for(cursors->count, ANIM_GRAIN, sample_range, &job);
+}
@@ -0,0 +1,306 @@
+#include "lux/scene.h"
+#include "../debug/debug.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// each bit marks a cached value out of date
+#define CAMERA_VIEW 1
+#define CAMERA_PROJECTION 2
+#define CAMERA_PROJECTION_INVERSE 4
+#define CAMERA_VIEW_PROJECTION 8
+#define CAMERA_VIEW_PROJECTION_INVERSE 16
+#define CAMERA_FRUSTUM 32
+
+#define CAMERA_POSE (CAMERA_VIEW | CAMERA_VIEW_PROJECTION | CAMERA_VIEW_PROJECTION_INVERSE | CAMERA_FRUSTUM)
+#define CAMERA_LENS (CAMERA_PROJECTION | CAMERA_PROJECTION_INVERSE | CAMERA_VIEW_PROJECTION | CAMERA_VIEW_PROJECTION_INVERSE | CAMERA_FRUSTUM)
+
+struct _lx_camera
+{
+    lx_vec3 position;
+    lx_quat rotation;
+
+    float fov;
+    float aspect;
+    float near_plane;
+    float far_plane;
+    int reversed;
+
+    uint32_t dirty;
+
+    lx_mat4 view;
+    lx_mat4 view_inverse;
+    lx_mat4 projection;
+    lx_mat4 projection_inverse;
+    lx_mat4 view_projection;
+    lx_mat4 view_projection_inverse;
+    lx_frustum frustum;
+};
+
+// the rotation taking the axes to the columns x, y and z of an orthonormal basis
+static lx_quat rotation_from_basis(lx_vec3 x, lx_vec3 y, lx_vec3 z)
+{
+    float trace = x.x + y.y + z.z;
+
+    if (trace > 0.0f)
+    {
+        float s = sqrtf(trace + 1.0f) * 2.0f;
+        return (lx_quat){ (y.z - z.y) / s, (z.x - x.z) / s, (x.y - y.x) / s, 0.25f * s };
+    }
+
+    if (x.x > y.y && x.x > z.z)
+    {
+        float s = sqrtf(1.0f + x.x - y.y - z.z) * 2.0f;
+        return (lx_quat){ 0.25f * s, (y.x + x.y) / s, (z.x + x.z) / s, (y.z - z.y) / s };
+    }
+
+    if (y.y > z.z)
+    {
+        float s = sqrtf(1.0f + y.y - x.x - z.z) * 2.0f;
+        return (lx_quat){ (y.x + x.y) / s, 0.25f * s, (z.y + y.z) / s, (z.x - x.z) / s };
+    }
+
+    float s = sqrtf(1.0f + z.z - x.x - y.y) * 2.0f;
+    return (lx_quat){ (z.x + x.z) / s, (z.y + y.z) / s, 0.25f * s, (x.y - y.x) / s };
+}
+
+static void update_view(lx_camera* cam)
+{
+    if (!(cam->dirty & CAMERA_VIEW))
+        return;
+
+    cam->view_inverse = lx_mat4_from_trs(cam->position, cam->rotation, (lx_vec3){ 1.0f, 1.0f, 1.0f });
+    cam->view = lx_mat4_inverse_rigid(cam->view_inverse);
+    cam->dirty &= ~CAMERA_VIEW;
+}
+
+static void update_projection(lx_camera* cam)
+{
+    if (!(cam->dirty & CAMERA_PROJECTION))
+        return;
+
+    cam->projection = cam->reversed ?
+        lx_mat4_perspective_reversed(cam->fov, cam->aspect, cam->near_plane) :
+        lx_mat4_perspective(cam->fov, cam->aspect, cam->near_plane, cam->far_plane);
+
+    cam->dirty &= ~CAMERA_PROJECTION;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_camera* lx_camera_create()
+{
+    lx_camera* cam = calloc(1, sizeof(lx_camera));
+    GUARD(cam == NULL, ("failed to allocate camera"), NULL);
+
+    cam->rotation = (lx_quat){ 0.0f, 0.0f, 0.0f, 1.0f };
+    cam->fov = 60.0f;
+    cam->aspect = 1.0f;
+    cam->near_plane = 0.1f;
+    cam->far_plane = 100.0f;
+    cam->dirty = CAMERA_POSE | CAMERA_LENS;
+    return cam;
+}
+
+void lx_camera_destroy(lx_camera* cam)
+{
+    free(cam);
+}
+
+void lx_camera_set_position(lx_camera* cam, lx_vec3 position)
+{
+    GUARD(cam == NULL, ("failed to set camera position, null camera"));
+
+    cam->position = position;
+    cam->dirty |= CAMERA_POSE;
+}
+
+void lx_camera_set_rotation(lx_camera* cam, lx_quat rotation)
+{
+    GUARD(cam == NULL, ("failed to set camera rotation, null camera"));
+
+    cam->rotation = rotation;
+    cam->dirty |= CAMERA_POSE;
+}
+
+void lx_camera_look_at(lx_camera* cam, lx_vec3 eye, lx_vec3 center, lx_vec3 up)
+{
+    GUARD(cam == NULL, ("failed to point camera, null camera"));
+
+    lx_vec3 f = lx_vec3_normalize(lx_vec3_sub(center, eye));
+    lx_vec3 s = lx_vec3_normalize(lx_vec3_cross(f, up));
+    lx_vec3 u = lx_vec3_cross(s, f);
+
+    cam->position = eye;
+    cam->rotation = rotation_from_basis(s, u, (lx_vec3){ -f.x, -f.y, -f.z });
+    cam->dirty |= CAMERA_POSE;
+}
+
+lx_vec3 lx_camera_get_position(const lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera position, null camera"), lx_vec3_zero());
+    return cam->position;
+}
+
+lx_quat lx_camera_get_rotation(const lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera rotation, null camera"), ((lx_quat){ 0.0f, 0.0f, 0.0f, 1.0f }));
+    return cam->rotation;
+}
+
+void lx_camera_set_perspective(lx_camera* cam, float fov, float near, float far)
+{
+    GUARD(cam == NULL, ("failed to set camera perspective, null camera"));
+
+    cam->fov = fov;
+    cam->near_plane = near;
+    cam->far_plane = far;
+    cam->reversed = 0;
+    cam->dirty |= CAMERA_LENS;
+}
+
+void lx_camera_set_perspective_reversed(lx_camera* cam, float fov, float near)
+{
+    GUARD(cam == NULL, ("failed to set camera perspective, null camera"));
+
+    cam->fov = fov;
+    cam->near_plane = near;
+    cam->far_plane = INFINITY;
+    cam->reversed = 1;
+    cam->dirty |= CAMERA_LENS;
+}
+
+void lx_camera_set_viewport(lx_camera* cam, int width, int height)
+{
+    GUARD(cam == NULL, ("failed to set camera viewport, null camera"));
+
+    if (width <= 0 || height <= 0)
+        return;
+
+    float aspect = (float)width / (float)height;
+    if (aspect == cam->aspect)
+        return;
+
+    cam->aspect = aspect;
+    cam->dirty |= CAMERA_LENS;
+}
+
+const lx_mat4* lx_camera_get_view(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera view, null camera"), NULL);
+
+    update_view(cam);
+    return &cam->view;
+}
+
+const lx_mat4* lx_camera_get_view_inverse(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera view, null camera"), NULL);
+
+    update_view(cam);
+    return &cam->view_inverse;
+}
+
+const lx_mat4* lx_camera_get_projection(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera projection, null camera"), NULL);
+
+    update_projection(cam);
+    return &cam->projection;
+}
+
+const lx_mat4* lx_camera_get_projection_inverse(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera projection, null camera"), NULL);
+
+    if (cam->dirty & CAMERA_PROJECTION_INVERSE)
+    {
+        update_projection(cam);
+        lx_mat4_inverse_to(&cam->projection_inverse, &cam->projection);
+        cam->dirty &= ~CAMERA_PROJECTION_INVERSE;
+    }
+
+    return &cam->projection_inverse;
+}
+
+const lx_mat4* lx_camera_get_view_projection(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera view projection, null camera"), NULL);
+
+    if (cam->dirty & CAMERA_VIEW_PROJECTION)
+    {
+        update_view(cam);
+        update_projection(cam);
+        lx_mat4_mul_to(&cam->view_projection, &cam->projection, &cam->view);
+        cam->dirty &= ~CAMERA_VIEW_PROJECTION;
+    }
+
+    return &cam->view_projection;
+}
+
+const lx_mat4* lx_camera_get_view_projection_inverse(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera view projection, null camera"), NULL);
+
+    // the product of the two inverses, cheaper and more precise than a
+    // general inverse of the view projection
+    if (cam->dirty & CAMERA_VIEW_PROJECTION_INVERSE)
+    {
+        const lx_mat4* projection_inverse = lx_camera_get_projection_inverse(cam);
+        update_view(cam);
+        lx_mat4_mul_to(&cam->view_projection_inverse, &cam->view_inverse, projection_inverse);
+        cam->dirty &= ~CAMERA_VIEW_PROJECTION_INVERSE;
+    }
+
+    return &cam->view_projection_inverse;
+}
+
+const lx_frustum* lx_camera_get_frustum(lx_camera* cam)
+{
+    GUARD(cam == NULL, ("failed to get camera frustum, null camera"), NULL);
+
+    if (cam->dirty & CAMERA_FRUSTUM)
+    {
+        cam->frustum = lx_frustum_from_mat4(*lx_camera_get_view_projection(cam));
+
+        // with depth from 0 to 1 the far row is the near plane, and there is
+        // no far plane, so it is replaced with one everything is inside of
+        if (cam->reversed)
+        {
+            cam->frustum.planes[4] = cam->frustum.planes[5];
+            cam->frustum.planes[5] = (lx_vec4){ 0.0f, 0.0f, 0.0f, FLT_MAX };
+        }
+
+        cam->dirty &= ~CAMERA_FRUSTUM;
+    }
+
+    return &cam->frustum;
+}
+
+lx_ray lx_camera_get_ray(lx_camera* cam, float x, float y, float width, float height)
+{
+    GUARD(cam == NULL, ("failed to get camera ray, null camera"), (lx_ray){ 0 });
+    GUARD(width <= 0.0f || height <= 0.0f, ("failed to get camera ray, screen size %gx%g", width, height), (lx_ray){ 0 });
+
+    const lx_mat4* inverse = lx_camera_get_view_projection_inverse(cam);
+    float ndc_x = 2.0f * x / width - 1.0f;
+    float ndc_y = 1.0f - 2.0f * y / height;
+
+    // reversed depth puts the near plane at 1 and infinity at 0, so the
+    // second point is halfway between. otherwise as lx_ray_from_screen
+    float near_z = cam->reversed ? 1.0f : -1.0f;
+    float through_z = cam->reversed ? 0.5f : 0.0f;
+
+    lx_vec4 p0 = lx_mat4_mul_vec4(*inverse, (lx_vec4){ ndc_x, ndc_y, near_z, 1.0f });
+    lx_vec4 p1 = lx_mat4_mul_vec4(*inverse, (lx_vec4){ ndc_x, ndc_y, through_z, 1.0f });
+
+    lx_vec3 origin = { p0.x / p0.w, p0.y / p0.w, p0.z / p0.w };
+    lx_vec3 through = { p1.x / p1.w, p1.y / p1.w, p1.z / p1.w };
+
+    return (lx_ray){ origin, lx_vec3_normalize(lx_vec3_sub(through, origin)) };
+}
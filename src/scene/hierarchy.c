@@ -0,0 +1,244 @@
+#include "lux/scene.h"
+#include "../debug/debug.h"
+#include "../math/math.h"
+
+#include <stdlib.h>
+
+// private source
+// ----------------------------------------------------------------
+
+#define NODE_DIRTY 1
+#define NODE_UPDATED 2
+
+struct _lx_hierarchy
+{
+    size_t count;
+    size_t capacity;
+
+    // nodes before first_dirty are clean, nodes before first_updated were
+    // not recomputed by the last update
+    size_t first_dirty;
+    size_t first_updated;
+
+    lx_node* parents;
+    uint8_t* flags;
+    lx_vec3* translations;
+    lx_quat* rotations;
+    lx_vec3* scales;
+    lx_mat4* locals;
+    lx_mat4* worlds;
+};
+
+static int grow_array(void** array, size_t capacity, size_t size)
+{
+    void* grown = realloc(*array, capacity * size);
+    if (grown == NULL)
+        return 0;
+
+    *array = grown;
+    return 1;
+}
+
+static int reserve(lx_hierarchy* h, size_t capacity)
+{
+    if (capacity <= h->capacity)
+        return 1;
+
+    if (!grow_array((void**)&h->parents, capacity, sizeof(lx_node)) ||
+        !grow_array((void**)&h->flags, capacity, sizeof(uint8_t)) ||
+        !grow_array((void**)&h->translations, capacity, sizeof(lx_vec3)) ||
+        !grow_array((void**)&h->rotations, capacity, sizeof(lx_quat)) ||
+        !grow_array((void**)&h->scales, capacity, sizeof(lx_vec3)) ||
+        !grow_array((void**)&h->locals, capacity, sizeof(lx_mat4)) ||
+        !grow_array((void**)&h->worlds, capacity, sizeof(lx_mat4)))
+    {
+        lx_error("failed to allocate space for %zu hierarchy nodes", capacity);
+        return 0;
+    }
+
+    h->capacity = capacity;
+    return 1;
+}
+
+static void mark_dirty(lx_hierarchy* h, lx_node node)
+{
+    h->flags[node] |= NODE_DIRTY;
+
+    if (node < h->first_dirty)
+        h->first_dirty = node;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_hierarchy* lx_hierarchy_create(size_t capacity)
+{
+    lx_hierarchy* h = calloc(1, sizeof(lx_hierarchy));
+    GUARD(h == NULL, ("failed to allocate transform hierarchy"), NULL);
+
+    if (!reserve(h, capacity > 0 ? capacity : 16))
+    {
+        lx_hierarchy_destroy(h);
+        return NULL;
+    }
+
+    return h;
+}
+
+void lx_hierarchy_destroy(lx_hierarchy* h)
+{
+    if (h == NULL)
+        return;
+
+    free(h->parents);
+    free(h->flags);
+    free(h->translations);
+    free(h->rotations);
+    free(h->scales);
+    free(h->locals);
+    free(h->worlds);
+    free(h);
+}
+
+lx_node lx_hierarchy_add(lx_hierarchy* h, lx_node parent, lx_vec3 translation, lx_quat rotation, lx_vec3 scale)
+{
+    GUARD(parent != LX_NODE_NONE && parent >= h->count, ("failed to add hierarchy node, invalid parent %u", parent), LX_NODE_NONE);
+    GUARD(h->count >= LX_NODE_NONE, ("failed to add hierarchy node, too many nodes"), LX_NODE_NONE);
+
+    if (h->count == h->capacity && !reserve(h, h->capacity * 2))
+        return LX_NODE_NONE;
+
+    // appending keeps every parent before its children
+    lx_node node = (lx_node)h->count++;
+
+    h->parents[node] = parent;
+    h->flags[node] = 0;
+    h->translations[node] = translation;
+    h->rotations[node] = rotation;
+    h->scales[node] = scale;
+
+    mark_dirty(h, node);
+    return node;
+}
+
+void lx_hierarchy_clear(lx_hierarchy* h)
+{
+    h->count = 0;
+    h->first_dirty = 0;
+    h->first_updated = 0;
+}
+
+void lx_hierarchy_set_translation(lx_hierarchy* h, lx_node node, lx_vec3 translation)
+{
+    GUARD(node >= h->count, ("failed to set translation of invalid hierarchy node %u", node));
+
+    h->translations[node] = translation;
+    mark_dirty(h, node);
+}
+
+void lx_hierarchy_set_rotation(lx_hierarchy* h, lx_node node, lx_quat rotation)
+{
+    GUARD(node >= h->count, ("failed to set rotation of invalid hierarchy node %u", node));
+
+    h->rotations[node] = rotation;
+    mark_dirty(h, node);
+}
+
+void lx_hierarchy_set_scale(lx_hierarchy* h, lx_node node, lx_vec3 scale)
+{
+    GUARD(node >= h->count, ("failed to set scale of invalid hierarchy node %u", node));
+
+    h->scales[node] = scale;
+    mark_dirty(h, node);
+}
+
+lx_vec3 lx_hierarchy_get_translation(const lx_hierarchy* h, lx_node node)
+{
+    GUARD(node >= h->count, ("failed to get translation of invalid hierarchy node %u", node), (lx_vec3){ 0 });
+    return h->translations[node];
+}
+
+lx_quat lx_hierarchy_get_rotation(const lx_hierarchy* h, lx_node node)
+{
+    GUARD(node >= h->count, ("failed to get rotation of invalid hierarchy node %u", node), lx_quat_identity());
+    return h->rotations[node];
+}
+
+lx_vec3 lx_hierarchy_get_scale(const lx_hierarchy* h, lx_node node)
+{
+    GUARD(node >= h->count, ("failed to get scale of invalid hierarchy node %u", node), (lx_vec3){ 0 });
+    return h->scales[node];
+}
+
+lx_node lx_hierarchy_get_parent(const lx_hierarchy* h, lx_node node)
+{
+    GUARD(node >= h->count, ("failed to get parent of invalid hierarchy node %u", node), LX_NODE_NONE);
+    return h->parents[node];
+}
+
+size_t lx_hierarchy_get_count(const lx_hierarchy* h)
+{
+    return h->count;
+}
+
+size_t lx_hierarchy_update(lx_hierarchy* h)
+{
+    // nodes before the first dirty one cannot change, they only need the
+    // updated flag from the last pass clearing
+    for (size_t i = h->first_updated; i < h->first_dirty && i < h->count; i++)
+        h->flags[i] &= ~NODE_UPDATED;
+
+    size_t updated = 0;
+    size_t first_updated = h->count;
+
+    for (size_t i = h->first_dirty; i < h->count; i++)
+    {
+        uint8_t flags = h->flags[i];
+        lx_node parent = h->parents[i];
+
+        // a node changes if it was modified or its parent changed this pass,
+        // which has already been decided as parents come first
+        if (!(flags & NODE_DIRTY) && (parent == LX_NODE_NONE || !(h->flags[parent] & NODE_UPDATED)))
+        {
+            h->flags[i] = 0;
+            continue;
+        }
+
+        if (flags & NODE_DIRTY)
+            h->locals[i] = lx_mat4_from_trs(h->translations[i], h->rotations[i], h->scales[i]);
+
+        if (parent == LX_NODE_NONE)
+            h->worlds[i] = h->locals[i];
+        else
+            mt_kernels.mat4_mul(&h->worlds[parent], &h->locals[i], &h->worlds[i]);
+
+        h->flags[i] = NODE_UPDATED;
+
+        if (first_updated == h->count)
+            first_updated = i;
+
+        updated++;
+    }
+
+    h->first_dirty = h->count;
+    h->first_updated = first_updated;
+
+    return updated;
+}
+
+int lx_hierarchy_was_updated(const lx_hierarchy* h, lx_node node)
+{
+    GUARD(node >= h->count, ("failed to query invalid hierarchy node %u", node), 0);
+    return (h->flags[node] & NODE_UPDATED) != 0;
+}
+
+lx_mat4 lx_hierarchy_get_world(const lx_hierarchy* h, lx_node node)
+{
+    GUARD(node >= h->count, ("failed to get world matrix of invalid hierarchy node %u", node), lx_mat4_identity());
+    return h->worlds[node];
+}
+
+const lx_mat4* lx_hierarchy_get_worlds(const lx_hierarchy* h)
+{
+    return h->worlds;
+}
@@ -0,0 +1,46 @@
+#include "lux/scene.h"
+#include "../debug/debug.h"
+#include "../math/math.h"
+#include "../utils/utils.h"
+
+// private source
+// ----------------------------------------------------------------
+
+// vertices handed to each worker
+#define SKIN_GRAIN 4096
+
+typedef struct _skin_job
+{
+    const lx_mat4* palette;
+    size_t bone_count;
+    const lx_skin_vertex* vertices;
+    lx_vec3* positions;
+    lx_vec3* normals;
+}
+skin_job;
+
+static void skin_range(void* ctx, int range, size_t begin, size_t end)
+{
+    (void)range;
+    skin_job* job = ctx;
+
+    mt_kernels.skin_vertices(
+        job->palette,
+        job->bone_count,
+        job->vertices + begin,
+        job->positions + begin,
+        job->normals != NULL ? job->normals + begin : NULL,
+        end - begin
+    );
+}
+
+// public header
+// ----------------------------------------------------------------
+
+void lx_skin_vertices(const lx_mat4* palette, size_t bone_count, const lx_skin_vertex* vertices, size_t count, lx_vec3* positions, lx_vec3* normals)
+{
+    GUARD(palette == NULL || vertices == NULL || positions == NULL, ("failed to skin vertices, null palette or array"));
+
+    skin_job job = { palette, bone_count, vertices, positions, normals };
+    parallel_for(count, SKIN_GRAIN, skin_range, &job);
+}
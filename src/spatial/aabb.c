@@ -0,0 +1,30 @@
+#include "lux/spatial.h"
+
+#include <math.h>
+
+// public header
+// ----------------------------------------------------------------
+
+lx_aabb lx_aabb_transform(lx_aabb b, lx_mat4 m)
+{
+    const float* e = m.m;
+
+    lx_vec3 c = { (b.min.x + b.max.x) * 0.5f, (b.min.y + b.max.y) * 0.5f, (b.min.z + b.max.z) * 0.5f };
+    lx_vec3 h = { (b.max.x - b.min.x) * 0.5f, (b.max.y - b.min.y) * 0.5f, (b.max.z - b.min.z) * 0.5f };
+
+    // the center moves with the transform, the extents are projected onto
+    // each axis through the absolute upper 3x3
+    lx_vec3 center = {
+        e[0] * c.x + e[4] * c.y + e[8] * c.z + e[12],
+        e[1] * c.x + e[5] * c.y + e[9] * c.z + e[13],
+        e[2] * c.x + e[6] * c.y + e[10] * c.z + e[14]
+    };
+
+    lx_vec3 extent = {
+        fabsf(e[0]) * h.x + fabsf(e[4]) * h.y + fabsf(e[8]) * h.z,
+        fabsf(e[1]) * h.x + fabsf(e[5]) * h.y + fabsf(e[9]) * h.z,
+        fabsf(e[2]) * h.x + fabsf(e[6]) * h.y + fabsf(e[10]) * h.z
+    };
+
+    return (lx_aabb){ lx_vec3_sub(center, extent), lx_vec3_add(center, extent) };
+}
@@ -0,0 +1,413 @@
+#include "lux/spatial.h"
+#include "../debug/debug.h"
+#include "../math/math.h"
+#include "../utils/utils.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// primitives are binned by centroid along each axis when looking for a split
+#define BVH_BINS 12
+
+// nodes holding more primitives than this are split even if the surface area
+// heuristic would rather keep them whole
+#define BVH_MAX_LEAF 8
+
+// rays handed to each worker
+#define RAYCAST_GRAIN 256
+
+struct _lx_bvh
+{
+    bvh_node* nodes;
+    size_t node_count;
+
+    // one of these is set, in leaf order
+    bvh_triangle* triangles;
+    lx_aabb* boxes;
+    uint32_t* ids;
+};
+
+typedef struct _build_task
+{
+    uint32_t node;
+    uint32_t begin;
+    uint32_t end;
+    int depth;
+}
+build_task;
+
+typedef struct _bin
+{
+    lx_aabb bounds;
+    uint32_t count;
+}
+bin;
+
+typedef struct _raycast_job
+{
+    bvh_tree tree;
+    const lx_ray* rays;
+    float max_distance;
+    lx_ray_hit* hits;
+
+    size_t hit_count[PARALLEL_MAX_RANGES];
+}
+raycast_job;
+
+static const lx_aabb empty_box = { { INFINITY, INFINITY, INFINITY }, { -INFINITY, -INFINITY, -INFINITY } };
+
+static inline float min_of(float a, float b) { return a < b ? a : b; }
+static inline float max_of(float a, float b) { return a > b ? a : b; }
+
+static inline void grow_box(lx_aabb* b, const lx_aabb* other)
+{
+    b->min = (lx_vec3){ min_of(b->min.x, other->min.x), min_of(b->min.y, other->min.y), min_of(b->min.z, other->min.z) };
+    b->max = (lx_vec3){ max_of(b->max.x, other->max.x), max_of(b->max.y, other->max.y), max_of(b->max.z, other->max.z) };
+}
+
+static inline float half_area(const lx_aabb* b)
+{
+    float x = b->max.x - b->min.x;
+    float y = b->max.y - b->min.y;
+    float z = b->max.z - b->min.z;
+    return x * y + y * z + z * x;
+}
+
+static inline float axis_of(const lx_vec3* v, int axis)
+{
+    return (&v->x)[axis];
+}
+
+static inline int bin_of(const lx_vec3* centroid, int axis, float min, float scale)
+{
+    int b = (int)((axis_of(centroid, axis) - min) * scale);
+    return b < BVH_BINS - 1 ? b : BVH_BINS - 1;
+}
+
+// finds the cheapest binned split of a node's primitives, returning its
+// relative cost, or infinity if the centroids are all in one place
+static float find_split(const lx_aabb* bounds, const lx_vec3* centroids, const uint32_t* ids, uint32_t begin, uint32_t end,
+    const lx_aabb* centroid_bounds, int* split_axis, int* split_bin)
+{
+    float best = INFINITY;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float min = axis_of(&centroid_bounds->min, axis);
+        float extent = axis_of(&centroid_bounds->max, axis) - min;
+        if (extent <= 0.0f)
+            continue;
+
+        bin bins[BVH_BINS];
+        for (int b = 0; b < BVH_BINS; b++)
+            bins[b] = (bin){ empty_box, 0 };
+
+        float scale = BVH_BINS / extent;
+        for (uint32_t i = begin; i < end; i++)
+        {
+            bin* b = &bins[bin_of(&centroids[ids[i]], axis, min, scale)];
+            grow_box(&b->bounds, &bounds[ids[i]]);
+            b->count++;
+        }
+
+        // sweep from the right, then from the left pricing each boundary
+        float right_cost[BVH_BINS];
+        lx_aabb right = empty_box;
+        uint32_t right_count = 0;
+
+        for (int b = BVH_BINS - 1; b > 0; b--)
+        {
+            grow_box(&right, &bins[b].bounds);
+            right_count += bins[b].count;
+            right_cost[b] = right_count > 0 ? half_area(&right) * right_count : 0.0f;
+        }
+
+        lx_aabb left = empty_box;
+        uint32_t left_count = 0;
+
+        for (int b = 0; b < BVH_BINS - 1; b++)
+        {
+            grow_box(&left, &bins[b].bounds);
+            left_count += bins[b].count;
+
+            if (left_count == 0 || left_count == end - begin)
+                continue;
+
+            float cost = half_area(&left) * left_count + right_cost[b + 1];
+            if (cost < best)
+            {
+                best = cost;
+                *split_axis = axis;
+                *split_bin = b;
+            }
+        }
+    }
+
+    return best;
+}
+
+static int build(lx_bvh* bvh, const lx_aabb* bounds, const lx_vec3* centroids, uint32_t count)
+{
+    bvh->nodes = malloc((2 * (size_t)count - 1) * sizeof(bvh_node));
+    bvh->ids = malloc(count * sizeof(uint32_t));
+    if (bvh->nodes == NULL || bvh->ids == NULL)
+        return 0;
+
+    for (uint32_t i = 0; i < count; i++)
+        bvh->ids[i] = i;
+
+    uint32_t* ids = bvh->ids;
+    uint32_t used = 1;
+
+    // depth first, so the stack holds at most one sibling per level
+    build_task stack[BVH_MAX_DEPTH + 2];
+    int top = 0;
+    stack[top++] = (build_task){ 0, 0, count, 0 };
+
+    while (top > 0)
+    {
+        build_task task = stack[--top];
+        bvh_node* node = &bvh->nodes[task.node];
+        uint32_t n = task.end - task.begin;
+
+        lx_aabb node_bounds = empty_box;
+        lx_aabb centroid_bounds = empty_box;
+
+        for (uint32_t i = task.begin; i < task.end; i++)
+        {
+            grow_box(&node_bounds, &bounds[ids[i]]);
+            grow_box(&centroid_bounds, &(lx_aabb){ centroids[ids[i]], centroids[ids[i]] });
+        }
+
+        *node = (bvh_node){
+            { node_bounds.min.x, node_bounds.min.y, node_bounds.min.z }, task.begin,
+            { node_bounds.max.x, node_bounds.max.y, node_bounds.max.z }, n
+        };
+
+        if (n == 1 || task.depth >= BVH_MAX_DEPTH)
+            continue;
+
+        int axis = 0;
+        int split = 0;
+        float cost = find_split(bounds, centroids, ids, task.begin, task.end, &centroid_bounds, &axis, &split);
+
+        // the cost of splitting is one traversal step plus the primitives
+        // of each child weighted by the chance a ray through the node hits it
+        float area = half_area(&node_bounds);
+        int splittable = cost < INFINITY;
+
+        if (n <= BVH_MAX_LEAF && (!splittable || area <= 0.0f || 1.0f + cost / area >= (float)n))
+            continue;
+
+        uint32_t mid;
+
+        if (splittable)
+        {
+            float min = axis_of(&centroid_bounds.min, axis);
+            float scale = BVH_BINS / (axis_of(&centroid_bounds.max, axis) - min);
+
+            uint32_t i = task.begin;
+            uint32_t j = task.end;
+
+            while (i < j)
+            {
+                if (bin_of(&centroids[ids[i]], axis, min, scale) <= split)
+                {
+                    i++;
+                    continue;
+                }
+
+                uint32_t swap = ids[i];
+                ids[i] = ids[--j];
+                ids[j] = swap;
+            }
+
+            mid = i;
+        }
+        else
+        {
+            // every centroid is the same point, any halving is as good
+            mid = task.begin + n / 2;
+        }
+
+        node->index = used;
+        node->count = 0;
+        used += 2;
+
+        stack[top++] = (build_task){ node->index, task.begin, mid, task.depth + 1 };
+        stack[top++] = (build_task){ node->index + 1, mid, task.end, task.depth + 1 };
+    }
+
+    bvh->node_count = used;
+
+    bvh_node* shrunk = realloc(bvh->nodes, used * sizeof(bvh_node));
+    if (shrunk != NULL)
+        bvh->nodes = shrunk;
+
+    return 1;
+}
+
+static void raycast_range(void* ctx, int range, size_t begin, size_t end)
+{
+    raycast_job* job = ctx;
+    job->hit_count[range] = mt_kernels.bvh_raycast(&job->tree, job->rays + begin, end - begin, job->max_distance, job->hits + begin);
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_bvh* lx_bvh_create_triangles(const lx_vec3* vertices, size_t vertex_count, const uint32_t* indices, size_t triangle_count)
+{
+    GUARD(vertices == NULL || indices == NULL, ("failed to create bvh, null vertices or indices"), NULL);
+    GUARD(triangle_count > UINT32_MAX / 2, ("failed to create bvh, %zu triangles is too many", triangle_count), NULL);
+
+    for (size_t i = 0; i < triangle_count * 3; i++)
+        GUARD(indices[i] >= vertex_count, ("failed to create bvh, index %u out of range", indices[i]), NULL);
+
+    lx_bvh* bvh = calloc(1, sizeof(lx_bvh));
+    lx_aabb* bounds = malloc(triangle_count * sizeof(lx_aabb));
+    lx_vec3* centroids = malloc(triangle_count * sizeof(lx_vec3));
+    bvh_triangle* triangles = malloc(triangle_count * sizeof(bvh_triangle));
+
+    int built = bvh != NULL && bounds != NULL && centroids != NULL && triangles != NULL;
+
+    for (size_t i = 0; built && i < triangle_count; i++)
+    {
+        bounds[i] = empty_box;
+
+        for (int v = 0; v < 3; v++)
+        {
+            lx_vec3 p = vertices[indices[i * 3 + v]];
+            grow_box(&bounds[i], &(lx_aabb){ p, p });
+        }
+
+        centroids[i] = lx_vec3_scale_by_scalar(lx_vec3_add(bounds[i].min, bounds[i].max), 0.5f);
+    }
+
+    if (built && triangle_count > 0)
+        built = build(bvh, bounds, centroids, (uint32_t)triangle_count);
+
+    if (built)
+    {
+        // stored in leaf order, so each leaf reads a contiguous run
+        for (size_t i = 0; i < triangle_count; i++)
+        {
+            const uint32_t* t = &indices[bvh->ids[i] * 3];
+            lx_vec3 v0 = vertices[t[0]];
+
+            triangles[i] = (bvh_triangle){ v0, lx_vec3_sub(vertices[t[1]], v0), lx_vec3_sub(vertices[t[2]], v0) };
+        }
+
+        bvh->triangles = triangles;
+    }
+
+    free(bounds);
+    free(centroids);
+
+    if (!built)
+    {
+        free(triangles);
+        lx_bvh_destroy(bvh);
+        lx_error("failed to allocate bvh over %zu triangles", triangle_count);
+        return NULL;
+    }
+
+    return bvh;
+}
+
+lx_bvh* lx_bvh_create_aabbs(const lx_aabb* boxes, size_t count)
+{
+    GUARD(boxes == NULL, ("failed to create bvh, null boxes"), NULL);
+    GUARD(count > UINT32_MAX / 2, ("failed to create bvh, %zu boxes is too many", count), NULL);
+
+    lx_bvh* bvh = calloc(1, sizeof(lx_bvh));
+    lx_vec3* centroids = malloc(count * sizeof(lx_vec3));
+    lx_aabb* sorted = malloc(count * sizeof(lx_aabb));
+
+    int built = bvh != NULL && centroids != NULL && sorted != NULL;
+
+    for (size_t i = 0; built && i < count; i++)
+        centroids[i] = lx_vec3_scale_by_scalar(lx_vec3_add(boxes[i].min, boxes[i].max), 0.5f);
+
+    if (built && count > 0)
+        built = build(bvh, boxes, centroids, (uint32_t)count);
+
+    if (built)
+    {
+        for (size_t i = 0; i < count; i++)
+            sorted[i] = boxes[bvh->ids[i]];
+
+        bvh->boxes = sorted;
+    }
+
+    free(centroids);
+
+    if (!built)
+    {
+        free(sorted);
+        lx_bvh_destroy(bvh);
+        lx_error("failed to allocate bvh over %zu boxes", count);
+        return NULL;
+    }
+
+    return bvh;
+}
+
+void lx_bvh_destroy(lx_bvh* bvh)
+{
+    if (bvh == NULL)
+        return;
+
+    free(bvh->nodes);
+    free(bvh->triangles);
+    free(bvh->boxes);
+    free(bvh->ids);
+    free(bvh);
+}
+
+int lx_bvh_raycast(const lx_bvh* bvh, lx_ray r, float max_distance, lx_ray_hit* hit)
+{
+    GUARD(bvh == NULL || hit == NULL, ("failed to raycast, null bvh or hit"), 0);
+
+    if (bvh->node_count == 0)
+    {
+        *hit = (lx_ray_hit){ max_distance, 0.0f, 0.0f, LX_BVH_NO_HIT };
+        return 0;
+    }
+
+    // a lone ray would leave the other lanes of a packet idle, for no gain
+    // over the scalar kernel
+    bvh_tree tree = { bvh->nodes, bvh->triangles, bvh->boxes, bvh->ids };
+    return (int)scalar_bvh_raycast(&tree, &r, 1, max_distance, hit);
+}
+
+size_t lx_bvh_raycast_packet(const lx_bvh* bvh, const lx_ray* rays, size_t count, float max_distance, lx_ray_hit* hits)
+{
+    GUARD(bvh == NULL || rays == NULL || hits == NULL, ("failed to raycast, null bvh or array"), 0);
+
+    if (bvh->node_count == 0)
+    {
+        for (size_t i = 0; i < count; i++)
+            hits[i] = (lx_ray_hit){ max_distance, 0.0f, 0.0f, LX_BVH_NO_HIT };
+
+        return 0;
+    }
+
+    raycast_job job = {
+        .tree = { bvh->nodes, bvh->triangles, bvh->boxes, bvh->ids },
+        .rays = rays,
+        .max_distance = max_distance,
+        .hits = hits
+    };
+
+    int ranges = parallel_for(count, RAYCAST_GRAIN, raycast_range, &job);
+
+    size_t n = 0;
+    for (int r = 0; r < ranges; r++)
+        n += job.hit_count[r];
+
+    return n;
+}
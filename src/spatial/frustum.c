@@ -0,0 +1,187 @@
+#include "lux/spatial.h"
+#include "../debug/debug.h"
+#include "../math/math.h"
+#include "../utils/utils.h"
+
+#include <math.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+// private source
+// ----------------------------------------------------------------
+
+// ranges handed to each worker are a whole number of mask words
+#define CULL_GRAIN 4096
+
+typedef struct _cull_job
+{
+    const lx_frustum* f;
+    const void* volumes;
+    int aabbs;
+
+    uint32_t* mask;
+    uint32_t* indices;
+
+    size_t begin[PARALLEL_MAX_RANGES];
+    size_t visible[PARALLEL_MAX_RANGES];
+}
+cull_job;
+
+static inline int lowest_bit(uint32_t bits)
+{
+#ifdef _MSC_VER
+    unsigned long i;
+    _BitScanForward(&i, bits);
+    return (int)i;
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+static void cull_range(const cull_job* job, size_t begin, size_t end, uint32_t* mask)
+{
+    if (job->aabbs)
+        mt_kernels.frustum_cull_aabbs(job->f, (const lx_aabb*)job->volumes + begin, end - begin, mask);
+    else
+        mt_kernels.frustum_cull_spheres(job->f, (const lx_sphere*)job->volumes + begin, end - begin, mask);
+}
+
+static void cull_mask(void* ctx, int range, size_t begin, size_t end)
+{
+    (void)range;
+    cull_job* job = ctx;
+    cull_range(job, begin, end, job->mask + begin / 32);
+}
+
+static void cull_indices(void* ctx, int range, size_t begin, size_t end)
+{
+    cull_job* job = ctx;
+    uint32_t* out = job->indices + begin;
+    size_t n = 0;
+
+    // the mask is built a block at a time on the stack, then expanded
+    uint32_t mask[CULL_GRAIN / 32];
+
+    for (size_t block = begin; block < end; block += CULL_GRAIN)
+    {
+        size_t block_end = block + CULL_GRAIN < end ? block + CULL_GRAIN : end;
+        cull_range(job, block, block_end, mask);
+
+        for (size_t w = 0; w * 32 < block_end - block; w++)
+        {
+            uint32_t base = (uint32_t)(block + w * 32);
+
+            for (uint32_t bits = mask[w]; bits != 0; bits &= bits - 1)
+                out[n++] = base + lowest_bit(bits);
+        }
+    }
+
+    job->begin[range] = begin;
+    job->visible[range] = n;
+}
+
+static size_t cull_compact(cull_job* job, size_t count)
+{
+    int ranges = parallel_for(count, CULL_GRAIN, cull_indices, job);
+
+    // each range wrote its indices from its own start, close the gaps
+    size_t n = 0;
+    for (int r = 0; r < ranges; r++)
+    {
+        if (job->begin[r] != n)
+            memmove(job->indices + n, job->indices + job->begin[r], job->visible[r] * sizeof(uint32_t));
+
+        n += job->visible[r];
+    }
+
+    return n;
+}
+
+static lx_vec4 normalize_plane(float x, float y, float z, float w)
+{
+    float mag = sqrtf(x * x + y * y + z * z);
+    return (lx_vec4){ x / mag, y / mag, z / mag, w / mag };
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_frustum lx_frustum_from_mat4(lx_mat4 view_projection)
+{
+    const float* m = view_projection.m;
+    lx_frustum f;
+
+    // each plane is the last row of the matrix plus or minus one of the others
+    for (int i = 0; i < 3; i++)
+    {
+        f.planes[i * 2] = normalize_plane(m[3] + m[i], m[7] + m[4 + i], m[11] + m[8 + i], m[15] + m[12 + i]);
+        f.planes[i * 2 + 1] = normalize_plane(m[3] - m[i], m[7] - m[4 + i], m[11] - m[8 + i], m[15] - m[12 + i]);
+    }
+
+    return f;
+}
+
+int lx_frustum_test_sphere(const lx_frustum* f, lx_sphere s)
+{
+    for (int p = 0; p < 6; p++)
+    {
+        lx_vec4 n = f->planes[p];
+        if (n.x * s.center.x + n.y * s.center.y + n.z * s.center.z + n.w < -s.radius)
+            return 0;
+    }
+
+    return 1;
+}
+
+int lx_frustum_test_aabb(const lx_frustum* f, lx_aabb b)
+{
+    for (int p = 0; p < 6; p++)
+    {
+        lx_vec4 n = f->planes[p];
+
+        // the corner furthest along the normal decides the whole box
+        float x = n.x > 0.0f ? b.max.x : b.min.x;
+        float y = n.y > 0.0f ? b.max.y : b.min.y;
+        float z = n.z > 0.0f ? b.max.z : b.min.z;
+
+        if (n.x * x + n.y * y + n.z * z + n.w < 0.0f)
+            return 0;
+    }
+
+    return 1;
+}
+
+void lx_frustum_cull_spheres(const lx_frustum* f, const lx_sphere* spheres, size_t count, uint32_t* mask)
+{
+    GUARD(f == NULL || spheres == NULL || mask == NULL, ("failed to cull spheres, null frustum or array"));
+
+    cull_job job = { .f = f, .volumes = spheres, .aabbs = 0, .mask = mask };
+    parallel_for(count, CULL_GRAIN, cull_mask, &job);
+}
+
+size_t lx_frustum_cull_spheres_indices(const lx_frustum* f, const lx_sphere* spheres, size_t count, uint32_t* indices)
+{
+    GUARD(f == NULL || spheres == NULL || indices == NULL, ("failed to cull spheres, null frustum or array"), 0);
+
+    cull_job job = { .f = f, .volumes = spheres, .aabbs = 0, .indices = indices };
+    return cull_compact(&job, count);
+}
+
+void lx_frustum_cull_aabbs(const lx_frustum* f, const lx_aabb* boxes, size_t count, uint32_t* mask)
+{
+    GUARD(f == NULL || boxes == NULL || mask == NULL, ("failed to cull boxes, null frustum or array"));
+
+    cull_job job = { .f = f, .volumes = boxes, .aabbs = 1, .mask = mask };
+    parallel_for(count, CULL_GRAIN, cull_mask, &job);
+}
+
+size_t lx_frustum_cull_aabbs_indices(const lx_frustum* f, const lx_aabb* boxes, size_t count, uint32_t* indices)
+{
+    GUARD(f == NULL || boxes == NULL || indices == NULL, ("failed to cull boxes, null frustum or array"), 0);
+
+    cull_job job = { .f = f, .volumes = boxes, .aabbs = 1, .indices = indices };
+    return cull_compact(&job, count);
+}
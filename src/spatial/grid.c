@@ -0,0 +1,636 @@
+#include "lux/spatial.h"
+#include "../debug/debug.h"
+#include "../utils/utils.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// points handed to each worker
+#define GRID_GRAIN 16384
+
+// queries keep their bucket lists and heaps here unless they need more
+#define GRID_LOCAL 64
+
+struct _lx_hash_grid
+{
+    float cell_size;
+    float inv_cell_size;
+    int dims;
+
+    size_t count;
+    size_t capacity;
+    uint32_t mask;
+
+    // the bucket of each point in input order, then the points counting
+    // sorted by bucket, bucket b spanning [offsets[b], offsets[b + 1])
+    uint32_t* keys;
+    uint32_t* offsets;
+    uint32_t* ids;
+    lx_vec3* points;
+
+    // the range of cells holding points, which bounds every query
+    int32_t cell_min[3];
+    int32_t cell_max[3];
+};
+
+typedef struct _build_job
+{
+    lx_hash_grid* grid;
+    const lx_vec3* points;
+    const lx_vec2* points_2d;
+
+    int32_t cell_min[PARALLEL_MAX_RANGES][3];
+    int32_t cell_max[PARALLEL_MAX_RANGES][3];
+}
+build_job;
+
+static inline int32_t cell_of(const lx_hash_grid* grid, float v)
+{
+    return (int32_t)floorf(v * grid->inv_cell_size);
+}
+
+static inline uint32_t bucket_of(const lx_hash_grid* grid, int32_t x, int32_t y, int32_t z)
+{
+    return ((uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u ^ (uint32_t)z * 83492791u) & grid->mask;
+}
+
+static inline lx_vec3 point_of(const build_job* job, size_t i)
+{
+    if (job->points != NULL)
+        return job->points[i];
+
+    return (lx_vec3){ job->points_2d[i].x, job->points_2d[i].y, 0.0f };
+}
+
+static int reserve(lx_hash_grid* grid, size_t count)
+{
+    // about one bucket per point keeps collisions between cells rare
+    size_t buckets = 16;
+    while (buckets < count)
+        buckets *= 2;
+
+    if (count > grid->capacity)
+    {
+        uint32_t* keys = realloc(grid->keys, count * sizeof(uint32_t));
+        if (keys != NULL)
+            grid->keys = keys;
+
+        uint32_t* ids = realloc(grid->ids, count * sizeof(uint32_t));
+        if (ids != NULL)
+            grid->ids = ids;
+
+        lx_vec3* points = realloc(grid->points, count * sizeof(lx_vec3));
+        if (points != NULL)
+            grid->points = points;
+
+        if (keys == NULL || ids == NULL || points == NULL)
+        {
+            lx_error("failed to allocate space for %zu hash grid points", count);
+            return 0;
+        }
+
+        grid->capacity = count;
+    }
+
+    if (buckets - 1 != grid->mask || grid->offsets == NULL)
+    {
+        uint32_t* offsets = realloc(grid->offsets, (buckets + 1) * sizeof(uint32_t));
+        if (offsets == NULL)
+        {
+            lx_error("failed to allocate %zu hash grid buckets", buckets);
+            return 0;
+        }
+
+        grid->offsets = offsets;
+        grid->mask = (uint32_t)(buckets - 1);
+    }
+
+    return 1;
+}
+
+static void hash_range(void* ctx, int range, size_t begin, size_t end)
+{
+    build_job* job = ctx;
+    lx_hash_grid* grid = job->grid;
+
+    int32_t lo[3] = { INT32_MAX, INT32_MAX, INT32_MAX };
+    int32_t hi[3] = { INT32_MIN, INT32_MIN, INT32_MIN };
+
+    for (size_t i = begin; i < end; i++)
+    {
+        lx_vec3 p = point_of(job, i);
+        int32_t c[3] = { cell_of(grid, p.x), cell_of(grid, p.y), cell_of(grid, p.z) };
+
+        for (int a = 0; a < 3; a++)
+        {
+            lo[a] = c[a] < lo[a] ? c[a] : lo[a];
+            hi[a] = c[a] > hi[a] ? c[a] : hi[a];
+        }
+
+        grid->keys[i] = bucket_of(grid, c[0], c[1], c[2]);
+    }
+
+    memcpy(job->cell_min[range], lo, sizeof(lo));
+    memcpy(job->cell_max[range], hi, sizeof(hi));
+}
+
+static void gather_range(void* ctx, int range, size_t begin, size_t end)
+{
+    (void)range;
+    build_job* job = ctx;
+    lx_hash_grid* grid = job->grid;
+
+    for (size_t j = begin; j < end; j++)
+        grid->points[j] = point_of(job, grid->ids[j]);
+}
+
+static int build(lx_hash_grid* grid, build_job* job, size_t count, int dims)
+{
+    if (!reserve(grid, count))
+        return 0;
+
+    grid->count = count;
+    grid->dims = dims;
+
+    size_t buckets = (size_t)grid->mask + 1;
+    memset(grid->offsets, 0, (buckets + 1) * sizeof(uint32_t));
+
+    if (count == 0)
+        return 1;
+
+    // hashing is the costly part and runs in parallel, the counting sort
+    // is a few passes over plain integers
+    int ranges = parallel_for(count, GRID_GRAIN, hash_range, job);
+
+    memcpy(grid->cell_min, job->cell_min[0], sizeof(grid->cell_min));
+    memcpy(grid->cell_max, job->cell_max[0], sizeof(grid->cell_max));
+
+    for (int r = 1; r < ranges; r++)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            if (job->cell_min[r][a] < grid->cell_min[a])
+                grid->cell_min[a] = job->cell_min[r][a];
+            if (job->cell_max[r][a] > grid->cell_max[a])
+                grid->cell_max[a] = job->cell_max[r][a];
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+        grid->offsets[grid->keys[i]]++;
+
+    uint32_t sum = 0;
+    for (size_t b = 0; b <= buckets; b++)
+    {
+        uint32_t n = grid->offsets[b];
+        grid->offsets[b] = sum;
+        sum += n;
+    }
+
+    // each scatter advances its bucket's offset to the next bucket's start,
+    // shifting them back up afterwards restores the starts
+    for (size_t i = 0; i < count; i++)
+        grid->ids[grid->offsets[grid->keys[i]]++] = (uint32_t)i;
+
+    for (size_t b = buckets; b > 0; b--)
+        grid->offsets[b] = grid->offsets[b - 1];
+
+    grid->offsets[0] = 0;
+
+    parallel_for(count, GRID_GRAIN, gather_range, job);
+    return 1;
+}
+
+static int compare_buckets(const void* a, const void* b)
+{
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+// neighbouring cells may share a bucket, which must only be visited once
+static size_t sort_unique(uint32_t* buckets, size_t n)
+{
+    if (n <= GRID_LOCAL)
+    {
+        for (size_t i = 1; i < n; i++)
+        {
+            uint32_t b = buckets[i];
+            size_t j = i;
+
+            for (; j > 0 && buckets[j - 1] > b; j--)
+                buckets[j] = buckets[j - 1];
+
+            buckets[j] = b;
+        }
+    }
+    else
+    {
+        qsort(buckets, n, sizeof(uint32_t), compare_buckets);
+    }
+
+    size_t unique = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (unique == 0 || buckets[unique - 1] != buckets[i])
+            buckets[unique++] = buckets[i];
+    }
+
+    return unique;
+}
+
+static inline float distance_sq(lx_vec3 a, lx_vec3 b)
+{
+    float x = a.x - b.x;
+    float y = a.y - b.y;
+    float z = a.z - b.z;
+    return x * x + y * y + z * z;
+}
+
+// a max heap of the nearest points so far, on the caller's arrays
+static void sift_down(float* keys, uint32_t* ids, size_t size, size_t i)
+{
+    for (;;)
+    {
+        size_t largest = i;
+        size_t l = i * 2 + 1;
+        size_t r = l + 1;
+
+        if (l < size && keys[l] > keys[largest])
+            largest = l;
+        if (r < size && keys[r] > keys[largest])
+            largest = r;
+
+        if (largest == i)
+            return;
+
+        float k = keys[i];
+        keys[i] = keys[largest];
+        keys[largest] = k;
+
+        uint32_t id = ids[i];
+        ids[i] = ids[largest];
+        ids[largest] = id;
+
+        i = largest;
+    }
+}
+
+static void sift_up(float* keys, uint32_t* ids, size_t i)
+{
+    while (i > 0)
+    {
+        size_t parent = (i - 1) / 2;
+        if (keys[parent] >= keys[i])
+            return;
+
+        float k = keys[i];
+        keys[i] = keys[parent];
+        keys[parent] = k;
+
+        uint32_t id = ids[i];
+        ids[i] = ids[parent];
+        ids[parent] = id;
+
+        i = parent;
+    }
+}
+
+static int heap_contains(const uint32_t* ids, size_t size, uint32_t id)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        if (ids[i] == id)
+            return 1;
+    }
+
+    return 0;
+}
+
+static inline void heap_offer(float* keys, uint32_t* ids, size_t k, size_t* size, float d, uint32_t id)
+{
+    if (*size < k)
+    {
+        keys[*size] = d;
+        ids[*size] = id;
+        sift_up(keys, ids, (*size)++);
+    }
+    else if (d < keys[0])
+    {
+        keys[0] = d;
+        ids[0] = id;
+        sift_down(keys, ids, *size, 0);
+    }
+}
+
+// the cells a ring adds to the one inside it, as the faces of its cube
+// clipped to the occupied cells. each face leaves out the edges it shares
+// with the faces of earlier axes, so no cell is in two of them
+static int ring_faces(const lx_hash_grid* grid, const int32_t cell[3], int64_t ring, int64_t from[6][3], int64_t to[6][3])
+{
+    int faces = 0;
+    for (int a = 0; a < grid->dims; a++)
+    {
+        // the first ring is the one cell, with nothing inside it
+        for (int side = 0; side < (ring > 0 ? 2 : 1); side++)
+        {
+            int empty = 0;
+            for (int b = 0; b < 3; b++)
+            {
+                int64_t reach = b < grid->dims ? ring : 0;
+                int64_t lo = (int64_t)cell[b] - reach;
+                int64_t hi = (int64_t)cell[b] + reach;
+
+                if (b == a)
+                    lo = hi = side ? hi : lo;
+                else if (b < a)
+                {
+                    lo++;
+                    hi--;
+                }
+
+                from[faces][b] = lo > grid->cell_min[b] ? lo : grid->cell_min[b];
+                to[faces][b] = hi < grid->cell_max[b] ? hi : grid->cell_max[b];
+                empty = empty || from[faces][b] > to[faces][b];
+            }
+
+            faces += !empty;
+        }
+
+        if (ring == 0)
+            break;
+    }
+
+    return faces;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_hash_grid* lx_hash_grid_create(float cell_size)
+{
+    GUARD(!(cell_size > 0.0f), ("failed to create hash grid, cell size %g", cell_size), NULL);
+
+    lx_hash_grid* grid = calloc(1, sizeof(lx_hash_grid));
+    GUARD(grid == NULL, ("failed to allocate hash grid"), NULL);
+
+    grid->cell_size = cell_size;
+    grid->inv_cell_size = 1.0f / cell_size;
+    grid->dims = 3;
+    return grid;
+}
+
+void lx_hash_grid_destroy(lx_hash_grid* grid)
+{
+    if (grid == NULL)
+        return;
+
+    free(grid->keys);
+    free(grid->offsets);
+    free(grid->ids);
+    free(grid->points);
+    free(grid);
+}
+
+int lx_hash_grid_build(lx_hash_grid* grid, const lx_vec3* points, size_t count)
+{
+    GUARD(grid == NULL || points == NULL, ("failed to build hash grid, null grid or points"), 0);
+    GUARD(count > UINT32_MAX, ("failed to build hash grid, %zu points is too many", count), 0);
+
+    build_job job = { .grid = grid, .points = points };
+    return build(grid, &job, count, 3);
+}
+
+int lx_hash_grid_build_vec2(lx_hash_grid* grid, const lx_vec2* points, size_t count)
+{
+    GUARD(grid == NULL || points == NULL, ("failed to build hash grid, null grid or points"), 0);
+    GUARD(count > UINT32_MAX, ("failed to build hash grid, %zu points is too many", count), 0);
+
+    build_job job = { .grid = grid, .points_2d = points };
+    return build(grid, &job, count, 2);
+}
+
+size_t lx_hash_grid_query_radius(const lx_hash_grid* grid, lx_vec3 center, float radius, uint32_t* ids, size_t capacity)
+{
+    GUARD(grid == NULL || (ids == NULL && capacity > 0), ("failed to query hash grid, null grid or ids"), 0);
+
+    if (grid->count == 0 || radius < 0.0f)
+        return 0;
+
+    if (grid->dims == 2)
+        center.z = 0.0f;
+
+    const float* c = &center.x;
+    int32_t lo[3], hi[3];
+    uint64_t cells = 1;
+
+    for (int a = 0; a < 3; a++)
+    {
+        lo[a] = cell_of(grid, c[a] - radius);
+        hi[a] = cell_of(grid, c[a] + radius);
+        lo[a] = lo[a] > grid->cell_min[a] ? lo[a] : grid->cell_min[a];
+        hi[a] = hi[a] < grid->cell_max[a] ? hi[a] : grid->cell_max[a];
+
+        if (lo[a] > hi[a])
+            return 0;
+
+        cells *= (uint64_t)((int64_t)hi[a] - lo[a] + 1);
+    }
+
+    float radius_sq = radius * radius;
+    size_t n = 0;
+
+    // a query covering more cells than there are buckets reads them all
+    if (cells > (uint64_t)grid->mask + 1)
+    {
+        for (size_t j = 0; j < grid->count; j++)
+        {
+            if (distance_sq(grid->points[j], center) > radius_sq)
+                continue;
+
+            if (n < capacity)
+                ids[n] = grid->ids[j];
+
+            n++;
+        }
+
+        return n;
+    }
+
+    uint32_t local[GRID_LOCAL];
+    uint32_t* buckets = cells <= GRID_LOCAL ? local : malloc((size_t)cells * sizeof(uint32_t));
+    GUARD(buckets == NULL, ("failed to allocate %zu hash grid query buckets", (size_t)cells), 0);
+
+    size_t count = 0;
+    for (int32_t z = lo[2]; z <= hi[2]; z++)
+    {
+        for (int32_t y = lo[1]; y <= hi[1]; y++)
+        {
+            for (int32_t x = lo[0]; x <= hi[0]; x++)
+                buckets[count++] = bucket_of(grid, x, y, z);
+        }
+    }
+
+    count = sort_unique(buckets, count);
+
+    for (size_t b = 0; b < count; b++)
+    {
+        for (uint32_t j = grid->offsets[buckets[b]]; j < grid->offsets[buckets[b] + 1]; j++)
+        {
+            if (distance_sq(grid->points[j], center) > radius_sq)
+                continue;
+
+            if (n < capacity)
+                ids[n] = grid->ids[j];
+
+            n++;
+        }
+    }
+
+    if (buckets != local)
+        free(buckets);
+
+    return n;
+}
+
+size_t lx_hash_grid_query_nearest(const lx_hash_grid* grid, lx_vec3 center, size_t k, uint32_t* ids, float* distances)
+{
+    GUARD(grid == NULL || (ids == NULL && k > 0), ("failed to query hash grid, null grid or ids"), 0);
+
+    if (k > grid->count)
+        k = grid->count;
+
+    if (k == 0)
+        return 0;
+
+    if (grid->dims == 2)
+        center.z = 0.0f;
+
+    float local[GRID_LOCAL];
+    float* keys = distances != NULL ? distances : k <= GRID_LOCAL ? local : malloc(k * sizeof(float));
+    GUARD(keys == NULL, ("failed to allocate hash grid query of %zu points", k), 0);
+
+    const float* c = &center.x;
+    int32_t cell[3] = { cell_of(grid, c[0]), cell_of(grid, c[1]), cell_of(grid, c[2]) };
+
+    // rings of cells are searched outwards, starting from the first that
+    // reaches the occupied cells
+    int64_t ring = 0;
+    for (int a = 0; a < grid->dims; a++)
+    {
+        int64_t gap = (int64_t)grid->cell_min[a] - cell[a] > (int64_t)cell[a] - grid->cell_max[a] ?
+            (int64_t)grid->cell_min[a] - cell[a] : (int64_t)cell[a] - grid->cell_max[a];
+
+        ring = gap > ring ? gap : ring;
+    }
+
+    size_t size = 0;
+
+    for (;; ring++)
+    {
+        int64_t lo[3], hi[3];
+        int covered = 1;
+
+        for (int a = 0; a < 3; a++)
+        {
+            int64_t reach = a < grid->dims ? ring : 0;
+            lo[a] = (int64_t)cell[a] - reach;
+            hi[a] = (int64_t)cell[a] + reach;
+            covered = covered && lo[a] <= grid->cell_min[a] && hi[a] >= grid->cell_max[a];
+        }
+
+        int64_t from[6][3], to[6][3];
+        int faces = ring_faces(grid, cell, ring, from, to);
+
+        uint64_t cells = 0;
+        for (int f = 0; f < faces; f++)
+            cells += (uint64_t)(to[f][0] - from[f][0] + 1) * (uint64_t)(to[f][1] - from[f][1] + 1) * (uint64_t)(to[f][2] - from[f][2] + 1);
+
+        // once a ring holds more cells than there are points, as around a
+        // far outlier, reading every point is cheaper than going on
+        if (cells > grid->count)
+        {
+            size = 0;
+            for (size_t j = 0; j < grid->count; j++)
+                heap_offer(keys, ids, k, &size, distance_sq(grid->points[j], center), grid->ids[j]);
+
+            break;
+        }
+
+        for (int f = 0; f < faces; f++)
+        {
+            for (int64_t z = from[f][2]; z <= to[f][2]; z++)
+            {
+                for (int64_t y = from[f][1]; y <= to[f][1]; y++)
+                {
+                    for (int64_t x = from[f][0]; x <= to[f][0]; x++)
+                    {
+                        uint32_t b = bucket_of(grid, (int32_t)x, (int32_t)y, (int32_t)z);
+                        for (uint32_t j = grid->offsets[b]; j < grid->offsets[b + 1]; j++)
+                        {
+                            float d = distance_sq(grid->points[j], center);
+                            uint32_t id = grid->ids[j];
+
+                            if (size == k && d >= keys[0])
+                                continue;
+
+                            // a bucket shared by two cells shows its points twice
+                            if (heap_contains(ids, size, id))
+                                continue;
+
+                            heap_offer(keys, ids, k, &size, d, id);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (covered)
+            break;
+
+        // every point outside the ring is further than the nearest face of it
+        if (size == k)
+        {
+            float gap = INFINITY;
+            for (int a = 0; a < grid->dims; a++)
+            {
+                float below = c[a] - (float)lo[a] * grid->cell_size;
+                float above = (float)(hi[a] + 1) * grid->cell_size - c[a];
+                gap = fminf(gap, fminf(below, above));
+            }
+
+            if (keys[0] <= gap * gap)
+                break;
+        }
+    }
+
+    // sorting the heap in place leaves the nearest first
+    for (size_t end = size; end > 1; end--)
+    {
+        float key = keys[0];
+        keys[0] = keys[end - 1];
+        keys[end - 1] = key;
+
+        uint32_t id = ids[0];
+        ids[0] = ids[end - 1];
+        ids[end - 1] = id;
+
+        sift_down(keys, ids, end - 1, 0);
+    }
+
+    if (distances != NULL)
+    {
+        for (size_t i = 0; i < size; i++)
+            distances[i] = sqrtf(distances[i]);
+    }
+    else if (keys != local)
+    {
+        free(keys);
+    }
+
+    return size;
+}
@@ -0,0 +1,106 @@
+#include "lux/spatial.h"
+#include "lux/core.h"
+#include "lux/input.h"
+#include "../debug/debug.h"
+
+#include <math.h>
+
+// public header
+// ----------------------------------------------------------------
+
+lx_ray lx_ray_from_screen(float x, float y, float width, float height, lx_mat4 view, lx_mat4 projection)
+{
+    GUARD(width <= 0.0f || height <= 0.0f, ("failed to unproject, screen size %gx%g", width, height), (lx_ray){ 0 });
+
+    lx_mat4 inverse = lx_mat4_inverse(lx_mat4_mul(projection, view));
+    float ndc_x = 2.0f * x / width - 1.0f;
+    float ndc_y = 1.0f - 2.0f * y / height;
+
+    // the second point is taken at a depth of 0 rather than on the far plane,
+    // where depth packs distant points together and loses their precision
+    lx_vec4 p0 = lx_mat4_mul_vec4(inverse, (lx_vec4){ ndc_x, ndc_y, -1.0f, 1.0f });
+    lx_vec4 p1 = lx_mat4_mul_vec4(inverse, (lx_vec4){ ndc_x, ndc_y, 0.0f, 1.0f });
+
+    lx_vec3 origin = { p0.x / p0.w, p0.y / p0.w, p0.z / p0.w };
+    lx_vec3 through = { p1.x / p1.w, p1.y / p1.w, p1.z / p1.w };
+
+    return (lx_ray){ origin, lx_vec3_normalize(lx_vec3_sub(through, origin)) };
+}
+
+lx_ray lx_ray_from_mouse(lx_mat4 view, lx_mat4 projection)
+{
+    lx_mousepos pos = lx_get_mouse_pos();
+    return lx_ray_from_screen((float)pos.x, (float)pos.y, (float)lx_get_width(), (float)lx_get_height(), view, projection);
+}
+
+int lx_ray_test_aabb(lx_ray r, lx_aabb b, float* t)
+{
+    const float* o = &r.origin.x;
+    const float* d = &r.direction.x;
+    const float* min = &b.min.x;
+    const float* max = &b.max.x;
+
+    float enter = 0.0f;
+    float leave = INFINITY;
+
+    for (int i = 0; i < 3; i++)
+    {
+        // a ray parallel to the slab is inside it everywhere or nowhere
+        if (d[i] == 0.0f)
+        {
+            if (o[i] < min[i] || o[i] > max[i])
+                return 0;
+
+            continue;
+        }
+
+        float t0 = (min[i] - o[i]) / d[i];
+        float t1 = (max[i] - o[i]) / d[i];
+
+        enter = fmaxf(enter, fminf(t0, t1));
+        leave = fminf(leave, fmaxf(t0, t1));
+    }
+
+    if (leave < enter)
+        return 0;
+
+    if (t != NULL)
+        *t = enter;
+
+    return 1;
+}
+
+int lx_ray_test_triangle(lx_ray r, lx_vec3 v0, lx_vec3 v1, lx_vec3 v2, lx_ray_hit* hit)
+{
+    lx_vec3 e1 = lx_vec3_sub(v1, v0);
+    lx_vec3 e2 = lx_vec3_sub(v2, v0);
+    lx_vec3 p = lx_vec3_cross(r.direction, e2);
+
+    float det = lx_vec3_dot(e1, p);
+    if (det == 0.0f)
+        return 0;
+
+    float inv_det = 1.0f / det;
+    lx_vec3 s = lx_vec3_sub(r.origin, v0);
+    float u = lx_vec3_dot(s, p) * inv_det;
+    if (u < 0.0f || u > 1.0f)
+        return 0;
+
+    lx_vec3 q = lx_vec3_cross(s, e1);
+    float v = lx_vec3_dot(r.direction, q) * inv_det;
+    if (v < 0.0f || u + v > 1.0f)
+        return 0;
+
+    float t = lx_vec3_dot(e2, q) * inv_det;
+    if (t < 1e-6f)
+        return 0;
+
+    if (hit != NULL)
+    {
+        hit->t = t;
+        hit->u = u;
+        hit->v = v;
+    }
+
+    return 1;
+}
@@ -0,0 +1,236 @@
+#include "lux/spatial.h"
+#include "../debug/debug.h"
+#include "../math/math.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// private source
+// ----------------------------------------------------------------
+
+// an insertion sort moving entries further than this many times the count
+// is given up for a full sort, as after a teleport or a shuffle
+#define SWEEP_MAX_SHIFTS 16
+
+typedef struct _sweep_entry
+{
+    float key;
+    uint32_t index;
+}
+sweep_entry;
+
+struct _lx_sweep_prune
+{
+    size_t count;
+    size_t capacity;
+    int axis;
+
+    // sorted by key, the minimum of each box along the axis
+    sweep_entry* entries;
+
+    // the boxes gathered into sorted order, one padded array per bound
+    float* bounds[6];
+    uint32_t* ids;
+};
+
+static int reserve(lx_sweep_prune* sp, size_t capacity)
+{
+    if (capacity <= sp->capacity)
+        return 1;
+
+    size_t padded = capacity + SWEEP_PADDING;
+
+    sweep_entry* entries = realloc(sp->entries, capacity * sizeof(sweep_entry));
+    if (entries != NULL)
+        sp->entries = entries;
+
+    uint32_t* ids = realloc(sp->ids, padded * sizeof(uint32_t));
+    if (ids != NULL)
+        sp->ids = ids;
+
+    int grown = entries != NULL && ids != NULL;
+    for (int b = 0; b < 6; b++)
+    {
+        float* bound = realloc(sp->bounds[b], padded * sizeof(float));
+        if (bound != NULL)
+            sp->bounds[b] = bound;
+
+        grown = grown && bound != NULL;
+    }
+
+    if (!grown)
+    {
+        lx_error("failed to allocate space for %zu sweep and prune boxes", capacity);
+        return 0;
+    }
+
+    sp->capacity = capacity;
+    return 1;
+}
+
+static int compare_entries(const void* a, const void* b)
+{
+    float ka = ((const sweep_entry*)a)->key;
+    float kb = ((const sweep_entry*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static inline float axis_of(const lx_vec3* v, int axis)
+{
+    return (&v->x)[axis];
+}
+
+// the axis along which the box centers vary the most separates the most pairs
+static int spread_axis(const lx_vec3* mins, const lx_vec3* maxs, size_t count)
+{
+    double sum[3] = { 0.0 };
+    double sum_sq[3] = { 0.0 };
+
+    for (size_t i = 0; i < count; i++)
+    {
+        for (int a = 0; a < 3; a++)
+        {
+            double c = (double)axis_of(&mins[i], a) + (double)axis_of(&maxs[i], a);
+            sum[a] += c;
+            sum_sq[a] += c * c;
+        }
+    }
+
+    int axis = 0;
+    double best = -1.0;
+
+    for (int a = 0; a < 3; a++)
+    {
+        double variance = sum_sq[a] - sum[a] * sum[a] / (double)count;
+        if (variance > best)
+        {
+            best = variance;
+            axis = a;
+        }
+    }
+
+    return axis;
+}
+
+// returns 0 if the order moved too far to be worth finishing
+static int insertion_sort(sweep_entry* entries, size_t count)
+{
+    size_t budget = count * SWEEP_MAX_SHIFTS;
+
+    for (size_t i = 1; i < count; i++)
+    {
+        sweep_entry e = entries[i];
+        size_t j = i;
+
+        while (j > 0 && entries[j - 1].key > e.key)
+        {
+            entries[j] = entries[j - 1];
+            j--;
+        }
+
+        entries[j] = e;
+
+        size_t shifts = i - j;
+        if (shifts > budget)
+            return 0;
+
+        budget -= shifts;
+    }
+
+    return 1;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_sweep_prune* lx_sweep_prune_create()
+{
+    lx_sweep_prune* sp = calloc(1, sizeof(lx_sweep_prune));
+    GUARD(sp == NULL, ("failed to allocate sweep and prune"), NULL);
+
+    return sp;
+}
+
+void lx_sweep_prune_destroy(lx_sweep_prune* sp)
+{
+    if (sp == NULL)
+        return;
+
+    free(sp->entries);
+    free(sp->ids);
+
+    for (int b = 0; b < 6; b++)
+        free(sp->bounds[b]);
+
+    free(sp);
+}
+
+size_t lx_sweep_prune_update(lx_sweep_prune* sp, const lx_vec3* mins, const lx_vec3* maxs, size_t count, lx_pair* pairs, size_t capacity)
+{
+    GUARD(sp == NULL || mins == NULL || maxs == NULL, ("failed to update sweep and prune, null broadphase or array"), 0);
+    GUARD(pairs == NULL && capacity > 0, ("failed to update sweep and prune, null pairs"), 0);
+    GUARD(count > UINT32_MAX, ("failed to update sweep and prune, %zu boxes is too many", count), 0);
+
+    if (count == 0)
+    {
+        sp->count = 0;
+        return 0;
+    }
+
+    if (!reserve(sp, count))
+        return 0;
+
+    if (count != sp->count)
+    {
+        sp->count = count;
+        sp->axis = spread_axis(mins, maxs, count);
+
+        for (size_t i = 0; i < count; i++)
+            sp->entries[i] = (sweep_entry){ axis_of(&mins[i], sp->axis), (uint32_t)i };
+
+        qsort(sp->entries, count, sizeof(sweep_entry), compare_entries);
+    }
+    else
+    {
+        // last update's order is nearly sorted for boxes that moved a little
+        for (size_t i = 0; i < count; i++)
+            sp->entries[i].key = axis_of(&mins[sp->entries[i].index], sp->axis);
+
+        if (!insertion_sort(sp->entries, count))
+            qsort(sp->entries, count, sizeof(sweep_entry), compare_entries);
+    }
+
+    int y = (sp->axis + 1) % 3;
+    int z = (sp->axis + 2) % 3;
+
+    for (size_t k = 0; k < count; k++)
+    {
+        uint32_t i = sp->entries[k].index;
+
+        sp->bounds[0][k] = sp->entries[k].key;
+        sp->bounds[1][k] = axis_of(&mins[i], y);
+        sp->bounds[2][k] = axis_of(&mins[i], z);
+        sp->bounds[3][k] = axis_of(&maxs[i], sp->axis);
+        sp->bounds[4][k] = axis_of(&maxs[i], y);
+        sp->bounds[5][k] = axis_of(&maxs[i], z);
+        sp->ids[k] = i;
+    }
+
+    // padding that starts after everything, so ends every run
+    for (size_t k = count; k < count + SWEEP_PADDING; k++)
+    {
+        sp->bounds[0][k] = INFINITY;
+        for (int b = 1; b < 6; b++)
+            sp->bounds[b][k] = 0.0f;
+
+        sp->ids[k] = 0;
+    }
+
+    sweep_bounds sorted = {
+        { sp->bounds[0], sp->bounds[1], sp->bounds[2] },
+        { sp->bounds[3], sp->bounds[4], sp->bounds[5] },
+        sp->ids
+    };
+
+    return mt_kernels.sweep_pairs(&sorted, count, pairs, capacity);
+}
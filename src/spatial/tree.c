@@ -0,0 +1,704 @@
+#include "lux/spatial.h"
+#include "../debug/debug.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// private source
+// ----------------------------------------------------------------
+
+#define TREE_NULL UINT32_MAX
+
+// queries keep their traversal stack here unless the tree is taller
+#define TREE_LOCAL_STACK 64
+
+// leaves have no children, free nodes have a height of -1 and are linked
+// through parent
+typedef struct _tree_node
+{
+    lx_aabb box;
+    uint32_t parent;
+    uint32_t children[2];
+    uint32_t id;
+    int32_t height;
+}
+tree_node;
+
+struct _lx_aabb_tree
+{
+    tree_node* nodes;
+    uint32_t capacity;
+    uint32_t root;
+    uint32_t free_list;
+    float margin;
+};
+
+// the ids a query has found, counting past the capacity
+typedef struct _query_out
+{
+    uint32_t* ids;
+    size_t capacity;
+    size_t count;
+}
+query_out;
+
+typedef struct _node_pair
+{
+    uint32_t a;
+    uint32_t b;
+}
+node_pair;
+
+static inline float min_of(float a, float b) { return a < b ? a : b; }
+static inline float max_of(float a, float b) { return a > b ? a : b; }
+
+static inline lx_aabb box_union(const lx_aabb* a, const lx_aabb* b)
+{
+    return (lx_aabb){
+        { min_of(a->min.x, b->min.x), min_of(a->min.y, b->min.y), min_of(a->min.z, b->min.z) },
+        { max_of(a->max.x, b->max.x), max_of(a->max.y, b->max.y), max_of(a->max.z, b->max.z) }
+    };
+}
+
+static inline float half_area(const lx_aabb* b)
+{
+    float x = b->max.x - b->min.x;
+    float y = b->max.y - b->min.y;
+    float z = b->max.z - b->min.z;
+    return x * y + y * z + z * x;
+}
+
+static inline int box_contains(const lx_aabb* outer, const lx_aabb* inner)
+{
+    return outer->min.x <= inner->min.x && outer->min.y <= inner->min.y && outer->min.z <= inner->min.z &&
+        outer->max.x >= inner->max.x && outer->max.y >= inner->max.y && outer->max.z >= inner->max.z;
+}
+
+static inline int box_overlaps(const lx_aabb* a, const lx_aabb* b)
+{
+    return a->min.x <= b->max.x && a->max.x >= b->min.x && a->min.y <= b->max.y && a->max.y >= b->min.y &&
+        a->min.z <= b->max.z && a->max.z >= b->min.z;
+}
+
+static inline int is_leaf(const tree_node* n)
+{
+    return n->children[0] == TREE_NULL;
+}
+
+static inline int is_proxy(const lx_aabb_tree* tree, lx_proxy proxy)
+{
+    return proxy < tree->capacity && tree->nodes[proxy].height == 0;
+}
+
+static uint32_t allocate_node(lx_aabb_tree* tree)
+{
+    if (tree->free_list == TREE_NULL)
+    {
+        uint32_t capacity = tree->capacity > 0 ? tree->capacity * 2 : 32;
+
+        tree_node* grown = realloc(tree->nodes, capacity * sizeof(tree_node));
+        if (grown == NULL)
+        {
+            lx_error("failed to allocate space for %u tree nodes", capacity);
+            return TREE_NULL;
+        }
+
+        // thread the new nodes onto the free list, lowest first
+        for (uint32_t i = tree->capacity; i < capacity; i++)
+        {
+            grown[i].parent = i + 1 < capacity ? i + 1 : TREE_NULL;
+            grown[i].height = -1;
+        }
+
+        tree->nodes = grown;
+        tree->free_list = tree->capacity;
+        tree->capacity = capacity;
+    }
+
+    uint32_t index = tree->free_list;
+    tree_node* n = &tree->nodes[index];
+    tree->free_list = n->parent;
+
+    n->parent = TREE_NULL;
+    n->children[0] = TREE_NULL;
+    n->children[1] = TREE_NULL;
+    n->id = 0;
+    n->height = 0;
+    return index;
+}
+
+static void free_node(lx_aabb_tree* tree, uint32_t index)
+{
+    tree->nodes[index].parent = tree->free_list;
+    tree->nodes[index].height = -1;
+    tree->free_list = index;
+}
+
+static void refit(lx_aabb_tree* tree, uint32_t index)
+{
+    tree_node* n = &tree->nodes[index];
+    const tree_node* a = &tree->nodes[n->children[0]];
+    const tree_node* b = &tree->nodes[n->children[1]];
+
+    n->box = box_union(&a->box, &b->box);
+    n->height = 1 + (a->height > b->height ? a->height : b->height);
+}
+
+// swaps a child of the node with a grandchild under its other child, if that
+// shrinks the other child, the node's own box is the same either way
+static void rotate(lx_aabb_tree* tree, uint32_t index)
+{
+    tree_node* nodes = tree->nodes;
+    tree_node* n = &nodes[index];
+
+    float best = 0.0f;
+    int best_child = -1;
+    int best_grandchild = -1;
+
+    for (int c = 0; c < 2; c++)
+    {
+        const tree_node* child = &nodes[n->children[c]];
+        const tree_node* other = &nodes[n->children[1 - c]];
+
+        if (is_leaf(other))
+            continue;
+
+        // swapping child for one grandchild leaves other holding the child
+        // and the remaining grandchild
+        float area = half_area(&other->box);
+        for (int g = 0; g < 2; g++)
+        {
+            lx_aabb swapped = box_union(&child->box, &nodes[other->children[1 - g]].box);
+            float gain = area - half_area(&swapped);
+
+            if (gain > best)
+            {
+                best = gain;
+                best_child = c;
+                best_grandchild = g;
+            }
+        }
+    }
+
+    if (best_child < 0)
+        return;
+
+    uint32_t child = n->children[best_child];
+    uint32_t other = n->children[1 - best_child];
+    uint32_t grandchild = nodes[other].children[best_grandchild];
+
+    n->children[best_child] = grandchild;
+    nodes[grandchild].parent = index;
+    nodes[other].children[best_grandchild] = child;
+    nodes[child].parent = other;
+
+    refit(tree, other);
+    refit(tree, index);
+}
+
+static void insert_leaf(lx_aabb_tree* tree, uint32_t leaf)
+{
+    tree_node* nodes = tree->nodes;
+
+    if (tree->root == TREE_NULL)
+    {
+        tree->root = leaf;
+        nodes[leaf].parent = TREE_NULL;
+        return;
+    }
+
+    // descend towards the sibling that grows the tree's total area the least,
+    // every node passed on the way grows to hold the new leaf regardless
+    const lx_aabb* box = &nodes[leaf].box;
+    uint32_t index = tree->root;
+
+    while (!is_leaf(&nodes[index]))
+    {
+        const tree_node* n = &nodes[index];
+
+        lx_aabb combined = box_union(&n->box, box);
+        float combined_area = half_area(&combined);
+        float here = 2.0f * combined_area;
+        float inherited = 2.0f * (combined_area - half_area(&n->box));
+
+        float costs[2];
+        for (int c = 0; c < 2; c++)
+        {
+            const tree_node* child = &nodes[n->children[c]];
+            lx_aabb grown = box_union(&child->box, box);
+
+            costs[c] = half_area(&grown) + inherited - (is_leaf(child) ? 0.0f : half_area(&child->box));
+        }
+
+        if (here < costs[0] && here < costs[1])
+            break;
+
+        index = n->children[costs[0] <= costs[1] ? 0 : 1];
+    }
+
+    // allocating may move the nodes
+    uint32_t sibling = index;
+    uint32_t old_parent = nodes[sibling].parent;
+    uint32_t parent = allocate_node(tree);
+    nodes = tree->nodes;
+
+    if (parent == TREE_NULL)
+        return;
+
+    nodes[parent].parent = old_parent;
+    nodes[parent].children[0] = sibling;
+    nodes[parent].children[1] = leaf;
+    nodes[sibling].parent = parent;
+    nodes[leaf].parent = parent;
+
+    if (old_parent == TREE_NULL)
+        tree->root = parent;
+    else
+        nodes[old_parent].children[nodes[old_parent].children[0] == sibling ? 0 : 1] = parent;
+
+    for (index = parent; index != TREE_NULL; index = nodes[index].parent)
+    {
+        refit(tree, index);
+        rotate(tree, index);
+    }
+}
+
+static void remove_leaf(lx_aabb_tree* tree, uint32_t leaf)
+{
+    tree_node* nodes = tree->nodes;
+
+    if (leaf == tree->root)
+    {
+        tree->root = TREE_NULL;
+        return;
+    }
+
+    // the sibling takes the place of the parent
+    uint32_t parent = nodes[leaf].parent;
+    uint32_t grandparent = nodes[parent].parent;
+    uint32_t sibling = nodes[parent].children[nodes[parent].children[0] == leaf ? 1 : 0];
+
+    nodes[sibling].parent = grandparent;
+    free_node(tree, parent);
+
+    if (grandparent == TREE_NULL)
+    {
+        tree->root = sibling;
+        return;
+    }
+
+    nodes[grandparent].children[nodes[grandparent].children[0] == parent ? 0 : 1] = sibling;
+
+    for (uint32_t index = grandparent; index != TREE_NULL; index = nodes[index].parent)
+        refit(tree, index);
+}
+
+static int grow_pair_stack(node_pair** stack, const node_pair* local, size_t* capacity)
+{
+    node_pair* grown = *stack == local ? malloc(*capacity * 2 * sizeof(node_pair)) : realloc(*stack, *capacity * 2 * sizeof(node_pair));
+    if (grown == NULL)
+    {
+        lx_error("failed to allocate tree query stack of %zu pairs", *capacity * 2);
+        return 0;
+    }
+
+    if (*stack == local)
+        memcpy(grown, local, *capacity * sizeof(node_pair));
+
+    *stack = grown;
+    *capacity *= 2;
+    return 1;
+}
+
+static inline void emit(query_out* out, uint32_t id)
+{
+    if (out->count < out->capacity)
+        out->ids[out->count] = id;
+
+    out->count++;
+}
+
+static uint32_t* stack_for(const lx_aabb_tree* tree, uint32_t* local)
+{
+    // each pop pushes at most two children, so the stack never holds more
+    // than one node per level plus one
+    size_t size = (size_t)tree->nodes[tree->root].height + 2;
+    if (size <= TREE_LOCAL_STACK)
+        return local;
+
+    uint32_t* stack = malloc(size * sizeof(uint32_t));
+    if (stack == NULL)
+        lx_error("failed to allocate tree query stack of %zu nodes", size);
+
+    return stack;
+}
+
+static void emit_subtree(const lx_aabb_tree* tree, uint32_t index, query_out* out)
+{
+    uint32_t local[TREE_LOCAL_STACK];
+    uint32_t* stack = local;
+
+    // a subtree is never taller than the whole tree
+    size_t size = (size_t)tree->nodes[index].height + 2;
+    if (size > TREE_LOCAL_STACK && (stack = malloc(size * sizeof(uint32_t))) == NULL)
+        return;
+
+    size_t top = 0;
+    stack[top++] = index;
+
+    while (top > 0)
+    {
+        const tree_node* n = &tree->nodes[stack[--top]];
+
+        if (is_leaf(n))
+        {
+            emit(out, n->id);
+            continue;
+        }
+
+        stack[top++] = n->children[0];
+        stack[top++] = n->children[1];
+    }
+
+    if (stack != local)
+        free(stack);
+}
+
+// 0 if the box is outside a plane, 2 if it is inside all of them, 1 otherwise
+static int classify_box(const lx_frustum* f, const lx_aabb* b)
+{
+    int inside = 1;
+
+    for (int p = 0; p < 6; p++)
+    {
+        const lx_vec4* n = &f->planes[p];
+
+        float far_x = n->x > 0.0f ? b->max.x : b->min.x;
+        float far_y = n->y > 0.0f ? b->max.y : b->min.y;
+        float far_z = n->z > 0.0f ? b->max.z : b->min.z;
+
+        if (n->x * far_x + n->y * far_y + n->z * far_z + n->w < 0.0f)
+            return 0;
+
+        float near_x = n->x > 0.0f ? b->min.x : b->max.x;
+        float near_y = n->y > 0.0f ? b->min.y : b->max.y;
+        float near_z = n->z > 0.0f ? b->min.z : b->max.z;
+
+        if (n->x * near_x + n->y * near_y + n->z * near_z + n->w < 0.0f)
+            inside = 0;
+    }
+
+    return inside ? 2 : 1;
+}
+
+static int ray_crosses(const lx_vec3* origin, const lx_vec3* inverse, float max_t, const lx_aabb* b)
+{
+    float x0 = (b->min.x - origin->x) * inverse->x, x1 = (b->max.x - origin->x) * inverse->x;
+    float y0 = (b->min.y - origin->y) * inverse->y, y1 = (b->max.y - origin->y) * inverse->y;
+    float z0 = (b->min.z - origin->z) * inverse->z, z1 = (b->max.z - origin->z) * inverse->z;
+
+    float enter = max_of(max_of(min_of(x0, x1), min_of(y0, y1)), max_of(min_of(z0, z1), 0.0f));
+    float leave = min_of(min_of(max_of(x0, x1), max_of(y0, y1)), min_of(max_of(z0, z1), max_t));
+    return enter <= leave;
+}
+
+static inline float safe_inverse(float d)
+{
+    // keeps slab distances finite for axis aligned rays
+    if (d > -1e-20f && d < 1e-20f)
+        d = d < 0.0f ? -1e-20f : 1e-20f;
+
+    return 1.0f / d;
+}
+
+// public header
+// ----------------------------------------------------------------
+
+lx_aabb_tree* lx_aabb_tree_create(float margin)
+{
+    GUARD(margin < 0.0f, ("failed to create aabb tree, negative margin %g", margin), NULL);
+
+    lx_aabb_tree* tree = calloc(1, sizeof(lx_aabb_tree));
+    GUARD(tree == NULL, ("failed to allocate aabb tree"), NULL);
+
+    tree->root = TREE_NULL;
+    tree->free_list = TREE_NULL;
+    tree->margin = margin;
+    return tree;
+}
+
+void lx_aabb_tree_destroy(lx_aabb_tree* tree)
+{
+    if (tree == NULL)
+        return;
+
+    free(tree->nodes);
+    free(tree);
+}
+
+lx_proxy lx_aabb_tree_insert(lx_aabb_tree* tree, lx_aabb box, uint32_t id)
+{
+    GUARD(tree == NULL, ("failed to insert into aabb tree, null tree"), LX_PROXY_NONE);
+
+    // a leaf and the parent joining it to the tree, allocated up front so
+    // the insert cannot fail halfway
+    uint32_t leaf = allocate_node(tree);
+    if (leaf == TREE_NULL)
+        return LX_PROXY_NONE;
+
+    uint32_t spare = allocate_node(tree);
+    if (spare == TREE_NULL)
+    {
+        free_node(tree, leaf);
+        return LX_PROXY_NONE;
+    }
+
+    free_node(tree, spare);
+
+    lx_vec3 margin = { tree->margin, tree->margin, tree->margin };
+    tree->nodes[leaf].box = (lx_aabb){ lx_vec3_sub(box.min, margin), lx_vec3_add(box.max, margin) };
+    tree->nodes[leaf].id = id;
+
+    insert_leaf(tree, leaf);
+    return leaf;
+}
+
+void lx_aabb_tree_remove(lx_aabb_tree* tree, lx_proxy proxy)
+{
+    GUARD(tree == NULL || !is_proxy(tree, proxy), ("failed to remove from aabb tree, invalid proxy %u", proxy));
+
+    remove_leaf(tree, proxy);
+    free_node(tree, proxy);
+}
+
+int lx_aabb_tree_move(lx_aabb_tree* tree, lx_proxy proxy, lx_aabb box)
+{
+    GUARD(tree == NULL || !is_proxy(tree, proxy), ("failed to move in aabb tree, invalid proxy %u", proxy), 0);
+
+    tree_node* n = &tree->nodes[proxy];
+    if (box_contains(&n->box, &box))
+        return 0;
+
+    // the removed leaf's parent is freed, so the insert never has to grow
+    // the nodes and the leaf keeps its proxy
+    remove_leaf(tree, proxy);
+
+    lx_vec3 margin = { tree->margin, tree->margin, tree->margin };
+    n->box = (lx_aabb){ lx_vec3_sub(box.min, margin), lx_vec3_add(box.max, margin) };
+
+    insert_leaf(tree, proxy);
+    return 1;
+}
+
+size_t lx_aabb_tree_update(lx_aabb_tree* tree, const lx_proxy* proxies, const lx_aabb* boxes, const lx_mat4* transforms, size_t count)
+{
+    GUARD(tree == NULL || proxies == NULL || boxes == NULL || transforms == NULL, ("failed to update aabb tree, null tree or array"), 0);
+
+    size_t moved = 0;
+    for (size_t i = 0; i < count; i++)
+        moved += lx_aabb_tree_move(tree, proxies[i], lx_aabb_transform(boxes[i], transforms[i]));
+
+    return moved;
+}
+
+lx_aabb lx_aabb_tree_get_fat_aabb(const lx_aabb_tree* tree, lx_proxy proxy)
+{
+    GUARD(tree == NULL || !is_proxy(tree, proxy), ("failed to get fat aabb, invalid proxy %u", proxy), (lx_aabb){ 0 });
+
+    return tree->nodes[proxy].box;
+}
+
+size_t lx_aabb_tree_query_aabb(const lx_aabb_tree* tree, lx_aabb box, uint32_t* ids, size_t capacity)
+{
+    GUARD(tree == NULL || (ids == NULL && capacity > 0), ("failed to query aabb tree, null tree or ids"), 0);
+
+    query_out out = { ids, capacity, 0 };
+    if (tree->root == TREE_NULL)
+        return 0;
+
+    uint32_t local[TREE_LOCAL_STACK];
+    uint32_t* stack = stack_for(tree, local);
+    if (stack == NULL)
+        return 0;
+
+    size_t top = 0;
+    stack[top++] = tree->root;
+
+    while (top > 0)
+    {
+        const tree_node* n = &tree->nodes[stack[--top]];
+        if (!box_overlaps(&n->box, &box))
+            continue;
+
+        if (is_leaf(n))
+        {
+            emit(&out, n->id);
+            continue;
+        }
+
+        stack[top++] = n->children[0];
+        stack[top++] = n->children[1];
+    }
+
+    if (stack != local)
+        free(stack);
+
+    return out.count;
+}
+
+size_t lx_aabb_tree_query_frustum(const lx_aabb_tree* tree, const lx_frustum* f, uint32_t* ids, size_t capacity)
+{
+    GUARD(tree == NULL || f == NULL || (ids == NULL && capacity > 0), ("failed to query aabb tree, null tree, frustum or ids"), 0);
+
+    query_out out = { ids, capacity, 0 };
+    if (tree->root == TREE_NULL)
+        return 0;
+
+    uint32_t local[TREE_LOCAL_STACK];
+    uint32_t* stack = stack_for(tree, local);
+    if (stack == NULL)
+        return 0;
+
+    size_t top = 0;
+    stack[top++] = tree->root;
+
+    while (top > 0)
+    {
+        uint32_t index = stack[--top];
+        const tree_node* n = &tree->nodes[index];
+
+        int visible = classify_box(f, &n->box);
+        if (visible == 0)
+            continue;
+
+        if (is_leaf(n))
+        {
+            emit(&out, n->id);
+            continue;
+        }
+
+        if (visible == 2)
+        {
+            emit_subtree(tree, index, &out);
+            continue;
+        }
+
+        stack[top++] = n->children[0];
+        stack[top++] = n->children[1];
+    }
+
+    if (stack != local)
+        free(stack);
+
+    return out.count;
+}
+
+size_t lx_aabb_tree_query_ray(const lx_aabb_tree* tree, lx_ray r, float max_distance, uint32_t* ids, size_t capacity)
+{
+    GUARD(tree == NULL || (ids == NULL && capacity > 0), ("failed to query aabb tree, null tree or ids"), 0);
+
+    query_out out = { ids, capacity, 0 };
+    if (tree->root == TREE_NULL)
+        return 0;
+
+    uint32_t local[TREE_LOCAL_STACK];
+    uint32_t* stack = stack_for(tree, local);
+    if (stack == NULL)
+        return 0;
+
+    lx_vec3 inverse = { safe_inverse(r.direction.x), safe_inverse(r.direction.y), safe_inverse(r.direction.z) };
+
+    size_t top = 0;
+    stack[top++] = tree->root;
+
+    while (top > 0)
+    {
+        const tree_node* n = &tree->nodes[stack[--top]];
+        if (!ray_crosses(&r.origin, &inverse, max_distance, &n->box))
+            continue;
+
+        if (is_leaf(n))
+        {
+            emit(&out, n->id);
+            continue;
+        }
+
+        stack[top++] = n->children[0];
+        stack[top++] = n->children[1];
+    }
+
+    if (stack != local)
+        free(stack);
+
+    return out.count;
+}
+
+size_t lx_aabb_tree_query_pairs(const lx_aabb_tree* tree, lx_pair* pairs, size_t capacity)
+{
+    GUARD(tree == NULL || (pairs == NULL && capacity > 0), ("failed to query aabb tree, null tree or pairs"), 0);
+
+    if (tree->root == TREE_NULL || is_leaf(&tree->nodes[tree->root]))
+        return 0;
+
+    // the tree is descended against itself, a node paired with itself stands
+    // for the pairs within it, so every pair is reached exactly once
+    node_pair local[TREE_LOCAL_STACK];
+    node_pair* stack = local;
+    size_t stack_capacity = TREE_LOCAL_STACK;
+    size_t top = 0;
+    size_t count = 0;
+
+    stack[top++] = (node_pair){ tree->root, tree->root };
+
+    while (top > 0)
+    {
+        node_pair p = stack[--top];
+        const tree_node* a = &tree->nodes[p.a];
+        const tree_node* b = &tree->nodes[p.b];
+
+        // at most three pairs are pushed below
+        if (top + 3 > stack_capacity && !grow_pair_stack(&stack, local, &stack_capacity))
+            break;
+
+        if (p.a == p.b)
+        {
+            if (is_leaf(a))
+                continue;
+
+            stack[top++] = (node_pair){ a->children[0], a->children[0] };
+            stack[top++] = (node_pair){ a->children[1], a->children[1] };
+            stack[top++] = (node_pair){ a->children[0], a->children[1] };
+            continue;
+        }
+
+        if (!box_overlaps(&a->box, &b->box))
+            continue;
+
+        if (is_leaf(a) && is_leaf(b))
+        {
+            if (count < capacity)
+                pairs[count] = a->id < b->id ? (lx_pair){ a->id, b->id } : (lx_pair){ b->id, a->id };
+
+            count++;
+            continue;
+        }
+
+        // split the larger node, or the one that is not a leaf
+        if (is_leaf(b) || (!is_leaf(a) && half_area(&a->box) > half_area(&b->box)))
+        {
+            stack[top++] = (node_pair){ a->children[0], p.b };
+            stack[top++] = (node_pair){ a->children[1], p.b };
+        }
+        else
+        {
+            stack[top++] = (node_pair){ p.a, b->children[0] };
+            stack[top++] = (node_pair){ p.a, b->children[1] };
+        }
+    }
+
+    if (stack != local)
+        free(stack);
+
+    return count;
+}
@@ -0,0 +1,60 @@
+#include "lux/utils.h"
+#include "utils.h"
+
+static int worker_count = 1;
+
+// public header
+// ---------------------------------------------------------------- 
+
+void lx_set_worker_count(int count)
+{
+    if (count <= 0)
+        count = parallel_hardware_threads();
+
+    worker_count = count > PARALLEL_MAX_RANGES ? PARALLEL_MAX_RANGES : count;
+}
+
+int lx_get_worker_count()
+{
+    return worker_count;
+}
+
+// private header
+// ----------------------------------------------------------------
+
+int parallel_for(size_t count, size_t grain, parallel_fn fn, void* ctx)
+{
+    if (count == 0)
+        return 0;
+
+    // never split below one grain per range
+    size_t ranges = count / grain;
+    if (ranges > (size_t)worker_count)
+        ranges = worker_count;
+    if (ranges == 0)
+        ranges = 1;
+
+    // rounding the share up keeps the ranges from outnumbering the workers
+    size_t per_range = ((count + ranges - 1) / ranges + grain - 1) / grain * grain;
+
+    parallel_task tasks[PARALLEL_MAX_RANGES];
+    int n = 0;
+
+    for (size_t begin = 0; begin < count; begin += per_range, n++)
+    {
+        tasks[n] = (parallel_task){
+            .fn = fn,
+            .ctx = ctx,
+            .range = n,
+            .begin = begin,
+            .end = begin + per_range < count ? begin + per_range : count
+        };
+    }
+
+    if (n == 1)
+        fn(ctx, 0, 0, count);
+    else
+        parallel_run(tasks, n);
+
+    return n;
+}
@@ -0,0 +1,43 @@
+#include "utils.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+// private source
+// ----------------------------------------------------------------
+
+static void* run_task(void* arg)
+{
+    parallel_task* task = arg;
+    task->fn(task->ctx, task->range, task->begin, task->end);
+    return NULL;
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void parallel_run(parallel_task* tasks, int count)
+{
+    pthread_t threads[PARALLEL_MAX_RANGES];
+    int spawned[PARALLEL_MAX_RANGES];
+
+    for (int i = 1; i < count; i++)
+        spawned[i] = pthread_create(&threads[i], NULL, run_task, &tasks[i]) == 0;
+
+    run_task(&tasks[0]);
+
+    // a task whose thread failed to start still runs, just not in parallel
+    for (int i = 1; i < count; i++)
+    {
+        if (spawned[i])
+            pthread_join(threads[i], NULL);
+        else
+            run_task(&tasks[i]);
+    }
+}
+
+int parallel_hardware_threads()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
@@ -0,0 +1,47 @@
+#include "utils.h"
+
+#include <windows.h>
+
+// private source
+// ----------------------------------------------------------------
+
+static DWORD WINAPI run_task(LPVOID arg)
+{
+    parallel_task* task = arg;
+    task->fn(task->ctx, task->range, task->begin, task->end);
+    return 0;
+}
+
+// private header
+// ----------------------------------------------------------------
+
+void parallel_run(parallel_task* tasks, int count)
+{
+    HANDLE threads[PARALLEL_MAX_RANGES];
+
+    for (int i = 1; i < count; i++)
+        threads[i] = CreateThread(NULL, 0, run_task, &tasks[i], 0, NULL);
+
+    run_task(&tasks[0]);
+
+    // a task whose thread failed to start still runs, just not in parallel
+    for (int i = 1; i < count; i++)
+    {
+        if (threads[i] != NULL)
+        {
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+        }
+        else
+        {
+            run_task(&tasks[i]);
+        }
+    }
+}
+
+int parallel_hardware_threads()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
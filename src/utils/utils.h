@@ -0,0 +1,39 @@
+#pragma once
+
+#include "lux/utils.h"
+
+#include <stddef.h>
+
+// types
+// ----------------------------------------------------------------
+
+// runs over [begin, end), range being the index of the range within the split
+typedef void (*parallel_fn)(void* ctx, int range, size_t begin, size_t end);
+
+typedef struct _parallel_task
+{
+    parallel_fn fn;
+    void* ctx;
+    int range;
+    size_t begin;
+    size_t end;
+}
+parallel_task;
+
+#define PARALLEL_MAX_RANGES 64
+
+// parallel
+// ----------------------------------------------------------------
+
+// splits [0, count) into at most one range per worker, each a multiple of
+// grain long apart from the last, and runs fn over every range before
+// returning. the calling thread takes the first range. returns the number of
+// ranges, which is never more than PARALLEL_MAX_RANGES.
+int parallel_for(size_t count, size_t grain, parallel_fn fn, void* ctx);
+
+// runs the first task on the calling thread and the rest on new threads,
+// waiting for all of them
+void parallel_run(parallel_task* tasks, int count);
+
+// gets the number of hardware threads
+int parallel_hardware_threads();
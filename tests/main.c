@@ -6,6 +6,7 @@
 void on_resize(int width, int height)
 {
     glViewport(0, 0, width, height);
+    resize_test_camera(width, height);
 }
 
 void on_error(const char* desc)
@@ -22,6 +23,8 @@ int main()
 
         .on_resize = on_resize,
         .on_error = on_error,
+
+        .gl_state_cache = 1,
     });
 
     create_test_shader();
@@ -45,6 +48,7 @@ int main()
         lx_swap_buffers();
     }
 
+    destroy_test_camera();
     lx_quit();
     return 0;
 }
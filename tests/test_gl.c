@@ -4,6 +4,7 @@
 
 static unsigned int shader;
 static unsigned int vao;
+static lx_camera* camera;
 
 void create_test_shader()
 {
@@ -45,6 +46,22 @@ void create_test_shader()
 
     glEnable(GL_DEPTH_TEST);
     glUseProgram(shader); 
+
+    camera = lx_camera_create();
+    lx_camera_set_perspective(camera, 45.0f, 0.1f, 100.0f);
+    lx_camera_set_viewport(camera, lx_get_width(), lx_get_height());
+}
+
+void resize_test_camera(int width, int height)
+{
+    if (camera != NULL)
+        lx_camera_set_viewport(camera, width, height);
+}
+
+void destroy_test_camera()
+{
+    lx_camera_destroy(camera);
+    camera = NULL;
 }
 
 void create_test_cube()
@@ -99,11 +116,8 @@ void draw_test_cube()
 
     glUseProgram(shader); 
 
-    lx_mat4 perspective = lx_mat4_perspective(45.0f, (float)lx_get_width()/(float)lx_get_height(), 0.1f, 100.0f);
-    glUniformMatrix4fv(glGetUniformLocation(shader, "projection"), 1, GL_FALSE, perspective.m);
-
-    lx_mat4 view = lx_mat4_identity();
-    glUniformMatrix4fv(glGetUniformLocation(shader, "view"), 1, GL_FALSE, view.m);
+    glUniformMatrix4fv(glGetUniformLocation(shader, "projection"), 1, GL_FALSE, lx_camera_get_projection(camera)->m);
+    glUniformMatrix4fv(glGetUniformLocation(shader, "view"), 1, GL_FALSE, lx_camera_get_view(camera)->m);
 
     lx_mat4 model = lx_mat4_identity();
     model = lx_mat4_translate(model, (lx_vec3){ 0.0f, 0.0f, -5.0f });
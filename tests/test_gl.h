@@ -3,3 +3,5 @@
 void create_test_shader();
 void create_test_cube();
 void draw_test_cube();
+void resize_test_camera(int width, int height);
+void destroy_test_camera();